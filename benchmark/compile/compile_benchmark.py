@@ -0,0 +1,170 @@
+#!/usr/bin/env python3
+"""
+Measures the compile time and peak memory of translation units.
+
+This has two modes:
+
+* `launch`: used as the `CXX_COMPILER_LAUNCHER` of the compile benchmark
+  target. It runs the compiler command that follows `--`, and writes the wall
+  time and peak resident memory of the compile to `<object>.compile.json`.
+  With `--repeat N`, the compile is run N times and the fastest time and the
+  largest peak memory are recorded.
+
+* `report`: collects every `*.compile.json` record under a directory into a
+  CSV file named for the compiler, and prints a summary.
+"""
+
+import argparse
+import csv
+import glob
+import json
+import os
+import subprocess
+import sys
+import time
+
+try:
+    import resource
+except ImportError:  # Windows
+    resource = None
+
+
+def _run_once(command):
+    """Runs `command`, returning (exit code, seconds, peak RSS in KiB)"""
+    start = time.perf_counter()
+    process = subprocess.Popen(command)
+
+    if resource is not None and hasattr(os, "wait4"):
+        _, status, usage = os.wait4(process.pid, 0)
+        elapsed = time.perf_counter() - start
+        if os.WIFEXITED(status):
+            process.returncode = os.WEXITSTATUS(status)
+        else:
+            process.returncode = -os.WTERMSIG(status)
+        # ru_maxrss is reported in bytes on macOS, and in KiB elsewhere
+        peak = usage.ru_maxrss
+        if sys.platform == "darwin":
+            peak //= 1024
+        return process.returncode, elapsed, peak
+
+    process.wait()
+    return process.returncode, time.perf_counter() - start, None
+
+
+def _object_path(command):
+    """Finds the object file that `command` outputs"""
+    for i, argument in enumerate(command):
+        if argument == "-o" and i + 1 < len(command):
+            return command[i + 1]
+        if argument.startswith("/Fo") or argument.startswith("-Fo"):
+            return argument[3:]
+    return None
+
+
+def _source_path(command):
+    """Finds the source file that `command` compiles"""
+    for argument in reversed(command):
+        if os.path.splitext(argument)[1] in (".cpp", ".cc", ".cxx"):
+            return argument
+    return None
+
+
+def launch(arguments):
+    command = arguments.command
+    if command and command[0] == "--":
+        command = command[1:]
+    if not command:
+        sys.stderr.write("compile_benchmark.py: no compiler command given\n")
+        return 1
+
+    best_time = None
+    peak_memory = None
+    for _ in range(max(arguments.repeat, 1)):
+        code, elapsed, peak = _run_once(command)
+        if code != 0:
+            return code
+        best_time = elapsed if best_time is None else min(best_time, elapsed)
+        if peak is not None:
+            peak_memory = peak if peak_memory is None else max(peak_memory, peak)
+
+    output = _object_path(command)
+    if output is None:
+        return 0
+
+    record = {
+        "source": os.path.basename(_source_path(command) or output),
+        "seconds": best_time,
+        "peak_memory_kib": peak_memory,
+    }
+    with open(output + ".compile.json", "w") as stream:
+        json.dump(record, stream)
+    return 0
+
+
+def report(arguments):
+    pattern = os.path.join(arguments.directory, "**", "*.compile.json")
+    records = []
+    for path in sorted(glob.glob(pattern, recursive=True)):
+        with open(path) as stream:
+            records.append(json.load(stream))
+
+    if not records:
+        sys.stderr.write("compile_benchmark.py: no compile records found in "
+                         "'{}'; rebuild the compile benchmark target first\n"
+                         .format(arguments.directory))
+        return 1
+
+    records.sort(key=lambda r: r["source"])
+    compiler = "{}-{}".format(arguments.compiler_id, arguments.compiler_version)
+    output = os.path.join(arguments.output_dir,
+                          "compile-benchmark-{}.csv".format(compiler))
+
+    with open(output, "w", newline="") as stream:
+        writer = csv.writer(stream)
+        writer.writerow(["compiler", "types", "source", "seconds",
+                         "peak_memory_kib"])
+        for r in records:
+            writer.writerow([compiler, arguments.types, r["source"],
+                             "{:.3f}".format(r["seconds"]),
+                             r["peak_memory_kib"]])
+
+    total = sum(r["seconds"] for r in records)
+    peaks = [r["peak_memory_kib"] for r in records
+             if r["peak_memory_kib"] is not None]
+
+    print("{} distinct result types in {} translation units ({})"
+          .format(arguments.types, len(records), compiler))
+    for r in records:
+        memory = r["peak_memory_kib"]
+        print("  {:<32} {:>8.3f} s {:>10} KiB".format(
+            r["source"], r["seconds"], memory if memory is not None else "-"))
+    print("  {:<32} {:>8.3f} s {:>10} KiB".format(
+        "total / peak", total, max(peaks) if peaks else "-"))
+    print("Results written to '{}'".format(output))
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    commands = parser.add_subparsers(dest="mode")
+    commands.required = True
+
+    p = commands.add_parser("launch", help="run and measure a compile command")
+    p.add_argument("--repeat", type=int, default=1)
+    p.add_argument("command", nargs=argparse.REMAINDER)
+    p.set_defaults(function=launch)
+
+    p = commands.add_parser("report", help="summarize measured compiles")
+    p.add_argument("--directory", required=True)
+    p.add_argument("--output-dir", required=True)
+    p.add_argument("--compiler-id", required=True)
+    p.add_argument("--compiler-version", required=True)
+    p.add_argument("--types", required=True)
+    p.set_defaults(function=report)
+
+    arguments = parser.parse_args()
+    return arguments.function(arguments)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,93 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020-2021 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef RESULT_BENCHMARK_UTILITIES_HPP
+#define RESULT_BENCHMARK_UTILITIES_HPP
+
+#include "result.hpp"
+
+#include <cstddef>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#if defined(__has_include)
+# if __has_include(<version>)
+#  include <version>
+# endif
+#endif
+
+#if defined(__cpp_lib_expected) && __cpp_lib_expected >= 202202L
+# include <expected>
+# define RESULT_BENCHMARK_HAS_EXPECTED 1
+#endif
+
+// Functions under benchmark are kept out-of-line, so that the cost of
+// returning each error-handling type across a call boundary is measured
+// rather than being optimized away entirely.
+#if defined(__GNUC__) || defined(__clang__)
+# define RESULT_BENCHMARK_NOINLINE __attribute__((noinline))
+#elif defined(_MSC_VER)
+# define RESULT_BENCHMARK_NOINLINE __declspec(noinline)
+#else
+# define RESULT_BENCHMARK_NOINLINE
+#endif
+
+namespace cpp {
+namespace benchmark {
+
+/// \brief Produces a deterministic sequence of inputs, where roughly
+///        \p error_percent of the inputs are negative (and thus errors)
+///
+/// \param size the number of inputs
+/// \param error_percent the percentage [0, 100] of inputs that are errors
+/// \return the inputs
+inline auto make_inputs(std::size_t size, int error_percent) -> std::vector<int>
+{
+  auto inputs = std::vector<int>{};
+  inputs.reserve(size);
+
+  // A simple LCG keeps the distribution stable across runs and platforms
+  auto state = 0x2545F491u;
+  for (auto i = 0u; i < size; ++i) {
+    state = state * 1664525u + 1013904223u;
+    const auto roll = static_cast<int>((state >> 16u) % 100u);
+    const auto value = static_cast<int>(i % 1024u);
+
+    inputs.push_back(roll < error_percent ? -(value + 1) : value);
+  }
+  return inputs;
+}
+
+/// \brief A large-enough string that never uses the small-buffer
+///        optimization, used as a non-trivial T
+inline auto make_string() -> std::string
+{
+  return std::string(64u, 'x');
+}
+
+} // namespace benchmark
+} // namespace cpp
+
+#endif /* RESULT_BENCHMARK_UTILITIES_HPP */
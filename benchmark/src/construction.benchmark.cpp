@@ -0,0 +1,237 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020-2021 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include "benchmark_utilities.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <system_error>
+#include <utility>
+
+namespace cpp {
+namespace benchmark {
+namespace {
+
+using ::benchmark::State;
+using ::benchmark::DoNotOptimize;
+using ::benchmark::ClobberMemory;
+
+//=============================================================================
+// Construction
+//=============================================================================
+
+RESULT_BENCHMARK_NOINLINE
+auto make_value(int x) -> result<int,std::errc>
+{
+  return x;
+}
+
+RESULT_BENCHMARK_NOINLINE
+auto make_error(int) -> result<int,std::errc>
+{
+  return fail(std::errc::invalid_argument);
+}
+
+RESULT_BENCHMARK_NOINLINE
+auto make_string_value(const std::string& s) -> result<std::string,std::errc>
+{
+  return s;
+}
+
+RESULT_BENCHMARK_NOINLINE
+auto make_string_error(const std::string&) -> result<std::string,std::errc>
+{
+  return fail(std::errc::invalid_argument);
+}
+
+auto result_construct_value(State& state) -> void
+{
+  auto x = 0;
+  for (auto _ : state) {
+    DoNotOptimize(x);
+    auto r = make_value(x);
+    DoNotOptimize(r);
+  }
+}
+BENCHMARK(result_construct_value);
+
+auto result_construct_error(State& state) -> void
+{
+  auto x = 0;
+  for (auto _ : state) {
+    DoNotOptimize(x);
+    auto r = make_error(x);
+    DoNotOptimize(r);
+  }
+}
+BENCHMARK(result_construct_error);
+
+auto result_construct_string_value(State& state) -> void
+{
+  const auto s = make_string();
+  for (auto _ : state) {
+    auto r = make_string_value(s);
+    DoNotOptimize(r);
+  }
+}
+BENCHMARK(result_construct_string_value);
+
+auto result_construct_string_error(State& state) -> void
+{
+  const auto s = make_string();
+  for (auto _ : state) {
+    auto r = make_string_error(s);
+    DoNotOptimize(r);
+  }
+}
+BENCHMARK(result_construct_string_error);
+
+auto raw_construct_string(State& state) -> void
+{
+  const auto s = make_string();
+  for (auto _ : state) {
+    auto r = std::string{s};
+    DoNotOptimize(r);
+  }
+}
+BENCHMARK(raw_construct_string);
+
+#if defined(RESULT_BENCHMARK_HAS_EXPECTED)
+
+RESULT_BENCHMARK_NOINLINE
+auto make_expected_value(int x) -> std::expected<int,std::errc>
+{
+  return x;
+}
+
+RESULT_BENCHMARK_NOINLINE
+auto make_expected_error(int) -> std::expected<int,std::errc>
+{
+  return std::unexpected{std::errc::invalid_argument};
+}
+
+auto expected_construct_value(State& state) -> void
+{
+  auto x = 0;
+  for (auto _ : state) {
+    DoNotOptimize(x);
+    auto r = make_expected_value(x);
+    DoNotOptimize(r);
+  }
+}
+BENCHMARK(expected_construct_value);
+
+auto expected_construct_error(State& state) -> void
+{
+  auto x = 0;
+  for (auto _ : state) {
+    DoNotOptimize(x);
+    auto r = make_expected_error(x);
+    DoNotOptimize(r);
+  }
+}
+BENCHMARK(expected_construct_error);
+
+#endif
+
+//=============================================================================
+// Copy / Move
+//=============================================================================
+
+auto result_copy_string(State& state) -> void
+{
+  const auto source = result<std::string,std::errc>{make_string()};
+  for (auto _ : state) {
+    auto copy = source;
+    DoNotOptimize(copy);
+  }
+}
+BENCHMARK(result_copy_string);
+
+auto result_move_string(State& state) -> void
+{
+  auto source = result<std::string,std::errc>{make_string()};
+  for (auto _ : state) {
+    auto moved = std::move(source);
+    DoNotOptimize(moved);
+    source = std::move(moved);
+    ClobberMemory();
+  }
+}
+BENCHMARK(result_move_string);
+
+auto raw_move_string(State& state) -> void
+{
+  auto source = make_string();
+  for (auto _ : state) {
+    auto moved = std::move(source);
+    DoNotOptimize(moved);
+    source = std::move(moved);
+    ClobberMemory();
+  }
+}
+BENCHMARK(raw_move_string);
+
+auto result_copy_error(State& state) -> void
+{
+  const auto source = result<std::string,std::error_code>{
+    fail(std::make_error_code(std::errc::invalid_argument))
+  };
+  for (auto _ : state) {
+    auto copy = source;
+    DoNotOptimize(copy);
+  }
+}
+BENCHMARK(result_copy_error);
+
+#if defined(RESULT_BENCHMARK_HAS_EXPECTED)
+
+auto expected_copy_string(State& state) -> void
+{
+  const auto source = std::expected<std::string,std::errc>{make_string()};
+  for (auto _ : state) {
+    auto copy = source;
+    DoNotOptimize(copy);
+  }
+}
+BENCHMARK(expected_copy_string);
+
+auto expected_move_string(State& state) -> void
+{
+  auto source = std::expected<std::string,std::errc>{make_string()};
+  for (auto _ : state) {
+    auto moved = std::move(source);
+    DoNotOptimize(moved);
+    source = std::move(moved);
+    ClobberMemory();
+  }
+}
+BENCHMARK(expected_move_string);
+
+#endif
+
+} // namespace <anonymous>
+} // namespace benchmark
+} // namespace cpp
@@ -0,0 +1,197 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020-2021 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include "benchmark_utilities.hpp"
+#include "result_coroutine.hpp"
+
+#include <benchmark/benchmark.h>
+
+#if RESULT_HAS_COROUTINES
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <system_error>
+
+// GCC cannot see that the replaced 'operator new' below is backed by 'malloc'
+#if defined(__GNUC__) && !defined(__clang__)
+# pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+namespace {
+
+// Every global allocation in the benchmark executable is counted, so that
+// the allocations performed by coroutine frames can be reported.
+std::atomic<std::size_t> g_allocations{0u};
+
+} // namespace <anonymous>
+
+auto operator new(std::size_t size) -> void*
+{
+  g_allocations.fetch_add(1u, std::memory_order_relaxed);
+  if (auto* p = std::malloc(size == 0u ? 1u : size)) {
+    return p;
+  }
+  throw std::bad_alloc{};
+}
+
+auto operator delete(void* p) noexcept -> void
+{
+  std::free(p);
+}
+
+auto operator delete(void* p, std::size_t) noexcept -> void
+{
+  std::free(p);
+}
+
+namespace cpp {
+namespace benchmark {
+namespace {
+
+using ::benchmark::State;
+using ::benchmark::DoNotOptimize;
+
+constexpr auto input_size = 1024u;
+
+RESULT_BENCHMARK_NOINLINE
+auto checked(int x) -> result<int,std::errc>
+{
+  if (x < 0) {
+    return fail(std::errc::invalid_argument);
+  }
+  return x;
+}
+
+auto checked_half(int x) -> result<int,std::errc>
+{
+  if (x % 2 != 0) {
+    return fail(std::errc::result_out_of_range);
+  }
+  return x / 2;
+}
+
+auto twice(int x) -> int { return x * 2; }
+
+/// \brief Reports the number of global allocations performed per item
+///        processed since \p before
+auto report_allocations(State& state, std::size_t before) -> void
+{
+  const auto allocations = g_allocations.load() - before;
+  const auto items = state.iterations() * input_size;
+
+  state.counters["allocs_per_item"] =
+    static_cast<double>(allocations) / static_cast<double>(items);
+}
+
+RESULT_BENCHMARK_NOINLINE
+auto flat_map_chain(int x) -> result<int,std::errc>
+{
+  return checked(x)
+    .flat_map(checked_half)
+    .flat_map(checked)
+    .flat_map(checked_half)
+    .flat_map(checked)
+    .map(twice);
+}
+
+RESULT_BENCHMARK_NOINLINE
+auto coroutine_chain(int x) -> result<int,std::errc>
+{
+  const auto a = co_await checked(x);
+  const auto b = co_await checked_half(a);
+  const auto c = co_await checked(b);
+  const auto d = co_await checked_half(c);
+  const auto e = co_await checked(d);
+  co_return twice(e);
+}
+
+RESULT_BENCHMARK_NOINLINE
+auto coroutine_inner(int x) -> result<int,std::errc>
+{
+  co_return co_await checked_half(co_await checked(x));
+}
+
+RESULT_BENCHMARK_NOINLINE
+auto coroutine_nested(int x) -> result<int,std::errc>
+{
+  const auto a = co_await coroutine_inner(x);
+  const auto b = co_await coroutine_inner(a);
+  co_return twice(b);
+}
+
+//=============================================================================
+// flat_map vs coroutines
+//=============================================================================
+
+auto result_flat_map_sequence(State& state) -> void
+{
+  const auto inputs = make_inputs(input_size, static_cast<int>(state.range(0)));
+  const auto before = g_allocations.load();
+  for (auto _ : state) {
+    for (auto x : inputs) {
+      auto r = flat_map_chain(x);
+      DoNotOptimize(r);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * input_size);
+  report_allocations(state, before);
+}
+BENCHMARK(result_flat_map_sequence)->Arg(0)->Arg(50);
+
+auto result_coroutine_sequence(State& state) -> void
+{
+  const auto inputs = make_inputs(input_size, static_cast<int>(state.range(0)));
+  const auto before = g_allocations.load();
+  for (auto _ : state) {
+    for (auto x : inputs) {
+      auto r = coroutine_chain(x);
+      DoNotOptimize(r);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * input_size);
+  report_allocations(state, before);
+}
+BENCHMARK(result_coroutine_sequence)->Arg(0)->Arg(50);
+
+auto result_coroutine_nested(State& state) -> void
+{
+  const auto inputs = make_inputs(input_size, static_cast<int>(state.range(0)));
+  const auto before = g_allocations.load();
+  for (auto _ : state) {
+    for (auto x : inputs) {
+      auto r = coroutine_nested(x);
+      DoNotOptimize(r);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * input_size);
+  report_allocations(state, before);
+}
+BENCHMARK(result_coroutine_nested)->Arg(0)->Arg(50);
+
+} // namespace <anonymous>
+} // namespace benchmark
+} // namespace cpp
+
+#endif
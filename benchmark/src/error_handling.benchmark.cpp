@@ -0,0 +1,275 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020-2021 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+////////////////////////////////////////////////////////////////////////////////
+// These benchmarks compare the same fallible "parse" operation, reported
+// through each of the common error-handling mechanisms. Each benchmark is run
+// on a happy-path workload (0% errors), and error-heavy workloads (10% and 50%
+// errors).
+////////////////////////////////////////////////////////////////////////////////
+
+#include "benchmark_utilities.hpp"
+#include "result_context.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+namespace cpp {
+namespace benchmark {
+namespace {
+
+using ::benchmark::State;
+using ::benchmark::DoNotOptimize;
+
+constexpr auto input_size = 1024u;
+
+//=============================================================================
+// result
+//=============================================================================
+
+RESULT_BENCHMARK_NOINLINE
+auto parse_result(int x) -> result<int,std::error_code>
+{
+  if (x < 0) {
+    return fail(std::make_error_code(std::errc::invalid_argument));
+  }
+  return x * 3;
+}
+
+auto result_error_handling(State& state) -> void
+{
+  const auto inputs = make_inputs(input_size, static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    auto sum = 0;
+    auto errors = 0;
+    for (auto x : inputs) {
+      const auto r = parse_result(x);
+      if (r) {
+        sum += *r;
+      } else {
+        ++errors;
+      }
+    }
+    DoNotOptimize(sum);
+    DoNotOptimize(errors);
+  }
+  state.SetItemsProcessed(state.iterations() * input_size);
+}
+BENCHMARK(result_error_handling)->Arg(0)->Arg(10)->Arg(50);
+
+//=============================================================================
+// std::expected
+//=============================================================================
+
+#if defined(RESULT_BENCHMARK_HAS_EXPECTED)
+
+RESULT_BENCHMARK_NOINLINE
+auto parse_expected(int x) -> std::expected<int,std::error_code>
+{
+  if (x < 0) {
+    return std::unexpected{std::make_error_code(std::errc::invalid_argument)};
+  }
+  return x * 3;
+}
+
+auto expected_error_handling(State& state) -> void
+{
+  const auto inputs = make_inputs(input_size, static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    auto sum = 0;
+    auto errors = 0;
+    for (auto x : inputs) {
+      const auto r = parse_expected(x);
+      if (r) {
+        sum += *r;
+      } else {
+        ++errors;
+      }
+    }
+    DoNotOptimize(sum);
+    DoNotOptimize(errors);
+  }
+  state.SetItemsProcessed(state.iterations() * input_size);
+}
+BENCHMARK(expected_error_handling)->Arg(0)->Arg(10)->Arg(50);
+
+#endif
+
+//=============================================================================
+// std::error_code out-parameter
+//=============================================================================
+
+RESULT_BENCHMARK_NOINLINE
+auto parse_error_code(int x, std::error_code& ec) -> int
+{
+  if (x < 0) {
+    ec = std::make_error_code(std::errc::invalid_argument);
+    return 0;
+  }
+  ec.clear();
+  return x * 3;
+}
+
+auto error_code_error_handling(State& state) -> void
+{
+  const auto inputs = make_inputs(input_size, static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    auto sum = 0;
+    auto errors = 0;
+    for (auto x : inputs) {
+      auto ec = std::error_code{};
+      const auto r = parse_error_code(x, ec);
+      if (!ec) {
+        sum += r;
+      } else {
+        ++errors;
+      }
+    }
+    DoNotOptimize(sum);
+    DoNotOptimize(errors);
+  }
+  state.SetItemsProcessed(state.iterations() * input_size);
+}
+BENCHMARK(error_code_error_handling)->Arg(0)->Arg(10)->Arg(50);
+
+//=============================================================================
+// exceptions
+//=============================================================================
+
+RESULT_BENCHMARK_NOINLINE
+auto parse_exception(int x) -> int
+{
+  if (x < 0) {
+    throw std::system_error{std::make_error_code(std::errc::invalid_argument)};
+  }
+  return x * 3;
+}
+
+auto exception_error_handling(State& state) -> void
+{
+  const auto inputs = make_inputs(input_size, static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    auto sum = 0;
+    auto errors = 0;
+    for (auto x : inputs) {
+      try {
+        sum += parse_exception(x);
+      } catch (const std::system_error&) {
+        ++errors;
+      }
+    }
+    DoNotOptimize(sum);
+    DoNotOptimize(errors);
+  }
+  state.SetItemsProcessed(state.iterations() * input_size);
+}
+BENCHMARK(exception_error_handling)->Arg(0)->Arg(10)->Arg(50);
+
+//=============================================================================
+// error context
+//=============================================================================
+
+// Errors that carry human-readable context are commonly built by prefixing
+// a 'std::string' at each layer they propagate through, which allocates at
+// every layer. 'contextual_error' instead copies each message into a
+// per-thread arena.
+
+RESULT_BENCHMARK_NOINLINE
+auto parse_string_context(int x) -> result<int,std::string>
+{
+  return parse_result(x).map_error([](const std::error_code& ec) {
+    return "while parsing value: " + ec.message();
+  });
+}
+
+RESULT_BENCHMARK_NOINLINE
+auto load_string_context(int x) -> result<int,std::string>
+{
+  return parse_string_context(x).map_error([](std::string&& e) {
+    return "while loading record: " + std::move(e);
+  });
+}
+
+auto string_context_error_handling(State& state) -> void
+{
+  const auto inputs = make_inputs(input_size, static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    auto sum = 0;
+    auto errors = 0;
+    for (auto x : inputs) {
+      const auto r = load_string_context(x).map_error([](std::string&& e) {
+        return "while reading input: " + std::move(e);
+      });
+      if (r) {
+        sum += *r;
+      } else {
+        ++errors;
+      }
+    }
+    DoNotOptimize(sum);
+    DoNotOptimize(errors);
+  }
+  state.SetItemsProcessed(state.iterations() * input_size);
+}
+BENCHMARK(string_context_error_handling)->Arg(0)->Arg(10)->Arg(30)->Arg(50);
+
+RESULT_BENCHMARK_NOINLINE
+auto parse_contextual(int x) -> result<int,contextual_error<std::error_code>>
+{
+  return with_context(parse_result(x), "while parsing value");
+}
+
+RESULT_BENCHMARK_NOINLINE
+auto load_contextual(int x) -> result<int,contextual_error<std::error_code>>
+{
+  return with_context(parse_contextual(x), "while loading record");
+}
+
+auto contextual_error_handling(State& state) -> void
+{
+  const auto inputs = make_inputs(input_size, static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    auto sum = 0;
+    auto errors = 0;
+    for (auto x : inputs) {
+      const auto r = with_context(load_contextual(x), "while reading input");
+      if (r) {
+        sum += *r;
+      } else {
+        ++errors;
+      }
+    }
+    DoNotOptimize(sum);
+    DoNotOptimize(errors);
+  }
+  state.SetItemsProcessed(state.iterations() * input_size);
+}
+BENCHMARK(contextual_error_handling)->Arg(0)->Arg(10)->Arg(30)->Arg(50);
+
+} // namespace <anonymous>
+} // namespace benchmark
+} // namespace cpp
@@ -0,0 +1,242 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020-2021 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include "benchmark_utilities.hpp"
+#include "result_pipeline.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <system_error>
+
+namespace cpp {
+namespace benchmark {
+namespace {
+
+using ::benchmark::State;
+using ::benchmark::DoNotOptimize;
+
+constexpr auto input_size = 1024u;
+
+RESULT_BENCHMARK_NOINLINE
+auto checked(int x) -> result<int,std::errc>
+{
+  if (x < 0) {
+    return fail(std::errc::invalid_argument);
+  }
+  return x;
+}
+
+auto add_one(int x) -> int { return x + 1; }
+auto twice(int x) -> int { return x * 2; }
+auto checked_half(int x) -> result<int,std::errc>
+{
+  if (x % 2 != 0) {
+    return fail(std::errc::result_out_of_range);
+  }
+  return x / 2;
+}
+
+//=============================================================================
+// map
+//=============================================================================
+
+auto result_map_chain(State& state) -> void
+{
+  const auto inputs = make_inputs(input_size, static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    for (auto x : inputs) {
+      auto r = checked(x).map(add_one).map(twice).map(add_one);
+      DoNotOptimize(r);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * input_size);
+}
+BENCHMARK(result_map_chain)->Arg(0)->Arg(50);
+
+//=============================================================================
+// flat_map
+//=============================================================================
+
+auto result_flat_map_chain(State& state) -> void
+{
+  const auto inputs = make_inputs(input_size, static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    for (auto x : inputs) {
+      auto r = checked(x).flat_map(checked_half).flat_map(checked).map(twice);
+      DoNotOptimize(r);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * input_size);
+}
+BENCHMARK(result_flat_map_chain)->Arg(0)->Arg(50);
+
+//=============================================================================
+// pipeline
+//=============================================================================
+
+// A non-trivial error, long enough to not fit in the small-string buffer,
+// shows the cost of moving the error through each stage of a chain. Both
+// variants use function objects, since calls through function pointers that
+// are stored in pipeline stages are not reliably inlined.
+RESULT_BENCHMARK_NOINLINE
+auto checked_message(int x) -> result<int,std::string>
+{
+  if (x < 0) {
+    return fail(std::string{"the input to this stage must not be negative"});
+  }
+  return x;
+}
+
+auto result_string_error_chain(State& state) -> void
+{
+  const auto inc = [](int x) { return x + 1; };
+  const auto dbl = [](int x) { return x * 2; };
+  const auto inputs = make_inputs(input_size, static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    for (auto x : inputs) {
+      auto r = checked_message(x)
+        .map(inc)
+        .map(dbl)
+        .map(inc)
+        .map(dbl)
+        .map(inc)
+        .map(dbl);
+      DoNotOptimize(r);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * input_size);
+}
+BENCHMARK(result_string_error_chain)->Arg(0)->Arg(50);
+
+auto result_string_error_pipeline(State& state) -> void
+{
+  namespace pipe = ::cpp::pipeline;
+
+  const auto inc = [](int x) { return x + 1; };
+  const auto dbl = [](int x) { return x * 2; };
+  const auto inputs = make_inputs(input_size, static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    for (auto x : inputs) {
+      auto r = checked_message(x)
+        | pipe::map(inc)
+        | pipe::map(dbl)
+        | pipe::map(inc)
+        | pipe::map(dbl)
+        | pipe::map(inc)
+        | pipe::map(dbl)
+        | pipe::collect();
+      DoNotOptimize(r);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * input_size);
+}
+BENCHMARK(result_string_error_pipeline)->Arg(0)->Arg(50);
+
+//=============================================================================
+// value_or
+//=============================================================================
+
+auto result_value_or(State& state) -> void
+{
+  const auto inputs = make_inputs(input_size, static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    auto sum = 0;
+    for (auto x : inputs) {
+      sum += checked(x).value_or(0);
+    }
+    DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * input_size);
+}
+BENCHMARK(result_value_or)->Arg(0)->Arg(50);
+
+// The monadic functions of std::expected were added after its introduction
+#if defined(RESULT_BENCHMARK_HAS_EXPECTED) && __cpp_lib_expected >= 202211L
+
+RESULT_BENCHMARK_NOINLINE
+auto expected_checked(int x) -> std::expected<int,std::errc>
+{
+  if (x < 0) {
+    return std::unexpected{std::errc::invalid_argument};
+  }
+  return x;
+}
+
+auto expected_checked_half(int x) -> std::expected<int,std::errc>
+{
+  if (x % 2 != 0) {
+    return std::unexpected{std::errc::result_out_of_range};
+  }
+  return x / 2;
+}
+
+auto expected_map_chain(State& state) -> void
+{
+  const auto inputs = make_inputs(input_size, static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    for (auto x : inputs) {
+      auto r = expected_checked(x).transform(add_one).transform(twice).transform(add_one);
+      DoNotOptimize(r);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * input_size);
+}
+BENCHMARK(expected_map_chain)->Arg(0)->Arg(50);
+
+auto expected_flat_map_chain(State& state) -> void
+{
+  const auto inputs = make_inputs(input_size, static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    for (auto x : inputs) {
+      auto r = expected_checked(x)
+        .and_then(expected_checked_half)
+        .and_then(expected_checked)
+        .transform(twice);
+      DoNotOptimize(r);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * input_size);
+}
+BENCHMARK(expected_flat_map_chain)->Arg(0)->Arg(50);
+
+auto expected_value_or(State& state) -> void
+{
+  const auto inputs = make_inputs(input_size, static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    auto sum = 0;
+    for (auto x : inputs) {
+      sum += expected_checked(x).value_or(0);
+    }
+    DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * input_size);
+}
+BENCHMARK(expected_value_or)->Arg(0)->Arg(50);
+
+#endif
+
+} // namespace <anonymous>
+} // namespace benchmark
+} // namespace cpp
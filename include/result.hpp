@@ -33,17 +33,51 @@
 #define RESULT_RESULT_HPP
 
 #include <cstddef>      // std::size_t
+#include <cstdint>      // std::uintptr_t, std::uintmax_t
+#include <cstring>      // std::memcpy
+#include <climits>      // CHAR_BIT
+#include <limits>       // std::numeric_limits
 #include <type_traits>  // std::enable_if, std::is_constructible, etc
 #include <new>          // placement-new
-#include <memory>       // std::address_of
+#include <memory>       // std::address_of, std::allocator_arg_t, std::uses_allocator
 #include <functional>   // std::reference_wrapper, std::invoke
 #include <utility>      // std::in_place_t, std::forward
 #include <initializer_list> // std::initializer_list
 #include <string>       // std::string (for exception message)
 
-#if defined(RESULT_EXCEPTIONS_DISABLED)
-# include <cstdio> // std::fprintf, stderr
-#else
+#include <cstdio>       // std::fprintf, stderr
+#include <cstdlib>      // std::abort
+#include <atomic>       // std::atomic
+
+#if defined(RESULT_EXTERN_TEMPLATES)
+# include <system_error> // std::error_code
+#endif
+
+// The compiled library fixes the configuration of its instantiations, and
+// exports it as 'RESULT_LIBRARY_*' definitions. Linking them into a
+// translation unit that is configured differently would silently mix two
+// definitions of the same functions, so any difference is an error.
+#if defined(RESULT_EXTERN_TEMPLATES)
+# if defined(RESULT_ENABLE_STATS) || defined(RESULT_ENABLE_TRACE)
+#   error "RESULT_EXTERN_TEMPLATES cannot be combined with RESULT_ENABLE_STATS or RESULT_ENABLE_TRACE"
+# endif
+# if defined(RESULT_DISABLE_EXCEPTIONS) != (RESULT_LIBRARY_DISABLE_EXCEPTIONS + 0)
+#   error "RESULT_DISABLE_EXCEPTIONS does not match the configuration of the compiled library"
+# endif
+# if defined(RESULT_NONALLOCATING_BAD_RESULT_ACCESS) != (RESULT_LIBRARY_NONALLOCATING_BAD_RESULT_ACCESS + 0)
+#   error "RESULT_NONALLOCATING_BAD_RESULT_ACCESS does not match the configuration of the compiled library"
+# endif
+// The library always uses the C++11 storage, so that consumers may use any
+// language standard
+# if !defined(RESULT_HAS_CONDITIONALLY_TRIVIAL_SPECIAL_MEMBERS)
+#   define RESULT_HAS_CONDITIONALLY_TRIVIAL_SPECIAL_MEMBERS 0
+# elif RESULT_HAS_CONDITIONALLY_TRIVIAL_SPECIAL_MEMBERS
+#   error "RESULT_HAS_CONDITIONALLY_TRIVIAL_SPECIAL_MEMBERS must be 0 with the compiled library"
+# endif
+#endif
+
+#if !defined(RESULT_DISABLE_EXCEPTIONS)
+# include <exception> // std::exception
 # include <stdexcept> // std::logic_error
 #endif
 
@@ -53,14 +87,42 @@
 # define RESULT_CPP14_CONSTEXPR
 #endif
 
+// Constant evaluation of results of non-trivial types needs constexpr
+// destructors and 'std::construct_at' (P0784)
+#if __cplusplus >= 202002L && defined(__cpp_constexpr_dynamic_alloc) && \
+    __cpp_constexpr_dynamic_alloc >= 201907L
+# define RESULT_HAS_CONSTEXPR_DYNAMIC_ALLOC 1
+# define RESULT_CPP20_CONSTEXPR constexpr
+#else
+# define RESULT_HAS_CONSTEXPR_DYNAMIC_ALLOC 0
+# define RESULT_CPP20_CONSTEXPR
+#endif
+
 #if __cplusplus >= 201703L
 # define RESULT_CPP17_INLINE inline
 #else
 # define RESULT_CPP17_INLINE
 #endif
 
+// Conditionally-trivial special members (P0848) let `result_storage` be a
+// single class instead of a ladder of bases. Define this to 0 to force the
+// C++11 implementation.
+#if !defined(RESULT_HAS_CONDITIONALLY_TRIVIAL_SPECIAL_MEMBERS)
+# if __cplusplus >= 202002L && defined(__cpp_concepts) && __cpp_concepts >= 202002L
+#   define RESULT_HAS_CONDITIONALLY_TRIVIAL_SPECIAL_MEMBERS 1
+# else
+#   define RESULT_HAS_CONDITIONALLY_TRIVIAL_SPECIAL_MEMBERS 0
+# endif
+#endif
+
+// With extern templates, functions are not force-inlined, since that would
+// require every translation unit to instantiate them anyway.
 #if defined(__clang__) && defined(_MSC_VER)
 # define RESULT_INLINE_VISIBILITY __attribute__((visibility("hidden")))
+#elif (defined(__clang__) || defined(__GNUC__)) && defined(RESULT_EXTERN_TEMPLATES)
+# define RESULT_INLINE_VISIBILITY __attribute__((visibility("hidden")))
+#elif defined(_MSC_VER) && defined(RESULT_EXTERN_TEMPLATES)
+# define RESULT_INLINE_VISIBILITY
 #elif defined(__clang__) || defined(__GNUC__)
 # define RESULT_INLINE_VISIBILITY __attribute__((visibility("hidden"), always_inline))
 #elif defined(_MSC_VER)
@@ -69,6 +131,74 @@
 # define RESULT_INLINE_VISIBILITY
 #endif
 
+#if defined(__has_builtin)
+# if __has_builtin(__builtin_FILE) && __has_builtin(__builtin_LINE) && \
+     __has_builtin(__builtin_FUNCTION)
+#   define RESULT_HAS_BUILTIN_SOURCE_LOCATION 1
+# endif
+#endif
+#if !defined(RESULT_HAS_BUILTIN_SOURCE_LOCATION)
+# if (defined(__GNUC__) && !defined(__clang__)) || \
+     (defined(_MSC_VER) && _MSC_VER >= 1926)
+#   define RESULT_HAS_BUILTIN_SOURCE_LOCATION 1
+# else
+#   define RESULT_HAS_BUILTIN_SOURCE_LOCATION 0
+# endif
+#endif
+
+#if defined(__has_builtin)
+# if __has_builtin(__builtin_is_constant_evaluated)
+#   define RESULT_HAS_BUILTIN_IS_CONSTANT_EVALUATED 1
+# endif
+#endif
+#if !defined(RESULT_HAS_BUILTIN_IS_CONSTANT_EVALUATED)
+# if (defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 9) || \
+     (defined(_MSC_VER) && _MSC_VER >= 1925)
+#   define RESULT_HAS_BUILTIN_IS_CONSTANT_EVALUATED 1
+# else
+#   define RESULT_HAS_BUILTIN_IS_CONSTANT_EVALUATED 0
+# endif
+#endif
+
+#if defined(RESULT_ENABLE_STATS)
+# if !defined(RESULT_STATS_TABLE_SIZE)
+#   define RESULT_STATS_TABLE_SIZE 256
+# endif
+# if !defined(RESULT_STATS_SAMPLE_PERIOD)
+#   define RESULT_STATS_SAMPLE_PERIOD 1
+# endif
+# include <mutex>   // std::mutex
+# include <vector>  // std::vector
+#endif
+
+#if defined(RESULT_ENABLE_TRACE)
+# if !defined(RESULT_TRACE_BUFFER_SIZE)
+#   define RESULT_TRACE_BUFFER_SIZE 64
+# endif
+# if !defined(RESULT_TRACE_PAYLOAD_SIZE)
+#   define RESULT_TRACE_PAYLOAD_SIZE 16
+# endif
+# if !defined(__x86_64__) && !defined(__i386__) && !defined(_M_X64) && \
+     !defined(_M_IX86) && !defined(__aarch64__)
+#   include <chrono> // std::chrono::steady_clock
+# elif defined(_MSC_VER)
+#   include <intrin.h> // __rdtsc
+# endif
+#endif
+
+#if !defined(RESULT_BAD_RESULT_ACCESS_MESSAGE_SIZE)
+# define RESULT_BAD_RESULT_ACCESS_MESSAGE_SIZE 128
+#endif
+
+// Failure paths are kept out-of-line and out of the hot text of the caller.
+#if defined(__clang__) || defined(__GNUC__)
+# define RESULT_COLD __attribute__((cold, noinline))
+#elif defined(_MSC_VER)
+# define RESULT_COLD __declspec(noinline)
+#else
+# define RESULT_COLD
+#endif
+
 // [[clang::warn_unused_result]] is more full-featured than gcc's variant, since
 // it supports being applied to class objects.
 #if __cplusplus >= 201703L
@@ -129,6 +259,26 @@ inline namespace bitwizeshift {
 #endif
   } // namespace detail
 
+  //===========================================================================
+  // utilities : constexpr construct_at
+  //===========================================================================
+
+  // placement-new cannot be used in constant expressions, but
+  // std::construct_at can be from C++20
+  namespace detail {
+    template <typename T, typename...Args>
+    inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+    auto construct_at(T* p, Args&&...args)
+      noexcept(std::is_nothrow_constructible<T,Args...>::value) -> T*
+    {
+#if RESULT_HAS_CONSTEXPR_DYNAMIC_ALLOC
+      return std::construct_at(p, detail::forward<Args>(args)...);
+#else
+      return ::new (static_cast<void*>(p)) T(detail::forward<Args>(args)...);
+#endif
+    }
+  } // namespace detail
+
 
   //===========================================================================
   // utilities : invoke / invoke_result
@@ -141,6 +291,7 @@ inline namespace bitwizeshift {
     using std::invoke;
     using std::invoke_result;
     using std::invoke_result_t;
+    using std::is_invocable;
 #else
     template<typename T>
     struct is_reference_wrapper : std::false_type{};
@@ -268,6 +419,50 @@ inline namespace bitwizeshift {
     template <typename Fn, typename...Args>
     using invoke_result_t = typename invoke_result<Fn, Args...>::type;
 #endif
+
+    //-------------------------------------------------------------------------
+
+    /// \brief The result of invoking a fallback \p Fn, which is given \p Arg
+    ///        if it accepts it, and is otherwise called with no arguments
+    template <typename Fn, typename Arg>
+    using fallback_result_t = typename std::conditional<
+      is_invocable<Fn,Arg>::value,
+      invoke_result<Fn,Arg>,
+      invoke_result<Fn>
+    >::type::type;
+
+    template <typename Fn, typename Arg>
+    inline RESULT_INLINE_VISIBILITY constexpr
+    auto invoke_fallback(std::true_type, Fn&& fn, Arg&& arg)
+      -> invoke_result_t<Fn,Arg>
+    {
+      return RESULT_NS_IMPL::detail::invoke(
+        RESULT_NS_IMPL::detail::forward<Fn>(fn),
+        RESULT_NS_IMPL::detail::forward<Arg>(arg)
+      );
+    }
+
+    template <typename Fn, typename Arg>
+    inline RESULT_INLINE_VISIBILITY constexpr
+    auto invoke_fallback(std::false_type, Fn&& fn, Arg&&)
+      -> invoke_result_t<Fn>
+    {
+      return RESULT_NS_IMPL::detail::invoke(RESULT_NS_IMPL::detail::forward<Fn>(fn));
+    }
+
+    /// \brief Invokes the fallback \p fn with \p arg if it accepts it, or
+    ///        with no arguments otherwise
+    template <typename Fn, typename Arg>
+    inline RESULT_INLINE_VISIBILITY constexpr
+    auto invoke_fallback(Fn&& fn, Arg&& arg)
+      -> fallback_result_t<Fn,Arg>
+    {
+      return invoke_fallback(
+        std::integral_constant<bool,is_invocable<Fn,Arg>::value>{},
+        RESULT_NS_IMPL::detail::forward<Fn>(fn),
+        RESULT_NS_IMPL::detail::forward<Arg>(arg)
+      );
+    }
   }
 
   //===========================================================================
@@ -326,3832 +521,8244 @@ inline namespace bitwizeshift {
   struct is_result<result<T,E>> : std::true_type{};
 
   //===========================================================================
-  // trait : detail::wrapped_result_type
+  // trait : result_niche_traits<T>
   //===========================================================================
 
-  namespace detail {
-
-    template <typename T>
-    using wrapped_result_type = typename std::conditional<
-      std::is_lvalue_reference<T>::value,
-      std::reference_wrapper<
-        typename std::remove_reference<T>::type
-      >,
-      typename std::remove_const<T>::type
-    >::type;
+  /////////////////////////////////////////////////////////////////////////////
+  /// \brief A customization point that describes the spare representations
+  ///        (the "niche") of a value type \p T
+  ///
+  /// A niche is a set of object representations of `T` that can never be
+  /// produced by a valid value. When a `result<T,E>` is instantiated with a
+  /// `T` that has a niche large enough to encode an `E`, the error is encoded
+  /// directly into the storage of `T` and no separate discriminator is
+  /// stored -- making `sizeof(result<T,E>) == sizeof(T)`.
+  ///
+  /// The primary template describes no niche. Specializations must provide:
+  ///
+  /// * `static constexpr std::size_t payload_bits` -- the number of payload
+  ///   bits that can be encoded into the niche,
+  /// * `static auto make_niche(std::uintmax_t payload) noexcept -> T` --
+  ///   produces a `T` in the niche that encodes \p payload,
+  /// * `static auto is_niche(const T& value) noexcept -> bool` -- queries
+  ///   whether \p value is in the niche, and
+  /// * `static auto niche_payload(const T& value) noexcept -> std::uintmax_t`
+  ///   -- retrieves the payload from a niche value
+  ///
+  /// Niche storage is only ever used when `T` is trivially copyable and
+  /// trivially destructible, and when `E` is a (non-`bool`) integral or
+  /// enum type whose width fits within `payload_bits`.
+  ///
+  /// No type has a niche by default. Pointers may opt in by deriving their
+  /// specialization from `pointer_niche_traits`, which uses the otherwise
+  /// unused low bit of the address, and which also provides a niche for
+  /// `result<T&,E>`. This is not the default since inspecting the bits of an
+  /// address cannot be done in a constant expression, so opted-in results can
+  /// no longer be observed in constant expressions. Enums may opt in by
+  /// deriving from `enum_niche_traits`, which uses the values after their
+  /// last enumerator, and which remains usable in constant expressions.
+  ///
+  /// ### Examples
+  ///
+  /// Opting a pointer type into niche storage:
+  ///
+  /// ```cpp
+  /// template <>
+  /// struct cpp::result_niche_traits<widget*>
+  ///   : cpp::pointer_niche_traits<widget>{};
+  ///
+  /// static_assert(sizeof(cpp::result<widget*,std::errc>) == sizeof(widget*), "");
+  /// ```
+  ///
+  /// \tparam T the value type to describe
+  /////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  struct result_niche_traits
+  {
+    static constexpr std::size_t payload_bits = 0u;
+  };
 
-  } // namespace detail
+  //===========================================================================
+  // trait : enable_compact_void_result<E>
+  //===========================================================================
 
-#if !defined(RESULT_DISABLE_EXCEPTIONS)
+  /////////////////////////////////////////////////////////////////////////////
+  /// \brief A customization point that opts `result<void,E>` into a compact
+  ///        storage that uses the default state of `E` as the discriminant
+  ///
+  /// By default `result<void,E>` stores an `E` alongside a `bool`. When this
+  /// trait is specialized to inherit from `std::true_type`, only the `E` is
+  /// stored and `has_value()` is implemented as `error() == E{}`, making
+  /// `sizeof(result<void,E>) == sizeof(E)`.
+  ///
+  /// This formalizes the assumption that `E{}` is the "no-error" state of an
+  /// error type; as a consequence, a `result<void,E>` constructed from a
+  /// `failure<E>` containing `E{}` will contain a value.
+  ///
+  /// \note Only trivially destructible error types may opt in to compact
+  ///       storage
+  ///
+  /// ### Examples
+  ///
+  /// Basic Usage:
+  ///
+  /// ```cpp
+  /// template <>
+  /// struct cpp::enable_compact_void_result<std::errc> : std::true_type{};
+  ///
+  /// static_assert(sizeof(cpp::result<void,std::errc>) == sizeof(std::errc), "");
+  /// ```
+  ///
+  /// \tparam E the error type
+  /////////////////////////////////////////////////////////////////////////////
+  template <typename E>
+  struct enable_compact_void_result : std::false_type{};
 
   //===========================================================================
-  // class : bad_result_access<E>
+  // trait : enable_throwing_assignment<T>
   //===========================================================================
 
   /////////////////////////////////////////////////////////////////////////////
-  /// \brief An exception thrown when result::value is accessed without
-  ///        a contained value
+  /// \brief A customization point that allows `result` objects containing a
+  ///        `T` to be assigned even when `T`'s constructors may throw
+  ///
+  /// By default, `result` is only assignable when constructing the new value
+  /// or error cannot throw, which guarantees that it is never left without a
+  /// value or an error. When this trait is specialized to inherit from
+  /// `std::true_type`, assignments that change the active type instead
+  /// provide the strong exception guarantee through a temporary on the stack,
+  /// as in the `std::expected` proposal:
+  ///
+  /// * if `T` is nothrow move-constructible, the new `T` is constructed into
+  ///   a temporary, and is moved into place once construction succeeds;
+  /// * otherwise, the active value or error is moved into a temporary, and is
+  ///   moved back if constructing the new `T` throws. This requires the other
+  ///   type to be nothrow move-constructible.
+  ///
+  /// If neither type is nothrow move-constructible, the assignment remains
+  /// disabled.
+  ///
+  /// ### Examples
+  ///
+  /// Basic Usage:
+  ///
+  /// ```cpp
+  /// template <>
+  /// struct cpp::enable_throwing_assignment<legacy::widget> : std::true_type{};
+  ///
+  /// auto r = cpp::result<legacy::widget,std::error_code>{};
+  /// r = legacy::widget{}; // may throw; 'r' is unchanged if it does
+  /// ```
+  ///
+  /// \tparam T the value or error type
   /////////////////////////////////////////////////////////////////////////////
-  template <typename E>
-  class bad_result_access : public std::logic_error
-  {
-    //-------------------------------------------------------------------------
-    // Constructor / Assignment
-    //-------------------------------------------------------------------------
-  public:
+  template <typename T>
+  struct enable_throwing_assignment : std::false_type{};
 
-    /// \brief Constructs this exception using the underlying error type for
-    ///        the error type
-    ///
-    /// \param error the underlying error
-    template <typename E2,
-              typename = typename std::enable_if<std::is_constructible<E,E2>::value>::type>
-    explicit bad_result_access(E2&& error);
+  //===========================================================================
+  // trait : is_trivially_relocatable<T>
+  //===========================================================================
 
-    /// \{
-    /// \brief Constructs this exception using the underlying error type for
-    ///        the error and a message
-    ///
-    /// \param what_arg the message for the failure
-    /// \param error the underlying error
-    template <typename E2,
-              typename = typename std::enable_if<std::is_constructible<E,E2>::value>::type>
-    bad_result_access(const char* what_arg, E2&& error);
-    template <typename E2,
-              typename = typename std::enable_if<std::is_constructible<E,E2>::value>::type>
-    bad_result_access(const std::string& what_arg, E2&& error);
-    /// \}
+  /////////////////////////////////////////////////////////////////////////////
+  /// \brief A customization point that determines whether a `T` object may be
+  ///        relocated -- moved to a new location, and the source destroyed --
+  ///        with a plain `std::memcpy`
+  ///
+  /// All trivially copyable types are trivially relocatable. Many other types,
+  /// such as `std::unique_ptr` or most `std::vector` implementations, are
+  /// also trivially relocatable despite having non-trivial move constructors
+  /// and destructors; these may opt-in by specializing this trait.
+  ///
+  /// A `result<T,E>` is trivially relocatable if both `T` and `E` are. This
+  /// is used by `uninitialized_relocate` to turn relocations of `result`
+  /// objects into a single `memcpy`.
+  ///
+  /// ### Examples
+  ///
+  /// Basic Usage:
+  ///
+  /// ```cpp
+  /// template <typename T>
+  /// struct cpp::is_trivially_relocatable<std::unique_ptr<T>> : std::true_type{};
+  ///
+  /// static_assert(
+  ///   cpp::is_trivially_relocatable<cpp::result<std::unique_ptr<int>,int>>::value,
+  ///   ""
+  /// );
+  /// ```
+  ///
+  /// \tparam T the type to query
+  /////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  struct is_trivially_relocatable
+    : std::integral_constant<bool, std::is_trivially_copyable<T>::value>{};
 
-    bad_result_access(const bad_result_access& other) = default;
-    bad_result_access(bad_result_access&& other) = default;
+  template <typename T>
+  struct is_trivially_relocatable<std::reference_wrapper<T>> : std::true_type{};
 
-    //-------------------------------------------------------------------------
+  template <typename T, typename E>
+  struct is_trivially_relocatable<result<T,E>>
+    : std::integral_constant<bool,(
+        // References and 'void' are always trivially relocatable
+        std::conditional<
+          std::is_lvalue_reference<T>::value || std::is_void<T>::value,
+          std::true_type,
+          is_trivially_relocatable<typename std::remove_const<T>::type>
+        >::type::value &&
+        is_trivially_relocatable<E>::value
+      )>{};
 
-    auto operator=(const bad_result_access& other) -> bad_result_access& = default;
-    auto operator=(bad_result_access&& other) -> bad_result_access& = default;
+  namespace detail {
 
-    /// \{
-    /// \brief Gets the underlying error
-    ///
-    /// \return the error
-    auto error() & noexcept -> E&;
-    auto error() && noexcept -> E&&;
-    auto error() const & noexcept -> const E&;
-    auto error() const && noexcept -> const E&&;
-    /// \}
+    template <typename T, bool IsObject = std::is_object<T>::value>
+    struct pointer_niche_bits
+      : std::integral_constant<std::size_t,
+          (alignof(T) > 1u) ? (sizeof(std::uintptr_t) * CHAR_BIT - 1u) : 0u
+        >{};
 
-    //-------------------------------------------------------------------------
-    // Private Members
-    //-------------------------------------------------------------------------
-  private:
+    template <typename T>
+    struct pointer_niche_bits<T, false>
+      : std::integral_constant<std::size_t, 0u>{};
 
-    E m_error;
-  };
+  } // namespace detail
 
-#endif
+  //===========================================================================
+  // trait : pointer_niche_traits<T>
+  //===========================================================================
 
-  namespace detail {
+  /////////////////////////////////////////////////////////////////////////////
+  /// \brief A niche for object pointers that stores the payload in the
+  ///        addresses whose low bit is set
+  ///
+  /// This is not used unless `result_niche_traits<T*>` is specialized to
+  /// derive from it. The pointed-to type must be complete when a `result`
+  /// is instantiated with an error type that may be encoded.
+  ///
+  /// \tparam T the pointed-to type
+  /////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  struct pointer_niche_traits
+  {
+    static constexpr std::size_t payload_bits = detail::pointer_niche_bits<T>::value;
 
-    template <typename E, typename E2>
-    using failure_is_value_convertible = std::integral_constant<bool,(
-      std::is_constructible<E, E2&&>::value &&
-      !std::is_same<typename std::decay<E2>::type, in_place_t>::value &&
-      !is_failure<typename std::decay<E2>::type>::value &&
-      !is_result<typename std::decay<E2>::type>::value
-    )>;
+    static auto make_niche(std::uintmax_t payload) noexcept -> T*;
+    static auto is_niche(T* const& value) noexcept -> bool;
+    static auto niche_payload(T* const& value) noexcept -> std::uintmax_t;
+  };
 
-    template <typename E, typename E2>
-    using failure_is_explicit_value_convertible = std::integral_constant<bool,(
-      failure_is_value_convertible<E, E2>::value &&
-      !std::is_convertible<E2, E>::value
-    )>;
+  //===========================================================================
+  // trait : enum_niche_traits<T, Last>
+  //===========================================================================
 
-    template <typename E, typename E2>
-    using failure_is_implicit_value_convertible = std::integral_constant<bool,(
-      failure_is_value_convertible<E, E2>::value &&
-      std::is_convertible<E2, E>::value
-    )>;
+  namespace detail {
 
-    template <typename E, typename E2>
-    using failure_is_value_assignable = std::integral_constant<bool,(
-      !is_result<typename std::decay<E2>::type>::value &&
-      !is_failure<typename std::decay<E2>::type>::value &&
-      std::is_assignable<wrapped_result_type<E>&,E2>::value
-    )>;
+    /// \brief Computes the number of bits needed to index below \p n
+    constexpr auto niche_floor_log2(std::uintmax_t n) noexcept -> std::size_t
+    {
+      return (n < 2u) ? 0u : (1u + niche_floor_log2(n >> 1u));
+    }
 
   } // namespace detail
 
-  //===========================================================================
-  // class : failure_type
-  //===========================================================================
-
-  //////////////////////////////////////////////////////////////////////////////
-  /// \brief A semantic type used for distinguishing failure values in an
-  ///        API that returns result types
+  /////////////////////////////////////////////////////////////////////////////
+  /// \brief A niche for enums that stores the payload in the values of the
+  ///        underlying type after the last enumerator \p Last
   ///
-  /// \tparam E the error type
-  //////////////////////////////////////////////////////////////////////////////
-  template <typename E>
-  class failure
+  /// The language does not describe which values of an enum are in use, so
+  /// this is not used unless `result_niche_traits<T>` is specialized to
+  /// derive from it. Unlike `pointer_niche_traits`, this niche may be used
+  /// in constant expressions.
+  ///
+  /// ### Examples
+  ///
+  /// Basic Usage:
+  ///
+  /// ```cpp
+  /// enum class token : std::uint16_t { identifier, number, end };
+  ///
+  /// template <>
+  /// struct cpp::result_niche_traits<token>
+  ///   : cpp::enum_niche_traits<token, token::end>{};
+  ///
+  /// static_assert(sizeof(cpp::result<token,std::uint8_t>) == sizeof(token), "");
+  /// ```
+  ///
+  /// \tparam T the enum type
+  /// \tparam Last the largest value of \p T that is ever used
+  /////////////////////////////////////////////////////////////////////////////
+  template <typename T, T Last>
+  struct enum_niche_traits
   {
     static_assert(
-      !is_result<typename std::decay<E>::type>::value,
-      "A (possibly CV-qualified) result 'E' type is ill-formed."
-    );
-    static_assert(
-      !is_failure<typename std::decay<E>::type>::value,
-      "A (possibly CV-qualified) failure 'E' type is ill-formed."
+      std::is_enum<T>::value,
+      "enum_niche_traits requires T to be an enum type"
     );
+
+    using underlying_type = typename std::underlying_type<T>::type;
+
     static_assert(
-      !std::is_void<typename std::decay<E>::type>::value,
-      "A (possibly CV-qualified) 'void' 'E' type is ill-formed."
+      std::is_unsigned<underlying_type>::value ||
+      static_cast<std::intmax_t>(Last) >= 0,
+      "enum_niche_traits requires the last enumerator to be non-negative"
     );
-    static_assert(
-      !std::is_rvalue_reference<E>::value,
-      "rvalue references for 'E' type is ill-formed. "
-      "Only lvalue references are valid."
+
+    static constexpr std::size_t payload_bits = detail::niche_floor_log2(
+      static_cast<std::uintmax_t>(
+        std::numeric_limits<underlying_type>::max() -
+        static_cast<underlying_type>(Last)
+      )
     );
 
-    //-------------------------------------------------------------------------
-    // Public Member Types
-    //-------------------------------------------------------------------------
-  public:
+    static constexpr auto make_niche(std::uintmax_t payload) noexcept -> T;
+    static constexpr auto is_niche(const T& value) noexcept -> bool;
+    static constexpr auto niche_payload(const T& value) noexcept -> std::uintmax_t;
+  };
 
-    using error_type = E;
+  //===========================================================================
+  // trait : detail::wrapped_result_type
+  //===========================================================================
 
-    //-------------------------------------------------------------------------
-    // Constructors / Assignment
-    //-------------------------------------------------------------------------
-  public:
+  namespace detail {
 
-    /// \brief Constructs a failure via default construction
-    failure() = default;
+    template <typename T>
+    using wrapped_result_type = typename std::conditional<
+      std::is_lvalue_reference<T>::value,
+      std::reference_wrapper<
+        typename std::remove_reference<T>::type
+      >,
+      typename std::remove_const<T>::type
+    >::type;
 
-    /// \brief Constructs a failure by delegating construction to the
-    ///        underlying constructor
-    ///
-    /// \param args the arguments to forward to E's constructor
-    template <typename...Args,
-              typename = typename std::enable_if<std::is_constructible<E,Args...>::value>::type>
-    constexpr failure(in_place_t, Args&&...args)
-      noexcept(std::is_nothrow_constructible<E, Args...>::value);
+    //=========================================================================
+    // class : detail::niche_reference<T>
+    //=========================================================================
 
-    /// \brief Constructs a failure by delegating construction to the
-    ///        underlying constructor
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A trivially copyable equivalent of `std::reference_wrapper`
+    ///        that is used as the storage of `result<T&,E>` when its error
+    ///        is encoded in a niche
     ///
-    /// \param ilist the initializer list
-    /// \param args the arguments to forward to E's constructor
-    template <typename U, typename...Args,
-              typename = typename std::enable_if<std::is_constructible<E,std::initializer_list<U>,Args...>::value>::type>
-    constexpr failure(in_place_t, std::initializer_list<U> ilist, Args&&...args)
-      noexcept(std::is_nothrow_constructible<E, std::initializer_list<U>, Args...>::value);
-
-    /// \{
-    /// \brief Constructs a failure from the given error
+    /// Unlike `std::reference_wrapper`, the representation of this type is
+    /// exactly a `T*`, which allows the spare representations of the pointer
+    /// to be used as a niche.
     ///
-    /// \param error the error to create a failure from
-    template <typename E2,
-              typename std::enable_if<detail::failure_is_implicit_value_convertible<E,E2>::value,int>::type = 0>
-    constexpr failure(E2&& error)
-      noexcept(std::is_nothrow_constructible<E,E2>::value);
-    template <typename E2,
-              typename std::enable_if<detail::failure_is_explicit_value_convertible<E,E2>::value,int>::type = 0>
-    constexpr explicit failure(E2&& error)
-      noexcept(std::is_nothrow_constructible<E,E2>::value);
-    /// \}
+    /// \tparam T the referred-to type
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    class niche_reference
+    {
+      //-----------------------------------------------------------------------
+      // Public Member Types
+      //-----------------------------------------------------------------------
+    public:
 
-    /// \brief Constructs this failure by copying the contents of an existing
-    ///        one
-    ///
-    /// \param other the other failure to copy
-    /* implicit */ failure(const failure& other) = default;
+      using type = T;
 
-    /// \brief Constructs this failure by moving the contents of an existing
-    ///        one
-    ///
-    /// \param other the other failure to move
-    /* implicit */ failure(failure&& other) = default;
+      //-----------------------------------------------------------------------
+      // Constructors / Assignment
+      //-----------------------------------------------------------------------
+    public:
 
-    /// \brief Constructs this failure by copy-converting \p other
-    ///
-    /// \param other the other failure to copy
-    template <typename E2,
-              typename = typename std::enable_if<std::is_constructible<E,const E2&>::value>::type>
-    constexpr /* implicit */ failure(const failure<E2>& other)
-      noexcept(std::is_nothrow_constructible<E,const E2&>::value);
+      /// \brief Constructs this niche_reference by referring to \p reference
+      ///
+      /// \param reference the reference to refer to
+      niche_reference(T& reference) noexcept;
+      niche_reference(T&&) = delete;
 
-    /// \brief Constructs this failure by move-converting \p other
-    ///
-    /// \param other the other failure to copy
-    template <typename E2,
-              typename = typename std::enable_if<std::is_constructible<E,E2&&>::value>::type>
-    constexpr /* implicit */ failure(failure<E2>&& other)
-      noexcept(std::is_nothrow_constructible<E,E2&&>::value);
+      niche_reference(const niche_reference& other) = default;
 
-    //--------------------------------------------------------------------------
+      //-----------------------------------------------------------------------
 
-    /// \brief Assigns the value of \p error to this failure through
-    ///        move-assignment
-    ///
-    /// \param error the value to assign
-    /// \return reference to `(*this)`
-    template <typename E2,
-              typename = typename std::enable_if<detail::failure_is_value_assignable<E,E2>::value>::type>
-    RESULT_CPP14_CONSTEXPR
-    auto operator=(E2&& error)
-      noexcept(std::is_nothrow_assignable<E,E2>::value || std::is_lvalue_reference<E>::value) -> failure&;
+      auto operator=(const niche_reference& other) -> niche_reference& = default;
 
-    /// \brief Assigns the contents of \p other to this by copy-assignment
-    ///
-    /// \param other the other failure to copy
-    /// \return reference to `(*this)`
-    auto operator=(const failure& other) -> failure& = default;
+      //-----------------------------------------------------------------------
+      // Observers
+      //-----------------------------------------------------------------------
+    public:
 
-    /// \brief Assigns the contents of \p other to this by move-assignment
+      /// \brief Gets the underlying reference
+      ///
+      /// \return the stored reference
+      constexpr operator T&() const noexcept;
+
+      /// \copydoc operator T&()
+      constexpr auto get() const noexcept -> T&;
+
+      //-----------------------------------------------------------------------
+      // Private Constructors
+      //-----------------------------------------------------------------------
+    private:
+
+      explicit niche_reference(T* pointer) noexcept;
+
+      //-----------------------------------------------------------------------
+      // Private Members
+      //-----------------------------------------------------------------------
+    private:
+
+      T* m_pointer;
+
+      friend struct result_niche_traits<niche_reference>;
+    };
+
+    //=========================================================================
+    // trait : detail::niche_wrapped_result_type
+    //=========================================================================
+
+    /// \brief The type stored by a `result<T,E>` whose error is encoded in a
+    ///        niche
+    template <typename T>
+    using niche_wrapped_result_type = typename std::conditional<
+      std::is_lvalue_reference<T>::value,
+      niche_reference<
+        typename std::remove_reference<T>::type
+      >,
+      typename std::remove_const<T>::type
+    >::type;
+
+    //=========================================================================
+    // trait : detail::niche_error_traits<E>
+    //=========================================================================
+
+    /// \brief Encodes integral and enum error types into a niche payload
     ///
-    /// \param other the other failure to move
-    /// \return reference to `(*this)`
-    auto operator=(failure&& other) -> failure& = default;
+    /// \tparam E the error type
+    template <typename E,
+              bool IsEncodable = (std::is_integral<E>::value || std::is_enum<E>::value) &&
+                                 !std::is_same<E, bool>::value &&
+                                 std::is_same<E, typename std::remove_cv<E>::type>::value>
+    struct niche_error_traits
+    {
+      static constexpr bool is_encodable = false;
+    };
 
-    /// \brief Assigns the contents of \p other to this by copy conversion
+    template <typename E>
+    struct niche_error_traits<E, true>
+    {
+      using integral_type = typename std::conditional<
+        std::is_enum<E>::value,
+        std::underlying_type<E>,
+        std::common_type<E>
+      >::type::type;
+      using unsigned_type = typename std::make_unsigned<integral_type>::type;
+
+      static constexpr bool is_encodable = true;
+      static constexpr std::size_t bits = sizeof(E) * CHAR_BIT;
+
+      static constexpr auto encode(E error) noexcept -> std::uintmax_t;
+      static constexpr auto decode(std::uintmax_t payload) noexcept -> E;
+    };
+
+    //=========================================================================
+    // trait : detail::result_uses_niche<T, E>
+    //=========================================================================
+
+    /// \brief Determines whether `result<T,E>` should store its error in the
+    ///        niche of `T`
     ///
-    /// \param other the other failure to copy-convert
-    /// \return reference to `(*this)`
-    template <typename E2,
-              typename = typename std::enable_if<std::is_assignable<E&,const E2&>::value>::type>
-    RESULT_CPP14_CONSTEXPR
-    auto operator=(const failure<E2>& other)
-      noexcept(std::is_nothrow_assignable<E,const E2&>::value) -> failure&;
+    /// The niche traits of `T` are only ever queried when `E` is encodable,
+    /// so that pointers to incomplete types may still be used with any other
+    /// error type.
+    template <typename T, typename E,
+              bool IsEncodable = niche_error_traits<E>::is_encodable>
+    struct result_uses_niche : std::false_type{};
 
-    /// \brief Assigns the contents of \p other to this by move conversion
+    template <typename T, typename E>
+    struct result_uses_niche<T, E, true> : std::integral_constant<bool,(
+      std::is_trivially_copyable<niche_wrapped_result_type<T>>::value &&
+      std::is_trivially_destructible<niche_wrapped_result_type<T>>::value &&
+      (result_niche_traits<niche_wrapped_result_type<T>>::payload_bits >= niche_error_traits<E>::bits)
+    )>{};
+
+  } // namespace detail
+
+  /// \brief A niche for references, which shares the niche of `T*`
+  ///
+  /// \tparam T the referred-to type
+  template <typename T>
+  struct result_niche_traits<detail::niche_reference<T>>
+  {
+    static constexpr std::size_t payload_bits = result_niche_traits<T*>::payload_bits;
+
+    static auto make_niche(std::uintmax_t payload) noexcept -> detail::niche_reference<T>;
+    static auto is_niche(const detail::niche_reference<T>& value) noexcept -> bool;
+    static auto niche_payload(const detail::niche_reference<T>& value) noexcept -> std::uintmax_t;
+  };
+
+  //===========================================================================
+  // class : source_location
+  //===========================================================================
+
+  /////////////////////////////////////////////////////////////////////////////
+  /// \brief The location in source code that a function was called from
+  ///
+  /// This is a C++11-compatible equivalent of `std::source_location`, which is
+  /// used to report where an unchecked access to a `result` was made. On
+  /// compilers without the necessary builtins, the location is empty.
+  /////////////////////////////////////////////////////////////////////////////
+  class source_location
+  {
+    //-------------------------------------------------------------------------
+    // Static Factories
+    //-------------------------------------------------------------------------
+  public:
+
+    /// \brief Gets the location of the caller of this function
     ///
-    /// \param other the other failure to move-convert
-    /// \return reference to `(*this)`
-    template <typename E2,
-              typename = typename std::enable_if<std::is_assignable<E&,E2&&>::value>::type>
-    RESULT_CPP14_CONSTEXPR
-    auto operator=(failure<E2>&& other)
-      noexcept(std::is_nothrow_assignable<E,E2&&>::value) -> failure&;
+    /// \return the location
+#if RESULT_HAS_BUILTIN_SOURCE_LOCATION
+    static constexpr auto current(const char* file = __builtin_FILE(),
+                                  const char* function = __builtin_FUNCTION(),
+                                  unsigned line = __builtin_LINE())
+      noexcept -> source_location;
+#else
+    static constexpr auto current(const char* file = "",
+                                  const char* function = "",
+                                  unsigned line = 0u)
+      noexcept -> source_location;
+#endif
 
-    //--------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    // Constructors
+    //-------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs an empty source location
+    constexpr source_location() noexcept = default;
+
+    //-------------------------------------------------------------------------
     // Observers
-    //--------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
   public:
 
-    /// \{
-    /// \brief Gets the underlying error
-    ///
-    /// \return the underlying error
-    RESULT_CPP14_CONSTEXPR
-    auto error() & noexcept
-      -> typename std::add_lvalue_reference<E>::type;
-    RESULT_CPP14_CONSTEXPR
-    auto error() && noexcept
-      -> typename std::add_rvalue_reference<E>::type;
-    constexpr auto error() const & noexcept
-      -> typename std::add_lvalue_reference<typename std::add_const<E>::type>::type;
-    constexpr auto error() const && noexcept
-      -> typename std::add_rvalue_reference<typename std::add_const<E>::type>::type;
-    /// \}
+    /// \brief Gets the name of the file, or an empty string if unknown
+    constexpr auto file_name() const noexcept -> const char*;
+
+    /// \brief Gets the name of the function, or an empty string if unknown
+    constexpr auto function_name() const noexcept -> const char*;
+
+    /// \brief Gets the line number, or `0` if unknown
+    constexpr auto line() const noexcept -> unsigned;
 
     //-------------------------------------------------------------------------
-    // Private Member Types
+    // Private Constructors
     //-------------------------------------------------------------------------
   private:
 
-    using underlying_type = detail::wrapped_result_type<E>;
+    constexpr source_location(const char* file,
+                              const char* function,
+                              unsigned line) noexcept;
 
     //-------------------------------------------------------------------------
     // Private Members
     //-------------------------------------------------------------------------
   private:
 
-    underlying_type m_failure;
+    const char* m_file = "";
+    const char* m_function = "";
+    unsigned m_line = 0u;
   };
 
-#if __cplusplus >= 201703L
-  template <typename T>
-  failure(std::reference_wrapper<T>) -> failure<T&>;
-
-  template <typename T>
-  failure(T&&) -> failure<typename std::decay<T>::type>;
-#endif
-
   //===========================================================================
-  // non-member functions : class : failure
+  // class : bad_result_access_info
   //===========================================================================
 
-  //---------------------------------------------------------------------------
-  // Comparison
-  //---------------------------------------------------------------------------
+  /////////////////////////////////////////////////////////////////////////////
+  /// \brief Information about an attempt to access the value of a `result`
+  ///        that contains an error
+  ///
+  /// This is the argument given to the handler installed with
+  /// `set_bad_result_access_handler`. The error is type-erased, and may be
+  /// recovered with `error_if<E>()`. The referenced message and error are only
+  /// valid for the duration of the handler call.
+  /////////////////////////////////////////////////////////////////////////////
+  class bad_result_access_info
+  {
+    //-------------------------------------------------------------------------
+    // Constructors
+    //-------------------------------------------------------------------------
+  public:
 
-  template <typename E1, typename E2>
-  constexpr auto operator==(const failure<E1>& lhs,
-                            const failure<E2>& rhs) noexcept -> bool;
-  template <typename E1, typename E2>
-  constexpr auto operator!=(const failure<E1>& lhs,
-                            const failure<E2>& rhs) noexcept -> bool;
-  template <typename E1, typename E2>
-  constexpr auto operator<(const failure<E1>& lhs,
-                           const failure<E2>& rhs) noexcept -> bool;
-  template <typename E1, typename E2>
-  constexpr auto operator>(const failure<E1>& lhs,
-                           const failure<E2>& rhs) noexcept -> bool;
-  template <typename E1, typename E2>
-  constexpr auto operator<=(const failure<E1>& lhs,
-                            const failure<E2>& rhs) noexcept -> bool;
-  template <typename E1, typename E2>
-  constexpr auto operator>=(const failure<E1>& lhs,
-                            const failure<E2>& rhs) noexcept -> bool;
+    /// \brief Constructs this info from a \p message, \p error and location
+    ///        \p where
+    ///
+    /// \param message the message describing the failure
+    /// \param error the error contained in the result
+    /// \param where the location of the access
+    template <typename E>
+    bad_result_access_info(const char* message,
+                           const E& error,
+                           source_location where) noexcept;
 
-  //---------------------------------------------------------------------------
-  // Utilities
-  //---------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    // Observers
+    //-------------------------------------------------------------------------
+  public:
 
-  /// \brief Deduces and constructs a failure type from \p e
-  ///
-  /// \param e the failure value
-  /// \return a constructed failure value
-  template <typename E>
-  RESULT_WARN_UNUSED
-  constexpr auto fail(E&& e)
-    noexcept(std::is_nothrow_constructible<typename std::decay<E>::type,E>::value)
-    -> failure<typename std::decay<E>::type>;
+    /// \brief Gets the message describing the failure
+    auto message() const noexcept -> const char*;
 
-  /// \brief Deduces a failure reference from a reverence_wrapper
-  ///
-  /// \param e the failure value
-  /// \return a constructed failure reference
-  template <typename E>
-  RESULT_WARN_UNUSED
-  constexpr auto fail(std::reference_wrapper<E> e)
-    noexcept -> failure<E&>;
+    /// \brief Gets the location of the access
+    auto where() const noexcept -> source_location;
 
-  /// \brief Constructs a failure type from a series of arguments
-  ///
-  /// \tparam E the failure type
-  /// \param args the arguments to forward to E's constructor
-  /// \return a constructed failure type
-  template <typename E, typename...Args,
-            typename = typename std::enable_if<std::is_constructible<E,Args...>::value>::type>
-  RESULT_WARN_UNUSED
-  constexpr auto fail(Args&&...args)
-    noexcept(std::is_nothrow_constructible<E, Args...>::value)
-    -> failure<E>;
+    /// \brief Gets a pointer to the error, if it is of type \p E
+    ///
+    /// \tparam E the type of the error
+    /// \return a pointer to the error, or `nullptr` if it is not an `E`
+    template <typename E>
+    auto error_if() const noexcept -> const E*;
 
-  /// \brief Constructs a failure type from an initializer list and series of
-  ///        arguments
+    //-------------------------------------------------------------------------
+    // Private Members
+    //-------------------------------------------------------------------------
+  private:
+
+    const char* m_message;
+    const void* m_error;
+    const void* m_error_type;
+    source_location m_where;
+  };
+
+  //===========================================================================
+  // utilities : bad_result_access_handler
+  //===========================================================================
+
+  /// \brief A function invoked when the value of a `result` containing an
+  ///        error is accessed
+  using bad_result_access_handler = void(*)(const bad_result_access_info&);
+
+  /// \brief Installs \p handler as the function to invoke when the value of a
+  ///        `result` containing an error is accessed
   ///
-  /// \tparam E the failure type
-  /// \param args the arguments to forward to E's constructor
-  /// \return a constructed failure type
-  template <typename E, typename U, typename...Args,
-            typename = typename std::enable_if<std::is_constructible<E,std::initializer_list<U>,Args...>::value>::type>
-  RESULT_WARN_UNUSED
-  constexpr auto fail(std::initializer_list<U> ilist, Args&&...args)
-    noexcept(std::is_nothrow_constructible<E, std::initializer_list<U>, Args...>::value)
-    -> failure<E>;
+  /// The handler is invoked before the default behavior -- throwing
+  /// `bad_result_access`, or aborting if `RESULT_DISABLE_EXCEPTIONS` is
+  /// defined. A handler is intended to not return (by aborting, or by throwing
+  /// its own exception); if it does return, the default behavior follows.
+  ///
+  /// Invoking the handler never allocates, unless `expect` was given a message
+  /// that is not a C string.
+  ///
+  /// ### Examples
+  ///
+  /// Basic Usage:
+  ///
+  /// ```cpp
+  /// [[noreturn]] void on_bad_access(const cpp::bad_result_access_info& info)
+  /// {
+  ///   if (const auto* ec = info.error_if<std::error_code>()) {
+  ///     log_error(info.where().file_name(), info.where().line(), *ec);
+  ///   }
+  ///   std::abort();
+  /// }
+  ///
+  /// auto main() -> int
+  /// {
+  ///   cpp::set_bad_result_access_handler(&on_bad_access);
+  ///   ...
+  /// }
+  /// ```
+  ///
+  /// \param handler the handler to install, or `nullptr` to remove it
+  /// \return the previously installed handler
+  auto set_bad_result_access_handler(bad_result_access_handler handler)
+    noexcept -> bad_result_access_handler;
 
-  /// \brief Swaps the contents of two failure values
+  /// \brief Gets the currently installed bad_result_access_handler
   ///
-  /// \param lhs the left failure
-  /// \param rhs the right failure
-  template <typename E>
-  auto swap(failure<E>& lhs, failure<E>& rhs)
-#if __cplusplus >= 201703L
-    noexcept(std::is_nothrow_swappable<E>::value) -> void;
-#else
-    noexcept(std::is_nothrow_move_constructible<E>::value) -> void;
+  /// \return the handler, or `nullptr` if none is installed
+  auto get_bad_result_access_handler() noexcept -> bad_result_access_handler;
+
+  namespace detail {
+
+    /// \brief Gets the storage for the installed bad_result_access_handler
+    auto bad_result_access_handler_storage()
+      noexcept -> std::atomic<bad_result_access_handler>&;
+
+    /// \brief A unique address for each type \p T, used to identify
+    ///        type-erased objects without RTTI
+    template <typename T>
+    struct type_id
+    {
+      static constexpr char value = 0;
+    };
+
+#if __cplusplus < 201703L
+    template <typename T>
+    constexpr char type_id<T>::value;
 #endif
 
+  } // namespace detail
+
+#if defined(RESULT_ENABLE_STATS) || defined(RESULT_ENABLE_TRACE)
+
   namespace detail {
 
-    //=========================================================================
-    // class : unit
-    //=========================================================================
+    /// \brief Gets a signature that spells the name of the type \p E
+    template <typename E>
+    auto failure_type_signature() noexcept -> const char*;
 
-    /// \brief A standalone monostate object (effectively std::monostate). This
-    ///        exists to allow for `void` specializations
-    struct unit {};
+    /// \brief Gets the name of the type spelled by a \p signature from
+    ///        `failure_type_signature`
+    auto failure_type_name(const char* signature) -> std::string;
 
-    //=========================================================================
-    // non-member functions : class : unit
-    //=========================================================================
+  } // namespace detail
 
-    constexpr auto operator==(unit, unit) noexcept -> bool { return true; }
-    constexpr auto operator!=(unit, unit) noexcept -> bool { return false; }
-    constexpr auto operator<(unit, unit) noexcept -> bool { return false; }
-    constexpr auto operator>(unit, unit) noexcept -> bool { return false; }
-    constexpr auto operator<=(unit, unit) noexcept -> bool { return true; }
-    constexpr auto operator>=(unit, unit) noexcept -> bool { return true; }
+#endif
 
-    //=========================================================================
-    // class : detail::result_union<T, E, IsTrivial>
-    //=========================================================================
+#if defined(RESULT_ENABLE_STATS)
 
-    ///////////////////////////////////////////////////////////////////////////
-    /// \brief A basic utility that acts as a union containing the T and E
-    ///        types
-    ///
-    /// This is specialized on the case that both T and E are trivial, in which
-    /// case `result_union` is also trivial
-    ///
-    /// \tparam T the value type result to be returned
-    /// \tparam E the error type returned on failure
-    /// \tparam IsTrivial Whether or not both T and E are trivial
-    ///////////////////////////////////////////////////////////////////////////
-    template <typename T, typename E,
-              bool IsTrivial = std::is_trivially_destructible<T>::value &&
-                               std::is_trivially_destructible<E>::value>
-    struct result_union
-    {
-      //-----------------------------------------------------------------------
-      // Public Member Types
-      //-----------------------------------------------------------------------
+  namespace detail {
+    class failure_stats_registry;
+  } // namespace detail
 
-      using underlying_value_type = wrapped_result_type<T>;
-      using underlying_error_type = E;
+  //===========================================================================
+  // class : failure_count
+  //===========================================================================
 
-      //-----------------------------------------------------------------------
-      // Constructors / Assignment
-      //-----------------------------------------------------------------------
+  /////////////////////////////////////////////////////////////////////////////
+  /// \brief The number of failures of one error type that were recorded from
+  ///        one source location
+  ///
+  /// Failures are recorded by `fail` and by the `in_place_error` constructors
+  /// of `result` when `RESULT_ENABLE_STATS` is defined. Only `fail(E&&)` knows
+  /// the location of its caller, so failures from the other overloads and the
+  /// constructors have an empty location. Locations are also only sampled
+  /// once every `RESULT_STATS_SAMPLE_PERIOD` failures on each thread; the
+  /// failures in between are counted with an empty location.
+  /////////////////////////////////////////////////////////////////////////////
+  class failure_count
+  {
+    //-------------------------------------------------------------------------
+    // Constructors
+    //-------------------------------------------------------------------------
+  public:
 
-      /// \brief Constructs an empty object
-      ///
-      /// This is for use with conversion constructors, since it allows a
-      /// temporary unused object to be set
-      result_union(unit) noexcept;
+    /// \brief Constructs this count from the error's type and \p signature,
+    ///        the location \p where, and the \p count
+    ///
+    /// \param type the unique identifier of the error type
+    /// \param signature the signature that the name of the type is read from
+    /// \param where the location the failures were recorded from
+    /// \param count the number of failures
+    failure_count(const void* type,
+                  const char* signature,
+                  source_location where,
+                  std::uint64_t count) noexcept;
 
-      /// \brief Constructs the underlying value from the specified \p args
-      ///
-      /// \param args the arguments to forward to T's constructor
-      template <typename...Args>
-      constexpr result_union(in_place_t, Args&&...args)
-        noexcept(std::is_nothrow_constructible<T, Args...>::value);
+    //-------------------------------------------------------------------------
+    // Observers
+    //-------------------------------------------------------------------------
+  public:
 
-      /// \brief Constructs the underlying error from the specified \p args
-      ///
-      /// \param args the arguments to forward to E's constructor
-      template <typename...Args>
-      constexpr result_union(in_place_error_t, Args&&...args)
-        noexcept(std::is_nothrow_constructible<E, Args...>::value);
+    /// \brief Checks whether the failures are of error type \p E
+    ///
+    /// \tparam E the type of the error
+    /// \return `true` if the failures are of type \p E
+    template <typename E>
+    auto is() const noexcept -> bool;
 
-      result_union(const result_union&) = default;
-      result_union(result_union&&) = default;
+    /// \brief Gets the name of the error type, as spelled by the compiler
+    auto error_type() const -> std::string;
 
-      //-----------------------------------------------------------------------
+    /// \brief Gets the location the failures were recorded from, or an empty
+    ///        location if it is unknown or was not sampled
+    auto where() const noexcept -> source_location;
 
-      auto operator=(const result_union&) -> result_union& = default;
-      auto operator=(result_union&&) -> result_union& = default;
+    /// \brief Gets the number of failures
+    auto count() const noexcept -> std::uint64_t;
 
-      //-----------------------------------------------------------------------
-      // Modifiers
-      //-----------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    // Private Members
+    //-------------------------------------------------------------------------
+  private:
 
-      /// \brief A no-op for trivial types
-      auto destroy() const noexcept -> void;
+    const void* m_type;
+    const char* m_signature;
+    source_location m_where;
+    std::uint64_t m_count;
 
-      //-----------------------------------------------------------------------
-      // Public Members
-      //-----------------------------------------------------------------------
+    friend class failure_stats;
+    friend class detail::failure_stats_registry;
+  };
 
-      union {
-        underlying_value_type m_value;
-        underlying_error_type m_error;
-        unit m_empty;
-      };
-      bool m_has_value;
-    };
+  //===========================================================================
+  // class : failure_stats
+  //===========================================================================
 
+  /////////////////////////////////////////////////////////////////////////////
+  /// \brief A snapshot of the failures recorded across all threads
+  ///
+  /// Each thread counts its own failures in a fixed-size table of
+  /// `RESULT_STATS_TABLE_SIZE` entries, without locking or atomic
+  /// read-modify-writes; taking a snapshot reads the tables of every live
+  /// thread along with the totals of threads that have exited. Failures that
+  /// do not fit in a thread's table are counted as dropped.
+  ///
+  /// ### Examples
+  ///
+  /// Basic Usage:
+  ///
+  /// ```cpp
+  /// const auto stats = cpp::failure_stats::snapshot();
+  ///
+  /// for (const auto& entry : stats.counts()) {
+  ///   std::printf("%s:%u: %llu x %s\n",
+  ///               entry.where().file_name(), entry.where().line(),
+  ///               static_cast<unsigned long long>(entry.count()),
+  ///               entry.error_type().c_str());
+  /// }
+  /// ```
+  /////////////////////////////////////////////////////////////////////////////
+  class failure_stats
+  {
     //-------------------------------------------------------------------------
+    // Static Functions
+    //-------------------------------------------------------------------------
+  public:
 
-    template <typename T, typename E>
-    struct result_union<T, E, false>
-    {
-      //-----------------------------------------------------------------------
-      // Public Member Types
-      //-----------------------------------------------------------------------
+    /// \brief Aggregates the failures recorded on every thread since the last
+    ///        call to `reset`
+    ///
+    /// \return the aggregated failures
+    static auto snapshot() -> failure_stats;
 
-      using underlying_value_type = wrapped_result_type<T>;
-      using underlying_error_type = E;
+    /// \brief Discards the failures recorded so far, so that later snapshots
+    ///        only count newer failures
+    static auto reset() -> void;
 
-      //-----------------------------------------------------------------------
-      // Constructors / Assignment / Destructor
-      //-----------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    // Observers
+    //-------------------------------------------------------------------------
+  public:
 
-      /// \brief Constructs an empty object
-      ///
-      /// This is for use with conversion constructors, since it allows a
-      /// temporary unused object to be set
-      result_union(unit) noexcept;
+    /// \brief Gets the failures counted by error type and location
+    auto counts() const noexcept -> const std::vector<failure_count>&;
 
-      /// \brief Constructs the underlying value from the specified \p args
-      ///
-      /// \param args the arguments to forward to T's constructor
-      template <typename...Args>
-      constexpr result_union(in_place_t, Args&&...args)
-        noexcept(std::is_nothrow_constructible<T, Args...>::value);
+    /// \brief Gets the number of failures of error type \p E, across all
+    ///        locations
+    ///
+    /// \tparam E the type of the error
+    /// \return the number of failures
+    template <typename E>
+    auto count_of() const noexcept -> std::uint64_t;
 
-      /// \brief Constructs the underlying error from the specified \p args
-      ///
-      /// \param args the arguments to forward to E's constructor
-      template <typename...Args>
-      constexpr result_union(in_place_error_t, Args&&...args)
-        noexcept(std::is_nothrow_constructible<E, Args...>::value);
+    /// \brief Gets the number of failures of every error type
+    auto total() const noexcept -> std::uint64_t;
 
-      result_union(const result_union&) = default;
-      result_union(result_union&&) = default;
+    /// \brief Gets the number of failures that could not be counted because a
+    ///        thread's table was full
+    auto dropped() const noexcept -> std::uint64_t;
 
-      //-----------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    // Private Members
+    //-------------------------------------------------------------------------
+  private:
 
-      /// \brief Destroys the underlying stored object
-      ~result_union()
-        noexcept(std::is_nothrow_destructible<T>::value &&
-                 std::is_nothrow_destructible<E>::value);
+    auto count_of(const void* type) const noexcept -> std::uint64_t;
 
-      //-----------------------------------------------------------------------
+    std::vector<failure_count> m_counts;
+    std::uint64_t m_dropped = 0u;
 
-      auto operator=(const result_union&) -> result_union& = default;
-      auto operator=(result_union&&) -> result_union& = default;
+    friend class detail::failure_stats_registry;
+  };
 
-      //-----------------------------------------------------------------------
-      // Modifiers
-      //-----------------------------------------------------------------------
+#endif // defined(RESULT_ENABLE_STATS)
 
-      /// \brief Destroys the underlying stored object
-      auto destroy() -> void;
+  namespace detail {
 
-      //-----------------------------------------------------------------------
-      // Public Members
-      //-----------------------------------------------------------------------
-
-      union {
-        underlying_value_type m_value;
-        underlying_error_type m_error;
-        unit m_empty;
-      };
-      bool m_has_value;
-    };
+#if defined(RESULT_ENABLE_STATS)
 
     //=========================================================================
-    // class : result_construct_base<T, E>
+    // class : detail::failure_stats_table
     //=========================================================================
 
-    ///////////////////////////////////////////////////////////////////////////
-    /// \brief Base class of assignment to enable construction and assignment
-    ///
-    /// This class is used with several pieces of construction to ensure
-    /// trivial constructibility and assignability:
-    ///
-    /// * `result_trivial_copy_ctor_base`
-    /// * `result_trivial_move_ctor_base`
-    /// * `result_copy_assign_base`
-    /// * `result_move_assign_base`
+    /// \brief The table that a single thread counts its failures in
     ///
-    /// \tparam T the value type
-    /// \tparam E the error type
-    ///////////////////////////////////////////////////////////////////////////
-    template <typename T, typename E>
-    struct result_construct_base
+    /// Only the owning thread writes to the table, so counting is a relaxed
+    /// load and store. An entry's key is published with a release store after
+    /// the rest of the entry is written, so that other threads may read it
+    /// while taking a snapshot.
+    struct failure_stats_table
     {
-      //-----------------------------------------------------------------------
-      // Constructors / Assignment
-      //-----------------------------------------------------------------------
+      struct entry
+      {
+        std::atomic<const void*> type{nullptr};
+        const char* signature = nullptr;
+        source_location where;
+        std::atomic<std::uint64_t> count{0u};
+      };
 
-      /// \brief Constructs an empty object
+      /// \brief Gets the table of the calling thread, creating it on first
+      ///        use
       ///
-      /// This is for use with conversion constructors, since it allows a
-      /// temporary unused object to be set
-      result_construct_base(unit) noexcept;
+      /// \return the table, or `nullptr` if it could not be created
+      static auto local() noexcept -> failure_stats_table*;
+
+      /// \brief Counts a failure of \p type from the location \p where
+      auto record(const void* type,
+                  const char* signature,
+                  source_location where) noexcept -> void;
+
+      entry entries[RESULT_STATS_TABLE_SIZE];
+      std::atomic<std::uint64_t> dropped{0u};
+      unsigned until_sample = 1u;
+      failure_stats_table* next = nullptr;
+    };
 
-      /// \brief Constructs the underlying value from the specified \p args
-      ///
-      /// \param args the arguments to forward to T's constructor
-      template <typename...Args>
-      constexpr result_construct_base(in_place_t, Args&&...args)
-        noexcept(std::is_nothrow_constructible<T, Args...>::value);
+    //=========================================================================
+    // class : detail::failure_stats_registry
+    //=========================================================================
 
-      /// \brief Constructs the underlying error from the specified \p args
-      ///
-      /// \param args the arguments to forward to E's constructor
-      template <typename...Args>
-      constexpr result_construct_base(in_place_error_t, Args&&...args)
-        noexcept(std::is_nothrow_constructible<E, Args...>::value);
+    /// \brief The list of every live thread's table, and the totals of the
+    ///        threads that have exited
+    class failure_stats_registry
+    {
+    public:
 
-      result_construct_base(const result_construct_base&) = default;
-      result_construct_base(result_construct_base&&) = default;
+      static auto instance() noexcept -> failure_stats_registry&;
 
-      auto operator=(const result_construct_base&) -> result_construct_base& = default;
-      auto operator=(result_construct_base&&) -> result_construct_base& = default;
+      auto attach(failure_stats_table* table) -> void;
+      auto detach(failure_stats_table* table) -> void;
 
-      //-----------------------------------------------------------------------
-      // Construction / Assignment
-      //-----------------------------------------------------------------------
+      auto snapshot() -> failure_stats;
+      auto reset() -> void;
 
-      /// \brief Constructs the value type from \p args
-      ///
-      /// \note This is an implementation detail only meant to be used during
-      ///       construction
-      ///
-      /// \pre there is no contained value or error at the time of construction
-      ///
-      /// \param args the arguments to forward to T's constructor
-      template <typename...Args>
-      auto construct_value(Args&&...args)
-        noexcept(std::is_nothrow_constructible<T,Args...>::value) -> void;
+    private:
 
-      /// \brief Constructs the error type from \p args
-      ///
-      /// \note This is an implementation detail only meant to be used during
-      ///       construction
-      ///
-      /// \pre there is no contained value or error at the time of construction
-      ///
-      /// \param args the arguments to forward to E's constructor
-      template <typename...Args>
-      auto construct_error(Args&&...args)
-        noexcept(std::is_nothrow_constructible<E,Args...>::value) -> void;
+      static auto merge(failure_stats& stats,
+                        const failure_stats_table& table) -> void;
+      static auto merge(failure_stats& stats,
+                        const failure_count& count,
+                        bool subtract) -> void;
 
-      /// \brief Constructs the underlying error from the \p other result
-      ///
-      /// If \p other contains a value, then the T type will be
-      /// default-constructed.
-      ///
-      /// \note This is an implementation detail only meant to be used during
-      ///       construction of `result<void, E>` types
-      ///
-      /// \pre there is no contained value or error at the time of construction
-      ///
-      /// \param other the other result to construct
-      template <typename Result>
-      auto construct_error_from_result(Result&& other) -> void;
+      auto collect() -> failure_stats;
 
-      /// \brief Constructs the underlying type from a result object
-      ///
-      /// \note This is an implementation detail only meant to be used during
-      ///       construction
-      ///
-      /// \pre there is no contained value or error at the time of construction
-      ///
-      /// \param other the other result to construct
-      template <typename Result>
-      auto construct_from_result(Result&& other) -> void;
+      std::mutex m_mutex;
+      failure_stats_table* m_tables = nullptr;
+      failure_stats m_exited;
+      failure_stats m_baseline;
+    };
 
-      //-----------------------------------------------------------------------
+    /// \brief Records a failure of type \p E from the location \p where,
+    ///        unless this is being evaluated as a constant expression
+    ///
+    /// \return `true`
+    template <typename E>
+    constexpr auto record_failure(source_location where) noexcept -> bool;
 
-      template <typename Value>
-      auto assign_value(Value&& value)
-        noexcept(std::is_nothrow_assignable<T, Value>::value) -> void;
+    /// \brief Records a failure of \p type from the location \p where in
+    ///        the calling thread's table
+    ///
+    /// \return `true`
+    auto record_failure(const void* type,
+                        const char* signature,
+                        source_location where) noexcept -> bool;
 
-      template <typename Error>
-      auto assign_error(Error&& error)
-        noexcept(std::is_nothrow_assignable<E, Error>::value) -> void;
+#endif // defined(RESULT_ENABLE_STATS)
 
-      template <typename Result>
-      auto assign_from_result(Result&& other) -> void;
+    /// \brief Gets the `in_place_error` tag for constructing an error of type
+    ///        \p E, recording the failure if `RESULT_ENABLE_STATS` is defined
+    template <typename E>
+    constexpr auto recorded_in_place_error() noexcept -> in_place_error_t;
 
-      //-----------------------------------------------------------------------
+  } // namespace detail
 
-      template <typename ReferenceWrapper>
-      auto construct_value_from_result_impl(std::true_type, ReferenceWrapper&& reference)
-        noexcept -> void;
+#if defined(RESULT_ENABLE_TRACE)
 
-      template <typename Value>
-      auto construct_value_from_result_impl(std::false_type, Value&& value)
-        noexcept(std::is_nothrow_constructible<T,Value>::value) -> void;
+  //===========================================================================
+  // class : failure_trace_entry
+  //===========================================================================
 
-      template <typename Result>
-      auto assign_value_from_result_impl(std::true_type, Result&& other) -> void;
+  /////////////////////////////////////////////////////////////////////////////
+  /// \brief A failure that was recorded in a `failure_trace`
+  ///
+  /// The error itself is only kept if it is trivially copyable and fits in
+  /// `RESULT_TRACE_PAYLOAD_SIZE` bytes; otherwise only its type is known.
+  /////////////////////////////////////////////////////////////////////////////
+  class failure_trace_entry
+  {
+    //-------------------------------------------------------------------------
+    // Observers
+    //-------------------------------------------------------------------------
+  public:
 
-      template <typename Result>
-      auto assign_value_from_result_impl(std::false_type, Result&& other) -> void;
+    /// \brief Gets the time the failure was recorded at, in ticks of the time
+    ///        stamp counter where one is available
+    auto timestamp() const noexcept -> std::uint64_t;
 
-      //-----------------------------------------------------------------------
-      // Public Members
-      //-----------------------------------------------------------------------
+    /// \brief Gets the location the failure was converted into a `result` at,
+    ///        or an empty location if it is unknown
+    auto where() const noexcept -> source_location;
 
-      using storage_type = result_union<T, E>;
+    /// \brief Checks whether the error of the result is of type \p E
+    ///
+    /// \tparam E the type of the error
+    /// \return `true` if the error is of type \p E
+    template <typename E>
+    auto is() const noexcept -> bool;
 
-      storage_type storage;
-    };
+    /// \brief Gets a pointer to the recorded error, if it is of type \p E and
+    ///        was kept
+    ///
+    /// \tparam E the type of the error
+    /// \return a pointer to the error, or `nullptr`
+    template <typename E>
+    auto error_if() const noexcept -> const E*;
 
-    //=========================================================================
-    // class : result_trivial_copy_ctor_base
-    //=========================================================================
+    /// \brief Gets the name of the error type, as spelled by the compiler
+    ///
+    /// \note Unlike the other observers, this allocates, and so may not be
+    ///       used from a signal handler
+    auto error_type() const -> std::string;
 
-    template <typename T, typename E>
-    struct result_trivial_copy_ctor_base_impl : result_construct_base<T,E>
-    {
-      using base_type = result_construct_base<T,E>;
-      using base_type::base_type;
+    //-------------------------------------------------------------------------
+    // Private Members
+    //-------------------------------------------------------------------------
+  private:
 
-      result_trivial_copy_ctor_base_impl(const result_trivial_copy_ctor_base_impl& other)
-        noexcept(std::is_nothrow_copy_constructible<T>::value &&
-                 std::is_nothrow_copy_constructible<E>::value);
-      result_trivial_copy_ctor_base_impl(result_trivial_copy_ctor_base_impl&& other) = default;
+    std::uint64_t m_timestamp = 0u;
+    source_location m_where;
+    const void* m_type = nullptr;
+    const char* m_signature = "";
+    std::size_t m_payload_size = 0u;
+    alignas(std::max_align_t) unsigned char m_payload[RESULT_TRACE_PAYLOAD_SIZE] = {};
 
-      auto operator=(const result_trivial_copy_ctor_base_impl& other) -> result_trivial_copy_ctor_base_impl& = default;
-      auto operator=(result_trivial_copy_ctor_base_impl&& other) -> result_trivial_copy_ctor_base_impl& = default;
-    };
+    friend class failure_trace;
+  };
 
-    template <bool Condition, typename Base>
-    using conditionally_nest_type = typename std::conditional<
-      Condition,
-      typename Base::base_type,
-      Base
-    >::type;
+  //===========================================================================
+  // class : failure_trace
+  //===========================================================================
 
-    template <typename T, typename E>
-    using result_trivial_copy_ctor_base = conditionally_nest_type<
-      std::is_trivially_copy_constructible<T>::value &&
-      std::is_trivially_copy_constructible<E>::value,
-      result_trivial_copy_ctor_base_impl<T,E>
-    >;
+  /////////////////////////////////////////////////////////////////////////////
+  /// \brief A ring buffer of the most recent failures of a thread
+  ///
+  /// Each time a `failure` is converted into a `result` -- by construction
+  /// or assignment -- an entry is written to the calling thread's trace.
+  /// Writing is wait-free and never allocates, since every thread's trace is
+  /// a fixed array of `RESULT_TRACE_BUFFER_SIZE` entries in thread-local
+  /// storage. The trace only holds `RESULT_TRACE_BUFFER_SIZE - 1` entries, so
+  /// that the entry being written is never one that is read.
+  ///
+  /// A trace may be read by its own thread, including from a signal handler
+  /// that interrupted a write, or from a debugger as
+  /// `cpp::bitwizeshift::failure_trace::local()::trace`. It may not be read
+  /// from other threads while its thread is running.
+  ///
+  /// ### Examples
+  ///
+  /// Basic Usage:
+  ///
+  /// ```cpp
+  /// void on_signal(int)
+  /// {
+  ///   cpp::failure_trace_entry entries[RESULT_TRACE_BUFFER_SIZE];
+  ///   const auto n = cpp::failure_trace::local().copy(entries, RESULT_TRACE_BUFFER_SIZE);
+  ///
+  ///   for (auto i = 0u; i < n; ++i) {
+  ///     write_entry(entries[i]); // e.g. formatted with 'write(2)'
+  ///   }
+  /// }
+  /// ```
+  /////////////////////////////////////////////////////////////////////////////
+  class failure_trace
+  {
+    //-------------------------------------------------------------------------
+    // Static Functions
+    //-------------------------------------------------------------------------
+  public:
 
-    //=========================================================================
-    // class : result_trivial_move_ctor_base
-    //=========================================================================
+    /// \brief Gets the trace of the calling thread
+    static auto local() noexcept -> failure_trace&;
 
-    template <typename T, typename E>
-    struct result_trivial_move_ctor_base_impl : result_trivial_copy_ctor_base<T,E>
-    {
-      using base_type = result_trivial_copy_ctor_base<T,E>;
-      using base_type::base_type;
+    /// \brief Gets the number of entries a trace can hold
+    static constexpr auto capacity() noexcept -> std::size_t;
 
-      result_trivial_move_ctor_base_impl(const result_trivial_move_ctor_base_impl& other) = default;
-      result_trivial_move_ctor_base_impl(result_trivial_move_ctor_base_impl&& other)
-        noexcept(std::is_nothrow_move_constructible<T>::value &&
-                 std::is_nothrow_move_constructible<E>::value);
+    //-------------------------------------------------------------------------
+    // Observers
+    //-------------------------------------------------------------------------
+  public:
 
-      auto operator=(const result_trivial_move_ctor_base_impl& other) -> result_trivial_move_ctor_base_impl& = default;
-      auto operator=(result_trivial_move_ctor_base_impl&& other) -> result_trivial_move_ctor_base_impl& = default;
-    };
+    /// \brief Gets the number of entries currently held
+    auto size() const noexcept -> std::size_t;
 
-    template <typename T, typename E>
-    using result_trivial_move_ctor_base = conditionally_nest_type<
-      std::is_trivially_move_constructible<T>::value &&
-      std::is_trivially_move_constructible<E>::value,
-      result_trivial_move_ctor_base_impl<T,E>
-    >;
+    /// \brief Copies the most recent entries into \p out, oldest first
+    ///
+    /// \param out the entries to copy into
+    /// \param count the number of entries \p out can hold
+    /// \return the number of entries copied
+    auto copy(failure_trace_entry* out, std::size_t count) const noexcept
+      -> std::size_t;
 
-    //=========================================================================
-    // class : result_trivial_copy_assign_base
-    //=========================================================================
+    //-------------------------------------------------------------------------
+    // Modifiers
+    //-------------------------------------------------------------------------
+  public:
 
-    template <typename T, typename E>
-    struct result_trivial_copy_assign_base_impl
-      : result_trivial_move_ctor_base<T, E>
-    {
-      using base_type = result_trivial_move_ctor_base<T,E>;
-      using base_type::base_type;
+    /// \brief Discards all entries
+    auto clear() noexcept -> void;
 
-      result_trivial_copy_assign_base_impl(const result_trivial_copy_assign_base_impl& other) = default;
-      result_trivial_copy_assign_base_impl(result_trivial_copy_assign_base_impl&& other) = default;
+    /// \brief Records a failure of \p type at the location \p where
+    ///
+    /// \param type the unique identifier of the error type
+    /// \param signature the signature that the name of the type is read from
+    /// \param where the location of the conversion
+    /// \param payload the bytes of the error, or `nullptr`
+    /// \param size the number of bytes in \p payload
+    auto record(const void* type,
+                const char* signature,
+                source_location where,
+                const void* payload,
+                std::size_t size) noexcept -> void;
 
-      auto operator=(const result_trivial_copy_assign_base_impl& other)
-        noexcept(std::is_nothrow_copy_constructible<T>::value &&
-                 std::is_nothrow_copy_constructible<E>::value &&
-                 std::is_nothrow_copy_assignable<T>::value &&
-                 std::is_nothrow_copy_assignable<E>::value)
-        -> result_trivial_copy_assign_base_impl&;
-      auto operator=(result_trivial_copy_assign_base_impl&& other)
-        -> result_trivial_copy_assign_base_impl& = default;
-    };
+    //-------------------------------------------------------------------------
+    // Private Members
+    //-------------------------------------------------------------------------
+  private:
 
-    template <typename T, typename E>
-    using result_trivial_copy_assign_base = conditionally_nest_type<
-      std::is_trivially_copy_constructible<T>::value &&
-      std::is_trivially_copy_constructible<E>::value &&
-      std::is_trivially_copy_assignable<T>::value &&
-      std::is_trivially_copy_assignable<E>::value &&
-      std::is_trivially_destructible<T>::value &&
-      std::is_trivially_destructible<E>::value,
-      result_trivial_copy_assign_base_impl<T,E>
-    >;
+    failure_trace_entry m_entries[RESULT_TRACE_BUFFER_SIZE];
+    std::atomic<std::uint64_t> m_written{0u};
+    std::atomic<std::uint64_t> m_cleared{0u};
+  };
 
-    //=========================================================================
-    // class : result_trivial_move_assign_base
-    //=========================================================================
+  namespace detail {
 
-    template <typename T, typename E>
-    struct result_trivial_move_assign_base_impl
-      : result_trivial_copy_assign_base<T, E>
-    {
-      using base_type = result_trivial_copy_assign_base<T,E>;
-      using base_type::base_type;
+    /// \brief Reads the time stamp counter, or a steady clock where there is
+    ///        no counter
+    auto trace_timestamp() noexcept -> std::uint64_t;
 
-      result_trivial_move_assign_base_impl(const result_trivial_move_assign_base_impl& other) = default;
-      result_trivial_move_assign_base_impl(result_trivial_move_assign_base_impl&& other) = default;
+    /// \brief Records the conversion of \p error into a `result` with error
+    ///        type \p E at the location \p where, unless this is being
+    ///        evaluated as a constant expression
+    ///
+    /// \return `true`
+    template <typename E, typename E2>
+    constexpr auto trace_failure(const E2& error, source_location where) noexcept -> bool;
 
-      auto operator=(const result_trivial_move_assign_base_impl& other)
-        -> result_trivial_move_assign_base_impl& = default;
-      auto operator=(result_trivial_move_assign_base_impl&& other)
-        noexcept(std::is_nothrow_move_constructible<T>::value &&
-                 std::is_nothrow_move_constructible<E>::value &&
-                 std::is_nothrow_move_assignable<T>::value &&
-                 std::is_nothrow_move_assignable<E>::value)
-        -> result_trivial_move_assign_base_impl&;
-    };
+    /// \{
+    /// \brief Records \p error, keeping it as the payload only if it is kept
+    ///        by value
+    template <typename E, typename E2>
+    auto trace_failure(std::true_type, const E2& error, source_location where) noexcept -> bool;
+    template <typename E, typename E2>
+    auto trace_failure(std::false_type, const E2& error, source_location where) noexcept -> bool;
+    /// \}
 
-    template <typename T, typename E>
-    using result_trivial_move_assign_base = conditionally_nest_type<
-      std::is_trivially_move_constructible<T>::value &&
-      std::is_trivially_move_constructible<E>::value &&
-      std::is_trivially_move_assignable<T>::value &&
-      std::is_trivially_move_assignable<E>::value &&
-      std::is_trivially_destructible<T>::value &&
-      std::is_trivially_destructible<E>::value,
-      result_trivial_move_assign_base_impl<T,E>
+    /// \brief Determines whether an \p E2 converted into an \p E is kept as
+    ///        the payload of a `failure_trace_entry`
+    template <typename E, typename E2>
+    using is_trace_payload = std::integral_constant<bool,
+      std::is_same<E, E2>::value &&
+      std::is_trivially_copyable<E>::value &&
+      sizeof(E) <= RESULT_TRACE_PAYLOAD_SIZE &&
+      alignof(E) <= alignof(std::max_align_t)
     >;
 
-    //=========================================================================
-    // class : disable_copy_ctor
-    //=========================================================================
 
-    template <typename T, typename E>
-    struct disable_copy_ctor : result_trivial_move_assign_base<T,E>
-    {
-      using base_type = result_trivial_move_assign_base<T,E>;
-      using base_type::base_type;
+    /// \brief Gets the `in_place_error` tag for constructing an error of type
+    ///        \p E from \p error, tracing its conversion from a `failure` at
+    ///        the location \p where
+    template <typename E, typename E2>
+    constexpr auto traced_in_place_error(const E2& error, source_location where)
+      noexcept -> in_place_error_t;
 
-      disable_copy_ctor(const disable_copy_ctor& other) = delete;
-      disable_copy_ctor(disable_copy_ctor&& other) = default;
+  } // namespace detail
 
-      auto operator=(const disable_copy_ctor& other)
-        -> disable_copy_ctor& = default;
-      auto operator=(disable_copy_ctor&& other)
-        -> disable_copy_ctor& = default;
-    };
+#endif // defined(RESULT_ENABLE_TRACE)
 
-    template <typename T, typename E>
-    using result_copy_ctor_base = conditionally_nest_type<
-      std::is_copy_constructible<T>::value &&
-      std::is_copy_constructible<E>::value,
-      disable_copy_ctor<T,E>
-    >;
+#if !defined(RESULT_DISABLE_EXCEPTIONS)
 
-    //=========================================================================
-    // class : disable_move_ctor
-    //=========================================================================
+  namespace detail {
 
-    template <typename T, typename E>
-    struct disable_move_ctor : result_copy_ctor_base<T,E>
-    {
-      using base_type = result_copy_ctor_base<T,E>;
-      using base_type::base_type;
+#if defined(RESULT_NONALLOCATING_BAD_RESULT_ACCESS)
 
-      disable_move_ctor(const disable_move_ctor& other) = default;
-      disable_move_ctor(disable_move_ctor&& other) = delete;
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief The base of `bad_result_access` that stores its message in a
+    ///        fixed inline buffer, rather than allocating it
+    ///
+    /// Messages longer than `RESULT_BAD_RESULT_ACCESS_MESSAGE_SIZE - 1`
+    /// characters are truncated.
+    ///////////////////////////////////////////////////////////////////////////
+    class bad_result_access_base : public std::exception
+    {
+    public:
 
-      auto operator=(const disable_move_ctor& other)
-        -> disable_move_ctor& = default;
-      auto operator=(disable_move_ctor&& other)
-        -> disable_move_ctor& = default;
-    };
+      explicit bad_result_access_base(const char* what_arg) noexcept;
+      explicit bad_result_access_base(const std::string& what_arg) noexcept;
 
-    template <typename T, typename E>
-    using result_move_ctor_base = conditionally_nest_type<
-      std::is_move_constructible<T>::value &&
-      std::is_move_constructible<E>::value,
-      disable_move_ctor<T,E>
-    >;
+      auto what() const noexcept -> const char* override;
 
-    //=========================================================================
-    // class : disable_move_assignment
-    //=========================================================================
+    private:
 
-    template <typename T, typename E>
-    struct disable_move_assignment
-      : result_move_ctor_base<T, E>
-    {
-      using base_type = result_move_ctor_base<T, E>;
-      using base_type::base_type;
+      char m_what[RESULT_BAD_RESULT_ACCESS_MESSAGE_SIZE];
+    };
 
-      disable_move_assignment(const disable_move_assignment& other) = default;
-      disable_move_assignment(disable_move_assignment&& other) = default;
+#else
 
-      auto operator=(const disable_move_assignment& other)
-        -> disable_move_assignment& = delete;
-      auto operator=(disable_move_assignment&& other)
-        -> disable_move_assignment& = default;
-    };
+    using bad_result_access_base = std::logic_error;
 
-    template <typename T, typename E>
-    using result_copy_assign_base = conditionally_nest_type<
-      std::is_nothrow_copy_constructible<T>::value &&
-      std::is_nothrow_copy_constructible<E>::value &&
-      std::is_copy_assignable<wrapped_result_type<T>>::value &&
-      std::is_copy_assignable<E>::value,
-      disable_move_assignment<T,E>
-    >;
+#endif
 
-    //=========================================================================
-    // class : disable_copy_assignment
-    //=========================================================================
+  } // namespace detail
 
-    template <typename T, typename E>
-    struct disable_copy_assignment
-      : result_copy_assign_base<T, E>
-    {
-      using base_type = result_copy_assign_base<T, E>;
-      using base_type::base_type;
+  //===========================================================================
+  // class : bad_result_access<E>
+  //===========================================================================
 
-      disable_copy_assignment(const disable_copy_assignment& other) = default;
-      disable_copy_assignment(disable_copy_assignment&& other) = default;
+  /////////////////////////////////////////////////////////////////////////////
+  /// \brief An exception thrown when result::value is accessed without
+  ///        a contained value
+  ///
+  /// This derives from `std::logic_error`, unless
+  /// `RESULT_NONALLOCATING_BAD_RESULT_ACCESS` is defined -- in which case it
+  /// derives from `std::exception` and stores its message in a fixed inline
+  /// buffer, so that constructing it never allocates.
+  /////////////////////////////////////////////////////////////////////////////
+  template <typename E>
+  class bad_result_access : public detail::bad_result_access_base
+  {
+    //-------------------------------------------------------------------------
+    // Constructor / Assignment
+    //-------------------------------------------------------------------------
+  public:
 
-      auto operator=(const disable_copy_assignment& other)
-        -> disable_copy_assignment& = default;
-      auto operator=(disable_copy_assignment&& other)
-        -> disable_copy_assignment& = delete;
-    };
+    /// \brief Constructs this exception using the underlying error type for
+    ///        the error type
+    ///
+    /// \param error the underlying error
+    template <typename E2,
+              typename = typename std::enable_if<std::is_constructible<E,E2>::value>::type>
+    explicit bad_result_access(E2&& error);
 
-    template <typename T, typename E>
-    using result_move_assign_base = conditionally_nest_type<
-      std::is_nothrow_move_constructible<T>::value &&
-      std::is_nothrow_move_constructible<E>::value &&
-      std::is_move_assignable<wrapped_result_type<T>>::value &&
-      std::is_move_assignable<E>::value,
-      disable_copy_assignment<T,E>
-    >;
+    /// \{
+    /// \brief Constructs this exception using the underlying error type for
+    ///        the error and a message
+    ///
+    /// \param what_arg the message for the failure
+    /// \param error the underlying error
+    template <typename E2,
+              typename = typename std::enable_if<std::is_constructible<E,E2>::value>::type>
+    bad_result_access(const char* what_arg, E2&& error);
+    template <typename E2,
+              typename = typename std::enable_if<std::is_constructible<E,E2>::value>::type>
+    bad_result_access(const std::string& what_arg, E2&& error);
+    /// \}
 
-    //=========================================================================
-    // alias : result_storage
-    //=========================================================================
+    bad_result_access(const bad_result_access& other) = default;
+    bad_result_access(bad_result_access&& other) = default;
 
-    template <typename T, typename E>
-    using result_storage = result_move_assign_base<T, E>;
+    //-------------------------------------------------------------------------
 
-    //=========================================================================
-    // traits : result
-    //=========================================================================
+    auto operator=(const bad_result_access& other) -> bad_result_access& = default;
+    auto operator=(bad_result_access&& other) -> bad_result_access& = default;
 
-    template <typename T1, typename E1, typename T2, typename E2>
-    using result_is_convertible = std::integral_constant<bool,(
-      // T1 constructible from result<T2,E2>
-      std::is_constructible<T1, result<T2,E2>&>:: value ||
-      std::is_constructible<T1, const result<T2,E2>&>:: value ||
-      std::is_constructible<T1, result<T2,E2>&&>:: value ||
-      std::is_constructible<T1, const result<T2,E2>&&>:: value ||
+    /// \{
+    /// \brief Gets the underlying error
+    ///
+    /// \return the error
+    auto error() & noexcept -> E&;
+    auto error() && noexcept -> E&&;
+    auto error() const & noexcept -> const E&;
+    auto error() const && noexcept -> const E&&;
+    /// \}
 
-      // E1 constructible from result<T2,E2>
-      std::is_constructible<E1, result<T2,E2>&>:: value ||
-      std::is_constructible<E1, const result<T2,E2>&>:: value ||
-      std::is_constructible<E1, result<T2,E2>&&>:: value ||
-      std::is_constructible<E1, const result<T2,E2>&&>:: value ||
+    //-------------------------------------------------------------------------
+    // Private Members
+    //-------------------------------------------------------------------------
+  private:
 
-      // result<T2,E2> convertible to T1
-      std::is_convertible<result<T2,E2>&, T1>:: value ||
-      std::is_convertible<const result<T2,E2>&, T1>:: value ||
-      std::is_convertible<result<T2,E2>&&, T1>::value ||
-      std::is_convertible<const result<T2,E2>&&, T1>::value ||
+    E m_error;
+  };
 
-      // result<T2,E2> convertible to E2
-      std::is_convertible<result<T2,E2>&, E1>:: value ||
-      std::is_convertible<const result<T2,E2>&, E1>:: value ||
-      std::is_convertible<result<T2,E2>&&, E1>::value ||
-      std::is_convertible<const result<T2,E2>&&, E1>::value
-    )>;
+#endif
 
-    //-------------------------------------------------------------------------
+  namespace detail {
 
-    template <typename T1, typename E1, typename T2, typename E2>
-    using result_is_copy_convertible = std::integral_constant<bool,(
-      !result_is_convertible<T1,E1,T2,E2>::value &&
-      std::is_constructible<T1, const T2&>::value &&
-      std::is_constructible<E1, const E2&>::value
+    template <typename E, typename E2>
+    using failure_is_value_convertible = std::integral_constant<bool,(
+      std::is_constructible<E, E2&&>::value &&
+      !std::is_same<typename std::decay<E2>::type, in_place_t>::value &&
+      !is_failure<typename std::decay<E2>::type>::value &&
+      !is_result<typename std::decay<E2>::type>::value
     )>;
 
-    template <typename T1, typename E1, typename T2, typename E2>
-    using result_is_implicit_copy_convertible = std::integral_constant<bool,(
-      result_is_copy_convertible<T1,E1,T2,E2>::value &&
-      std::is_convertible<const T2&, T1>::value &&
-      std::is_convertible<const E2&, E1>::value
+    template <typename E, typename E2>
+    using failure_is_explicit_value_convertible = std::integral_constant<bool,(
+      failure_is_value_convertible<E, E2>::value &&
+      !std::is_convertible<E2, E>::value
     )>;
 
-    template <typename T1, typename E1, typename T2, typename E2>
-    using result_is_explicit_copy_convertible = std::integral_constant<bool,(
-      result_is_copy_convertible<T1,E1,T2,E2>::value &&
-      (!std::is_convertible<const T2&, T1>::value ||
-       !std::is_convertible<const E2&, E1>::value)
+    template <typename E, typename E2>
+    using failure_is_implicit_value_convertible = std::integral_constant<bool,(
+      failure_is_value_convertible<E, E2>::value &&
+      std::is_convertible<E2, E>::value
     )>;
 
-    //-------------------------------------------------------------------------
-
-    template <typename T1, typename E1, typename T2, typename E2>
-    using result_is_move_convertible = std::integral_constant<bool,(
-      !result_is_convertible<T1,E1,T2,E2>::value &&
-      std::is_constructible<T1, T2&&>::value &&
-      std::is_constructible<E1, E2&&>::value
+    template <typename E, typename E2>
+    using failure_is_value_assignable = std::integral_constant<bool,(
+      !is_result<typename std::decay<E2>::type>::value &&
+      !is_failure<typename std::decay<E2>::type>::value &&
+      std::is_assignable<wrapped_result_type<E>&,E2>::value
     )>;
 
-    template <typename T1, typename E1, typename T2, typename E2>
-    using result_is_implicit_move_convertible = std::integral_constant<bool,(
-      result_is_move_convertible<T1,E1,T2,E2>::value &&
-      std::is_convertible<T2&&, T1>::value &&
-      std::is_convertible<E2&&, E1>::value
-    )>;
+  } // namespace detail
 
-    template <typename T1, typename E1, typename T2, typename E2>
-    using result_is_explicit_move_convertible = std::integral_constant<bool,(
-      result_is_move_convertible<T1,E1,T2,E2>::value &&
-      (!std::is_convertible<T2&&, T1>::value ||
-       !std::is_convertible<E2&&, E1>::value)
-    )>;
-
-    //-------------------------------------------------------------------------
-
-    template <typename T, typename U>
-    using result_is_value_convertible = std::integral_constant<bool,(
-      std::is_constructible<T, U&&>::value &&
-      !std::is_same<typename std::decay<U>::type, in_place_t>::value &&
-      !std::is_same<typename std::decay<U>::type, in_place_error_t>::value &&
-      !is_result<typename std::decay<U>::type>::value
-    )>;
-
-    template <typename T, typename U>
-    using result_is_explicit_value_convertible = std::integral_constant<bool,(
-      result_is_value_convertible<T, U>::value &&
-      !std::is_convertible<U&&, T>::value
-    )>;
-
-    template <typename T, typename U>
-    using result_is_implicit_value_convertible = std::integral_constant<bool,(
-      result_is_value_convertible<T, U>::value &&
-      std::is_convertible<U&&, T>::value
-    )>;
-
-    //-------------------------------------------------------------------------
-
-    template <typename T1, typename E1, typename T2, typename E2>
-    using result_is_convert_assignable = std::integral_constant<bool,(
-      result_is_convertible<T1,E1,T2,E2>::value &&
-
-      std::is_assignable<T1&, result<T2,E2>&>::value &&
-      std::is_assignable<T1&, const result<T2,E2>&>::value &&
-      std::is_assignable<T1&, result<T2,E2>&&>::value &&
-      std::is_assignable<T1&, const result<T2,E2>&&>::value &&
-
-      std::is_assignable<E1&, result<T2,E2>&>::value &&
-      std::is_assignable<E1&, const result<T2,E2>&>::value &&
-      std::is_assignable<E1&, result<T2,E2>&&>::value &&
-      std::is_assignable<E1&, const result<T2,E2>&&>::value
-    )>;
-
-    template <typename T1, typename E1, typename T2, typename E2>
-    using result_is_copy_convert_assignable = std::integral_constant<bool,(
-      !result_is_convert_assignable<T1,E1,T2,E2>::value &&
-
-      std::is_nothrow_constructible<T1, const T2&>::value &&
-      std::is_assignable<wrapped_result_type<T1>&, const T2&>::value &&
-      std::is_nothrow_constructible<E1, const E2&>::value &&
-      std::is_assignable<E1&, const E2&>::value
-    )>;
-
-    template <typename T1, typename E1, typename T2, typename E2>
-    using result_is_move_convert_assignable = std::integral_constant<bool,(
-      !result_is_convert_assignable<T1,E1,T2,E2>::value &&
-
-      std::is_nothrow_constructible<T1, T2&&>::value &&
-      std::is_assignable<T1&, T2&&>::value &&
-      std::is_nothrow_constructible<E1, E2&&>::value &&
-      std::is_assignable<E1&, E2&&>::value
-    )>;
-
-    //-------------------------------------------------------------------------
-
-    template <typename T, typename U>
-    using result_is_value_assignable = std::integral_constant<bool,(
-      !is_result<typename std::decay<U>::type>::value &&
-      !is_failure<typename std::decay<U>::type>::value &&
-      std::is_nothrow_constructible<T,U>::value &&
-      std::is_assignable<wrapped_result_type<T>&,U>::value &&
-      (
-        !std::is_same<typename std::decay<U>::type,typename std::decay<T>::type>::value ||
-        !std::is_scalar<T>::value
-      )
-    )>;
-
-    template <typename E, typename E2>
-    using result_is_failure_assignable = std::integral_constant<bool,(
-      std::is_nothrow_constructible<E,E2>::value &&
-      std::is_assignable<E&,E2>::value
-    )>;
-
-    // Friending 'extract_error" below was causing some compilers to incorrectly
-    // identify `exp.m_storage.m_error` as being an access violation despite the
-    // friendship. Using a type name instead seems to be ubiquitous across
-    // compilers
-    struct result_error_extractor
-    {
-      template <typename T, typename E>
-      static constexpr auto get(const result<T,E>& exp) noexcept -> const E&;
-      template <typename T, typename E>
-      static constexpr auto get(result<T,E>& exp) noexcept -> E&;
-    };
-
-    template <typename T, typename E>
-    constexpr auto extract_error(const result<T,E>& exp) noexcept -> const E&;
-
-    template <typename E>
-    [[noreturn]]
-    auto throw_bad_result_access(E&& error) -> void;
-
-    template <typename String, typename E>
-    [[noreturn]]
-    auto throw_bad_result_access_message(String&& message, E&& error) -> void;
-
-  } // namespace detail
+  //===========================================================================
+  // class : failure_type
+  //===========================================================================
 
-  /////////////////////////////////////////////////////////////////////////////
-  /// \brief The class template `result` manages result results from APIs,
-  ///        while encoding possible failure conditions.
-  ///
-  /// A common use-case for result is the return value of a function that
-  /// may fail. As opposed to other approaches, such as `std::pair<T,bool>`
-  /// or `std::optional`, `result` more accurately conveys the intent of the
-  /// user along with the failure condition to the caller. This effectively
-  /// produces an orthogonal error handling mechanism that allows for exception
-  /// safety while also allowing discrete testability of the return type.
-  ///
-  /// `result<T,E>` types may contain a `T` value, which signifies that an
-  /// operation succeeded in producing the result value of type `T`. If an
-  /// `result` does not contain a `T` value, it will always contain an `E`
-  /// error condition instead.
-  ///
-  /// An `result<T,E>` can always be queried for a possible error case by
-  /// calling the `error()` function, even if it contains a value.
-  /// In the case that a `result<T,E>` contains a value object, this will
-  /// simply return an `E` object constructed through default aggregate
-  /// construction, as if through the expression `E{}`, which is assumed to be
-  /// a "valid" (no-error) state for an `E` type.
-  /// For example:
-  ///
-  /// * `std::error_code{}` produces a default-construct error-code, which is
-  ///   the "no error" state,
-  /// * integral (or enum) error codes produce a `0` value (no error), thanks to
-  ///   zero-initialization,
-  /// * `std::exception_ptr{}` produces a null-pointer,
-  /// * `std::string{}` produces an empty string `""`,
-  /// * etc.
-  ///
-  /// When a `result<T,E>` contains either a value or error, the storage for
-  /// that object is guaranteed to be allocated as part of the result
-  /// object's footprint, i.e. no dynamic memory allocation ever takes place.
-  /// Thus, a result object models an object, not a pointer, even though the
-  /// `operator*()` and `operator->()` are defined.
-  ///
-  /// When an object of type `result<T,E>` is contextually converted to
-  /// `bool`, the conversion returns `true` if the object contains a value and
-  /// `false` if it contains an error.
-  ///
-  /// `result` objects do not have a "valueless" state like `variant`s do.
-  /// Once a `result` has been constructed with a value or error, the
-  /// active underlying type can only be changed through assignment which may
-  /// is only enabled if construction is guaranteed to be *non-throwing*. This
-  /// ensures that a valueless state cannot occur naturally.
-  ///
-  /// Example Use:
-  /// \code
-  /// auto to_string(int x) -> result<std::string>
-  /// {
-  ///   try {
-  ///     return std::stoi(x);
-  ///   } catch (const std::invalid_argument&) {
-  ///     return fail(std::errc::invalid_argument);
-  ///   } catch (const std::std::out_of_range&) {
-  ///     return fail(std::errc::result_out_of_range);
-  ///   }
-  /// }
-  /// \endcode
-  ///
-  /// \note If using C++17 or above, `fail` can be replaced with
-  ///       `failure{...}` thanks to CTAD.
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief A semantic type used for distinguishing failure values in an
+  ///        API that returns result types
   ///
-  /// \tparam T the underlying value type
-  /// \tparam E the underlying error type
-  ///////////////////////////////////////////////////////////////////////////
-  template <typename T, typename E>
-  class RESULT_NODISCARD result
+  /// \tparam E the error type
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename E>
+  class failure
   {
-    // Type requirements
-
-    static_assert(
-      !std::is_abstract<T>::value,
-      "It is ill-formed for T to be abstract type"
-    );
-    static_assert(
-      !std::is_same<typename std::decay<T>::type, in_place_t>::value,
-      "It is ill-formed for T to be a (possibly CV-qualified) in_place_t type"
-    );
-    static_assert(
-      !is_result<typename std::decay<T>::type>::value,
-      "It is ill-formed for T to be a (possibly CV-qualified) 'result' type"
-    );
-    static_assert(
-      !is_failure<typename std::decay<T>::type>::value,
-      "It is ill-formed for T to be a (possibly CV-qualified) 'failure' type"
-    );
-    static_assert(
-      !std::is_rvalue_reference<T>::value,
-      "It is ill-formed for T to be an rvalue 'result type. "
-      "Only lvalue references are valid."
-    );
-
-    static_assert(
-      !std::is_abstract<E>::value,
-      "It is ill-formed for E to be abstract type"
-    );
-    static_assert(
-      !std::is_void<typename std::decay<E>::type>::value,
-      "It is ill-formed for E to be (possibly CV-qualified) void type"
-    );
     static_assert(
       !is_result<typename std::decay<E>::type>::value,
-      "It is ill-formed for E to be a (possibly CV-qualified) 'result' type"
+      "A (possibly CV-qualified) result 'E' type is ill-formed."
     );
     static_assert(
       !is_failure<typename std::decay<E>::type>::value,
-      "It is ill-formed for E to be a (possibly CV-qualified) 'failure' type"
+      "A (possibly CV-qualified) failure 'E' type is ill-formed."
     );
     static_assert(
-      !std::is_same<typename std::decay<E>::type, in_place_t>::value,
-      "It is ill-formed for E to be a (possibly CV-qualified) in_place_t type"
+      !std::is_void<typename std::decay<E>::type>::value,
+      "A (possibly CV-qualified) 'void' 'E' type is ill-formed."
     );
     static_assert(
-      !std::is_reference<E>::value,
-      "It is ill-formed for E to be a reference type. "
-      "Only T types may be lvalue references"
+      !std::is_rvalue_reference<E>::value,
+      "rvalue references for 'E' type is ill-formed. "
+      "Only lvalue references are valid."
     );
 
-    // Friendship
-
-    friend detail::result_error_extractor;
-
-    template <typename T2, typename E2>
-    friend class result;
-
     //-------------------------------------------------------------------------
     // Public Member Types
     //-------------------------------------------------------------------------
   public:
 
-    using value_type = T; ///< The value type of this result
-    using error_type = E; ///< The error type of this result
-    using failure_type = failure<E>; ///< The failure type
-
-    template <typename U>
-    using rebind = result<U,E>; ///< Rebinds the result type
+    using error_type = E;
 
     //-------------------------------------------------------------------------
-    // Constructor / Destructor / Assignment
+    // Constructors / Assignment
     //-------------------------------------------------------------------------
   public:
 
-    /// \brief Default-constructs a result with the underlying value type
-    ///        active
-    ///
-    /// This constructor is only enabled if `T` is default-constructible
+    /// \brief Constructs a failure via default construction
+    failure() = default;
+
+    /// \brief Constructs a failure by delegating construction to the
+    ///        underlying constructor
     ///
-    /// ### Examples
+    /// \param args the arguments to forward to E's constructor
+    template <typename...Args,
+              typename = typename std::enable_if<std::is_constructible<E,Args...>::value>::type>
+    constexpr failure(in_place_t, Args&&...args)
+      noexcept(std::is_nothrow_constructible<E, Args...>::value);
+
+    /// \brief Constructs a failure by delegating construction to the
+    ///        underlying constructor
     ///
-    /// Basic Usage:
-    ///
-    /// ```cpp
-    /// assert(cpp::result<std::string,int>{} == std::string{});
-    /// ```
-    template <typename U=T,
-              typename = typename std::enable_if<std::is_constructible<U>::value>::type>
-    constexpr result()
-      noexcept(std::is_nothrow_constructible<U>::value);
+    /// \param ilist the initializer list
+    /// \param args the arguments to forward to E's constructor
+    template <typename U, typename...Args,
+              typename = typename std::enable_if<std::is_constructible<E,std::initializer_list<U>,Args...>::value>::type>
+    constexpr failure(in_place_t, std::initializer_list<U> ilist, Args&&...args)
+      noexcept(std::is_nothrow_constructible<E, std::initializer_list<U>, Args...>::value);
 
-    /// \brief Copy constructs this result
-    ///
-    /// If \p other contains a value, initializes the contained value as if
-    /// direct-initializing (but not direct-list-initializing) an object of
-    /// type `T` with the expression *other.
-    ///
-    /// If other contains an error, constructs an object that contains a copy
-    /// of that error.
-    ///
-    /// \note This constructor is defined as deleted if
-    ///       `std::is_copy_constructible<T>::value` or
-    ///       `std::is_copy_constructible<E>::value` is `false`
-    ///
-    /// \note This constructor is defined as trivial if both
-    ///       `std::is_trivially_copy_constructible<T>::value` and
-    ///       `std::is_trivially_copy_constructible<E>::value` are `true`
-    ///
-    /// ### Examples
-    ///
-    /// Basic Usage:
-    ///
-    /// ```cpp
-    /// const auto r = cpp::result<int,int>{42};
-    /// const auto s = r;
-    ///
-    /// assert(r == s);
-    /// ```
+    /// \{
+    /// \brief Constructs a failure from the given error
     ///
-    /// \param other the result to copy
-    constexpr result(const result& other) = default;
+    /// \param error the error to create a failure from
+    template <typename E2,
+              typename std::enable_if<detail::failure_is_implicit_value_convertible<E,E2>::value,int>::type = 0>
+    constexpr failure(E2&& error)
+      noexcept(std::is_nothrow_constructible<E,E2>::value);
+    template <typename E2,
+              typename std::enable_if<detail::failure_is_explicit_value_convertible<E,E2>::value,int>::type = 0>
+    constexpr explicit failure(E2&& error)
+      noexcept(std::is_nothrow_constructible<E,E2>::value);
+    /// \}
 
-    /// \brief Move constructs a result
-    ///
-    /// If other contains a value, initializes the contained value as if
-    /// direct-initializing (but not direct-list-initializing) an object
-    /// of type T with the expression `std::move(*other)` and does not make
-    /// other empty: a moved-from result still contains a value, but the
-    /// value itself is moved from.
-    ///
-    /// If other contains an error, move-constructs this result from that
-    /// error.
-    ///
-    /// \note This constructor is defined as deleted if
-    ///       `std::is_move_constructible<T>::value` or
-    ///       `std::is_move_constructible<E>::value` is `false`
-    ///
-    /// \note This constructor is defined as trivial if both
-    ///       `std::is_trivially_move_constructible<T>::value` and
-    ///       `std::is_trivially_move_constructible<E>::value` are `true`
-    ///
-    /// ### Examples
-    ///
-    /// Basic Usage:
-    ///
-    /// ```cpp
-    /// auto r = cpp::result<std::string,int>{"hello world"};
-    /// auto s = std::move(r);
-    ///
-    /// assert(s == "hello world");
-    /// ```
+    /// \brief Constructs this failure by copying the contents of an existing
+    ///        one
     ///
-    /// \param other the result to move
-    constexpr result(result&& other) = default;
+    /// \param other the other failure to copy
+    /* implicit */ failure(const failure& other) = default;
 
-    /// \{
-    /// \brief Converting copy constructor
-    ///
-    /// If \p other contains a value, constructs a result object
-    /// that contains a value, initialized as if direct-initializing
-    /// (but not direct-list-initializing) an object of type `T` with the
-    /// expression `*other`.
+    /// \brief Constructs this failure by moving the contents of an existing
+    ///        one
     ///
-    /// If \p other contains an error, constructs a result object that
-    /// contains an error, initialized as if direct-initializing
-    /// (but not direct-list-initializing) an object of type `E`.
+    /// \param other the other failure to move
+    /* implicit */ failure(failure&& other) = default;
+
+    /// \brief Constructs this failure by copy-converting \p other
     ///
-    /// \note This constructor does not participate in overload resolution
-    ///       unless the following conditions are met:
-    ///       - `std::is_constructible_v<T, const U&>` is `true`
-    ///       - T is not constructible or convertible from any expression
-    ///         of type (possibly const) `result<T2,E2>`
-    ///       - E is not constructible or convertible from any expression
-    ///         of type (possible const) `result<T2,E2>`
+    /// \param other the other failure to copy
+    template <typename E2,
+              typename = typename std::enable_if<std::is_constructible<E,const E2&>::value>::type>
+    constexpr /* implicit */ failure(const failure<E2>& other)
+      noexcept(std::is_nothrow_constructible<E,const E2&>::value);
+
+    /// \brief Constructs this failure by move-converting \p other
     ///
-    /// \note This constructor is explicit if and only if
-    ///       `std::is_convertible_v<const T2&, T>` or
-    ///       `std::is_convertible_v<const E2&, E>` is `false`
+    /// \param other the other failure to copy
+    template <typename E2,
+              typename = typename std::enable_if<std::is_constructible<E,E2&&>::value>::type>
+    constexpr /* implicit */ failure(failure<E2>&& other)
+      noexcept(std::is_nothrow_constructible<E,E2&&>::value);
+
+    //--------------------------------------------------------------------------
+
+    /// \brief Assigns the value of \p error to this failure through
+    ///        move-assignment
     ///
-    /// ### Examples
+    /// \param error the value to assign
+    /// \return reference to `(*this)`
+    template <typename E2,
+              typename = typename std::enable_if<detail::failure_is_value_assignable<E,E2>::value>::type>
+    RESULT_CPP14_CONSTEXPR
+    auto operator=(E2&& error)
+      noexcept(std::is_nothrow_assignable<E,E2>::value || std::is_lvalue_reference<E>::value) -> failure&;
+
+    /// \brief Assigns the contents of \p other to this by copy-assignment
     ///
-    /// Basic Usage:
+    /// \param other the other failure to copy
+    /// \return reference to `(*this)`
+    auto operator=(const failure& other) -> failure& = default;
+
+    /// \brief Assigns the contents of \p other to this by move-assignment
     ///
-    /// ```cpp
-    /// const auto r = cpp::result<int,int>{42};
-    /// const auto s = cpp::result<long,long>{r};
+    /// \param other the other failure to move
+    /// \return reference to `(*this)`
+    auto operator=(failure&& other) -> failure& = default;
+
+    /// \brief Assigns the contents of \p other to this by copy conversion
     ///
-    /// assert(r == s);
-    /// ```
+    /// \param other the other failure to copy-convert
+    /// \return reference to `(*this)`
+    template <typename E2,
+              typename = typename std::enable_if<std::is_assignable<E&,const E2&>::value>::type>
+    RESULT_CPP14_CONSTEXPR
+    auto operator=(const failure<E2>& other)
+      noexcept(std::is_nothrow_assignable<E,const E2&>::value) -> failure&;
+
+    /// \brief Assigns the contents of \p other to this by move conversion
     ///
-    /// \param other the other type to convert
-    template <typename T2, typename E2,
-              typename std::enable_if<detail::result_is_implicit_copy_convertible<T,E,T2,E2>::value,int>::type = 0>
-    result(const result<T2,E2>& other)
-      noexcept(std::is_nothrow_constructible<T,const T2&>::value &&
-               std::is_nothrow_constructible<E,const E2&>::value);
-    template <typename T2, typename E2,
-              typename std::enable_if<detail::result_is_explicit_copy_convertible<T,E,T2,E2>::value,int>::type = 0>
-    explicit result(const result<T2,E2>& other)
-      noexcept(std::is_nothrow_constructible<T,const T2&>::value &&
-               std::is_nothrow_constructible<E,const E2&>::value);
-    /// \}
+    /// \param other the other failure to move-convert
+    /// \return reference to `(*this)`
+    template <typename E2,
+              typename = typename std::enable_if<std::is_assignable<E&,E2&&>::value>::type>
+    RESULT_CPP14_CONSTEXPR
+    auto operator=(failure<E2>&& other)
+      noexcept(std::is_nothrow_assignable<E,E2&&>::value) -> failure&;
+
+    //--------------------------------------------------------------------------
+    // Observers
+    //--------------------------------------------------------------------------
+  public:
 
     /// \{
-    /// \brief Converting move constructor
-    ///
-    /// If \p other contains a value, constructs a result object
-    /// that contains a value, initialized as if direct-initializing
-    /// (but not direct-list-initializing) an object of type T with the
-    /// expression `std::move(*other)`.
-    ///
-    /// If \p other contains an error, constructs a result object that
-    /// contains an error, initialized as if direct-initializing
-    /// (but not direct-list-initializing) an object of type E&&.
-    ///
-    /// \note This constructor does not participate in overload resolution
-    ///       unless the following conditions are met:
-    ///       - `std::is_constructible_v<T, const U&>` is `true`
-    ///       - T is not constructible or convertible from any expression
-    ///         of type (possibly const) `result<T2,E2>`
-    ///       - E is not constructible or convertible from any expression
-    ///         of type (possible const) `result<T2,E2>`
-    ///
-    /// \note This constructor is explicit if and only if
-    ///       `std::is_convertible_v<const T2&, T>` or
-    ///       `std::is_convertible_v<const E2&, E>` is `false`
-    ///
-    /// ### Examples
-    ///
-    /// Basic Usage:
-    ///
-    /// ```cpp
-    /// auto r = cpp::result<std::unique_ptr<Derived>,int>{
-    ///   std::make_unique<Derived>()
-    /// };
-    /// const auto s = cpp::result<std::unique_ptr<Base>,long>{
-    ///   std::move(r)
-    /// };
-    /// ```
+    /// \brief Gets the underlying error
     ///
-    /// \param other the other type to convert
-    template <typename T2, typename E2,
-              typename std::enable_if<detail::result_is_implicit_move_convertible<T,E,T2,E2>::value,int>::type = 0>
-    result(result<T2,E2>&& other)
-      noexcept(std::is_nothrow_constructible<T,T2&&>::value &&
-               std::is_nothrow_constructible<E,E2&&>::value);
-    template <typename T2, typename E2,
-              typename std::enable_if<detail::result_is_explicit_move_convertible<T,E,T2,E2>::value,int>::type = 0>
-    explicit result(result<T2,E2>&& other)
-      noexcept(std::is_nothrow_constructible<T,T2&&>::value &&
-               std::is_nothrow_constructible<E,E2&&>::value);
+    /// \return the underlying error
+    RESULT_CPP14_CONSTEXPR
+    auto error() & noexcept
+      -> typename std::add_lvalue_reference<E>::type;
+    RESULT_CPP14_CONSTEXPR
+    auto error() && noexcept
+      -> typename std::add_rvalue_reference<E>::type;
+    constexpr auto error() const & noexcept
+      -> typename std::add_lvalue_reference<typename std::add_const<E>::type>::type;
+    constexpr auto error() const && noexcept
+      -> typename std::add_rvalue_reference<typename std::add_const<E>::type>::type;
     /// \}
 
     //-------------------------------------------------------------------------
+    // Private Member Types
+    //-------------------------------------------------------------------------
+  private:
 
-    /// \brief Constructs a result object that contains a value
-    ///
-    /// The value is initialized as if direct-initializing (but not
-    /// direct-list-initializing) an object of type `T` from the arguments
-    /// `std::forward<Args>(args)...`
-    ///
-    /// ### Examples
-    ///
-    /// Basic Usage:
-    ///
-    /// ```cpp
-    /// auto r = cpp::result<std::string,int>{
-    ///   cpp::in_place, "Hello world"
-    /// };
-    /// ```
-    ///
-    /// \param args the arguments to pass to T's constructor
-    template <typename...Args,
-              typename = typename std::enable_if<std::is_constructible<T,Args...>::value>::type>
-    constexpr explicit result(in_place_t, Args&&... args)
-      noexcept(std::is_nothrow_constructible<T, Args...>::value);
-
-    /// \brief Constructs a result object that contains a value
-    ///
-    /// The value is initialized as if direct-initializing (but not
-    /// direct-list-initializing) an object of type `T` from the arguments
-    /// `std::forward<std::initializer_list<U>>(ilist)`,
-    /// `std::forward<Args>(args)...`
-    ///
-    /// ### Examples
-    ///
-    /// Basic Usage:
-    ///
-    /// ```cpp
-    /// auto r = cpp::result<std::string,int>{
-    ///   cpp::in_place, {'H','e','l','l','o'}
-    /// };
-    /// ```
-    ///
-    /// \param ilist An initializer list of entries to forward
-    /// \param args  the arguments to pass to T's constructor
-    template <typename U, typename...Args,
-              typename = typename std::enable_if<std::is_constructible<T, std::initializer_list<U>&, Args...>::value>::type>
-    constexpr explicit result(in_place_t,
-                              std::initializer_list<U> ilist,
-                              Args&&...args)
-      noexcept(std::is_nothrow_constructible<T, std::initializer_list<U>, Args...>::value);
+    using underlying_type = detail::wrapped_result_type<E>;
 
     //-------------------------------------------------------------------------
+    // Private Members
+    //-------------------------------------------------------------------------
+  private:
 
-    /// \brief Constructs a result object that contains an error
-    ///
-    /// the value is initialized as if direct-initializing (but not
-    /// direct-list-initializing) an object of type `E` from the arguments
-    /// `std::forward<Args>(args)...`
-    ///
-    /// ### Examples
-    ///
-    /// Basic Usage:
-    ///
-    /// ```cpp
-    /// auto r = cpp::result<int,std::string>{
-    ///   cpp::in_place_error, "Hello world"
-    /// };
-    /// ```
-    ///
-    /// \param args the arguments to pass to E's constructor
-    template <typename...Args,
-              typename = typename std::enable_if<std::is_constructible<E,Args...>::value>::type>
-    constexpr explicit result(in_place_error_t, Args&&... args)
-      noexcept(std::is_nothrow_constructible<E, Args...>::value);
+    underlying_type m_failure;
+  };
 
-    /// \brief Constructs a result object that contains an error
-    ///
-    /// The value is initialized as if direct-initializing (but not
-    /// direct-list-initializing) an object of type `E` from the arguments
-    /// `std::forward<std::initializer_list<U>>(ilist)`,
-    /// `std::forward<Args>(args)...`
-    ///
-    /// ### Examples
-    ///
-    /// Basic Usage:
-    ///
-    /// ```cpp
-    /// auto r = cpp::result<int,std::string>{
-    ///   cpp::in_place_error, {'H','e','l','l','o'}
-    /// };
-    /// ```
-    ///
-    /// \param ilist An initializer list of entries to forward
-    /// \param args  the arguments to pass to Es constructor
-    template <typename U, typename...Args,
-              typename = typename std::enable_if<std::is_constructible<E, std::initializer_list<U>&, Args...>::value>::type>
-    constexpr explicit result(in_place_error_t,
-                              std::initializer_list<U> ilist,
-                              Args&&...args)
-      noexcept(std::is_nothrow_constructible<E, std::initializer_list<U>, Args...>::value);
+#if __cplusplus >= 201703L
+  template <typename T>
+  failure(std::reference_wrapper<T>) -> failure<T&>;
 
-    //-------------------------------------------------------------------------
+  template <typename T>
+  failure(T&&) -> failure<typename std::decay<T>::type>;
+#endif
 
-    /// \{
-    /// \brief Constructs the underlying error of this result
-    ///
-    /// \note This constructor only participates in overload resolution if
-    ///       `E` is constructible from \p e
-    ///
-    /// ### Examples
-    ///
-    /// Basic Usage:
-    ///
-    /// ```cpp
-    /// cpp::result<int,int> r = cpp::fail(42);
-    ///
-    /// auto get_error_result() -> cpp::result<int,std::string> {
-    ///   return cpp::fail("hello world!");
-    /// }
-    /// ```
-    ///
-    /// \param e the failure error
-    template <typename E2,
-              typename = typename std::enable_if<std::is_constructible<E,const E2&>::value>::type>
-    constexpr /* implicit */ result(const failure<E2>& e)
-      noexcept(std::is_nothrow_constructible<E,const E2&>::value);
-    template <typename E2,
-              typename = typename std::enable_if<std::is_constructible<E,E2&&>::value>::type>
-    constexpr /* implicit */ result(failure<E2>&& e)
-      noexcept(std::is_nothrow_constructible<E,E2&&>::value);
-    /// \}
+  //===========================================================================
+  // non-member functions : class : failure
+  //===========================================================================
 
-    /// \{
-    /// \brief Constructs a result object that contains a value
-    ///
-    /// The value is initialized as if direct-initializing (but not
-    /// direct-list-initializing) an object of type T with the expression
-    /// value.
-    ///
-    /// \note This constructor is constexpr if the constructor of T
-    ///       selected by direct-initialization is constexpr
-    ///
-    /// \note This constructor does not participate in overload
-    ///       resolution unless `std::is_constructible_v<T, U&&>` is true
-    ///       and `decay_t<U>` is neither `in_place_t`, `in_place_error_t`,
-    ///       nor a `result` type.
-    ///
-    /// \note This constructor is explicit if and only if
-    ///       `std::is_convertible_v<U&&, T>` is `false`
-    ///
-    /// ### Examples
-    ///
-    /// Basic Usage:
-    ///
-    /// ```cpp
-    /// cpp::result<int,int> r = 42;
-    ///
-    /// auto get_value() -> cpp::result<std::string,int> {
-    ///   return "hello world!"; // implicit conversion
-    /// }
-    /// ```
-    ///
-    /// \param value the value to copy
-    template <typename U,
-              typename std::enable_if<detail::result_is_explicit_value_convertible<T,U>::value,int>::type = 0>
-    constexpr explicit result(U&& value)
-      noexcept(std::is_nothrow_constructible<T,U>::value);
-    template <typename U,
-              typename std::enable_if<detail::result_is_implicit_value_convertible<T,U>::value,int>::type = 0>
-    constexpr /* implicit */ result(U&& value)
-      noexcept(std::is_nothrow_constructible<T,U>::value);
-    /// \}
+  //---------------------------------------------------------------------------
+  // Comparison
+  //---------------------------------------------------------------------------
 
-    //-------------------------------------------------------------------------
+  template <typename E1, typename E2>
+  constexpr auto operator==(const failure<E1>& lhs,
+                            const failure<E2>& rhs) noexcept -> bool;
+  template <typename E1, typename E2>
+  constexpr auto operator!=(const failure<E1>& lhs,
+                            const failure<E2>& rhs) noexcept -> bool;
+  template <typename E1, typename E2>
+  constexpr auto operator<(const failure<E1>& lhs,
+                           const failure<E2>& rhs) noexcept -> bool;
+  template <typename E1, typename E2>
+  constexpr auto operator>(const failure<E1>& lhs,
+                           const failure<E2>& rhs) noexcept -> bool;
+  template <typename E1, typename E2>
+  constexpr auto operator<=(const failure<E1>& lhs,
+                            const failure<E2>& rhs) noexcept -> bool;
+  template <typename E1, typename E2>
+  constexpr auto operator>=(const failure<E1>& lhs,
+                            const failure<E2>& rhs) noexcept -> bool;
 
-    /// \brief Copy assigns the result stored in \p other
-    ///
-    /// \note This assignment operator only participates in overload resolution
-    ///       if the following conditions are met:
-    ///       - `std::is_nothrow_copy_constructible_v<T>` is `true`, and
-    ///       - `std::is_nothrow_copy_constructible_v<E>` is `true`
-    ///       this restriction guarantees that no '
-    ///
-    /// \note This assignment operator is defined as trivial if the following
-    ///       conditions are all `true`:
-    ///       - `std::is_trivially_copy_constructible<T>::value`
-    ///       - `std::is_trivially_copy_constructible<E>::value`
-    ///       - `std::is_trivially_copy_assignable<T>::value`
-    ///       - `std::is_trivially_copy_assignable<E>::value`
-    ///       - `std::is_trivially_destructible<T>::value`
-    ///       - `std::is_trivially_destructible<E>::value`
-    ///
-    /// \param other the other result to copy
-    auto operator=(const result& other) -> result& = default;
+  //---------------------------------------------------------------------------
+  // Utilities
+  //---------------------------------------------------------------------------
 
-    /// \brief Move assigns the result stored in \p other
-    ///
-    /// \note This assignment operator only participates in overload resolution
-    ///       if the following conditions are met:
-    ///       - `std::is_nothrow_copy_constructible_v<T>` is `true`, and
-    ///       - `std::is_nothrow_copy_constructible_v<E>` is `true`
-    ///       this restriction guarantees that no 'valueless_by_exception` state
-    ///       may occur.
-    ///
-    /// \note This assignment operator is defined as trivial if the following
-    ///       conditions are all `true`:
-    ///       - `std::is_trivially_move_constructible<T>::value`
-    ///       - `std::is_trivially_move_constructible<E>::value`
-    ///       - `std::is_trivially_move_assignable<T>::value`
-    ///       - `std::is_trivially_move_assignable<E>::value`
-    ///       - `std::is_trivially_destructible<T>::value`
-    ///       - `std::is_trivially_destructible<E>::value`
-    ///
-    /// \param other the other result to copy
-    auto operator=(result&& other) -> result& = default;
+  /// \brief Deduces and constructs a failure type from \p e
+  ///
+  /// If `RESULT_ENABLE_STATS` is defined, the failure is counted along with
+  /// the location \p where it was made.
+  ///
+  /// \param e the failure value
+  /// \param where the location of the caller
+  /// \return a constructed failure value
+  template <typename E>
+  RESULT_WARN_UNUSED
+#if defined(RESULT_ENABLE_STATS)
+  constexpr auto fail(E&& e, source_location where = source_location::current())
+#else
+  constexpr auto fail(E&& e)
+#endif
+    noexcept(std::is_nothrow_constructible<typename std::decay<E>::type,E>::value)
+    -> failure<typename std::decay<E>::type>;
 
-    /// \brief Copy-converts the state of \p other
-    ///
-    /// If both `*this` and \p other contain either values or errors, the
-    /// underlying value is constructed as if through assignment.
-    ///
-    /// Otherwise if `*this` contains a value, but \p other contains an error,
-    /// then the contained value is destroyed by calling its destructor. `*this`
-    /// will no longer contain a value after the call, and will now contain `E`
-    /// constructed as if direct-initializing (but not direct-list-initializing)
-    /// an object with an argument of `const E2&`.
-    ///
-    /// If \p other contains a value and `*this` contains an error, then the
-    /// contained error is destroyed by calling its destructor. `*this` now
-    /// contains a value constructed as if direct-initializing (but not
-    /// direct-list-initializing) an object with an argument of `const T2&`.
-    ///
-    /// \note The function does not participate in overload resolution unless
-    ///       - `std::is_nothrow_constructible_v<T, const T2&>`,
-    ///         `std::is_assignable_v<T&, const T2&>`,
-    ///         `std::is_nothrow_constructible_v<E, const E2&>`,
-    ///         `std::is_assignable_v<E&, const E2&>` are all true.
-    ///       - T is not constructible, convertible, or assignable from any
-    ///         expression of type (possibly const) `result<T2,E2>`
-    ///
-    /// \param other the other result object to convert
-    /// \return reference to `(*this)`
-    template <typename T2, typename E2,
-              typename = typename std::enable_if<detail::result_is_copy_convert_assignable<T,E,T2,E2>::value>::type>
-    auto operator=(const result<T2,E2>& other)
-      noexcept(std::is_nothrow_assignable<T,const T2&>::value &&
-               std::is_nothrow_assignable<E,const E2&>::value) -> result&;
+  /// \brief Deduces a failure reference from a reverence_wrapper
+  ///
+  /// If `RESULT_ENABLE_STATS` is defined, the failure is counted along with
+  /// the location \p where it was made.
+  ///
+  /// \param e the failure value
+  /// \param where the location of the caller
+  /// \return a constructed failure reference
+  template <typename E>
+  RESULT_WARN_UNUSED
+#if defined(RESULT_ENABLE_STATS)
+  constexpr auto fail(std::reference_wrapper<E> e,
+                      source_location where = source_location::current())
+#else
+  constexpr auto fail(std::reference_wrapper<E> e)
+#endif
+    noexcept -> failure<E&>;
 
-    /// \brief Move-converts the state of \p other
-    ///
-    /// If both `*this` and \p other contain either values or errors, the
-    /// underlying value is constructed as if through move-assignment.
-    ///
-    /// Otherwise if `*this` contains a value, but \p other contains an error,
-    /// then the contained value is destroyed by calling its destructor. `*this`
-    /// will no longer contain a value after the call, and will now contain `E`
-    /// constructed as if direct-initializing (but not direct-list-initializing)
-    /// an object with an argument of `E2&&`.
-    ///
-    /// If \p other contains a value and `*this` contains an error, then the
-    /// contained error is destroyed by calling its destructor. `*this` now
-    /// contains a value constructed as if direct-initializing (but not
-    /// direct-list-initializing) an object with an argument of `T2&&`.
-    ///
-    /// \note The function does not participate in overload resolution unless
-    ///       - `std::is_nothrow_constructible_v<T, T2&&>`,
-    ///         `std::is_assignable_v<T&, T2&&>`,
-    ///         `std::is_nothrow_constructible_v<E, E2&&>`,
-    ///         `std::is_assignable_v<E&, E2&&>` are all true.
-    ///       - T is not constructible, convertible, or assignable from any
-    ///         expression of type (possibly const) `result<T2,E2>`
-    ///
-    /// \param other the other result object to convert
-    /// \return reference to `(*this)`
-    template <typename T2, typename E2,
-              typename = typename std::enable_if<detail::result_is_move_convert_assignable<T,E,T2,E2>::value>::type>
-    auto operator=(result<T2,E2>&& other)
-      noexcept(std::is_nothrow_assignable<T,T2&&>::value &&
-               std::is_nothrow_assignable<E,E2&&>::value) -> result&;
+  /// \brief Constructs a failure type from a series of arguments
+  ///
+  /// \tparam E the failure type
+  /// \param args the arguments to forward to E's constructor
+  /// \return a constructed failure type
+  template <typename E, typename...Args,
+            typename = typename std::enable_if<std::is_constructible<E,Args...>::value>::type>
+  RESULT_WARN_UNUSED
+  constexpr auto fail(Args&&...args)
+    noexcept(std::is_nothrow_constructible<E, Args...>::value)
+    -> failure<E>;
 
-    /// \brief Perfect-forwarded assignment
-    ///
-    /// Depending on whether `*this` contains a value before the call, the
-    /// contained value is either direct-initialized from std::forward<U>(value)
-    /// or assigned from std::forward<U>(value).
-    ///
-    /// \note The function does not participate in overload resolution unless
-    ///       - `std::decay_t<U>` is not a result type,
-    ///       - `std::decay_t<U>` is not a failure type
-    ///       - `std::is_nothrow_constructible_v<T, U>` is `true`
-    ///       - `std::is_assignable_v<T&, U>` is `true`
-    ///       - and at least one of the following is `true`:
-    ///           - `T` is not a scalar type;
-    ///           - `std::decay_t<U>` is not `T`.
-    ///
-    /// \param value to assign to the contained value
-    /// \return reference to `(*this)`
-    template <typename U,
-              typename = typename std::enable_if<detail::result_is_value_assignable<T,U>::value>::type>
-    auto operator=(U&& value)
-      noexcept(std::is_nothrow_assignable<T,U>::value) -> result&;
+  /// \brief Constructs a failure type from an initializer list and series of
+  ///        arguments
+  ///
+  /// \tparam E the failure type
+  /// \param args the arguments to forward to E's constructor
+  /// \return a constructed failure type
+  template <typename E, typename U, typename...Args,
+            typename = typename std::enable_if<std::is_constructible<E,std::initializer_list<U>,Args...>::value>::type>
+  RESULT_WARN_UNUSED
+  constexpr auto fail(std::initializer_list<U> ilist, Args&&...args)
+    noexcept(std::is_nothrow_constructible<E, std::initializer_list<U>, Args...>::value)
+    -> failure<E>;
 
-    /// \{
-    /// \brief Perfect-forwarded assignment
-    ///
-    /// Depending on whether `*this` contains an error before the call, the
-    /// contained error is either direct-initialized via forwarding the error,
-    /// or assigned from forwarding the error
-    ///
-    /// \note The function does not participate in overload resolution unless
-    ///       - `std::is_nothrow_constructible_v<E, E2>` is `true`, and
-    ///       - `std::is_assignable_v<E&, E2>` is `true`
-    ///
-    /// \param other the failure value to assign to this
-    /// \return reference to `(*this)`
-    template <typename E2,
-              typename = typename std::enable_if<detail::result_is_failure_assignable<E,const E2&>::value>::type>
-    auto operator=(const failure<E2>& other)
-      noexcept(std::is_nothrow_assignable<E, const E2&>::value) -> result&;
-    template <typename E2,
-              typename = typename std::enable_if<detail::result_is_failure_assignable<E,E2&&>::value>::type>
-    auto operator=(failure<E2>&& other)
-      noexcept(std::is_nothrow_assignable<E, E2&&>::value) -> result&;
-    /// \}
+  /// \brief Swaps the contents of two failure values
+  ///
+  /// \param lhs the left failure
+  /// \param rhs the right failure
+  template <typename E>
+  auto swap(failure<E>& lhs, failure<E>& rhs)
+#if __cplusplus >= 201703L
+    noexcept(std::is_nothrow_swappable<E>::value) -> void;
+#else
+    noexcept(std::is_nothrow_move_constructible<E>::value) -> void;
+#endif
 
-    //-------------------------------------------------------------------------
-    // Observers
-    //-------------------------------------------------------------------------
-  public:
+  namespace detail {
 
-    /// \{
-    /// \brief Retrieves a pointer to the contained value
-    ///
-    /// This operator exists to give `result` an `optional`-like API for cases
-    /// where it's known that the `result` already contains a value.
-    ///
-    /// Care must be taken to ensure that this is only used in safe contexts
-    /// where a `T` value is active.
-    ///
-    /// \note The behavior is undefined if `*this` does not contain a value.
-    ///
-    /// ### Examples
-    ///
-    /// Basic Usage:
-    ///
-    /// ```cpp
-    /// auto r = cpp::result<Widget,int>{
-    ///   make_widget()
-    /// };
-    ///
-    /// r->do_something();
-    /// ```
-    ///
-    /// \return a pointer to the contained value
-    RESULT_WARN_UNUSED
-    RESULT_CPP14_CONSTEXPR auto operator->()
-      noexcept -> typename std::remove_reference<T>::type*;
-    RESULT_WARN_UNUSED
-    constexpr auto operator->()
-      const noexcept -> typename std::remove_reference<typename std::add_const<T>::type>::type*;
-    /// \}
+    //=========================================================================
+    // class : unit
+    //=========================================================================
 
-    /// \{
-    /// \brief Retrieves a reference to the contained value
-    ///
-    /// This operator exists to give `result` an `optional`-like API for cases
-    /// where it's known that the `result` already contains a value.
-    ///
-    /// Care must be taken to ensure that this is only used in safe contexts
-    /// where a `T` value is active.
-    ///
-    /// \note The behaviour is undefined if `*this` does not contain a value
-    ///
-    /// ### Examples
-    ///
-    /// Basic Usage:
-    ///
-    /// ```cpp
-    /// auto r = cpp::result<Widget,int>{
-    ///   make_widget()
-    /// };
-    ///
-    /// (*r).do_something();
-    ///
-    /// consume(*r);
-    /// ```
-    ///
-    /// \return a reference to the contained value
-    RESULT_WARN_UNUSED
-    RESULT_CPP14_CONSTEXPR auto operator*()
-      & noexcept -> typename std::add_lvalue_reference<T>::type;
-    RESULT_WARN_UNUSED
-    RESULT_CPP14_CONSTEXPR auto operator*()
-      && noexcept -> typename std::add_rvalue_reference<T>::type;
-    RESULT_WARN_UNUSED
-    constexpr auto operator*()
-      const& noexcept -> typename std::add_lvalue_reference<typename std::add_const<T>::type>::type;
-    RESULT_WARN_UNUSED
-    constexpr auto operator*()
-      const&& noexcept -> typename std::add_rvalue_reference<typename std::add_const<T>::type>::type;
-    /// \}
+    /// \brief A standalone monostate object (effectively std::monostate). This
+    ///        exists to allow for `void` specializations
+    struct unit {};
 
-    //-------------------------------------------------------------------------
+    //=========================================================================
+    // class : propagated_error_t
+    //=========================================================================
 
-    /// \brief Contextually convertible to `true` if `*this` contains a value
-    ///
-    /// This function exists to allow for simple, terse checks for containing
-    /// a value.
-    ///
-    /// ### Examples
-    ///
-    /// Basic Usage:
-    ///
-    /// ```cpp
-    /// auto get_result() -> cpp::result<int, int>;
-    /// auto r = get_result();
-    /// if (r) { ... }
-    ///
-    /// assert(static_cast<bool>(cpp::result<int,int>{42}));
+    /// \brief A tag for constructing the error of a result from an error of
+    ///        another result, which is not counted as a new failure when
+    ///        `RESULT_ENABLE_STATS` is defined
+    struct propagated_error_t
+    {
+      explicit propagated_error_t() = default;
+    };
+
+    RESULT_CPP17_INLINE constexpr auto propagated_error = propagated_error_t{};
+
+    //=========================================================================
+    // non-member functions : class : unit
+    //=========================================================================
+
+    constexpr auto operator==(unit, unit) noexcept -> bool { return true; }
+    constexpr auto operator!=(unit, unit) noexcept -> bool { return false; }
+    constexpr auto operator<(unit, unit) noexcept -> bool { return false; }
+    constexpr auto operator>(unit, unit) noexcept -> bool { return false; }
+    constexpr auto operator<=(unit, unit) noexcept -> bool { return true; }
+    constexpr auto operator>=(unit, unit) noexcept -> bool { return true; }
+
+    //=========================================================================
+    // class : detail::result_union<T, E, IsTrivial>
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A basic utility that acts as a union containing the T and E
+    ///        types
     ///
-    /// assert(!static_cast<bool>(cpp::result<int,int>{cpp::fail(42)}));
-    /// ```
+    /// This is specialized on the case that both T and E are trivial, in which
+    /// case `result_union` is also trivial
     ///
-    /// \return `true` if `*this` contains a value, `false` if `*this`
-    ///         does not contain a value
-    RESULT_WARN_UNUSED
-    constexpr explicit operator bool() const noexcept;
+    /// \tparam T the value type result to be returned
+    /// \tparam E the error type returned on failure
+    /// \tparam IsTrivial Whether or not both T and E are trivial
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename E,
+              bool IsTrivial = std::is_trivially_destructible<T>::value &&
+                               std::is_trivially_destructible<E>::value>
+    struct result_union
+    {
+      //-----------------------------------------------------------------------
+      // Public Member Types
+      //-----------------------------------------------------------------------
 
-    /// \brief Returns `true` if `*this` contains a value
-    ///
-    /// ### Examples
-    ///
-    /// Basic Usage:
-    ///
-    /// ```cpp
-    /// auto get_result() -> cpp::result<int, int>;
-    /// auto r = get_result();
-    /// if (r.has_value()) { ... }
-    ///
-    /// assert(cpp::result<int,int>{42}.has_value());
-    ///
-    /// assert(!cpp::result<int,int>{cpp::fail(42)}.has_value());
-    /// ```
-    ///
-    /// \return `true` if `*this` contains a value, `false` if `*this`
-    ///         contains an error
-    RESULT_WARN_UNUSED
-    constexpr auto has_value() const noexcept -> bool;
+      using underlying_value_type = wrapped_result_type<T>;
+      using underlying_error_type = E;
+      using const_error_reference = const E&;
 
-    /// \brief Returns `true` if `*this` contains an error
-    ///
-    /// ### Examples
-    ///
-    /// Basic Usage:
-    ///
-    /// ```cpp
-    /// auto get_result() -> cpp::result<int, int>;
-    ///
-    /// auto r = get_result();
-    /// if (r.has_error()) { ... }
-    ///
-    /// assert(!cpp::result<int,int>{42}.has_error());
-    ///
-    /// assert(cpp::result<int,int>{cpp::fail(42)}.has_error());
-    /// ```
-    ///
-    /// \return `true` if `*this` contains an error, `false` if `*this`
-    ///          contains a value
-    RESULT_WARN_UNUSED
-    constexpr auto has_error() const noexcept -> bool;
+      //-----------------------------------------------------------------------
+      // Constructors / Assignment
+      //-----------------------------------------------------------------------
 
-    //-------------------------------------------------------------------------
+      /// \brief Constructs an empty object
+      ///
+      /// This is for use with conversion constructors, since it allows a
+      /// temporary unused object to be set
+      RESULT_CPP20_CONSTEXPR result_union(unit) noexcept;
 
-    /// \{
-    /// \brief Returns a reference to the contained value
-    ///
-    /// This function provides checked (throwing) access to the underlying
-    /// value. The constness and refness of this result is propagated to the
-    /// underlying reference.
-    ///
-    /// If this contains an error, an exception is thrown containing the
-    /// underlying error. The error is consumed propagating the same constness
-    /// and refness of this result.
-    ///
-    /// ### Examples
-    ///
-    /// Basic Usage:
-    ///
-    /// ```cpp
-    /// assert(cpp::result<int,int>{42}.value() == 42);
-    ///
-    /// auto r = cpp::result<std::unique_ptr<int>,int>{
-    ///   std::make_unique<int>(42)
-    /// };
-    /// auto s = std::move(r).value();
-    ///
-    /// try {
-    ///   auto r = cpp::result<int,int>{ cpp::fail(42) };
-    ///   auto v = r.value();
-    /// } catch (const cpp::bad_result_access<int>& e) {
-    ///   assert(e.error() == 42);
-    /// }
-    /// ```
-    ///
-    /// \throws bad_result_access<E> if `*this` does not contain a value.
-    ///
-    /// \return the value of `*this`
-    RESULT_WARN_UNUSED
-    RESULT_CPP14_CONSTEXPR auto value()
-      & -> typename std::add_lvalue_reference<T>::type;
-    RESULT_WARN_UNUSED
-    RESULT_CPP14_CONSTEXPR auto value()
-      && -> typename std::add_rvalue_reference<T>::type;
-    RESULT_WARN_UNUSED
-    constexpr auto value()
-      const & -> typename std::add_lvalue_reference<typename std::add_const<T>::type>::type;
-    RESULT_WARN_UNUSED
-    constexpr auto value()
-      const && -> typename std::add_rvalue_reference<typename std::add_const<T>::type>::type;
-    /// \}
+      /// \brief Constructs the underlying value from the specified \p args
+      ///
+      /// \param args the arguments to forward to T's constructor
+      template <typename...Args>
+      constexpr result_union(in_place_t, Args&&...args)
+        noexcept(std::is_nothrow_constructible<T, Args...>::value);
 
-    /// \{
-    /// \brief Returns the contained error, if one exists, or a
-    ///        default-constructed error value
-    ///
-    /// The `error()` function will not throw any exceptions if `E` does not
-    /// throw any exceptions for the copy or move construction.
-    ///
-    /// This is to limit the possible scope for exceptions, and to allow the
-    /// error type to be treated as a "status"-like type, where the
-    /// default-constructed case is considered the "good" state.
-    ///
-    /// If this function is invoked on an rvalue of a result, the error is
-    /// returned via move-construction
-    ///
-    /// ### Requires
-    ///
-    /// * `std::is_default_constructible<E>::value` is `true`
-    /// * `std::is_copy_constructible<E>::value` or
-    ///   `std::is_move_constructible<E>::value` is `true`
-    /// * `E{}` represents the "good" (non-error) state
-    ///
-    /// ### Examples
-    ///
-    /// Basic Usage:
-    ///
-    /// ```cpp
-    /// auto r = cpp::result<int,std::error_code>{ 42 };
-    /// assert(r.error() == std::error_code{});
-    ///
-    /// auto r = cpp::result<int,std::error_code>{
-    ///   cpp::fail(std::io_errc::stream)
-    /// };
-    ///
-    /// assert(r.error() == std::io_errc::stream);
-    /// ```
-    ///
-    /// \return the error or a default-constructed error value
-    RESULT_WARN_UNUSED
-    constexpr auto error() const &
-      noexcept(std::is_nothrow_constructible<E>::value &&
-               std::is_nothrow_copy_constructible<E>::value) -> E;
-    RESULT_WARN_UNUSED
-    RESULT_CPP14_CONSTEXPR auto error() &&
-      noexcept(std::is_nothrow_constructible<E>::value &&
-               std::is_nothrow_move_constructible<E>::value) -> E;
-    /// }
+      /// \brief Constructs the underlying error from the specified \p args
+      ///
+      /// \param args the arguments to forward to E's constructor
+      template <typename...Args>
+      constexpr result_union(in_place_error_t, Args&&...args)
+        noexcept(std::is_nothrow_constructible<E, Args...>::value);
 
-    /// \{
-    /// \brief Asserts an expectation that this result contains an error,
-    ///        throwing a bad_result_access on failure
-    ///
-    /// If this function is invoked from an rvalue of `result`, then this will
-    /// consume the underlying error first, if there is one.
-    ///
-    /// \note This function exists as a means to allow for results to be marked
-    ///       `used` without requiring directly inspecting the underlying value.
-    ///       This is, in effect, equivalent to `assert(res.has_value())`,
-    ///       however it uses exceptions to ensure the stack can be unwound, and
-    ///       exceptions invoked.
-    ///
-    /// ### Examples
-    ///
-    /// Basic Usage:
-    ///
-    /// ```cpp
-    /// auto start_service() -> cpp::result<void,int>;
-    ///
-    /// start_service().expect("Service failed to start!");
-    /// ```
-    ///
-    /// \param message the message to provide to this expectation
-    ///
-    /// \return the value of `*this`
-    template <typename String,
-            typename = typename std::enable_if<(
-                    std::is_convertible<String,const std::string&>::value &&
-                    std::is_copy_constructible<E>::value
-            )>::type>
-    RESULT_CPP14_CONSTEXPR auto expect(String&& message) & -> typename std::add_lvalue_reference<T>::type;
-    template <typename String,
-            typename = typename std::enable_if<(
-                    std::is_convertible<String,const std::string&>::value &&
-                    std::is_move_constructible<E>::value
-            )>::type>
-    RESULT_CPP14_CONSTEXPR auto expect(String&& message) && -> typename std::add_rvalue_reference<T>::type;
-    template <typename String,
-              typename = typename std::enable_if<(
-                std::is_convertible<String,const std::string&>::value &&
-                std::is_copy_constructible<E>::value
-              )>::type>
-    RESULT_CPP14_CONSTEXPR auto expect(String&& message) const & -> typename std::add_lvalue_reference<typename std::add_const<T>::type>::type;
-    template <typename String,
-            typename = typename std::enable_if<(
-                    std::is_convertible<String,const std::string&>::value &&
-                    std::is_copy_constructible<E>::value
-            )>::type>
-    RESULT_CPP14_CONSTEXPR auto expect(String&& message) const && -> typename std::add_rvalue_reference<typename std::add_const<T>::type>::type;
-    /// \}
+      result_union(const result_union&) = default;
+      result_union(result_union&&) = default;
 
-    //-------------------------------------------------------------------------
-    // Monadic Functionalities
-    //-------------------------------------------------------------------------
-  public:
+      //-----------------------------------------------------------------------
 
-    /// \{
-    /// \brief Returns the contained value if `*this` has a value,
-    ///        otherwise returns \p default_value.
-    ///
-    /// ### Examples
-    ///
-    /// Basic Usage:
-    ///
-    /// ```cpp
-    /// auto r = cpp::result<int,int>{42};
-    /// assert(r.value_or(0) == 42);
-    ///
-    /// auto r = cpp::result<int,int>{cpp::fail(42)};
-    /// assert(r.value_or(0) == 0);
-    /// ```
-    ///
-    /// \param default_value the value to use in case `*this` contains an error
-    /// \return the contained value or \p default_value
-    template <typename U>
-    RESULT_WARN_UNUSED
-    constexpr auto value_or(U&& default_value)
-      const & -> typename std::remove_reference<T>::type;
-    template <typename U>
-    RESULT_WARN_UNUSED
-    RESULT_CPP14_CONSTEXPR auto value_or(U&& default_value)
-      && -> typename std::remove_reference<T>::type;
-    /// \}
+      auto operator=(const result_union&) -> result_union& = default;
+      auto operator=(result_union&&) -> result_union& = default;
 
-    /// \{
-    /// \brief Returns the contained error if `*this` has an error,
-    ///        otherwise returns \p default_error.
-    ///
-    /// ### Examples
-    ///
-    /// Basic Usage:
+      //-----------------------------------------------------------------------
+      // Observers
+      //-----------------------------------------------------------------------
+
+      /// \brief Queries whether the underlying value is active
+      constexpr auto has_value() const noexcept -> bool;
+
+      /// \brief Gets the underlying error
+      ///
+      /// \pre `has_value()` is `false`
+      RESULT_CPP14_CONSTEXPR auto error() & noexcept -> E&;
+      RESULT_CPP14_CONSTEXPR auto error() && noexcept -> E&&;
+      constexpr auto error() const & noexcept -> const E&;
+
+      //-----------------------------------------------------------------------
+      // Modifiers
+      //-----------------------------------------------------------------------
+
+      /// \brief A no-op for trivial types
+      RESULT_CPP20_CONSTEXPR auto destroy() const noexcept -> void;
+
+      /// \brief Constructs the value from \p args
+      ///
+      /// \pre there is no active value or error
+      ///
+      /// \param args the arguments to forward to T's constructor
+      template <typename...Args>
+      RESULT_CPP20_CONSTEXPR auto construct_value(Args&&...args)
+        noexcept(std::is_nothrow_constructible<underlying_value_type,Args...>::value) -> void;
+
+      /// \brief Constructs the error from \p args
+      ///
+      /// \pre there is no active value or error
+      ///
+      /// \param args the arguments to forward to E's constructor
+      template <typename...Args>
+      RESULT_CPP20_CONSTEXPR auto construct_error(Args&&...args)
+        noexcept(std::is_nothrow_constructible<E,Args...>::value) -> void;
+
+      /// \brief Assigns \p error to the underlying error
+      ///
+      /// \pre `has_value()` is `false`
+      ///
+      /// \param error the error to assign
+      template <typename Error>
+      RESULT_CPP20_CONSTEXPR auto assign_error(Error&& error)
+        noexcept(std::is_nothrow_assignable<E&,Error>::value) -> void;
+
+      /// \brief Swaps the underlying error with the error of \p other
+      ///
+      /// \pre both `has_value()` and `other.has_value()` are `false`
+      ///
+      /// \param other the other storage to swap with
+      RESULT_CPP20_CONSTEXPR auto swap_error(result_union& other) -> void;
+
+      //-----------------------------------------------------------------------
+      // Public Members
+      //-----------------------------------------------------------------------
+
+      union {
+        underlying_value_type m_value;
+        underlying_error_type m_error;
+        unit m_empty;
+      };
+      bool m_has_value;
+    };
+
+    //-------------------------------------------------------------------------
+
+    template <typename T, typename E>
+    struct result_union<T, E, false>
+    {
+      //-----------------------------------------------------------------------
+      // Public Member Types
+      //-----------------------------------------------------------------------
+
+      using underlying_value_type = wrapped_result_type<T>;
+      using underlying_error_type = E;
+      using const_error_reference = const E&;
+
+      //-----------------------------------------------------------------------
+      // Constructors / Assignment / Destructor
+      //-----------------------------------------------------------------------
+
+      /// \brief Constructs an empty object
+      ///
+      /// This is for use with conversion constructors, since it allows a
+      /// temporary unused object to be set
+      RESULT_CPP20_CONSTEXPR result_union(unit) noexcept;
+
+      /// \brief Constructs the underlying value from the specified \p args
+      ///
+      /// \param args the arguments to forward to T's constructor
+      template <typename...Args>
+      constexpr result_union(in_place_t, Args&&...args)
+        noexcept(std::is_nothrow_constructible<T, Args...>::value);
+
+      /// \brief Constructs the underlying error from the specified \p args
+      ///
+      /// \param args the arguments to forward to E's constructor
+      template <typename...Args>
+      constexpr result_union(in_place_error_t, Args&&...args)
+        noexcept(std::is_nothrow_constructible<E, Args...>::value);
+
+      result_union(const result_union&) = default;
+      result_union(result_union&&) = default;
+
+      //-----------------------------------------------------------------------
+
+      /// \brief Destroys the underlying stored object
+      RESULT_CPP20_CONSTEXPR ~result_union()
+        noexcept(std::is_nothrow_destructible<T>::value &&
+                 std::is_nothrow_destructible<E>::value);
+
+      //-----------------------------------------------------------------------
+
+      auto operator=(const result_union&) -> result_union& = default;
+      auto operator=(result_union&&) -> result_union& = default;
+
+      //-----------------------------------------------------------------------
+      // Observers
+      //-----------------------------------------------------------------------
+
+      /// \brief Queries whether the underlying value is active
+      constexpr auto has_value() const noexcept -> bool;
+
+      /// \brief Gets the underlying error
+      ///
+      /// \pre `has_value()` is `false`
+      RESULT_CPP14_CONSTEXPR auto error() & noexcept -> E&;
+      RESULT_CPP14_CONSTEXPR auto error() && noexcept -> E&&;
+      constexpr auto error() const & noexcept -> const E&;
+
+      //-----------------------------------------------------------------------
+      // Modifiers
+      //-----------------------------------------------------------------------
+
+      /// \brief Destroys the underlying stored object
+      RESULT_CPP20_CONSTEXPR auto destroy() -> void;
+
+      /// \brief Constructs the value from \p args
+      ///
+      /// \pre there is no active value or error
+      ///
+      /// \param args the arguments to forward to T's constructor
+      template <typename...Args>
+      RESULT_CPP20_CONSTEXPR auto construct_value(Args&&...args)
+        noexcept(std::is_nothrow_constructible<underlying_value_type,Args...>::value) -> void;
+
+      /// \brief Constructs the error from \p args
+      ///
+      /// \pre there is no active value or error
+      ///
+      /// \param args the arguments to forward to E's constructor
+      template <typename...Args>
+      RESULT_CPP20_CONSTEXPR auto construct_error(Args&&...args)
+        noexcept(std::is_nothrow_constructible<E,Args...>::value) -> void;
+
+      /// \brief Assigns \p error to the underlying error
+      ///
+      /// \pre `has_value()` is `false`
+      ///
+      /// \param error the error to assign
+      template <typename Error>
+      RESULT_CPP20_CONSTEXPR auto assign_error(Error&& error)
+        noexcept(std::is_nothrow_assignable<E&,Error>::value) -> void;
+
+      /// \brief Swaps the underlying error with the error of \p other
+      ///
+      /// \pre both `has_value()` and `other.has_value()` are `false`
+      ///
+      /// \param other the other storage to swap with
+      RESULT_CPP20_CONSTEXPR auto swap_error(result_union& other) -> void;
+
+      //-----------------------------------------------------------------------
+      // Public Members
+      //-----------------------------------------------------------------------
+
+      union {
+        underlying_value_type m_value;
+        underlying_error_type m_error;
+        unit m_empty;
+      };
+      bool m_has_value;
+    };
+
+    //=========================================================================
+    // class : detail::result_niche_union<T, E>
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A storage for `result` that encodes the error into the niche of
+    ///        the value type, as described by `result_niche_traits`
     ///
-    /// ```cpp
-    /// auto r = cpp::result<int,int>{42};
-    /// assert(r.error_or(0) == cpp::fail(0));
+    /// The underlying value object is always alive; when an error is active
+    /// it simply holds a niche representation. As a result, there is no
+    /// discriminator and the error can only ever be observed by-value.
     ///
-    /// auto r = cpp::result<int,int>{cpp::fail(42)};
-    /// assert(r.error_or(0) == cpp::fail(42));
-    /// ```
+    /// \tparam T the value type result to be returned
+    /// \tparam E the error type returned on failure
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename E>
+    struct result_niche_union
+    {
+      //-----------------------------------------------------------------------
+      // Public Member Types
+      //-----------------------------------------------------------------------
+
+      using underlying_value_type = niche_wrapped_result_type<T>;
+      using underlying_error_type = E;
+      using const_error_reference = E;
+
+      using niche_traits = result_niche_traits<underlying_value_type>;
+      using error_traits = niche_error_traits<E>;
+
+      //-----------------------------------------------------------------------
+      // Constructors / Assignment
+      //-----------------------------------------------------------------------
+
+      /// \brief Constructs an empty object
+      ///
+      /// This is for use with conversion constructors, since it allows a
+      /// temporary unused object to be set
+      RESULT_CPP20_CONSTEXPR result_niche_union(unit) noexcept;
+
+      /// \brief Constructs the underlying value from the specified \p args
+      ///
+      /// \param args the arguments to forward to T's constructor
+      template <typename...Args>
+      constexpr result_niche_union(in_place_t, Args&&...args)
+        noexcept(std::is_nothrow_constructible<T, Args...>::value);
+
+      /// \brief Constructs the underlying error from the specified \p args
+      ///
+      /// \param args the arguments to forward to E's constructor
+      template <typename...Args>
+      RESULT_CPP20_CONSTEXPR result_niche_union(in_place_error_t, Args&&...args)
+        noexcept(std::is_nothrow_constructible<E, Args...>::value);
+
+      result_niche_union(const result_niche_union&) = default;
+      result_niche_union(result_niche_union&&) = default;
+
+      //-----------------------------------------------------------------------
+
+      auto operator=(const result_niche_union&) -> result_niche_union& = default;
+      auto operator=(result_niche_union&&) -> result_niche_union& = default;
+
+      //-----------------------------------------------------------------------
+      // Observers
+      //-----------------------------------------------------------------------
+
+      /// \brief Queries whether the underlying value is active
+      RESULT_CPP20_CONSTEXPR auto has_value() const noexcept -> bool;
+
+      /// \brief Decodes the underlying error
+      ///
+      /// \pre `has_value()` is `false`
+      RESULT_CPP20_CONSTEXPR auto error() const noexcept -> E;
+
+      //-----------------------------------------------------------------------
+      // Modifiers
+      //-----------------------------------------------------------------------
+
+      /// \brief A no-op, since niche storage is always trivial
+      RESULT_CPP20_CONSTEXPR auto destroy() const noexcept -> void;
+
+      /// \copydoc result_union::construct_value
+      template <typename...Args>
+      RESULT_CPP20_CONSTEXPR auto construct_value(Args&&...args)
+        noexcept(std::is_nothrow_constructible<underlying_value_type,Args...>::value) -> void;
+
+      /// \copydoc result_union::construct_error
+      template <typename...Args>
+      RESULT_CPP20_CONSTEXPR auto construct_error(Args&&...args)
+        noexcept(std::is_nothrow_constructible<E,Args...>::value) -> void;
+
+      /// \copydoc result_union::assign_error
+      template <typename Error>
+      RESULT_CPP20_CONSTEXPR auto assign_error(Error&& error)
+        noexcept(std::is_nothrow_constructible<E,Error>::value) -> void;
+
+      /// \copydoc result_union::swap_error
+      RESULT_CPP20_CONSTEXPR auto swap_error(result_niche_union& other) noexcept -> void;
+
+      //-----------------------------------------------------------------------
+      // Public Members
+      //-----------------------------------------------------------------------
+
+      union {
+        underlying_value_type m_value;
+        unit m_empty;
+      };
+    };
+
+    //=========================================================================
+    // class : detail::result_compact_union<E>
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A storage for `result<void,E>` that only stores an `E`, and
+    ///        uses `E{}` to represent the value state
     ///
-    /// \param default_error the error to use in case `*this` is empty
-    /// \return the contained value or \p default_error
-    template <typename U>
-    RESULT_WARN_UNUSED
-    constexpr auto error_or(U&& default_error) const & -> error_type;
-    template <typename U>
-    RESULT_WARN_UNUSED
-    RESULT_CPP14_CONSTEXPR auto error_or(U&& default_error) && -> error_type;
-    /// \}
+    /// This is selected with `enable_compact_void_result`
+    ///
+    /// \tparam E the error type returned on failure
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename E>
+    struct result_compact_union
+    {
+      static_assert(
+        std::is_trivially_destructible<E>::value,
+        "enable_compact_void_result may only be enabled for trivially "
+        "destructible error types"
+      );
+
+      //-----------------------------------------------------------------------
+      // Public Member Types
+      //-----------------------------------------------------------------------
+
+      using underlying_value_type = unit;
+      using underlying_error_type = E;
+      using const_error_reference = const E&;
+
+      //-----------------------------------------------------------------------
+      // Constructors / Assignment
+      //-----------------------------------------------------------------------
+
+      /// \brief Constructs an empty object
+      ///
+      /// This is for use with conversion constructors, since it allows a
+      /// temporary unused object to be set
+      RESULT_CPP20_CONSTEXPR result_compact_union(unit) noexcept;
+
+      /// \brief Constructs the value state by default-constructing the error
+      constexpr result_compact_union(in_place_t)
+        noexcept(std::is_nothrow_default_constructible<E>::value);
+
+      /// \brief Constructs the underlying error from the specified \p args
+      ///
+      /// \param args the arguments to forward to E's constructor
+      template <typename...Args>
+      constexpr result_compact_union(in_place_error_t, Args&&...args)
+        noexcept(std::is_nothrow_constructible<E, Args...>::value);
+
+      result_compact_union(const result_compact_union&) = default;
+      result_compact_union(result_compact_union&&) = default;
+
+      //-----------------------------------------------------------------------
+
+      auto operator=(const result_compact_union&) -> result_compact_union& = default;
+      auto operator=(result_compact_union&&) -> result_compact_union& = default;
+
+      //-----------------------------------------------------------------------
+      // Observers
+      //-----------------------------------------------------------------------
+
+      /// \brief Queries whether the underlying error is in its default state
+      constexpr auto has_value() const -> bool;
+
+      /// \copydoc result_union::error
+      RESULT_CPP14_CONSTEXPR auto error() & noexcept -> E&;
+      RESULT_CPP14_CONSTEXPR auto error() && noexcept -> E&&;
+      constexpr auto error() const & noexcept -> const E&;
+
+      //-----------------------------------------------------------------------
+      // Modifiers
+      //-----------------------------------------------------------------------
+
+      /// \brief A no-op, since compact storage is always trivially destructible
+      RESULT_CPP20_CONSTEXPR auto destroy() const noexcept -> void;
+
+      /// \brief Constructs the value state by default-constructing the error
+      ///
+      /// \pre there is no active error
+      RESULT_CPP20_CONSTEXPR auto construct_value(unit = {})
+        noexcept(std::is_nothrow_default_constructible<E>::value) -> void;
+
+      /// \copydoc result_union::construct_error
+      template <typename...Args>
+      RESULT_CPP20_CONSTEXPR auto construct_error(Args&&...args)
+        noexcept(std::is_nothrow_constructible<E,Args...>::value) -> void;
+
+      /// \copydoc result_union::assign_error
+      template <typename Error>
+      RESULT_CPP20_CONSTEXPR auto assign_error(Error&& error)
+        noexcept(std::is_nothrow_assignable<E&,Error>::value) -> void;
+
+      /// \copydoc result_union::swap_error
+      RESULT_CPP20_CONSTEXPR auto swap_error(result_compact_union& other) -> void;
+
+      //-----------------------------------------------------------------------
+      // Public Members
+      //-----------------------------------------------------------------------
+
+      static constexpr unit m_value{};
+
+      union {
+        underlying_error_type m_error;
+        unit m_empty;
+      };
+    };
+
+    //=========================================================================
+    // trait : detail::result_replace_strategy<T, Other, Args...>
+    //=========================================================================
+
+    /// \brief Selects how the active \p Other of a result is replaced with a
+    ///        \p T constructed from \p Args
+    ///
+    /// * `0`: \p Other is destroyed, and \p T is constructed in its place
+    /// * `1`: \p T is constructed into a temporary first, and is then moved
+    ///        into place
+    /// * `2`: \p Other is moved into a temporary first, and is moved back if
+    ///        constructing \p T throws
+    /// * `-1`: \p T cannot be constructed without risking a valueless result
+    ///
+    /// Strategies `1` and `2` are only used for types that opt in with
+    /// `enable_throwing_assignment`.
+    template <typename T, typename Other, typename...Args>
+    struct result_replace_strategy : std::integral_constant<int,(
+      std::is_nothrow_constructible<T,Args...>::value ? 0 :
+      !enable_throwing_assignment<typename std::remove_cv<T>::type>::value ||
+      !std::is_constructible<T,Args...>::value ? -1 :
+      std::is_nothrow_move_constructible<T>::value ? 1 :
+      std::is_nothrow_move_constructible<Other>::value ? 2 :
+      -1
+    )>{};
+
+    template <typename T, typename Other, typename...Args>
+    struct result_is_replaceable : std::integral_constant<bool,(
+      result_replace_strategy<T,Other,Args...>::value >= 0
+    )>{};
+
+    //=========================================================================
+    // trait : detail::result_allocator_strategy<T, Alloc, Args...>
+    //=========================================================================
+
+    /// \brief Selects how a \p T is constructed from \p Args with the
+    ///        allocator \p Alloc, following uses-allocator construction
+    ///
+    /// * `0`: \p T does not use \p Alloc, and is constructed from \p Args
+    /// * `1`: \p T is constructed from `std::allocator_arg`, the allocator,
+    ///        and then \p Args
+    /// * `2`: \p T is constructed from \p Args, and then the allocator
+    /// * `-1`: \p T uses \p Alloc, but cannot be constructed with it
+    template <typename T, typename Alloc, typename...Args>
+    struct result_allocator_strategy : std::integral_constant<int,(
+      !std::uses_allocator<T,Alloc>::value ? 0 :
+      std::is_constructible<T,std::allocator_arg_t,const Alloc&,Args...>::value ? 1 :
+      std::is_constructible<T,Args...,const Alloc&>::value ? 2 :
+      -1
+    )>{};
+
+    //=========================================================================
+    // alias : detail::result_storage_type<T, E>
+    //=========================================================================
+
+    template <typename T, typename E>
+    using result_storage_type = typename std::conditional<
+      std::is_same<T,unit>::value && enable_compact_void_result<E>::value,
+      result_compact_union<E>,
+      typename std::conditional<
+        result_uses_niche<T,E>::value,
+        result_niche_union<T,E>,
+        result_union<T,E>
+      >::type
+    >::type;
+
+    //=========================================================================
+    // class : result_construct_base<T, E>
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Base class of assignment to enable construction and assignment
+    ///
+    /// This class is used with several pieces of construction to ensure
+    /// trivial constructibility and assignability:
+    ///
+    /// * `result_trivial_copy_ctor_base`
+    /// * `result_trivial_move_ctor_base`
+    /// * `result_copy_assign_base`
+    /// * `result_move_assign_base`
+    ///
+    /// When conditionally-trivial special members are available, these are
+    /// replaced by a single `result_storage` class instead.
+    ///
+    /// \tparam T the value type
+    /// \tparam E the error type
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename E>
+    struct result_construct_base
+    {
+      //-----------------------------------------------------------------------
+      // Constructors / Assignment
+      //-----------------------------------------------------------------------
+
+      /// \brief Constructs an empty object
+      ///
+      /// This is for use with conversion constructors, since it allows a
+      /// temporary unused object to be set
+      RESULT_CPP20_CONSTEXPR result_construct_base(unit) noexcept;
+
+      /// \brief Constructs the underlying value from the specified \p args
+      ///
+      /// \param args the arguments to forward to T's constructor
+      template <typename...Args>
+      constexpr result_construct_base(in_place_t, Args&&...args)
+        noexcept(std::is_nothrow_constructible<T, Args...>::value);
+
+      /// \brief Constructs the underlying error from the specified \p args
+      ///
+      /// \param args the arguments to forward to E's constructor
+      template <typename...Args>
+      constexpr result_construct_base(in_place_error_t, Args&&...args)
+        noexcept(std::is_nothrow_constructible<E, Args...>::value);
+
+      result_construct_base(const result_construct_base&) = default;
+      result_construct_base(result_construct_base&&) = default;
+
+      auto operator=(const result_construct_base&) -> result_construct_base& = default;
+      auto operator=(result_construct_base&&) -> result_construct_base& = default;
+
+      //-----------------------------------------------------------------------
+      // Construction / Assignment
+      //-----------------------------------------------------------------------
+
+      /// \brief Constructs the value type from \p args
+      ///
+      /// \note This is an implementation detail only meant to be used during
+      ///       construction
+      ///
+      /// \pre there is no contained value or error at the time of construction
+      ///
+      /// \param args the arguments to forward to T's constructor
+      template <typename...Args>
+      RESULT_CPP20_CONSTEXPR auto construct_value(Args&&...args)
+        noexcept(std::is_nothrow_constructible<T,Args...>::value) -> void;
+
+      /// \brief Constructs the error type from \p args
+      ///
+      /// \note This is an implementation detail only meant to be used during
+      ///       construction
+      ///
+      /// \pre there is no contained value or error at the time of construction
+      ///
+      /// \param args the arguments to forward to E's constructor
+      template <typename...Args>
+      RESULT_CPP20_CONSTEXPR auto construct_error(Args&&...args)
+        noexcept(std::is_nothrow_constructible<E,Args...>::value) -> void;
+
+      /// \brief Constructs the underlying error from the \p other result
+      ///
+      /// If \p other contains a value, then the T type will be
+      /// default-constructed.
+      ///
+      /// \note This is an implementation detail only meant to be used during
+      ///       construction of `result<void, E>` types
+      ///
+      /// \pre there is no contained value or error at the time of construction
+      ///
+      /// \param other the other result to construct
+      template <typename Result>
+      RESULT_CPP20_CONSTEXPR auto construct_error_from_result(Result&& other) -> void;
+
+      /// \brief Constructs the underlying type from a result object
+      ///
+      /// \note This is an implementation detail only meant to be used during
+      ///       construction
+      ///
+      /// \pre there is no contained value or error at the time of construction
+      ///
+      /// \param other the other result to construct
+      template <typename Result>
+      RESULT_CPP20_CONSTEXPR auto construct_from_result(Result&& other) -> void;
+
+      /// \brief Constructs the value type from \p args, using uses-allocator
+      ///        construction with \p alloc
+      ///
+      /// \note This is an implementation detail only meant to be used during
+      ///       construction
+      ///
+      /// \pre there is no contained value or error at the time of construction
+      ///
+      /// \param alloc the allocator to construct T with, if it uses one
+      /// \param args the arguments to forward to T's constructor
+      template <typename Alloc, typename...Args>
+      RESULT_CPP20_CONSTEXPR auto construct_value_with_allocator(const Alloc& alloc,
+                                                                 Args&&...args) -> void;
+
+      /// \brief Constructs the error type from \p args, using uses-allocator
+      ///        construction with \p alloc
+      ///
+      /// \note This is an implementation detail only meant to be used during
+      ///       construction
+      ///
+      /// \pre there is no contained value or error at the time of construction
+      ///
+      /// \param alloc the allocator to construct E with, if it uses one
+      /// \param args the arguments to forward to E's constructor
+      template <typename Alloc, typename...Args>
+      RESULT_CPP20_CONSTEXPR auto construct_error_with_allocator(const Alloc& alloc,
+                                                                 Args&&...args) -> void;
+
+      /// \brief Constructs the underlying type from a result object, using
+      ///        uses-allocator construction with \p alloc
+      ///
+      /// \note This is an implementation detail only meant to be used during
+      ///       construction
+      ///
+      /// \pre there is no contained value or error at the time of construction
+      ///
+      /// \param alloc the allocator to construct T or E with
+      /// \param other the other result to construct
+      template <typename Alloc, typename Result>
+      RESULT_CPP20_CONSTEXPR auto construct_from_result_with_allocator(const Alloc& alloc,
+                                                                       Result&& other) -> void;
+
+      //-----------------------------------------------------------------------
+
+      template <typename Value>
+      RESULT_CPP20_CONSTEXPR auto assign_value(Value&& value)
+        noexcept(std::is_nothrow_constructible<T, Value>::value &&
+                 std::is_nothrow_assignable<T, Value>::value) -> void;
+
+      template <typename Error>
+      RESULT_CPP20_CONSTEXPR auto assign_error(Error&& error)
+        noexcept(std::is_nothrow_constructible<E, Error>::value &&
+                 std::is_nothrow_assignable<E, Error>::value) -> void;
+
+      template <typename Result>
+      RESULT_CPP20_CONSTEXPR auto assign_from_result(Result&& other) -> void;
+
+      /// \brief Replaces the contained error with a value constructed from
+      ///        \p args, as selected by `result_replace_strategy`
+      ///
+      /// \pre `storage.has_value()` is `false`
+      ///
+      /// \param args the arguments to forward to T's constructor
+      template <typename...Args>
+      RESULT_CPP20_CONSTEXPR auto replace_error(Args&&...args) -> void;
+
+      /// \brief Replaces the contained value with an error constructed from
+      ///        \p args, as selected by `result_replace_strategy`
+      ///
+      /// \pre `storage.has_value()` is `true`
+      ///
+      /// \param args the arguments to forward to E's constructor
+      template <typename...Args>
+      RESULT_CPP20_CONSTEXPR auto replace_value(Args&&...args) -> void;
+
+      /// \brief Replaces the contained value or error with a value
+      ///        constructed from \p args
+      ///
+      /// If constructing T may throw, it is constructed before the current
+      /// state is destroyed and then moved into place.
+      ///
+      /// \param args the arguments to forward to T's constructor
+      template <typename...Args>
+      RESULT_CPP20_CONSTEXPR auto emplace_value(Args&&...args) -> void;
+
+      /// \brief Assigns \p value to the contained value, or replaces the
+      ///        contained error with a value constructed from \p value
+      ///
+      /// \param value the value to assign
+      template <typename Value>
+      RESULT_CPP20_CONSTEXPR auto assign_or_reuse_value(Value&& value) -> void;
+
+      //-----------------------------------------------------------------------
+
+      template <typename...Args>
+      RESULT_CPP20_CONSTEXPR auto replace_error_impl(std::integral_constant<int,0>, Args&&...args) -> void;
+      template <typename...Args>
+      RESULT_CPP20_CONSTEXPR auto replace_error_impl(std::integral_constant<int,1>, Args&&...args) -> void;
+      template <typename...Args>
+      RESULT_CPP20_CONSTEXPR auto replace_error_impl(std::integral_constant<int,2>, Args&&...args) -> void;
+
+      template <typename...Args>
+      RESULT_CPP20_CONSTEXPR auto replace_value_impl(std::integral_constant<int,0>, Args&&...args) -> void;
+      template <typename...Args>
+      RESULT_CPP20_CONSTEXPR auto replace_value_impl(std::integral_constant<int,1>, Args&&...args) -> void;
+      template <typename...Args>
+      RESULT_CPP20_CONSTEXPR auto replace_value_impl(std::integral_constant<int,2>, Args&&...args) -> void;
+
+      template <typename ReferenceWrapper>
+      RESULT_CPP20_CONSTEXPR auto replace_error_from_result_impl(std::true_type, ReferenceWrapper&& reference)
+        -> void;
+
+      template <typename Value>
+      RESULT_CPP20_CONSTEXPR auto replace_error_from_result_impl(std::false_type, Value&& value)
+        -> void;
+
+      template <typename...Args>
+      RESULT_CPP20_CONSTEXPR auto emplace_value_impl(std::true_type, Args&&...args) -> void;
+
+      template <typename...Args>
+      RESULT_CPP20_CONSTEXPR auto emplace_value_impl(std::false_type, Args&&...args) -> void;
+
+      //-----------------------------------------------------------------------
+
+      template <typename ReferenceWrapper>
+      RESULT_CPP20_CONSTEXPR auto construct_value_from_result_impl(std::true_type, ReferenceWrapper&& reference)
+        noexcept -> void;
+
+      template <typename Value>
+      RESULT_CPP20_CONSTEXPR auto construct_value_from_result_impl(std::false_type, Value&& value)
+        noexcept(std::is_nothrow_constructible<T,Value>::value) -> void;
+
+      template <typename...Args>
+      RESULT_CPP20_CONSTEXPR auto construct_tagged(in_place_t, Args&&...args) -> void;
+
+      template <typename...Args>
+      RESULT_CPP20_CONSTEXPR auto construct_tagged(in_place_error_t, Args&&...args) -> void;
+
+      template <typename Tag, typename Alloc, typename...Args>
+      RESULT_CPP20_CONSTEXPR auto construct_with_allocator_impl(Tag tag,
+                                                                std::integral_constant<int,0>,
+                                                                const Alloc& alloc,
+                                                                Args&&...args) -> void;
+
+      template <typename Tag, typename Alloc, typename...Args>
+      RESULT_CPP20_CONSTEXPR auto construct_with_allocator_impl(Tag tag,
+                                                                std::integral_constant<int,1>,
+                                                                const Alloc& alloc,
+                                                                Args&&...args) -> void;
+
+      template <typename Tag, typename Alloc, typename...Args>
+      RESULT_CPP20_CONSTEXPR auto construct_with_allocator_impl(Tag tag,
+                                                                std::integral_constant<int,2>,
+                                                                const Alloc& alloc,
+                                                                Args&&...args) -> void;
+
+      template <typename Alloc, typename ReferenceWrapper>
+      RESULT_CPP20_CONSTEXPR auto construct_value_from_result_with_allocator_impl(std::true_type,
+                                                                                  const Alloc& alloc,
+                                                                                  ReferenceWrapper&& reference)
+        noexcept -> void;
+
+      template <typename Alloc, typename Value>
+      RESULT_CPP20_CONSTEXPR auto construct_value_from_result_with_allocator_impl(std::false_type,
+                                                                                  const Alloc& alloc,
+                                                                                  Value&& value) -> void;
+
+      template <typename Result>
+      RESULT_CPP20_CONSTEXPR auto assign_value_from_result_impl(std::true_type, Result&& other) -> void;
+
+      template <typename Result>
+      RESULT_CPP20_CONSTEXPR auto assign_value_from_result_impl(std::false_type, Result&& other) -> void;
+
+      //-----------------------------------------------------------------------
+      // Public Members
+      //-----------------------------------------------------------------------
+
+      using storage_type = result_storage_type<T, E>;
+
+      storage_type storage;
+    };
+
+#if RESULT_HAS_CONDITIONALLY_TRIVIAL_SPECIAL_MEMBERS
+
+    //=========================================================================
+    // trait : result_storage_traits<T, E>
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief The conditions that decide how each special member of
+    ///        `result_storage` is provided
+    ///
+    /// Each special member is either trivial (defaulted), user-provided, or
+    /// deleted. These mirror the conditions of the C++11 base-class ladder.
+    ///
+    /// \tparam T the value type
+    /// \tparam E the error type
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename E>
+    struct result_storage_traits
+    {
+      static constexpr bool trivially_destructible =
+        std::is_trivially_destructible<T>::value &&
+        std::is_trivially_destructible<E>::value;
+
+      static constexpr bool copy_constructible =
+        std::is_copy_constructible<T>::value &&
+        std::is_copy_constructible<E>::value;
+
+      static constexpr bool trivially_copy_constructible =
+        std::is_trivially_copy_constructible<T>::value &&
+        std::is_trivially_copy_constructible<E>::value;
+
+      static constexpr bool move_constructible =
+        std::is_move_constructible<T>::value &&
+        std::is_move_constructible<E>::value;
+
+      static constexpr bool trivially_move_constructible =
+        std::is_trivially_move_constructible<T>::value &&
+        std::is_trivially_move_constructible<E>::value;
+
+      static constexpr bool copy_assignable =
+        result_is_replaceable<T,E,const T&>::value &&
+        result_is_replaceable<E,T,const E&>::value &&
+        std::is_copy_assignable<wrapped_result_type<T>>::value &&
+        std::is_copy_assignable<E>::value;
+
+      static constexpr bool trivially_copy_assignable =
+        trivially_copy_constructible &&
+        std::is_trivially_copy_assignable<wrapped_result_type<T>>::value &&
+        std::is_trivially_copy_assignable<E>::value &&
+        trivially_destructible;
+
+      static constexpr bool move_assignable =
+        result_is_replaceable<T,E,T&&>::value &&
+        result_is_replaceable<E,T,E&&>::value &&
+        std::is_move_assignable<wrapped_result_type<T>>::value &&
+        std::is_move_assignable<E>::value;
+
+      static constexpr bool trivially_move_assignable =
+        trivially_move_constructible &&
+        std::is_trivially_move_assignable<wrapped_result_type<T>>::value &&
+        std::is_trivially_move_assignable<E>::value &&
+        trivially_destructible;
+    };
+
+    //=========================================================================
+    // class : result_storage
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief The storage of a `result`, with conditionally trivial special
+    ///        members
+    ///
+    /// This is the C++20 equivalent of the `result_trivial_*` and `disable_*`
+    /// base-class ladder; each special member is selected by a `requires`
+    /// clause rather than by a layer of inheritance.
+    ///
+    /// \tparam T the value type
+    /// \tparam E the error type
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename E>
+    struct result_storage : result_construct_base<T,E>
+    {
+      using base_type = result_construct_base<T,E>;
+      using traits = result_storage_traits<T,E>;
+      using base_type::base_type;
+
+      result_storage(const result_storage& other)
+        requires(traits::trivially_copy_constructible) = default;
+      RESULT_CPP20_CONSTEXPR result_storage(const result_storage& other)
+        noexcept(std::is_nothrow_copy_constructible<T>::value &&
+                 std::is_nothrow_copy_constructible<E>::value)
+        requires(traits::copy_constructible &&
+                 !traits::trivially_copy_constructible);
+      result_storage(const result_storage& other)
+        requires(!traits::copy_constructible) = delete;
+
+      result_storage(result_storage&& other)
+        requires(traits::trivially_move_constructible) = default;
+      RESULT_CPP20_CONSTEXPR result_storage(result_storage&& other)
+        noexcept(std::is_nothrow_move_constructible<T>::value &&
+                 std::is_nothrow_move_constructible<E>::value)
+        requires(traits::move_constructible &&
+                 !traits::trivially_move_constructible);
+      result_storage(result_storage&& other)
+        requires(!traits::move_constructible) = delete;
+
+      auto operator=(const result_storage& other) -> result_storage&
+        requires(traits::trivially_copy_assignable) = default;
+      RESULT_CPP20_CONSTEXPR auto operator=(const result_storage& other)
+        noexcept(std::is_nothrow_copy_constructible<T>::value &&
+                 std::is_nothrow_copy_constructible<E>::value &&
+                 std::is_nothrow_copy_assignable<T>::value &&
+                 std::is_nothrow_copy_assignable<E>::value)
+        -> result_storage&
+        requires(traits::copy_assignable &&
+                 !traits::trivially_copy_assignable);
+      auto operator=(const result_storage& other) -> result_storage&
+        requires(!traits::copy_assignable) = delete;
+
+      auto operator=(result_storage&& other) -> result_storage&
+        requires(traits::trivially_move_assignable) = default;
+      RESULT_CPP20_CONSTEXPR auto operator=(result_storage&& other)
+        noexcept(std::is_nothrow_move_constructible<T>::value &&
+                 std::is_nothrow_move_constructible<E>::value &&
+                 std::is_nothrow_move_assignable<T>::value &&
+                 std::is_nothrow_move_assignable<E>::value)
+        -> result_storage&
+        requires(traits::move_assignable &&
+                 !traits::trivially_move_assignable);
+      auto operator=(result_storage&& other) -> result_storage&
+        requires(!traits::move_assignable) = delete;
+    };
+
+#else // RESULT_HAS_CONDITIONALLY_TRIVIAL_SPECIAL_MEMBERS
+
+    //=========================================================================
+    // class : result_trivial_copy_ctor_base
+    //=========================================================================
+
+    template <typename T, typename E>
+    struct result_trivial_copy_ctor_base_impl : result_construct_base<T,E>
+    {
+      using base_type = result_construct_base<T,E>;
+      using base_type::base_type;
+
+      RESULT_CPP20_CONSTEXPR result_trivial_copy_ctor_base_impl(const result_trivial_copy_ctor_base_impl& other)
+        noexcept(std::is_nothrow_copy_constructible<T>::value &&
+                 std::is_nothrow_copy_constructible<E>::value);
+      result_trivial_copy_ctor_base_impl(result_trivial_copy_ctor_base_impl&& other) = default;
+
+      auto operator=(const result_trivial_copy_ctor_base_impl& other) -> result_trivial_copy_ctor_base_impl& = default;
+      auto operator=(result_trivial_copy_ctor_base_impl&& other) -> result_trivial_copy_ctor_base_impl& = default;
+    };
+
+    template <bool Condition, typename Base>
+    using conditionally_nest_type = typename std::conditional<
+      Condition,
+      typename Base::base_type,
+      Base
+    >::type;
+
+    template <typename T, typename E>
+    using result_trivial_copy_ctor_base = conditionally_nest_type<
+      std::is_trivially_copy_constructible<T>::value &&
+      std::is_trivially_copy_constructible<E>::value,
+      result_trivial_copy_ctor_base_impl<T,E>
+    >;
+
+    //=========================================================================
+    // class : result_trivial_move_ctor_base
+    //=========================================================================
+
+    template <typename T, typename E>
+    struct result_trivial_move_ctor_base_impl : result_trivial_copy_ctor_base<T,E>
+    {
+      using base_type = result_trivial_copy_ctor_base<T,E>;
+      using base_type::base_type;
+
+      result_trivial_move_ctor_base_impl(const result_trivial_move_ctor_base_impl& other) = default;
+      RESULT_CPP20_CONSTEXPR result_trivial_move_ctor_base_impl(result_trivial_move_ctor_base_impl&& other)
+        noexcept(std::is_nothrow_move_constructible<T>::value &&
+                 std::is_nothrow_move_constructible<E>::value);
+
+      auto operator=(const result_trivial_move_ctor_base_impl& other) -> result_trivial_move_ctor_base_impl& = default;
+      auto operator=(result_trivial_move_ctor_base_impl&& other) -> result_trivial_move_ctor_base_impl& = default;
+    };
+
+    template <typename T, typename E>
+    using result_trivial_move_ctor_base = conditionally_nest_type<
+      std::is_trivially_move_constructible<T>::value &&
+      std::is_trivially_move_constructible<E>::value,
+      result_trivial_move_ctor_base_impl<T,E>
+    >;
+
+    //=========================================================================
+    // class : result_trivial_copy_assign_base
+    //=========================================================================
+
+    template <typename T, typename E>
+    struct result_trivial_copy_assign_base_impl
+      : result_trivial_move_ctor_base<T, E>
+    {
+      using base_type = result_trivial_move_ctor_base<T,E>;
+      using base_type::base_type;
+
+      result_trivial_copy_assign_base_impl(const result_trivial_copy_assign_base_impl& other) = default;
+      result_trivial_copy_assign_base_impl(result_trivial_copy_assign_base_impl&& other) = default;
+
+      RESULT_CPP20_CONSTEXPR auto operator=(const result_trivial_copy_assign_base_impl& other)
+        noexcept(std::is_nothrow_copy_constructible<T>::value &&
+                 std::is_nothrow_copy_constructible<E>::value &&
+                 std::is_nothrow_copy_assignable<T>::value &&
+                 std::is_nothrow_copy_assignable<E>::value)
+        -> result_trivial_copy_assign_base_impl&;
+      auto operator=(result_trivial_copy_assign_base_impl&& other)
+        -> result_trivial_copy_assign_base_impl& = default;
+    };
+
+    template <typename T, typename E>
+    using result_trivial_copy_assign_base = conditionally_nest_type<
+      std::is_trivially_copy_constructible<T>::value &&
+      std::is_trivially_copy_constructible<E>::value &&
+      std::is_trivially_copy_assignable<wrapped_result_type<T>>::value &&
+      std::is_trivially_copy_assignable<E>::value &&
+      std::is_trivially_destructible<T>::value &&
+      std::is_trivially_destructible<E>::value,
+      result_trivial_copy_assign_base_impl<T,E>
+    >;
+
+    //=========================================================================
+    // class : result_trivial_move_assign_base
+    //=========================================================================
+
+    template <typename T, typename E>
+    struct result_trivial_move_assign_base_impl
+      : result_trivial_copy_assign_base<T, E>
+    {
+      using base_type = result_trivial_copy_assign_base<T,E>;
+      using base_type::base_type;
+
+      result_trivial_move_assign_base_impl(const result_trivial_move_assign_base_impl& other) = default;
+      result_trivial_move_assign_base_impl(result_trivial_move_assign_base_impl&& other) = default;
+
+      auto operator=(const result_trivial_move_assign_base_impl& other)
+        -> result_trivial_move_assign_base_impl& = default;
+      RESULT_CPP20_CONSTEXPR auto operator=(result_trivial_move_assign_base_impl&& other)
+        noexcept(std::is_nothrow_move_constructible<T>::value &&
+                 std::is_nothrow_move_constructible<E>::value &&
+                 std::is_nothrow_move_assignable<T>::value &&
+                 std::is_nothrow_move_assignable<E>::value)
+        -> result_trivial_move_assign_base_impl&;
+    };
+
+    template <typename T, typename E>
+    using result_trivial_move_assign_base = conditionally_nest_type<
+      std::is_trivially_move_constructible<T>::value &&
+      std::is_trivially_move_constructible<E>::value &&
+      std::is_trivially_move_assignable<wrapped_result_type<T>>::value &&
+      std::is_trivially_move_assignable<E>::value &&
+      std::is_trivially_destructible<T>::value &&
+      std::is_trivially_destructible<E>::value,
+      result_trivial_move_assign_base_impl<T,E>
+    >;
+
+    //=========================================================================
+    // class : disable_copy_ctor
+    //=========================================================================
+
+    template <typename T, typename E>
+    struct disable_copy_ctor : result_trivial_move_assign_base<T,E>
+    {
+      using base_type = result_trivial_move_assign_base<T,E>;
+      using base_type::base_type;
+
+      disable_copy_ctor(const disable_copy_ctor& other) = delete;
+      disable_copy_ctor(disable_copy_ctor&& other) = default;
+
+      auto operator=(const disable_copy_ctor& other)
+        -> disable_copy_ctor& = default;
+      auto operator=(disable_copy_ctor&& other)
+        -> disable_copy_ctor& = default;
+    };
+
+    template <typename T, typename E>
+    using result_copy_ctor_base = conditionally_nest_type<
+      std::is_copy_constructible<T>::value &&
+      std::is_copy_constructible<E>::value,
+      disable_copy_ctor<T,E>
+    >;
+
+    //=========================================================================
+    // class : disable_move_ctor
+    //=========================================================================
+
+    template <typename T, typename E>
+    struct disable_move_ctor : result_copy_ctor_base<T,E>
+    {
+      using base_type = result_copy_ctor_base<T,E>;
+      using base_type::base_type;
+
+      disable_move_ctor(const disable_move_ctor& other) = default;
+      disable_move_ctor(disable_move_ctor&& other) = delete;
+
+      auto operator=(const disable_move_ctor& other)
+        -> disable_move_ctor& = default;
+      auto operator=(disable_move_ctor&& other)
+        -> disable_move_ctor& = default;
+    };
+
+    template <typename T, typename E>
+    using result_move_ctor_base = conditionally_nest_type<
+      std::is_move_constructible<T>::value &&
+      std::is_move_constructible<E>::value,
+      disable_move_ctor<T,E>
+    >;
+
+    //=========================================================================
+    // class : disable_move_assignment
+    //=========================================================================
+
+    template <typename T, typename E>
+    struct disable_move_assignment
+      : result_move_ctor_base<T, E>
+    {
+      using base_type = result_move_ctor_base<T, E>;
+      using base_type::base_type;
+
+      disable_move_assignment(const disable_move_assignment& other) = default;
+      disable_move_assignment(disable_move_assignment&& other) = default;
+
+      auto operator=(const disable_move_assignment& other)
+        -> disable_move_assignment& = delete;
+      auto operator=(disable_move_assignment&& other)
+        -> disable_move_assignment& = default;
+    };
+
+    template <typename T, typename E>
+    using result_copy_assign_base = conditionally_nest_type<
+      result_is_replaceable<T,E,const T&>::value &&
+      result_is_replaceable<E,T,const E&>::value &&
+      std::is_copy_assignable<wrapped_result_type<T>>::value &&
+      std::is_copy_assignable<E>::value,
+      disable_move_assignment<T,E>
+    >;
+
+    //=========================================================================
+    // class : disable_copy_assignment
+    //=========================================================================
+
+    template <typename T, typename E>
+    struct disable_copy_assignment
+      : result_copy_assign_base<T, E>
+    {
+      using base_type = result_copy_assign_base<T, E>;
+      using base_type::base_type;
+
+      disable_copy_assignment(const disable_copy_assignment& other) = default;
+      disable_copy_assignment(disable_copy_assignment&& other) = default;
+
+      auto operator=(const disable_copy_assignment& other)
+        -> disable_copy_assignment& = default;
+      auto operator=(disable_copy_assignment&& other)
+        -> disable_copy_assignment& = delete;
+    };
+
+    template <typename T, typename E>
+    using result_move_assign_base = conditionally_nest_type<
+      result_is_replaceable<T,E,T&&>::value &&
+      result_is_replaceable<E,T,E&&>::value &&
+      std::is_move_assignable<wrapped_result_type<T>>::value &&
+      std::is_move_assignable<E>::value,
+      disable_copy_assignment<T,E>
+    >;
+
+    //=========================================================================
+    // alias : result_storage
+    //=========================================================================
+
+    template <typename T, typename E>
+    using result_storage = result_move_assign_base<T, E>;
+
+#endif // RESULT_HAS_CONDITIONALLY_TRIVIAL_SPECIAL_MEMBERS
+
+    //=========================================================================
+    // traits : result
+    //=========================================================================
+
+    template <typename T1, typename E1, typename T2, typename E2>
+    using result_is_convertible = std::integral_constant<bool,(
+      // T1 constructible from result<T2,E2>
+      std::is_constructible<T1, result<T2,E2>&>:: value ||
+      std::is_constructible<T1, const result<T2,E2>&>:: value ||
+      std::is_constructible<T1, result<T2,E2>&&>:: value ||
+      std::is_constructible<T1, const result<T2,E2>&&>:: value ||
+
+      // E1 constructible from result<T2,E2>
+      std::is_constructible<E1, result<T2,E2>&>:: value ||
+      std::is_constructible<E1, const result<T2,E2>&>:: value ||
+      std::is_constructible<E1, result<T2,E2>&&>:: value ||
+      std::is_constructible<E1, const result<T2,E2>&&>:: value ||
+
+      // result<T2,E2> convertible to T1
+      std::is_convertible<result<T2,E2>&, T1>:: value ||
+      std::is_convertible<const result<T2,E2>&, T1>:: value ||
+      std::is_convertible<result<T2,E2>&&, T1>::value ||
+      std::is_convertible<const result<T2,E2>&&, T1>::value ||
+
+      // result<T2,E2> convertible to E2
+      std::is_convertible<result<T2,E2>&, E1>:: value ||
+      std::is_convertible<const result<T2,E2>&, E1>:: value ||
+      std::is_convertible<result<T2,E2>&&, E1>::value ||
+      std::is_convertible<const result<T2,E2>&&, E1>::value
+    )>;
+
+    //-------------------------------------------------------------------------
+
+    template <typename T1, typename E1, typename T2, typename E2>
+    using result_is_copy_convertible = std::integral_constant<bool,(
+      !result_is_convertible<T1,E1,T2,E2>::value &&
+      std::is_constructible<T1, const T2&>::value &&
+      std::is_constructible<E1, const E2&>::value
+    )>;
+
+    template <typename T1, typename E1, typename T2, typename E2>
+    using result_is_implicit_copy_convertible = std::integral_constant<bool,(
+      result_is_copy_convertible<T1,E1,T2,E2>::value &&
+      std::is_convertible<const T2&, T1>::value &&
+      std::is_convertible<const E2&, E1>::value
+    )>;
+
+    template <typename T1, typename E1, typename T2, typename E2>
+    using result_is_explicit_copy_convertible = std::integral_constant<bool,(
+      result_is_copy_convertible<T1,E1,T2,E2>::value &&
+      (!std::is_convertible<const T2&, T1>::value ||
+       !std::is_convertible<const E2&, E1>::value)
+    )>;
+
+    //-------------------------------------------------------------------------
+
+    template <typename T1, typename E1, typename T2, typename E2>
+    using result_is_move_convertible = std::integral_constant<bool,(
+      !result_is_convertible<T1,E1,T2,E2>::value &&
+      std::is_constructible<T1, T2&&>::value &&
+      std::is_constructible<E1, E2&&>::value
+    )>;
+
+    template <typename T1, typename E1, typename T2, typename E2>
+    using result_is_implicit_move_convertible = std::integral_constant<bool,(
+      result_is_move_convertible<T1,E1,T2,E2>::value &&
+      std::is_convertible<T2&&, T1>::value &&
+      std::is_convertible<E2&&, E1>::value
+    )>;
+
+    template <typename T1, typename E1, typename T2, typename E2>
+    using result_is_explicit_move_convertible = std::integral_constant<bool,(
+      result_is_move_convertible<T1,E1,T2,E2>::value &&
+      (!std::is_convertible<T2&&, T1>::value ||
+       !std::is_convertible<E2&&, E1>::value)
+    )>;
+
+    //-------------------------------------------------------------------------
+
+    template <typename T, typename U>
+    using result_is_value_convertible = std::integral_constant<bool,(
+      std::is_constructible<T, U&&>::value &&
+      !std::is_same<typename std::decay<U>::type, in_place_t>::value &&
+      !std::is_same<typename std::decay<U>::type, in_place_error_t>::value &&
+      !is_result<typename std::decay<U>::type>::value
+    )>;
+
+    template <typename T, typename U>
+    using result_is_explicit_value_convertible = std::integral_constant<bool,(
+      result_is_value_convertible<T, U>::value &&
+      !std::is_convertible<U&&, T>::value
+    )>;
+
+    template <typename T, typename U>
+    using result_is_implicit_value_convertible = std::integral_constant<bool,(
+      result_is_value_convertible<T, U>::value &&
+      std::is_convertible<U&&, T>::value
+    )>;
+
+    //-------------------------------------------------------------------------
+
+    template <typename T1, typename E1, typename T2, typename E2>
+    using result_is_convert_assignable = std::integral_constant<bool,(
+      result_is_convertible<T1,E1,T2,E2>::value &&
+
+      std::is_assignable<T1&, result<T2,E2>&>::value &&
+      std::is_assignable<T1&, const result<T2,E2>&>::value &&
+      std::is_assignable<T1&, result<T2,E2>&&>::value &&
+      std::is_assignable<T1&, const result<T2,E2>&&>::value &&
+
+      std::is_assignable<E1&, result<T2,E2>&>::value &&
+      std::is_assignable<E1&, const result<T2,E2>&>::value &&
+      std::is_assignable<E1&, result<T2,E2>&&>::value &&
+      std::is_assignable<E1&, const result<T2,E2>&&>::value
+    )>;
+
+    template <typename T1, typename E1, typename T2, typename E2>
+    using result_is_copy_convert_assignable = std::integral_constant<bool,(
+      !result_is_convert_assignable<T1,E1,T2,E2>::value &&
+
+      result_is_replaceable<T1, E1, const T2&>::value &&
+      std::is_assignable<wrapped_result_type<T1>&, const T2&>::value &&
+      result_is_replaceable<E1, T1, const E2&>::value &&
+      std::is_assignable<E1&, const E2&>::value
+    )>;
+
+    template <typename T1, typename E1, typename T2, typename E2>
+    using result_is_move_convert_assignable = std::integral_constant<bool,(
+      !result_is_convert_assignable<T1,E1,T2,E2>::value &&
+
+      result_is_replaceable<T1, E1, T2&&>::value &&
+      std::is_assignable<T1&, T2&&>::value &&
+      result_is_replaceable<E1, T1, E2&&>::value &&
+      std::is_assignable<E1&, E2&&>::value
+    )>;
+
+    //-------------------------------------------------------------------------
+
+    /// \brief Trait to determine whether a value of type \p T can be
+    ///        emplaced into a result from \p Args without leaving it
+    ///        valueless if construction throws
+    template <typename T, typename...Args>
+    struct result_is_emplaceable : std::integral_constant<bool,(
+      !std::is_reference<T>::value &&
+      std::is_constructible<T,Args...>::value &&
+      (
+        std::is_nothrow_constructible<T,Args...>::value ||
+        std::is_nothrow_move_constructible<T>::value
+      )
+    )>{};
+
+    template <typename T, typename U>
+    using result_is_reuse_assignable = std::integral_constant<bool,(
+      !is_result<typename std::decay<U>::type>::value &&
+      !is_failure<typename std::decay<U>::type>::value &&
+      result_is_emplaceable<T,U>::value &&
+      std::is_assignable<T&,U>::value
+    )>;
+
+    template <typename T, typename E, typename U>
+    using result_is_value_assignable = std::integral_constant<bool,(
+      !is_result<typename std::decay<U>::type>::value &&
+      !is_failure<typename std::decay<U>::type>::value &&
+      result_is_replaceable<T,E,U>::value &&
+      std::is_assignable<wrapped_result_type<T>&,U>::value &&
+      (
+        !std::is_same<typename std::decay<U>::type,typename std::decay<T>::type>::value ||
+        !std::is_scalar<T>::value
+      )
+    )>;
+
+    template <typename T, typename E, typename E2>
+    using result_is_failure_assignable = std::integral_constant<bool,(
+      result_is_replaceable<E,T,E2>::value &&
+      std::is_assignable<E&,E2>::value
+    )>;
+
+    // Friending 'extract_error" below was causing some compilers to incorrectly
+    // identify `exp.m_storage.m_error` as being an access violation despite the
+    // friendship. Using a type name instead seems to be ubiquitous across
+    // compilers
+    /// \brief The type returned when observing the error of a const
+    ///        `result<T,E>`; this is `const E&`, unless niche storage is used
+    template <typename T, typename E>
+    using result_const_error_reference = typename result_storage_type<
+      typename std::conditional<std::is_void<T>::value, unit, T>::type,
+      E
+    >::const_error_reference;
+
+    /// \brief The type returned when observing the error of a non-const
+    ///        `result<T,E>`; this is `E&`, unless niche storage is used
+    template <typename T, typename E>
+    using result_error_reference = decltype(
+      std::declval<result_storage_type<
+        typename std::conditional<std::is_void<T>::value, unit, T>::type,
+        E
+      >&>().error()
+    );
+
+    /// \brief The type returned when consuming the error of an rvalue
+    ///        `result<T,E>`; this is `E&&`, unless niche storage is used
+    template <typename T, typename E>
+    using result_error_rvalue_reference = decltype(
+      std::declval<result_storage_type<
+        typename std::conditional<std::is_void<T>::value, unit, T>::type,
+        E
+      >&&>().error()
+    );
+
+    struct result_error_extractor
+    {
+      template <typename T, typename E>
+      static constexpr auto get(const result<T,E>& exp) noexcept
+        -> result_const_error_reference<T,E>;
+      template <typename T, typename E>
+      static RESULT_CPP20_CONSTEXPR auto take(result<T,E>&& exp) noexcept
+        -> result_error_rvalue_reference<T,E>;
+      template <typename T, typename E>
+      static RESULT_CPP20_CONSTEXPR auto swap(result<T,E>& lhs, result<T,E>& rhs) -> void;
+      template <typename R, typename...Args>
+      static constexpr auto propagate(Args&&...args)
+        noexcept(std::is_nothrow_constructible<typename R::error_type, Args...>::value)
+        -> R;
+    };
+
+    template <typename T, typename E>
+    constexpr auto extract_error(const result<T,E>& exp) noexcept
+      -> result_const_error_reference<T,E>;
+
+    //=========================================================================
+    // utilities : RESULT_TRY
+    //=========================================================================
+
+    /// \{
+    /// \brief Extracts the failure of a result known to contain an error,
+    ///        used by `RESULT_TRY`
+    ///
+    /// The error of an rvalue result is moved rather than copied, and is
+    /// accessed directly rather than through the checked `error()` function.
+    template <typename T, typename E>
+    RESULT_CPP20_CONSTEXPR auto try_extract_failure(const result<T,E>& r) -> failure<E>;
+    template <typename T, typename E>
+    RESULT_CPP20_CONSTEXPR auto try_extract_failure(result<T,E>&& r) -> failure<E>;
+    /// \}
+
+    /// \{
+    /// \brief Extracts the value of a result known to contain a value, used
+    ///        by `RESULT_TRY`
+    template <typename T, typename E>
+    RESULT_CPP20_CONSTEXPR auto try_extract_value(const result<T,E>& r) -> decltype(*r);
+    template <typename T, typename E>
+    RESULT_CPP20_CONSTEXPR auto try_extract_value(result<T,E>&& r)
+      -> decltype(*static_cast<result<T,E>&&>(r));
+    template <typename E>
+    RESULT_CPP20_CONSTEXPR auto try_extract_value(const result<void,E>& r) noexcept -> void;
+    /// \}
+
+    //=========================================================================
+    // class : erased_message
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A non-owning, type-erased reference to a message that is
+    ///        convertible to `std::string`
+    ///
+    /// This allows `expect` to pass its message to the failure path as two
+    /// pointers, deferring the construction of the `std::string` to the
+    /// outlined failure path rather than inlining it into every caller.
+    ///////////////////////////////////////////////////////////////////////////
+    class erased_message
+    {
+    public:
+
+      template <typename String>
+      explicit erased_message(String&& message) noexcept;
+
+      /// \brief Gets the referenced message if it is a C string, without
+      ///        constructing a `std::string`
+      ///
+      /// \return the message, or `nullptr` if it is not a C string
+      auto c_str() const noexcept -> const char*;
+
+      /// \brief Constructs the string of the referenced message
+      auto str() const -> std::string;
+
+    private:
+
+      template <typename String>
+      erased_message(std::true_type, String&& message) noexcept;
+      template <typename String>
+      erased_message(std::false_type, String&& message) noexcept;
+
+      template <typename String>
+      static auto convert(const void* message) -> std::string;
+
+      using converter = auto(*)(const void*) -> std::string;
+
+      const void* m_message;
+      converter m_convert; ///< nullptr if m_message is a C string
+    };
+
+    /// \brief Gets the message used when no message is given
+    constexpr auto bad_result_access_default_message() noexcept -> const char*;
+
+    template <typename E>
+    [[noreturn]]
+    auto throw_bad_result_access(E&& error, source_location where) -> void;
+
+    template <typename E>
+    [[noreturn]]
+    auto throw_bad_result_access_erased(const erased_message& message,
+                                        E&& error,
+                                        source_location where) -> void;
+
+    template <typename String, typename E>
+    [[noreturn]]
+    auto throw_bad_result_access_message(String&& message,
+                                         E&& error,
+                                         source_location where) -> void;
+
+  } // namespace detail
+
+  /////////////////////////////////////////////////////////////////////////////
+  /// \brief The class template `result` manages result results from APIs,
+  ///        while encoding possible failure conditions.
+  ///
+  /// A common use-case for result is the return value of a function that
+  /// may fail. As opposed to other approaches, such as `std::pair<T,bool>`
+  /// or `std::optional`, `result` more accurately conveys the intent of the
+  /// user along with the failure condition to the caller. This effectively
+  /// produces an orthogonal error handling mechanism that allows for exception
+  /// safety while also allowing discrete testability of the return type.
+  ///
+  /// `result<T,E>` types may contain a `T` value, which signifies that an
+  /// operation succeeded in producing the result value of type `T`. If an
+  /// `result` does not contain a `T` value, it will always contain an `E`
+  /// error condition instead.
+  ///
+  /// An `result<T,E>` can always be queried for a possible error case by
+  /// calling the `error()` function, even if it contains a value.
+  /// In the case that a `result<T,E>` contains a value object, this will
+  /// simply return an `E` object constructed through default aggregate
+  /// construction, as if through the expression `E{}`, which is assumed to be
+  /// a "valid" (no-error) state for an `E` type.
+  /// For example:
+  ///
+  /// * `std::error_code{}` produces a default-construct error-code, which is
+  ///   the "no error" state,
+  /// * integral (or enum) error codes produce a `0` value (no error), thanks to
+  ///   zero-initialization,
+  /// * `std::exception_ptr{}` produces a null-pointer,
+  /// * `std::string{}` produces an empty string `""`,
+  /// * etc.
+  ///
+  /// When a `result<T,E>` contains either a value or error, the storage for
+  /// that object is guaranteed to be allocated as part of the result
+  /// object's footprint, i.e. no dynamic memory allocation ever takes place.
+  /// Thus, a result object models an object, not a pointer, even though the
+  /// `operator*()` and `operator->()` are defined.
+  ///
+  /// When an object of type `result<T,E>` is contextually converted to
+  /// `bool`, the conversion returns `true` if the object contains a value and
+  /// `false` if it contains an error.
+  ///
+  /// `result` objects do not have a "valueless" state like `variant`s do.
+  /// Once a `result` has been constructed with a value or error, the
+  /// active underlying type can only be changed through assignment which may
+  /// is only enabled if construction is guaranteed to be *non-throwing*. This
+  /// ensures that a valueless state cannot occur naturally.
+  ///
+  /// Example Use:
+  /// \code
+  /// auto to_string(int x) -> result<std::string>
+  /// {
+  ///   try {
+  ///     return std::stoi(x);
+  ///   } catch (const std::invalid_argument&) {
+  ///     return fail(std::errc::invalid_argument);
+  ///   } catch (const std::std::out_of_range&) {
+  ///     return fail(std::errc::result_out_of_range);
+  ///   }
+  /// }
+  /// \endcode
+  ///
+  /// \note If using C++17 or above, `fail` can be replaced with
+  ///       `failure{...}` thanks to CTAD.
+  ///
+  /// \tparam T the underlying value type
+  /// \tparam E the underlying error type
+  ///////////////////////////////////////////////////////////////////////////
+  template <typename T, typename E>
+  class RESULT_NODISCARD result
+  {
+    // Type requirements
+
+    static_assert(
+      !std::is_abstract<T>::value,
+      "It is ill-formed for T to be abstract type"
+    );
+    static_assert(
+      !std::is_same<typename std::decay<T>::type, in_place_t>::value,
+      "It is ill-formed for T to be a (possibly CV-qualified) in_place_t type"
+    );
+    static_assert(
+      !is_result<typename std::decay<T>::type>::value,
+      "It is ill-formed for T to be a (possibly CV-qualified) 'result' type"
+    );
+    static_assert(
+      !is_failure<typename std::decay<T>::type>::value,
+      "It is ill-formed for T to be a (possibly CV-qualified) 'failure' type"
+    );
+    static_assert(
+      !std::is_rvalue_reference<T>::value,
+      "It is ill-formed for T to be an rvalue 'result type. "
+      "Only lvalue references are valid."
+    );
+
+    static_assert(
+      !std::is_abstract<E>::value,
+      "It is ill-formed for E to be abstract type"
+    );
+    static_assert(
+      !std::is_void<typename std::decay<E>::type>::value,
+      "It is ill-formed for E to be (possibly CV-qualified) void type"
+    );
+    static_assert(
+      !is_result<typename std::decay<E>::type>::value,
+      "It is ill-formed for E to be a (possibly CV-qualified) 'result' type"
+    );
+    static_assert(
+      !is_failure<typename std::decay<E>::type>::value,
+      "It is ill-formed for E to be a (possibly CV-qualified) 'failure' type"
+    );
+    static_assert(
+      !std::is_same<typename std::decay<E>::type, in_place_t>::value,
+      "It is ill-formed for E to be a (possibly CV-qualified) in_place_t type"
+    );
+    static_assert(
+      !std::is_reference<E>::value,
+      "It is ill-formed for E to be a reference type. "
+      "Only T types may be lvalue references"
+    );
+
+    // Friendship
+
+    friend detail::result_error_extractor;
+
+    template <typename T2, typename E2>
+    friend class result;
+
+    //-------------------------------------------------------------------------
+    // Public Member Types
+    //-------------------------------------------------------------------------
+  public:
+
+    using value_type = T; ///< The value type of this result
+    using error_type = E; ///< The error type of this result
+    using failure_type = failure<E>; ///< The failure type
+
+    template <typename U>
+    using rebind = result<U,E>; ///< Rebinds the result type
+
+    //-------------------------------------------------------------------------
+    // Constructor / Destructor / Assignment
+    //-------------------------------------------------------------------------
+  public:
+
+    /// \brief Default-constructs a result with the underlying value type
+    ///        active
+    ///
+    /// This constructor is only enabled if `T` is default-constructible
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// assert(cpp::result<std::string,int>{} == std::string{});
+    /// ```
+    template <typename U=T,
+              typename = typename std::enable_if<std::is_constructible<U>::value>::type>
+    constexpr result()
+      noexcept(std::is_nothrow_constructible<U>::value);
+
+    /// \brief Copy constructs this result
+    ///
+    /// If \p other contains a value, initializes the contained value as if
+    /// direct-initializing (but not direct-list-initializing) an object of
+    /// type `T` with the expression *other.
+    ///
+    /// If other contains an error, constructs an object that contains a copy
+    /// of that error.
+    ///
+    /// \note This constructor is defined as deleted if
+    ///       `std::is_copy_constructible<T>::value` or
+    ///       `std::is_copy_constructible<E>::value` is `false`
+    ///
+    /// \note This constructor is defined as trivial if both
+    ///       `std::is_trivially_copy_constructible<T>::value` and
+    ///       `std::is_trivially_copy_constructible<E>::value` are `true`
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// const auto r = cpp::result<int,int>{42};
+    /// const auto s = r;
+    ///
+    /// assert(r == s);
+    /// ```
+    ///
+    /// \param other the result to copy
+    constexpr result(const result& other) = default;
+
+    /// \brief Move constructs a result
+    ///
+    /// If other contains a value, initializes the contained value as if
+    /// direct-initializing (but not direct-list-initializing) an object
+    /// of type T with the expression `std::move(*other)` and does not make
+    /// other empty: a moved-from result still contains a value, but the
+    /// value itself is moved from.
+    ///
+    /// If other contains an error, move-constructs this result from that
+    /// error.
+    ///
+    /// \note This constructor is defined as deleted if
+    ///       `std::is_move_constructible<T>::value` or
+    ///       `std::is_move_constructible<E>::value` is `false`
+    ///
+    /// \note This constructor is defined as trivial if both
+    ///       `std::is_trivially_move_constructible<T>::value` and
+    ///       `std::is_trivially_move_constructible<E>::value` are `true`
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// auto r = cpp::result<std::string,int>{"hello world"};
+    /// auto s = std::move(r);
+    ///
+    /// assert(s == "hello world");
+    /// ```
+    ///
+    /// \param other the result to move
+    constexpr result(result&& other) = default;
+
+    /// \{
+    /// \brief Converting copy constructor
+    ///
+    /// If \p other contains a value, constructs a result object
+    /// that contains a value, initialized as if direct-initializing
+    /// (but not direct-list-initializing) an object of type `T` with the
+    /// expression `*other`.
+    ///
+    /// If \p other contains an error, constructs a result object that
+    /// contains an error, initialized as if direct-initializing
+    /// (but not direct-list-initializing) an object of type `E`.
+    ///
+    /// \note This constructor does not participate in overload resolution
+    ///       unless the following conditions are met:
+    ///       - `std::is_constructible_v<T, const U&>` is `true`
+    ///       - T is not constructible or convertible from any expression
+    ///         of type (possibly const) `result<T2,E2>`
+    ///       - E is not constructible or convertible from any expression
+    ///         of type (possible const) `result<T2,E2>`
+    ///
+    /// \note This constructor is explicit if and only if
+    ///       `std::is_convertible_v<const T2&, T>` or
+    ///       `std::is_convertible_v<const E2&, E>` is `false`
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// const auto r = cpp::result<int,int>{42};
+    /// const auto s = cpp::result<long,long>{r};
+    ///
+    /// assert(r == s);
+    /// ```
+    ///
+    /// \param other the other type to convert
+    template <typename T2, typename E2,
+              typename std::enable_if<detail::result_is_implicit_copy_convertible<T,E,T2,E2>::value,int>::type = 0>
+    RESULT_CPP20_CONSTEXPR result(const result<T2,E2>& other)
+      noexcept(std::is_nothrow_constructible<T,const T2&>::value &&
+               std::is_nothrow_constructible<E,const E2&>::value);
+    template <typename T2, typename E2,
+              typename std::enable_if<detail::result_is_explicit_copy_convertible<T,E,T2,E2>::value,int>::type = 0>
+    RESULT_CPP20_CONSTEXPR explicit result(const result<T2,E2>& other)
+      noexcept(std::is_nothrow_constructible<T,const T2&>::value &&
+               std::is_nothrow_constructible<E,const E2&>::value);
+    /// \}
+
+    /// \{
+    /// \brief Converting move constructor
+    ///
+    /// If \p other contains a value, constructs a result object
+    /// that contains a value, initialized as if direct-initializing
+    /// (but not direct-list-initializing) an object of type T with the
+    /// expression `std::move(*other)`.
+    ///
+    /// If \p other contains an error, constructs a result object that
+    /// contains an error, initialized as if direct-initializing
+    /// (but not direct-list-initializing) an object of type E&&.
+    ///
+    /// \note This constructor does not participate in overload resolution
+    ///       unless the following conditions are met:
+    ///       - `std::is_constructible_v<T, const U&>` is `true`
+    ///       - T is not constructible or convertible from any expression
+    ///         of type (possibly const) `result<T2,E2>`
+    ///       - E is not constructible or convertible from any expression
+    ///         of type (possible const) `result<T2,E2>`
+    ///
+    /// \note This constructor is explicit if and only if
+    ///       `std::is_convertible_v<const T2&, T>` or
+    ///       `std::is_convertible_v<const E2&, E>` is `false`
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// auto r = cpp::result<std::unique_ptr<Derived>,int>{
+    ///   std::make_unique<Derived>()
+    /// };
+    /// const auto s = cpp::result<std::unique_ptr<Base>,long>{
+    ///   std::move(r)
+    /// };
+    /// ```
+    ///
+    /// \param other the other type to convert
+    template <typename T2, typename E2,
+              typename std::enable_if<detail::result_is_implicit_move_convertible<T,E,T2,E2>::value,int>::type = 0>
+    RESULT_CPP20_CONSTEXPR result(result<T2,E2>&& other)
+      noexcept(std::is_nothrow_constructible<T,T2&&>::value &&
+               std::is_nothrow_constructible<E,E2&&>::value);
+    template <typename T2, typename E2,
+              typename std::enable_if<detail::result_is_explicit_move_convertible<T,E,T2,E2>::value,int>::type = 0>
+    RESULT_CPP20_CONSTEXPR explicit result(result<T2,E2>&& other)
+      noexcept(std::is_nothrow_constructible<T,T2&&>::value &&
+               std::is_nothrow_constructible<E,E2&&>::value);
+    /// \}
+
+    //-------------------------------------------------------------------------
+
+    /// \brief Constructs a result object that contains a value
+    ///
+    /// The value is initialized as if direct-initializing (but not
+    /// direct-list-initializing) an object of type `T` from the arguments
+    /// `std::forward<Args>(args)...`
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// auto r = cpp::result<std::string,int>{
+    ///   cpp::in_place, "Hello world"
+    /// };
+    /// ```
+    ///
+    /// \param args the arguments to pass to T's constructor
+    template <typename...Args,
+              typename = typename std::enable_if<std::is_constructible<T,Args...>::value>::type>
+    constexpr explicit result(in_place_t, Args&&... args)
+      noexcept(std::is_nothrow_constructible<T, Args...>::value);
+
+    /// \brief Constructs a result object that contains a value
+    ///
+    /// The value is initialized as if direct-initializing (but not
+    /// direct-list-initializing) an object of type `T` from the arguments
+    /// `std::forward<std::initializer_list<U>>(ilist)`,
+    /// `std::forward<Args>(args)...`
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// auto r = cpp::result<std::string,int>{
+    ///   cpp::in_place, {'H','e','l','l','o'}
+    /// };
+    /// ```
+    ///
+    /// \param ilist An initializer list of entries to forward
+    /// \param args  the arguments to pass to T's constructor
+    template <typename U, typename...Args,
+              typename = typename std::enable_if<std::is_constructible<T, std::initializer_list<U>&, Args...>::value>::type>
+    constexpr explicit result(in_place_t,
+                              std::initializer_list<U> ilist,
+                              Args&&...args)
+      noexcept(std::is_nothrow_constructible<T, std::initializer_list<U>, Args...>::value);
+
+    //-------------------------------------------------------------------------
+
+    /// \brief Constructs a result object that contains an error
+    ///
+    /// the value is initialized as if direct-initializing (but not
+    /// direct-list-initializing) an object of type `E` from the arguments
+    /// `std::forward<Args>(args)...`
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// auto r = cpp::result<int,std::string>{
+    ///   cpp::in_place_error, "Hello world"
+    /// };
+    /// ```
+    ///
+    /// \param args the arguments to pass to E's constructor
+    template <typename...Args,
+              typename = typename std::enable_if<std::is_constructible<E,Args...>::value>::type>
+    constexpr explicit result(in_place_error_t, Args&&... args)
+      noexcept(std::is_nothrow_constructible<E, Args...>::value);
+
+    /// \brief Constructs a result object that contains an error
+    ///
+    /// The value is initialized as if direct-initializing (but not
+    /// direct-list-initializing) an object of type `E` from the arguments
+    /// `std::forward<std::initializer_list<U>>(ilist)`,
+    /// `std::forward<Args>(args)...`
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// auto r = cpp::result<int,std::string>{
+    ///   cpp::in_place_error, {'H','e','l','l','o'}
+    /// };
+    /// ```
+    ///
+    /// \param ilist An initializer list of entries to forward
+    /// \param args  the arguments to pass to Es constructor
+    template <typename U, typename...Args,
+              typename = typename std::enable_if<std::is_constructible<E, std::initializer_list<U>&, Args...>::value>::type>
+    constexpr explicit result(in_place_error_t,
+                              std::initializer_list<U> ilist,
+                              Args&&...args)
+      noexcept(std::is_nothrow_constructible<E, std::initializer_list<U>, Args...>::value);
+
+    //-------------------------------------------------------------------------
+
+    /// \{
+    /// \brief Constructs the underlying error of this result
+    ///
+    /// \note This constructor only participates in overload resolution if
+    ///       `E` is constructible from \p e
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// cpp::result<int,int> r = cpp::fail(42);
+    ///
+    /// auto get_error_result() -> cpp::result<int,std::string> {
+    ///   return cpp::fail("hello world!");
+    /// }
+    /// ```
+    ///
+    /// \param e the failure error
+    template <typename E2,
+              typename = typename std::enable_if<std::is_constructible<E,const E2&>::value>::type>
+#if defined(RESULT_ENABLE_TRACE)
+    constexpr /* implicit */ result(const failure<E2>& e,
+                                    source_location where = source_location::current())
+#else
+    constexpr /* implicit */ result(const failure<E2>& e)
+#endif
+      noexcept(std::is_nothrow_constructible<E,const E2&>::value);
+    template <typename E2,
+              typename = typename std::enable_if<std::is_constructible<E,E2&&>::value>::type>
+#if defined(RESULT_ENABLE_TRACE)
+    constexpr /* implicit */ result(failure<E2>&& e,
+                                    source_location where = source_location::current())
+#else
+    constexpr /* implicit */ result(failure<E2>&& e)
+#endif
+      noexcept(std::is_nothrow_constructible<E,E2&&>::value);
+    /// \}
+
+    /// \{
+    /// \brief Constructs a result object that contains a value
+    ///
+    /// The value is initialized as if direct-initializing (but not
+    /// direct-list-initializing) an object of type T with the expression
+    /// value.
+    ///
+    /// \note This constructor is constexpr if the constructor of T
+    ///       selected by direct-initialization is constexpr
+    ///
+    /// \note This constructor does not participate in overload
+    ///       resolution unless `std::is_constructible_v<T, U&&>` is true
+    ///       and `decay_t<U>` is neither `in_place_t`, `in_place_error_t`,
+    ///       nor a `result` type.
+    ///
+    /// \note This constructor is explicit if and only if
+    ///       `std::is_convertible_v<U&&, T>` is `false`
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// cpp::result<int,int> r = 42;
+    ///
+    /// auto get_value() -> cpp::result<std::string,int> {
+    ///   return "hello world!"; // implicit conversion
+    /// }
+    /// ```
+    ///
+    /// \param value the value to copy
+    template <typename U,
+              typename std::enable_if<detail::result_is_explicit_value_convertible<T,U>::value,int>::type = 0>
+    constexpr explicit result(U&& value)
+      noexcept(std::is_nothrow_constructible<T,U>::value);
+    template <typename U,
+              typename std::enable_if<detail::result_is_implicit_value_convertible<T,U>::value,int>::type = 0>
+    constexpr /* implicit */ result(U&& value)
+      noexcept(std::is_nothrow_constructible<T,U>::value);
+    /// \}
+
+    //-------------------------------------------------------------------------
+
+    /// \{
+    /// \brief Allocator-extended constructors
+    ///
+    /// Each of these constructs the result as the matching constructor above
+    /// does, except that `T` and `E` are constructed by uses-allocator
+    /// construction with \p alloc: a `T` or `E` that uses `Alloc` is given
+    /// \p alloc, either after a leading `std::allocator_arg` or as a trailing
+    /// argument; any other type ignores it.
+    ///
+    /// These are what allow a `result` to be stored in allocator-aware
+    /// containers such as `std::pmr::vector`, which propagate their allocator
+    /// into the elements they construct.
+    ///
+    /// \note These constructors are never explicit, since they can only be
+    ///       reached through direct-initialization in practice.
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// auto resource = std::pmr::monotonic_buffer_resource{};
+    /// auto alloc = std::pmr::polymorphic_allocator<char>{&resource};
+    ///
+    /// auto r = cpp::result<std::pmr::string,int>{
+    ///   std::allocator_arg, alloc, "hello world"
+    /// };
+    ///
+    /// assert(r->get_allocator().resource() == &resource);
+    /// ```
+    ///
+    /// \param alloc the allocator to construct `T` or `E` with
+    template <typename Alloc, typename U=T,
+              typename = typename std::enable_if<std::is_constructible<U>::value>::type>
+    RESULT_CPP20_CONSTEXPR result(std::allocator_arg_t, const Alloc& alloc);
+    template <typename Alloc, typename U=T,
+              typename = typename std::enable_if<
+                std::is_copy_constructible<detail::wrapped_result_type<U>>::value &&
+                std::is_copy_constructible<E>::value
+              >::type>
+    RESULT_CPP20_CONSTEXPR result(std::allocator_arg_t, const Alloc& alloc,
+                                  const result& other);
+    template <typename Alloc, typename U=T,
+              typename = typename std::enable_if<
+                std::is_move_constructible<detail::wrapped_result_type<U>>::value &&
+                std::is_move_constructible<E>::value
+              >::type>
+    RESULT_CPP20_CONSTEXPR result(std::allocator_arg_t, const Alloc& alloc,
+                                  result&& other);
+    template <typename Alloc, typename T2, typename E2,
+              typename = typename std::enable_if<detail::result_is_copy_convertible<T,E,T2,E2>::value>::type>
+    RESULT_CPP20_CONSTEXPR result(std::allocator_arg_t, const Alloc& alloc,
+                                  const result<T2,E2>& other);
+    template <typename Alloc, typename T2, typename E2,
+              typename = typename std::enable_if<detail::result_is_move_convertible<T,E,T2,E2>::value>::type>
+    RESULT_CPP20_CONSTEXPR result(std::allocator_arg_t, const Alloc& alloc,
+                                  result<T2,E2>&& other);
+    template <typename Alloc, typename...Args,
+              typename = typename std::enable_if<std::is_constructible<T,Args...>::value>::type>
+    RESULT_CPP20_CONSTEXPR result(std::allocator_arg_t, const Alloc& alloc,
+                                  in_place_t, Args&&...args);
+    template <typename Alloc, typename...Args,
+              typename = typename std::enable_if<std::is_constructible<E,Args...>::value>::type>
+    RESULT_CPP20_CONSTEXPR result(std::allocator_arg_t, const Alloc& alloc,
+                                  in_place_error_t, Args&&...args);
+    template <typename Alloc, typename E2,
+              typename = typename std::enable_if<std::is_constructible<E,const E2&>::value>::type>
+    RESULT_CPP20_CONSTEXPR result(std::allocator_arg_t, const Alloc& alloc,
+                                  const failure<E2>& e);
+    template <typename Alloc, typename E2,
+              typename = typename std::enable_if<std::is_constructible<E,E2&&>::value>::type>
+    RESULT_CPP20_CONSTEXPR result(std::allocator_arg_t, const Alloc& alloc,
+                                  failure<E2>&& e);
+    template <typename Alloc, typename U,
+              typename = typename std::enable_if<detail::result_is_value_convertible<T,U>::value>::type>
+    RESULT_CPP20_CONSTEXPR result(std::allocator_arg_t, const Alloc& alloc,
+                                  U&& value);
+    /// \}
+
+    //-------------------------------------------------------------------------
+
+    /// \brief Copy assigns the result stored in \p other
+    ///
+    /// \note This assignment operator only participates in overload resolution
+    ///       if the following conditions are met:
+    ///       - `std::is_nothrow_copy_constructible_v<T>` is `true`, and
+    ///       - `std::is_nothrow_copy_constructible_v<E>` is `true`
+    ///       this restriction guarantees that no '
+    ///
+    /// \note This assignment operator is defined as trivial if the following
+    ///       conditions are all `true`:
+    ///       - `std::is_trivially_copy_constructible<T>::value`
+    ///       - `std::is_trivially_copy_constructible<E>::value`
+    ///       - `std::is_trivially_copy_assignable<T>::value`
+    ///       - `std::is_trivially_copy_assignable<E>::value`
+    ///       - `std::is_trivially_destructible<T>::value`
+    ///       - `std::is_trivially_destructible<E>::value`
+    ///
+    /// \param other the other result to copy
+    auto operator=(const result& other) -> result& = default;
+
+    /// \brief Move assigns the result stored in \p other
+    ///
+    /// \note This assignment operator only participates in overload resolution
+    ///       if the following conditions are met:
+    ///       - `std::is_nothrow_copy_constructible_v<T>` is `true`, and
+    ///       - `std::is_nothrow_copy_constructible_v<E>` is `true`
+    ///       this restriction guarantees that no 'valueless_by_exception` state
+    ///       may occur.
+    ///
+    /// \note This assignment operator is defined as trivial if the following
+    ///       conditions are all `true`:
+    ///       - `std::is_trivially_move_constructible<T>::value`
+    ///       - `std::is_trivially_move_constructible<E>::value`
+    ///       - `std::is_trivially_move_assignable<T>::value`
+    ///       - `std::is_trivially_move_assignable<E>::value`
+    ///       - `std::is_trivially_destructible<T>::value`
+    ///       - `std::is_trivially_destructible<E>::value`
+    ///
+    /// \param other the other result to copy
+    auto operator=(result&& other) -> result& = default;
+
+    /// \brief Copy-converts the state of \p other
+    ///
+    /// If both `*this` and \p other contain either values or errors, the
+    /// underlying value is constructed as if through assignment.
+    ///
+    /// Otherwise if `*this` contains a value, but \p other contains an error,
+    /// then the contained value is destroyed by calling its destructor. `*this`
+    /// will no longer contain a value after the call, and will now contain `E`
+    /// constructed as if direct-initializing (but not direct-list-initializing)
+    /// an object with an argument of `const E2&`.
+    ///
+    /// If \p other contains a value and `*this` contains an error, then the
+    /// contained error is destroyed by calling its destructor. `*this` now
+    /// contains a value constructed as if direct-initializing (but not
+    /// direct-list-initializing) an object with an argument of `const T2&`.
+    ///
+    /// \note The function does not participate in overload resolution unless
+    ///       - `std::is_nothrow_constructible_v<T, const T2&>`,
+    ///         `std::is_assignable_v<T&, const T2&>`,
+    ///         `std::is_nothrow_constructible_v<E, const E2&>`,
+    ///         `std::is_assignable_v<E&, const E2&>` are all true.
+    ///       - T is not constructible, convertible, or assignable from any
+    ///         expression of type (possibly const) `result<T2,E2>`
+    ///
+    /// \param other the other result object to convert
+    /// \return reference to `(*this)`
+    template <typename T2, typename E2,
+              typename = typename std::enable_if<detail::result_is_copy_convert_assignable<T,E,T2,E2>::value>::type>
+    RESULT_CPP20_CONSTEXPR auto operator=(const result<T2,E2>& other)
+      noexcept(std::is_nothrow_constructible<T,const T2&>::value &&
+               std::is_nothrow_assignable<T,const T2&>::value &&
+               std::is_nothrow_constructible<E,const E2&>::value &&
+               std::is_nothrow_assignable<E,const E2&>::value) -> result&;
+
+    /// \brief Move-converts the state of \p other
+    ///
+    /// If both `*this` and \p other contain either values or errors, the
+    /// underlying value is constructed as if through move-assignment.
+    ///
+    /// Otherwise if `*this` contains a value, but \p other contains an error,
+    /// then the contained value is destroyed by calling its destructor. `*this`
+    /// will no longer contain a value after the call, and will now contain `E`
+    /// constructed as if direct-initializing (but not direct-list-initializing)
+    /// an object with an argument of `E2&&`.
+    ///
+    /// If \p other contains a value and `*this` contains an error, then the
+    /// contained error is destroyed by calling its destructor. `*this` now
+    /// contains a value constructed as if direct-initializing (but not
+    /// direct-list-initializing) an object with an argument of `T2&&`.
+    ///
+    /// \note The function does not participate in overload resolution unless
+    ///       - `std::is_nothrow_constructible_v<T, T2&&>`,
+    ///         `std::is_assignable_v<T&, T2&&>`,
+    ///         `std::is_nothrow_constructible_v<E, E2&&>`,
+    ///         `std::is_assignable_v<E&, E2&&>` are all true.
+    ///       - T is not constructible, convertible, or assignable from any
+    ///         expression of type (possibly const) `result<T2,E2>`
+    ///
+    /// \param other the other result object to convert
+    /// \return reference to `(*this)`
+    template <typename T2, typename E2,
+              typename = typename std::enable_if<detail::result_is_move_convert_assignable<T,E,T2,E2>::value>::type>
+    RESULT_CPP20_CONSTEXPR auto operator=(result<T2,E2>&& other)
+      noexcept(std::is_nothrow_constructible<T,T2&&>::value &&
+               std::is_nothrow_assignable<T,T2&&>::value &&
+               std::is_nothrow_constructible<E,E2&&>::value &&
+               std::is_nothrow_assignable<E,E2&&>::value) -> result&;
+
+    /// \brief Perfect-forwarded assignment
+    ///
+    /// Depending on whether `*this` contains a value before the call, the
+    /// contained value is either direct-initialized from std::forward<U>(value)
+    /// or assigned from std::forward<U>(value).
+    ///
+    /// \note The function does not participate in overload resolution unless
+    ///       - `std::decay_t<U>` is not a result type,
+    ///       - `std::decay_t<U>` is not a failure type
+    ///       - `std::is_nothrow_constructible_v<T, U>` is `true`
+    ///       - `std::is_assignable_v<T&, U>` is `true`
+    ///       - and at least one of the following is `true`:
+    ///           - `T` is not a scalar type;
+    ///           - `std::decay_t<U>` is not `T`.
+    ///
+    /// \param value to assign to the contained value
+    /// \return reference to `(*this)`
+    template <typename U,
+              typename = typename std::enable_if<detail::result_is_value_assignable<T,E,U>::value>::type>
+    RESULT_CPP20_CONSTEXPR auto operator=(U&& value)
+      noexcept(std::is_nothrow_constructible<T,U>::value &&
+               std::is_nothrow_assignable<T,U>::value) -> result&;
+
+    /// \{
+    /// \brief Perfect-forwarded assignment
+    ///
+    /// Depending on whether `*this` contains an error before the call, the
+    /// contained error is either direct-initialized via forwarding the error,
+    /// or assigned from forwarding the error
+    ///
+    /// \note The function does not participate in overload resolution unless
+    ///       - `std::is_nothrow_constructible_v<E, E2>` is `true`, and
+    ///       - `std::is_assignable_v<E&, E2>` is `true`
+    ///
+    /// \param other the failure value to assign to this
+    /// \return reference to `(*this)`
+    template <typename E2,
+              typename = typename std::enable_if<detail::result_is_failure_assignable<T,E,const E2&>::value>::type>
+    RESULT_CPP20_CONSTEXPR auto operator=(const failure<E2>& other)
+      noexcept(std::is_nothrow_constructible<E, const E2&>::value &&
+               std::is_nothrow_assignable<E, const E2&>::value) -> result&;
+    template <typename E2,
+              typename = typename std::enable_if<detail::result_is_failure_assignable<T,E,E2&&>::value>::type>
+    RESULT_CPP20_CONSTEXPR auto operator=(failure<E2>&& other)
+      noexcept(std::is_nothrow_constructible<E, E2&&>::value &&
+               std::is_nothrow_assignable<E, E2&&>::value) -> result&;
+    /// \}
+
+    //-------------------------------------------------------------------------
+    // Modifiers
+    //-------------------------------------------------------------------------
+  public:
+
+    /// \{
+    /// \brief Replaces the contained value or error with a value constructed
+    ///        in-place from \p args
+    ///
+    /// Any contained value or error is destroyed first. If constructing `T`
+    /// may throw, the new value is instead constructed before the current
+    /// state is destroyed and then moved into place, so that `*this` is left
+    /// unchanged if construction throws.
+    ///
+    /// Unlike assignment, this does not require `T`'s construction to be
+    /// `noexcept`.
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// auto r = cpp::result<std::string,int>{cpp::fail(42)};
+    ///
+    /// r.emplace(3u, 'x');
+    /// assert(r == "xxx");
+    /// ```
+    ///
+    /// \note The function does not participate in overload resolution unless
+    ///       - `T` is not a reference,
+    ///       - `std::is_constructible_v<T, Args...>` is `true`, and
+    ///       - either `std::is_nothrow_constructible_v<T, Args...>` or
+    ///         `std::is_nothrow_move_constructible_v<T>` is `true`
+    ///
+    /// \param args the arguments to forward to T's constructor
+    /// \return a reference to the new value
+    template <typename...Args,
+              typename = typename std::enable_if<detail::result_is_emplaceable<T,Args...>::value>::type>
+    RESULT_CPP20_CONSTEXPR auto emplace(Args&&...args) -> T&;
+    template <typename U, typename...Args,
+              typename = typename std::enable_if<detail::result_is_emplaceable<T,std::initializer_list<U>&,Args...>::value>::type>
+    RESULT_CPP20_CONSTEXPR auto emplace(std::initializer_list<U> ilist, Args&&...args) -> T&;
+    /// \}
+
+    /// \brief Assigns \p value to the contained value, reusing its storage,
+    ///        or replaces the contained error with a value constructed from
+    ///        \p value
+    ///
+    /// Unlike `emplace`, a contained value is never destroyed, so any
+    /// resources it owns are reused. For example, assigning into a contained
+    /// `std::vector` keeps its capacity, so that a result that is refilled in
+    /// a loop only allocates when it changes from an error to a value.
+    ///
+    /// This differs from `operator=` when `T` is not nothrow-constructible
+    /// from \p value, in which case `operator=` assigns through an
+    /// intermediate result and discards the existing value.
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// auto r = cpp::result<std::vector<char>,int>{};
+    /// auto chunk = std::vector<char>{};
+    ///
+    /// while (read_chunk(chunk)) {
+    ///   r.assign_or_reuse(chunk); // no allocation once r has the capacity
+    ///   ...
+    /// }
+    /// ```
+    ///
+    /// \note The function does not participate in overload resolution unless
+    ///       - `std::decay_t<U>` is neither a result nor a failure type,
+    ///       - `std::is_assignable_v<T&, U>` is `true`, and
+    ///       - `T` is emplaceable from `U` (see `emplace`)
+    ///
+    /// \param value the value to assign
+    /// \return a reference to the contained value
+    template <typename U,
+              typename = typename std::enable_if<detail::result_is_reuse_assignable<T,U>::value>::type>
+    RESULT_CPP20_CONSTEXPR auto assign_or_reuse(U&& value) -> T&;
+
+    //-------------------------------------------------------------------------
+    // Observers
+    //-------------------------------------------------------------------------
+  public:
+
+    /// \{
+    /// \brief Retrieves a pointer to the contained value
+    ///
+    /// This operator exists to give `result` an `optional`-like API for cases
+    /// where it's known that the `result` already contains a value.
+    ///
+    /// Care must be taken to ensure that this is only used in safe contexts
+    /// where a `T` value is active.
+    ///
+    /// \note The behavior is undefined if `*this` does not contain a value.
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// auto r = cpp::result<Widget,int>{
+    ///   make_widget()
+    /// };
+    ///
+    /// r->do_something();
+    /// ```
+    ///
+    /// \return a pointer to the contained value
+    RESULT_WARN_UNUSED
+    RESULT_CPP14_CONSTEXPR auto operator->()
+      noexcept -> typename std::remove_reference<T>::type*;
+    RESULT_WARN_UNUSED
+    constexpr auto operator->()
+      const noexcept -> typename std::remove_reference<typename std::add_const<T>::type>::type*;
+    /// \}
+
+    /// \{
+    /// \brief Retrieves a reference to the contained value
+    ///
+    /// This operator exists to give `result` an `optional`-like API for cases
+    /// where it's known that the `result` already contains a value.
+    ///
+    /// Care must be taken to ensure that this is only used in safe contexts
+    /// where a `T` value is active.
+    ///
+    /// \note The behaviour is undefined if `*this` does not contain a value
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// auto r = cpp::result<Widget,int>{
+    ///   make_widget()
+    /// };
+    ///
+    /// (*r).do_something();
+    ///
+    /// consume(*r);
+    /// ```
+    ///
+    /// \return a reference to the contained value
+    RESULT_WARN_UNUSED
+    RESULT_CPP14_CONSTEXPR auto operator*()
+      & noexcept -> typename std::add_lvalue_reference<T>::type;
+    RESULT_WARN_UNUSED
+    RESULT_CPP14_CONSTEXPR auto operator*()
+      && noexcept -> typename std::add_rvalue_reference<T>::type;
+    RESULT_WARN_UNUSED
+    constexpr auto operator*()
+      const& noexcept -> typename std::add_lvalue_reference<typename std::add_const<T>::type>::type;
+    RESULT_WARN_UNUSED
+    constexpr auto operator*()
+      const&& noexcept -> typename std::add_rvalue_reference<typename std::add_const<T>::type>::type;
+    /// \}
+
+    //-------------------------------------------------------------------------
+
+    /// \brief Contextually convertible to `true` if `*this` contains a value
+    ///
+    /// This function exists to allow for simple, terse checks for containing
+    /// a value.
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// auto get_result() -> cpp::result<int, int>;
+    /// auto r = get_result();
+    /// if (r) { ... }
+    ///
+    /// assert(static_cast<bool>(cpp::result<int,int>{42}));
+    ///
+    /// assert(!static_cast<bool>(cpp::result<int,int>{cpp::fail(42)}));
+    /// ```
+    ///
+    /// \return `true` if `*this` contains a value, `false` if `*this`
+    ///         does not contain a value
+    RESULT_WARN_UNUSED
+    constexpr explicit operator bool() const noexcept;
+
+    /// \brief Returns `true` if `*this` contains a value
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// auto get_result() -> cpp::result<int, int>;
+    /// auto r = get_result();
+    /// if (r.has_value()) { ... }
+    ///
+    /// assert(cpp::result<int,int>{42}.has_value());
+    ///
+    /// assert(!cpp::result<int,int>{cpp::fail(42)}.has_value());
+    /// ```
+    ///
+    /// \return `true` if `*this` contains a value, `false` if `*this`
+    ///         contains an error
+    RESULT_WARN_UNUSED
+    constexpr auto has_value() const noexcept -> bool;
+
+    /// \brief Returns `true` if `*this` contains an error
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// auto get_result() -> cpp::result<int, int>;
+    ///
+    /// auto r = get_result();
+    /// if (r.has_error()) { ... }
+    ///
+    /// assert(!cpp::result<int,int>{42}.has_error());
+    ///
+    /// assert(cpp::result<int,int>{cpp::fail(42)}.has_error());
+    /// ```
+    ///
+    /// \return `true` if `*this` contains an error, `false` if `*this`
+    ///          contains a value
+    RESULT_WARN_UNUSED
+    constexpr auto has_error() const noexcept -> bool;
+
+    //-------------------------------------------------------------------------
+
+    /// \{
+    /// \brief Returns a reference to the contained value
+    ///
+    /// This function provides checked (throwing) access to the underlying
+    /// value. The constness and refness of this result is propagated to the
+    /// underlying reference.
+    ///
+    /// If this contains an error, an exception is thrown containing the
+    /// underlying error. The error is consumed propagating the same constness
+    /// and refness of this result.
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// assert(cpp::result<int,int>{42}.value() == 42);
+    ///
+    /// auto r = cpp::result<std::unique_ptr<int>,int>{
+    ///   std::make_unique<int>(42)
+    /// };
+    /// auto s = std::move(r).value();
+    ///
+    /// try {
+    ///   auto r = cpp::result<int,int>{ cpp::fail(42) };
+    ///   auto v = r.value();
+    /// } catch (const cpp::bad_result_access<int>& e) {
+    ///   assert(e.error() == 42);
+    /// }
+    /// ```
+    ///
+    /// \throws bad_result_access<E> if `*this` does not contain a value.
+    ///
+    /// \param where the location of the call, reported on failure
+    /// \return the value of `*this`
+    RESULT_WARN_UNUSED
+    RESULT_CPP14_CONSTEXPR auto value(source_location where = source_location::current())
+      & -> typename std::add_lvalue_reference<T>::type;
+    RESULT_WARN_UNUSED
+    RESULT_CPP14_CONSTEXPR auto value(source_location where = source_location::current())
+      && -> typename std::add_rvalue_reference<T>::type;
+    RESULT_WARN_UNUSED
+    constexpr auto value(source_location where = source_location::current())
+      const & -> typename std::add_lvalue_reference<typename std::add_const<T>::type>::type;
+    RESULT_WARN_UNUSED
+    constexpr auto value(source_location where = source_location::current())
+      const && -> typename std::add_rvalue_reference<typename std::add_const<T>::type>::type;
+    /// \}
+
+    /// \{
+    /// \brief Returns the contained error, if one exists, or a
+    ///        default-constructed error value
+    ///
+    /// The `error()` function will not throw any exceptions if `E` does not
+    /// throw any exceptions for the copy or move construction.
+    ///
+    /// This is to limit the possible scope for exceptions, and to allow the
+    /// error type to be treated as a "status"-like type, where the
+    /// default-constructed case is considered the "good" state.
+    ///
+    /// If this function is invoked on an rvalue of a result, the error is
+    /// returned via move-construction
+    ///
+    /// ### Requires
+    ///
+    /// * `std::is_default_constructible<E>::value` is `true`
+    /// * `std::is_copy_constructible<E>::value` or
+    ///   `std::is_move_constructible<E>::value` is `true`
+    /// * `E{}` represents the "good" (non-error) state
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// auto r = cpp::result<int,std::error_code>{ 42 };
+    /// assert(r.error() == std::error_code{});
+    ///
+    /// auto r = cpp::result<int,std::error_code>{
+    ///   cpp::fail(std::io_errc::stream)
+    /// };
+    ///
+    /// assert(r.error() == std::io_errc::stream);
+    /// ```
+    ///
+    /// \return the error or a default-constructed error value
+    RESULT_WARN_UNUSED
+    constexpr auto error() const &
+      noexcept(std::is_nothrow_constructible<E>::value &&
+               std::is_nothrow_copy_constructible<E>::value) -> E;
+    RESULT_WARN_UNUSED
+    RESULT_CPP14_CONSTEXPR auto error() &&
+      noexcept(std::is_nothrow_constructible<E>::value &&
+               std::is_nothrow_move_constructible<E>::value) -> E;
+    /// }
+
+    /// \{
+    /// \brief Returns a reference to the contained error, without copying it
+    ///
+    /// Unlike `error()`, this does not construct a new error object, which
+    /// avoids copying errors that are expensive to copy. The constness and
+    /// refness of this result is propagated to the underlying reference.
+    ///
+    /// \note The behaviour is undefined if `*this` does not contain an error
+    ///
+    /// \note If the error is encoded in the niche of the value (see
+    ///       `result_niche_traits`), there is no error object to refer to, so
+    ///       the error is returned by value instead
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// auto r = load_config();
+    /// if (r.has_error()) {
+    ///   log(r.error_ref()); // does not copy the error
+    /// }
+    ///
+    /// auto e = std::move(r).error_ref(); // moves the error out
+    /// ```
+    ///
+    /// \return a reference to the error of `*this`
+    RESULT_WARN_UNUSED
+    RESULT_CPP14_CONSTEXPR auto error_ref()
+      & noexcept -> detail::result_error_reference<T,E>;
+    RESULT_WARN_UNUSED
+    RESULT_CPP14_CONSTEXPR auto error_ref()
+      && noexcept -> detail::result_error_rvalue_reference<T,E>;
+    RESULT_WARN_UNUSED
+    constexpr auto error_ref()
+      const & noexcept -> detail::result_const_error_reference<T,E>;
+    /// \}
+
+    /// \{
+    /// \brief Returns a pointer to the contained error, or `nullptr` if
+    ///        `*this` contains a value
+    ///
+    /// This allows checking for and observing an error in one expression,
+    /// without copying the error.
+    ///
+    /// \note This is not available if the error is encoded in the niche of
+    ///       the value, since there is no error object to point to
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// if (const auto* e = load_config().error_if()) {
+    ///   log(*e);
+    /// }
+    /// ```
+    ///
+    /// \return a pointer to the error of `*this`, or `nullptr`
+    RESULT_WARN_UNUSED
+    RESULT_CPP14_CONSTEXPR auto error_if() noexcept -> E*;
+    RESULT_WARN_UNUSED
+    constexpr auto error_if() const noexcept -> const E*;
+    /// \}
+
+    /// \{
+    /// \brief Asserts an expectation that this result contains an error,
+    ///        throwing a bad_result_access on failure
+    ///
+    /// If this function is invoked from an rvalue of `result`, then this will
+    /// consume the underlying error first, if there is one.
+    ///
+    /// \note This function exists as a means to allow for results to be marked
+    ///       `used` without requiring directly inspecting the underlying value.
+    ///       This is, in effect, equivalent to `assert(res.has_value())`,
+    ///       however it uses exceptions to ensure the stack can be unwound, and
+    ///       exceptions invoked.
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// auto start_service() -> cpp::result<void,int>;
+    ///
+    /// start_service().expect("Service failed to start!");
+    /// ```
+    ///
+    /// \param message the message to provide to this expectation
+    /// \param where the location of the call, reported on failure
+    ///
+    /// \return the value of `*this`
+    template <typename String,
+            typename = typename std::enable_if<(
+                    std::is_convertible<String,const std::string&>::value &&
+                    std::is_copy_constructible<E>::value
+            )>::type>
+    RESULT_CPP14_CONSTEXPR auto expect(String&& message,
+                                       source_location where = source_location::current()) & -> typename std::add_lvalue_reference<T>::type;
+    template <typename String,
+            typename = typename std::enable_if<(
+                    std::is_convertible<String,const std::string&>::value &&
+                    std::is_move_constructible<E>::value
+            )>::type>
+    RESULT_CPP14_CONSTEXPR auto expect(String&& message,
+                                       source_location where = source_location::current()) && -> typename std::add_rvalue_reference<T>::type;
+    template <typename String,
+              typename = typename std::enable_if<(
+                std::is_convertible<String,const std::string&>::value &&
+                std::is_copy_constructible<E>::value
+              )>::type>
+    RESULT_CPP14_CONSTEXPR auto expect(String&& message,
+                                       source_location where = source_location::current()) const & -> typename std::add_lvalue_reference<typename std::add_const<T>::type>::type;
+    template <typename String,
+            typename = typename std::enable_if<(
+                    std::is_convertible<String,const std::string&>::value &&
+                    std::is_copy_constructible<E>::value
+            )>::type>
+    RESULT_CPP14_CONSTEXPR auto expect(String&& message,
+                                       source_location where = source_location::current()) const && -> typename std::add_rvalue_reference<typename std::add_const<T>::type>::type;
+    /// \}
+
+    //-------------------------------------------------------------------------
+    // Monadic Functionalities
+    //-------------------------------------------------------------------------
+  public:
+
+    /// \{
+    /// \brief Returns the contained value if `*this` has a value,
+    ///        otherwise returns \p default_value.
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// auto r = cpp::result<int,int>{42};
+    /// assert(r.value_or(0) == 42);
+    ///
+    /// auto r = cpp::result<int,int>{cpp::fail(42)};
+    /// assert(r.value_or(0) == 0);
+    /// ```
+    ///
+    /// \param default_value the value to use in case `*this` contains an error
+    /// \return the contained value or \p default_value
+    template <typename U>
+    RESULT_WARN_UNUSED
+    constexpr auto value_or(U&& default_value)
+      const & -> typename std::remove_reference<T>::type;
+    template <typename U>
+    RESULT_WARN_UNUSED
+    RESULT_CPP14_CONSTEXPR auto value_or(U&& default_value)
+      && -> typename std::remove_reference<T>::type;
+    /// \}
+
+    /// \{
+    /// \brief Returns the contained error if `*this` has an error,
+    ///        otherwise returns \p default_error.
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// auto r = cpp::result<int,int>{42};
+    /// assert(r.error_or(0) == cpp::fail(0));
+    ///
+    /// auto r = cpp::result<int,int>{cpp::fail(42)};
+    /// assert(r.error_or(0) == cpp::fail(42));
+    /// ```
+    ///
+    /// \param default_error the error to use in case `*this` is empty
+    /// \return the contained value or \p default_error
+    template <typename U>
+    RESULT_WARN_UNUSED
+    constexpr auto error_or(U&& default_error) const & -> error_type;
+    template <typename U>
+    RESULT_WARN_UNUSED
+    RESULT_CPP14_CONSTEXPR auto error_or(U&& default_error) && -> error_type;
+    /// \}
+
+    /// \{
+    /// \brief Returns the contained value if `*this` has a value,
+    ///        otherwise returns the result of invoking \p fn.
+    ///
+    /// Unlike `value_or`, the fallback is only computed if it is needed.
+    /// \p fn is invoked with the contained error if it accepts it, and with
+    /// no arguments otherwise.
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// auto r = cpp::result<std::string,int>{"hello"};
+    /// assert(r.value_or_else(load_default) == "hello"); // not called
+    ///
+    /// auto r = cpp::result<std::string,int>{cpp::fail(42)};
+    /// assert(r.value_or_else([](int e){ return std::to_string(e); }) == "42");
+    /// ```
+    ///
+    /// \param fn the function to compute the value with, in case `*this`
+    ///           contains an error
+    /// \return the contained value or the result of \p fn
+    template <typename Fn>
+    RESULT_WARN_UNUSED
+    constexpr auto value_or_else(Fn&& fn)
+      const & -> typename std::remove_reference<T>::type;
+    template <typename Fn>
+    RESULT_WARN_UNUSED
+    RESULT_CPP14_CONSTEXPR auto value_or_else(Fn&& fn)
+      && -> typename std::remove_reference<T>::type;
+    /// \}
+
+    /// \{
+    /// \brief Returns the contained error if `*this` has an error,
+    ///        otherwise returns the result of invoking \p fn.
+    ///
+    /// Unlike `error_or`, the fallback is only computed if it is needed.
+    /// \p fn is invoked with the contained value if it accepts it, and with
+    /// no arguments otherwise.
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// auto r = cpp::result<int,std::string>{42};
+    /// assert(r.error_or_else([](int v){ return std::to_string(v); }) == "42");
+    ///
+    /// auto r = cpp::result<int,std::string>{cpp::fail("error")};
+    /// assert(r.error_or_else(make_error) == "error"); // not called
+    /// ```
+    ///
+    /// \param fn the function to compute the error with, in case `*this`
+    ///           contains a value
+    /// \return the contained error or the result of \p fn
+    template <typename Fn>
+    RESULT_WARN_UNUSED
+    constexpr auto error_or_else(Fn&& fn) const & -> error_type;
+    template <typename Fn>
+    RESULT_WARN_UNUSED
+    RESULT_CPP14_CONSTEXPR auto error_or_else(Fn&& fn) && -> error_type;
+    /// \}
+
+    //-------------------------------------------------------------------------
+
+    /// \brief Returns a result containing \p value if this result contains
+    ///        a value, otherwise returns a result containing the current
+    ///        error.
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// auto r = cpp::result<int,int>{42};
+    /// assert(r.and_then(100) == 100);
+    ///
+    /// auto r = cpp::result<int,int>{cpp::fail(42)};
+    /// assert(r.and_then(100) == cpp::fail(42));
+    /// ```
+    ///
+    /// \param value the value to return as a result
+    /// \return a result of \p value if this contains a value
+    template <typename U>
+    RESULT_WARN_UNUSED
+    constexpr auto and_then(U&& value) const -> result<typename std::decay<U>::type,E>;
+
+    /// \{
+    /// \brief Invokes the function \p fn with the value of this result as
+    ///        the argument
+    ///
+    /// If this result contains an error, a result of the error is returned
+    ///
+    /// The function being called must return a `result` type or the program
+    /// is ill-formed
+    ///
+    /// If this is called on an rvalue of `result` which contains an error,
+    /// the returned `result` is constructed from an rvalue of that error.
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// auto to_string(int) -> cpp::result<std::string,int>;
+    /// auto r = cpp::result<int,int>{42};
+    /// assert(r.flat_map(to_string) == "42");
+    ///
+    /// auto r = cpp::result<int,int>{cpp::fail(42)};
+    /// assert(r.flat_map(to_string) == cpp::fail(42));
+    /// ```
+    ///
+    /// \param fn the function to invoke with this
+    /// \return The result of the function being called
+    template <typename Fn>
+    RESULT_WARN_UNUSED
+    constexpr auto flat_map(Fn&& fn) const & -> detail::invoke_result_t<Fn, const T&>;
+    template <typename Fn>
+    RESULT_WARN_UNUSED
+    RESULT_CPP14_CONSTEXPR auto flat_map(Fn&& fn) && -> detail::invoke_result_t<Fn, T&&>;
+    /// \}
+
+    /// \{
+    /// \brief Invokes the function \p fn with the value of this result as
+    ///        the argument
+    ///
+    /// If this result is an error, the result of this function is that
+    /// error. Otherwise this function wraps the result and returns it as an
+    /// result.
+    ///
+    /// If this is called on an rvalue of `result` which contains an error,
+    /// the returned `result` is constructed from an rvalue of that error.
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// auto to_string(int) -> std::string;
+    /// auto r = cpp::result<int,int>{42};
+    /// assert(r.map(to_string) == "42");
+    ///
+    /// auto r = cpp::result<int,int>{cpp::fail(42)};
+    /// assert(r.map(to_string) == cpp::fail(42));
+    /// ```
+    ///
+    /// \param fn the function to invoke with this
+    /// \return The result result of the function invoked
+    template <typename Fn>
+    RESULT_WARN_UNUSED
+    constexpr auto map(Fn&& fn) const & -> result<detail::invoke_result_t<Fn,const T&>,E>;
+    template <typename Fn>
+    RESULT_WARN_UNUSED
+    RESULT_CPP14_CONSTEXPR auto map(Fn&& fn) && -> result<detail::invoke_result_t<Fn,T&&>,E>;
+    /// \}
+
+    /// \{
+    /// \brief Invokes the function \p fn with the error of this result as
+    ///        the argument
+    ///
+    /// If this result contains a value, the result of this function is that
+    /// value. Otherwise the function is called with that error and returns the
+    /// result as a result.
+    ///
+    /// If this is called on an rvalue of `result` which contains a value,
+    /// the returned `result` is constructed from an rvalue of that value.
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// auto to_string(int) -> std::string;
+    /// auto r = cpp::result<int,int>{42};
+    /// assert(r.map_error(to_string) == 42);
+    ///
+    /// auto r = cpp::result<int,int>{cpp::fail(42)};
+    /// assert(r.map_error(to_string) == cpp::fail("42"));
+    ///
+    /// auto r = cpp::result<std::string,int>{};
+    /// auto s = r.map(std::string::size); // 's' contains 'result<size_t,int>'
+    /// ```
+    ///
+    /// \param fn the function to invoke with this
+    /// \return The result result of the function invoked
+    template <typename Fn>
+    RESULT_WARN_UNUSED
+    constexpr auto map_error(Fn&& fn)
+      const & -> result<T, detail::invoke_result_t<Fn,const E&>>;
+    template <typename Fn>
+    RESULT_WARN_UNUSED
+    RESULT_CPP14_CONSTEXPR auto map_error(Fn&& fn)
+      && -> result<T, detail::invoke_result_t<Fn,E&&>>;
+    /// \}
+
+    /// \{
+    /// \brief Invokes the function \p fn with the error of this result as
+    ///        the argument
+    ///
+    /// If this result contains a value, a result of the value is returned
+    ///
+    /// The function being called must return a `result` type or the program
+    /// is ill-formed
+    ///
+    /// If this is called on an rvalue of `result` which contains an error,
+    /// the returned `result` is constructed from an rvalue of that error.
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// auto to_string(int) -> cpp::result<int,std::string>;
+    /// auto r = cpp::result<int,int>{42};
+    /// assert(r.flat_map(to_string) == 42);
+    ///
+    /// auto r = cpp::result<int,int>{cpp::fail(42)};
+    /// assert(r.flat_map(to_string) == cpp::fail("42"));
+    /// ```
+    ///
+    /// \param fn the function to invoke with this
+    /// \return The result of the function being called
+    template <typename Fn>
+    RESULT_WARN_UNUSED
+    constexpr auto flat_map_error(Fn&& fn)
+      const & -> detail::invoke_result_t<Fn, const E&>;
+    template <typename Fn>
+    RESULT_WARN_UNUSED
+    RESULT_CPP14_CONSTEXPR auto flat_map_error(Fn&& fn)
+      && -> detail::invoke_result_t<Fn, E&&>;
+    /// \}
+
+    /// \{
+    /// \brief Returns this result if it contains a value, otherwise returns
+    ///        the result of invoking \p fn
+    ///
+    /// \p fn is only invoked if this result contains an error. It is given
+    /// that error if it accepts it, and is otherwise called with no
+    /// arguments.
+    ///
+    /// The function being called must return a `result` with the same value
+    /// type, or the program is ill-formed. The error type may differ.
+    ///
+    /// If this is called on an rvalue of `result` which contains a value,
+    /// the returned `result` is constructed from an rvalue of that value.
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// auto load_from_cache() -> cpp::result<config,io_error>;
+    /// auto load_from_disk() -> cpp::result<config,io_error>;
+    ///
+    /// auto r = load_from_cache().or_else(load_from_disk);
+    /// ```
+    ///
+    /// \param fn the function to invoke in case of an error
+    /// \return this result if it contains a value, or the result of \p fn
+    template <typename Fn>
+    RESULT_WARN_UNUSED
+    constexpr auto or_else(Fn&& fn)
+      const & -> detail::fallback_result_t<Fn, const E&>;
+    template <typename Fn>
+    RESULT_WARN_UNUSED
+    RESULT_CPP14_CONSTEXPR auto or_else(Fn&& fn)
+      && -> detail::fallback_result_t<Fn, E&&>;
+    /// \}
+
+    //-------------------------------------------------------------------------
+    // Private Constructors
+    //-------------------------------------------------------------------------
+  private:
+
+    /// \brief Constructs a result object that contains an error propagated
+    ///        from another result
+    ///
+    /// \param args the arguments to pass to E's constructor
+    template <typename...Args>
+    constexpr explicit result(detail::propagated_error_t, Args&&... args)
+      noexcept(std::is_nothrow_constructible<E, Args...>::value);
+
+    //-------------------------------------------------------------------------
+    // Private Members
+    //-------------------------------------------------------------------------
+  private:
+
+    detail::result_storage<T,E> m_storage;
+
+    //-------------------------------------------------------------------------
+    // Private Monadic Functions
+    //-------------------------------------------------------------------------
+  private:
+
+    /// \{
+    /// \brief Map implementations for void and non-void functions
+    ///
+    /// \param fn the function
+    template <typename Fn>
+    constexpr auto map_impl(std::true_type, Fn&& fn) const & -> result<void,E>;
+    template <typename Fn>
+    constexpr auto map_impl(std::false_type, Fn&& fn) const & -> result<detail::invoke_result_t<Fn,const T&>,E>;
+    template <typename Fn>
+    RESULT_CPP14_CONSTEXPR auto map_impl(std::true_type, Fn&& fn) && -> result<void,E>;
+    template <typename Fn>
+    RESULT_CPP14_CONSTEXPR auto map_impl(std::false_type, Fn&& fn) && -> result<detail::invoke_result_t<Fn,T&&>,E>;
+    /// \}
+  };
+
+  //===========================================================================
+  // class : result<void,E>
+  //===========================================================================
+
+  /////////////////////////////////////////////////////////////////////////////
+  /// \brief Partial specialization of `result<void, E>`
+  ///
+  /// \tparam E the underlying error type
+  /////////////////////////////////////////////////////////////////////////////
+  template <typename E>
+  class RESULT_NODISCARD result<void,E>
+  {
+    // Type requirements
+
+    static_assert(
+      !std::is_void<typename std::decay<E>::type>::value,
+      "It is ill-formed for E to be (possibly CV-qualified) void type"
+    );
+    static_assert(
+      !std::is_abstract<E>::value,
+      "It is ill-formed for E to be abstract type"
+    );
+    static_assert(
+      !is_failure<typename std::decay<E>::type>::value,
+      "It is ill-formed for E to be a (possibly CV-qualified) 'failure' type"
+    );
+    static_assert(
+      !std::is_reference<E>::value,
+      "It is ill-formed for E to be a reference type. "
+      "Only T types may be lvalue references"
+    );
+
+    // Friendship
+
+    friend detail::result_error_extractor;
+
+    template <typename T2, typename E2>
+    friend class result;
+
+    //-------------------------------------------------------------------------
+    // Public Member Types
+    //-------------------------------------------------------------------------
+  public:
+
+    using value_type = void; ///< The value type of this result
+    using error_type = E;    ///< The error type of this result
+    using failure_type = failure<E>; ///< The failure type
+
+    template <typename U>
+    using rebind = result<U,E>; ///< Rebinds the result type
+
+    //-------------------------------------------------------------------------
+    // Constructor / Assignment
+    //-------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs a `result` object in a value state
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// auto r = cpp::result<void,int>{};
+    /// ```
+    constexpr result() noexcept;
+
+    /// \brief Copy constructs this result
+    ///
+    /// If other contains an error, constructs an object that contains a copy
+    /// of that error.
+    ///
+    /// \note This constructor is defined as deleted if
+    ///       `std::is_copy_constructible<E>::value` is `false`
+    ///
+    /// \note This constructor is defined as trivial if both
+    ///       `std::is_trivially_copy_constructible<E>::value` are `true`
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// const auto r = cpp::result<void,int>{};
+    /// const auto s = r;
+    /// ```
+    ///
+    /// \param other the result to copy
+    constexpr result(const result& other) = default;
+
+    /// \brief Move constructs a result
+    ///
+    /// If other contains an error, move-constructs this result from that
+    /// error.
+    ///
+    /// \note This constructor is defined as deleted if
+    ///       `std::is_move_constructible<E>::value` is `false`
+    ///
+    /// \note This constructor is defined as trivial if both
+    ///       `std::is_trivially_move_constructible<E>::value` are `true`
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// auto r = cpp::result<void,std::string>{};
+    /// auto s = std::move(r);
+    /// ```
+    ///
+    /// \param other the result to move
+    constexpr result(result&& other) = default;
+
+    /// \brief Converting copy constructor
+    ///
+    /// If \p other contains a value, constructs a result object that is not
+    /// in an error state -- ignoring the value.
+    ///
+    /// If \p other contains an error, constructs a result object that
+    /// contains an error, initialized as if direct-initializing
+    /// (but not direct-list-initializing) an object of type `E`.
+    ///
+    /// \note This constructor does not participate in overload resolution
+    ///       unless the following conditions are met:
+    ///       - `std::is_constructible_v<E, const E2&>` is `true`
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// const auto r = cpp::result<int,int>{42};
+    /// const auto s = cpp::result<void,int>{r};
+    /// ```
+    ///
+    /// \param other the other type to convert
+    template <typename U, typename E2,
+              typename = typename std::enable_if<std::is_constructible<E,E2>::value>::type>
+    RESULT_CPP20_CONSTEXPR explicit result(const result<U,E2>& other)
+      noexcept(std::is_nothrow_constructible<E,const E2&>::value);
+
+    /// \brief Converting move constructor
+    ///
+    /// If \p other contains an error, constructs a result object that
+    /// contains an error, initialized as if direct-initializing
+    /// (but not direct-list-initializing) an object of type E&&.
+    ///
+    /// \note This constructor does not participate in overload resolution
+    ///       unless the following conditions are met:
+    ///       - `std::is_constructible_v<E, const E2&>` is `true`
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// auto r = cpp::result<int,std::string>{42};
+    /// auto s = cpp::result<void,std::string>{
+    ///   std::move(r)
+    /// };
+    /// ```
+    ///
+    /// \param other the other type to convert
+    template <typename U, typename E2,
+              typename = typename std::enable_if<std::is_constructible<E,E2>::value>::type>
+    RESULT_CPP20_CONSTEXPR explicit result(result<U,E2>&& other)
+      noexcept(std::is_nothrow_constructible<E,E2&&>::value);
+
+    //-------------------------------------------------------------------------
+
+    /// \brief Constructs a result object in a value state
+    ///
+    /// This constructor exists primarily for symmetry with the `result<T,E>`
+    /// constructor. Unlike the `T` overload, no variadic arguments may be
+    /// supplied.
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// auto r = cpp::result<void,std::string>{cpp::in_place};
+    /// ```
+    constexpr explicit result(in_place_t) noexcept;
+
+    /// \brief Constructs a result object that contains an error
+    ///
+    /// the value is initialized as if direct-initializing (but not
+    /// direct-list-initializing) an object of type `E` from the arguments
+    /// `std::forward<Args>(args)...`
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// auto r = cpp::result<void,std::string>{
+    ///   cpp::in_place_error, "Hello world"
+    /// };
+    /// ```
+    ///
+    /// \param args the arguments to pass to `E`'s constructor
+    template <typename...Args,
+              typename = typename std::enable_if<std::is_constructible<E,Args...>::value>::type>
+    constexpr explicit result(in_place_error_t, Args&&... args)
+      noexcept(std::is_nothrow_constructible<E, Args...>::value);
+
+    /// \brief Constructs a result object that contains an error
+    ///
+    /// The value is initialized as if direct-initializing (but not
+    /// direct-list-initializing) an object of type `E` from the arguments
+    /// `std::forward<std::initializer_list<U>>(ilist)`,
+    /// `std::forward<Args>(args)...`
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// auto r = cpp::result<void,std::string>{
+    ///   cpp::in_place_error, {'H','e','l','l','o'}
+    /// };
+    /// ```
+    ///
+    /// \param ilist An initializer list of entries to forward
+    /// \param args  the arguments to pass to Es constructor
+    template <typename U, typename...Args,
+              typename = typename std::enable_if<std::is_constructible<E, std::initializer_list<U>&, Args...>::value>::type>
+    constexpr explicit result(in_place_error_t,
+                              std::initializer_list<U> ilist,
+                              Args&&...args)
+      noexcept(std::is_nothrow_constructible<E, std::initializer_list<U>, Args...>::value);
+
+    //-------------------------------------------------------------------------
+
+    /// \{
+    /// \brief Constructs the underlying error of this result
+    ///
+    /// \note This constructor only participates in overload resolution if
+    ///       `E` is constructible from \p e
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// cpp::result<void,int> r = cpp::fail(42);
+    ///
+    /// auto get_error_result() -> cpp::result<void,std::string> {
+    ///   return cpp::fail("hello world!");
+    /// }
+    /// ```
+    ///
+    /// \param e the failure error
+    template <typename E2,
+              typename = typename std::enable_if<std::is_constructible<E,const E2&>::value>::type>
+#if defined(RESULT_ENABLE_TRACE)
+    constexpr /* implicit */ result(const failure<E2>& e,
+                                    source_location where = source_location::current())
+#else
+    constexpr /* implicit */ result(const failure<E2>& e)
+#endif
+      noexcept(std::is_nothrow_constructible<E,const E2&>::value);
+    template <typename E2,
+              typename = typename std::enable_if<std::is_constructible<E,E2&&>::value>::type>
+#if defined(RESULT_ENABLE_TRACE)
+    constexpr /* implicit */ result(failure<E2>&& e,
+                                    source_location where = source_location::current())
+#else
+    constexpr /* implicit */ result(failure<E2>&& e)
+#endif
+      noexcept(std::is_nothrow_constructible<E,E2&&>::value);
+    /// \}
+
+    //-------------------------------------------------------------------------
+
+    /// \{
+    /// \brief Allocator-extended constructors
+    ///
+    /// Each of these constructs the result as the matching constructor above
+    /// does, except that `E` is constructed by uses-allocator construction
+    /// with \p alloc. An `E` that does not use `Alloc` ignores it.
+    ///
+    /// \note These constructors are never explicit, since they can only be
+    ///       reached through direct-initialization in practice.
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// auto resource = std::pmr::monotonic_buffer_resource{};
+    /// auto alloc = std::pmr::polymorphic_allocator<char>{&resource};
+    ///
+    /// auto r = cpp::result<void,std::pmr::string>{
+    ///   std::allocator_arg, alloc, cpp::in_place_error, "hello world"
+    /// };
+    ///
+    /// assert(r.error_ref().get_allocator().resource() == &resource);
+    /// ```
+    ///
+    /// \param alloc the allocator to construct `E` with
+    template <typename Alloc>
+    RESULT_CPP20_CONSTEXPR result(std::allocator_arg_t, const Alloc& alloc);
+    template <typename Alloc, typename E2=E,
+              typename = typename std::enable_if<std::is_copy_constructible<E2>::value>::type>
+    RESULT_CPP20_CONSTEXPR result(std::allocator_arg_t, const Alloc& alloc,
+                                  const result& other);
+    template <typename Alloc, typename E2=E,
+              typename = typename std::enable_if<std::is_move_constructible<E2>::value>::type>
+    RESULT_CPP20_CONSTEXPR result(std::allocator_arg_t, const Alloc& alloc,
+                                  result&& other);
+    template <typename Alloc>
+    RESULT_CPP20_CONSTEXPR result(std::allocator_arg_t, const Alloc& alloc,
+                                  in_place_t);
+    template <typename Alloc, typename...Args,
+              typename = typename std::enable_if<std::is_constructible<E,Args...>::value>::type>
+    RESULT_CPP20_CONSTEXPR result(std::allocator_arg_t, const Alloc& alloc,
+                                  in_place_error_t, Args&&...args);
+    template <typename Alloc, typename E2,
+              typename = typename std::enable_if<std::is_constructible<E,const E2&>::value>::type>
+    RESULT_CPP20_CONSTEXPR result(std::allocator_arg_t, const Alloc& alloc,
+                                  const failure<E2>& e);
+    template <typename Alloc, typename E2,
+              typename = typename std::enable_if<std::is_constructible<E,E2&&>::value>::type>
+    RESULT_CPP20_CONSTEXPR result(std::allocator_arg_t, const Alloc& alloc,
+                                  failure<E2>&& e);
+    /// \}
+
+    //-------------------------------------------------------------------------
+
+    /// \brief Copy assigns the result stored in \p other
+    ///
+    /// \note The function does not participate in overload resolution unless
+    ///       - `std::is_nothrow_copy_constructible_v<E>` is `true`
+    ///       this restriction guarantees that no 'valueless_by_exception` state
+    ///       may occur.
+    ///
+    /// \note This assignment operator is defined as trivial if the following
+    ///       conditions are all `true`:
+    ///       - `std::is_trivially_copy_constructible<E>::value`
+    ///       - `std::is_trivially_copy_assignable<E>::value`
+    ///       - `std::is_trivially_destructible<E>::value`
+    ///
+    /// \param other the other result to copy
+    auto operator=(const result& other) -> result& = default;
+
+    /// \brief Move assigns the result stored in \p other
+    ///
+    /// \note The function does not participate in overload resolution unless
+    ///       - `std::is_nothrow_copy_constructible_v<E>` is `true`
+    ///       this restriction guarantees that no 'valueless_by_exception` state
+    ///       may occur.
+    ///
+    /// \note This assignment operator is defined as trivial if the following
+    ///       conditions are all `true`:
+    ///       - `std::is_trivially_move_constructible<E>::value`
+    ///       - `std::is_trivially_move_assignable<E>::value`
+    ///       - `std::is_trivially_destructible<E>::value`
+    ///
+    /// \param other the other result to copy
+    auto operator=(result&& other) -> result& = default;
+
+    /// \brief Copy-converts the state of \p other
+    ///
+    /// If both this and \p other contain an error, the underlying error is
+    /// assigned through copy-assignment.
+    ///
+    /// If \p other contains a value state, this result is constructed in a
+    /// value state.
+    ///
+    /// If \p other contans an error state, and this contains a value state,
+    /// the underlying error is constructed through copy-construction.
+    ///
+    /// \note The function does not participate in overload resolution unless
+    ///       - `std::is_nothrow_constructible_v<E, const E2&>`,
+    ///         `std::is_assignable_v<E&, const E2&>` are all `true`.
+    ///
+    /// \param other the other result object to convert
+    /// \return reference to `(*this)`
+    template <typename E2,
+              typename = typename std::enable_if<detail::result_is_failure_assignable<detail::unit,E,const E2&>::value>::type>
+    RESULT_CPP20_CONSTEXPR auto operator=(const result<void,E2>& other)
+      noexcept(std::is_nothrow_constructible<E, const E2&>::value &&
+               std::is_nothrow_assignable<E, const E2&>::value) -> result&;
+
+    /// \brief Move-converts the state of \p other
+    ///
+    /// If both this and \p other contain an error, the underlying error is
+    /// assigned through move-assignment.
+    ///
+    /// If \p other contains a value state, this result is constructed in a
+    /// value state.
+    ///
+    /// If \p other contans an error state, and this contains a value state,
+    /// the underlying error is constructed through move-construction.
+    ///
+    /// \note The function does not participate in overload resolution unless
+    ///       - `std::is_nothrow_constructible_v<E, E2&&>`,
+    ///         `std::is_assignable_v<E&, E2&&>` are all `true`.
+    ///
+    /// \param other the other result object to convert
+    /// \return reference to `(*this)`
+    template <typename E2,
+              typename = typename std::enable_if<detail::result_is_failure_assignable<detail::unit,E,E2&&>::value>::type>
+    RESULT_CPP20_CONSTEXPR auto operator=(result<void,E2>&& other)
+      noexcept(std::is_nothrow_constructible<E, E2&&>::value &&
+               std::is_nothrow_assignable<E, E2&&>::value) -> result&;
+
+    /// \{
+    /// \brief Perfect-forwarded assignment
+    ///
+    /// Depending on whether `*this` contains an error before the call, the
+    /// contained error is either direct-initialized via forwarding the error,
+    /// or assigned from forwarding the error
+    ///
+    /// \note The function does not participate in overload resolution unless
+    ///       - `std::is_nothrow_constructible_v<E, E2>` is `true`, and
+    ///       - `std::is_assignable_v<E&, E2>` is `true`
+    ///
+    /// \param other the failure value to assign to this
+    /// \return reference to `(*this)`
+    template <typename E2,
+              typename = typename std::enable_if<detail::result_is_failure_assignable<detail::unit,E,const E2&>::value>::type>
+    RESULT_CPP20_CONSTEXPR auto operator=(const failure<E2>& other)
+      noexcept(std::is_nothrow_constructible<E, const E2&>::value &&
+               std::is_nothrow_assignable<E, const E2&>::value) -> result&;
+    template <typename E2,
+              typename = typename std::enable_if<detail::result_is_failure_assignable<detail::unit,E,E2&&>::value>::type>
+    RESULT_CPP20_CONSTEXPR auto operator=(failure<E2>&& other)
+      noexcept(std::is_nothrow_constructible<E, E2&&>::value &&
+               std::is_nothrow_assignable<E, E2&&>::value) -> result&;
+    /// \}
+
+    //-------------------------------------------------------------------------
+    // Modifiers
+    //-------------------------------------------------------------------------
+  public:
+
+    /// \brief Replaces the contained error, if any, with a value
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// auto r = cpp::result<void,int>{cpp::fail(42)};
+    ///
+    /// r.emplace();
+    /// assert(r.has_value());
+    /// ```
+    RESULT_CPP20_CONSTEXPR auto emplace() noexcept -> void;
+
+    //-------------------------------------------------------------------------
+    // Observers
+    //-------------------------------------------------------------------------
+  public:
+
+
+    /// \brief Contextually convertible to `true` if `*this` does not contain
+    ///        an error
+    ///
+    /// This function exists to allow for simple, terse checks for containing
+    /// a value.
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// auto get_result() -> cpp::result<void, int>;
+    /// auto r = get_result();
+    /// if (r) { ... }
+    ///
+    /// assert(static_cast<bool>(cpp::result<void,int>{}));
+    ///
+    /// assert(!static_cast<bool>(cpp::result<void,int>{cpp::fail(42)}));
+    /// ```
+    ///
+    /// \return `true` if `*this` contains a value, `false` if `*this`
+    ///         does not contain a value
+    RESULT_WARN_UNUSED
+    constexpr explicit operator bool() const noexcept;
+
+    /// \copydoc result<T,E>::has_value
+    RESULT_WARN_UNUSED
+    constexpr auto has_value() const noexcept -> bool;
+
+    /// \copydoc result<T,E>::has_error
+    RESULT_WARN_UNUSED
+    constexpr auto has_error() const noexcept -> bool;
+
+    //-------------------------------------------------------------------------
+
+    /// \{
+    /// \brief Throws an exception if `(*this)` is in an error state
+    ///
+    /// This function exists for symmetry with `cpp::result<T,E>` objects where
+    /// `T` contains a value.
+    ///
+    /// If this contains an error, an exception is thrown containing the
+    /// underlying error. The error is consumed propagating the same constness
+    /// and refness of this result.
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// cpp::result<void,int>{}.value(); // no exception
+    ///
+    /// auto r = cpp::result<void,std::unique_ptr<int>>{
+    ///   cpp::fail(std::make_unique<int>(42))
+    /// };
+    /// std::move(r).value(); // throws bad_result_access<std::unique_ptr<int>>
+    ///
+    /// try {
+    ///   auto r = cpp::result<void,int>{ cpp::fail(42) }.value();
+    /// } catch (const cpp::bad_result_access<int>& e) {
+    ///   assert(e.error() == 42);
+    /// }
+    /// ```
+    ///
+    /// \throws bad_result_access<E> if `*this` does not contain a value.
+    ///
+    /// \param where the location of the call, reported on failure
+    RESULT_CPP14_CONSTEXPR auto value(source_location where = source_location::current()) && -> void;
+    RESULT_CPP14_CONSTEXPR auto value(source_location where = source_location::current()) const & -> void;
+    /// \}
+
+    /// \{
+    /// \copydoc result<T,E>::error
+    RESULT_WARN_UNUSED
+    constexpr auto error() const &
+      noexcept(std::is_nothrow_constructible<E>::value &&
+               std::is_nothrow_copy_constructible<E>::value) -> E;
+    RESULT_WARN_UNUSED
+    RESULT_CPP14_CONSTEXPR auto error() &&
+      noexcept(std::is_nothrow_constructible<E>::value &&
+               std::is_nothrow_copy_constructible<E>::value) -> E;
+    /// \}
+
+    /// \{
+    /// \copydoc result<T,E>::error_ref
+    RESULT_WARN_UNUSED
+    RESULT_CPP14_CONSTEXPR auto error_ref()
+      & noexcept -> detail::result_error_reference<void,E>;
+    RESULT_WARN_UNUSED
+    RESULT_CPP14_CONSTEXPR auto error_ref()
+      && noexcept -> detail::result_error_rvalue_reference<void,E>;
+    RESULT_WARN_UNUSED
+    constexpr auto error_ref()
+      const & noexcept -> detail::result_const_error_reference<void,E>;
+    /// \}
+
+    /// \{
+    /// \copydoc result<T,E>::error_if
+    RESULT_WARN_UNUSED
+    RESULT_CPP14_CONSTEXPR auto error_if() noexcept -> E*;
+    RESULT_WARN_UNUSED
+    constexpr auto error_if() const noexcept -> const E*;
+    /// \}
+
+    /// \{
+    /// \copydoc result<T,E>::expect
+    template <typename String,
+              typename = typename std::enable_if<(
+                std::is_convertible<String,const std::string&>::value &&
+                std::is_copy_constructible<E>::value
+              )>::type>
+    RESULT_CPP14_CONSTEXPR auto expect(String&& message,
+                                       source_location where = source_location::current()) const & -> void;
+    template <typename String,
+              typename = typename std::enable_if<(
+                std::is_convertible<String,const std::string&>::value &&
+                std::is_move_constructible<E>::value
+              )>::type>
+    RESULT_CPP14_CONSTEXPR auto expect(String&& message,
+                                       source_location where = source_location::current()) && -> void;
+    /// \}
+
+    //-------------------------------------------------------------------------
+    // Monadic Functionalities
+    //-------------------------------------------------------------------------
+  public:
+
+    /// \{
+    /// \copydoc result<T,E>::error_or
+    template <typename U>
+    RESULT_WARN_UNUSED
+    constexpr auto error_or(U&& default_error) const & -> error_type;
+    template <typename U>
+    RESULT_WARN_UNUSED
+    RESULT_CPP14_CONSTEXPR auto error_or(U&& default_error) && -> error_type;
+    /// \}
+
+    /// \{
+    /// \brief Returns the contained error if `*this` has an error,
+    ///        otherwise returns the result of invoking \p fn with no
+    ///        arguments.
+    ///
+    /// Unlike `error_or`, the fallback is only computed if it is needed.
+    ///
+    /// \param fn the function to compute the error with, in case `*this`
+    ///           contains a value
+    /// \return the contained error or the result of \p fn
+    template <typename Fn>
+    RESULT_WARN_UNUSED
+    constexpr auto error_or_else(Fn&& fn) const & -> error_type;
+    template <typename Fn>
+    RESULT_WARN_UNUSED
+    RESULT_CPP14_CONSTEXPR auto error_or_else(Fn&& fn) && -> error_type;
+    /// \}
+
+    //-------------------------------------------------------------------------
+
+    /// \copydoc result<T,E>::and_then
+    template <typename U>
+    RESULT_WARN_UNUSED
+    constexpr auto and_then(U&& value) const -> result<typename std::decay<U>::type,E>;
+
+    /// \{
+    /// \brief Invokes the function \p fn if `(*this)` contains no value
+    ///
+    /// If this result contains an error, a result of the error is returned
+    ///
+    /// The function being called must return a `result` type or the program
+    /// is ill-formed
+    ///
+    /// If this is called on an rvalue of `result` which contains an error,
+    /// the returned `result` is constructed from an rvalue of that error.
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// auto generate_int() -> cpp::result<int,int> { return 42; }
+    /// auto r = cpp::result<void,int>{};
+    /// assert(r.flat_map(generate_int) == 42);
+    ///
+    /// auto r = cpp::result<void,int>{cpp::fail(42)};
+    /// assert(r.flat_map(generate_int) == cpp::fail(42));
+    /// ```
+    ///
+    /// \param fn the function to invoke with this
+    /// \return The result of the function being called
+    template <typename Fn>
+    RESULT_WARN_UNUSED
+    constexpr auto flat_map(Fn&& fn) const & -> detail::invoke_result_t<Fn>;
+    template <typename Fn>
+    RESULT_WARN_UNUSED
+    RESULT_CPP14_CONSTEXPR auto flat_map(Fn&& fn) && -> detail::invoke_result_t<Fn>;
+    /// \}
+
+    /// \{
+    /// \brief Invokes the function \p fn if `(*this)` contains no value
+    ///
+    /// If this result is an error, the result of this function is that
+    /// error. Otherwise this function wraps the result and returns it as an
+    /// result.
+    ///
+    /// If this is called on an rvalue of `result` which contains an error,
+    /// the returned `result` is constructed from an rvalue of that error.
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// auto generate_int() -> int { return 42; }
+    /// auto r = cpp::result<void,int>{};
+    /// assert(r.map(generate_int) == 42);
+    ///
+    /// auto r = cpp::result<void,int>{cpp::fail(42)};
+    /// assert(r.map(generate_int) == cpp::fail(42));
+    /// ```
+    ///
+    /// \param fn the function to invoke with this
+    /// \return The result result of the function invoked
+    template <typename Fn>
+    RESULT_WARN_UNUSED
+    constexpr auto map(Fn&& fn) const & -> result<detail::invoke_result_t<Fn>,E>;
+    template <typename Fn>
+    RESULT_WARN_UNUSED
+    RESULT_CPP14_CONSTEXPR auto map(Fn&& fn) && -> result<detail::invoke_result_t<Fn>,E>;
+    /// \}
+
+    /// \{
+    /// \copydoc result<T,E>::map_error
+    template <typename Fn>
+    constexpr auto map_error(Fn&& fn) const & -> result<void, detail::invoke_result_t<Fn,const E&>>;
+    template <typename Fn>
+    RESULT_CPP14_CONSTEXPR
+    auto map_error(Fn&& fn) && -> result<void, detail::invoke_result_t<Fn,E&&>>;
+    /// \}
+
+
+    /// \{
+    /// \copydoc result<T,E>::flat_map_error
+    template <typename Fn>
+    RESULT_WARN_UNUSED
+    constexpr auto flat_map_error(Fn&& fn) const & -> detail::invoke_result_t<Fn, const E&>;
+    template <typename Fn>
+    RESULT_WARN_UNUSED
+    RESULT_CPP14_CONSTEXPR auto flat_map_error(Fn&& fn) && -> detail::invoke_result_t<Fn, E&&>;
+    /// \}
+
+    /// \{
+    /// \copydoc result<T,E>::or_else
+    template <typename Fn>
+    RESULT_WARN_UNUSED
+    constexpr auto or_else(Fn&& fn) const & -> detail::fallback_result_t<Fn, const E&>;
+    template <typename Fn>
+    RESULT_WARN_UNUSED
+    RESULT_CPP14_CONSTEXPR auto or_else(Fn&& fn) && -> detail::fallback_result_t<Fn, E&&>;
+    /// \}
+
+    //-------------------------------------------------------------------------
+    // Private Constructors
+    //-------------------------------------------------------------------------
+  private:
+
+    /// \brief Constructs a result object that contains an error propagated
+    ///        from another result
+    ///
+    /// \param args the arguments to pass to E's constructor
+    template <typename...Args>
+    constexpr explicit result(detail::propagated_error_t, Args&&... args)
+      noexcept(std::is_nothrow_constructible<E, Args...>::value);
+
+    //-------------------------------------------------------------------------
+    // Private Members
+    //-------------------------------------------------------------------------
+  private:
+
+    detail::result_storage<detail::unit,E> m_storage;
+
+    //-------------------------------------------------------------------------
+    // Private Monadic Functions
+    //-------------------------------------------------------------------------
+  private:
+
+    /// \{
+    /// \brief Map implementations for void and non-void functions
+    ///
+    /// \param fn the function
+    template <typename Fn>
+    constexpr auto map_impl(std::true_type, Fn&& fn) const & -> result<void,E>;
+    template <typename Fn>
+    constexpr auto map_impl(std::false_type, Fn&& fn) const & -> result<detail::invoke_result_t<Fn>,E>;
+    template <typename Fn>
+    RESULT_CPP14_CONSTEXPR auto map_impl(std::true_type, Fn&& fn) && -> result<void,E>;
+    template <typename Fn>
+    RESULT_CPP14_CONSTEXPR auto map_impl(std::false_type, Fn&& fn) && -> result<detail::invoke_result_t<Fn>,E>;
+    /// \}
+  };
+
+  //===========================================================================
+  // non-member functions : class : result
+  //===========================================================================
+
+  //---------------------------------------------------------------------------
+  // Comparison
+  //---------------------------------------------------------------------------
+
+  template <typename T1, typename E1, typename T2, typename E2>
+  constexpr auto operator==(const result<T1,E1>& lhs, const result<T2,E2>& rhs)
+    noexcept -> bool;
+  template <typename T1, typename E1, typename T2, typename E2>
+  constexpr auto operator!=(const result<T1,E1>& lhs, const result<T2,E2>& rhs)
+    noexcept -> bool;
+  template <typename T1, typename E1, typename T2, typename E2>
+  constexpr auto operator>=(const result<T1,E1>& lhs, const result<T2,E2>& rhs)
+    noexcept -> bool;
+  template <typename T1, typename E1, typename T2, typename E2>
+  constexpr auto operator<=(const result<T1,E1>& lhs, const result<T2,E2>& rhs)
+    noexcept -> bool;
+  template <typename T1, typename E1, typename T2, typename E2>
+  constexpr auto operator>(const result<T1,E1>& lhs, const result<T2,E2>& rhs)
+    noexcept -> bool;
+  template <typename T1, typename E1, typename T2, typename E2>
+  constexpr auto operator<(const result<T1,E1>& lhs, const result<T2,E2>& rhs)
+    noexcept -> bool;
+
+  //---------------------------------------------------------------------------
+
+  template <typename E1, typename E2>
+  constexpr auto operator==(const result<void,E1>& lhs, const result<void,E2>& rhs)
+    noexcept -> bool;
+  template <typename E1, typename E2>
+  constexpr auto operator!=(const result<void,E1>& lhs, const result<void,E2>& rhs)
+    noexcept -> bool;
+  template <typename E1, typename E2>
+  constexpr auto operator>=(const result<void,E1>& lhs, const result<void,E2>& rhs)
+    noexcept -> bool;
+  template <typename E1, typename E2>
+  constexpr auto operator<=(const result<void,E1>& lhs, const result<void,E2>& rhs)
+    noexcept -> bool;
+  template <typename E1, typename E2>
+  constexpr auto operator>(const result<void,E1>& lhs, const result<void,E2>& rhs)
+    noexcept -> bool;
+  template <typename E1, typename E2>
+  constexpr auto operator<(const result<void,E1>& lhs, const result<void,E2>& rhs)
+    noexcept -> bool;
+
+  //---------------------------------------------------------------------------
+
+  template <typename T, typename E, typename U,
+            typename = typename std::enable_if<!std::is_same<T,void>::value>::type>
+  constexpr auto operator==(const result<T,E>& exp, const U& value)
+    noexcept -> bool;
+  template <typename T, typename U, typename E,
+            typename = typename std::enable_if<!std::is_same<U,void>::value>::type>
+  constexpr auto operator==(const T& value, const result<U,E>& exp)
+    noexcept -> bool;
+  template <typename T, typename E, typename U,
+            typename = typename std::enable_if<!std::is_same<T,void>::value>::type>
+  constexpr auto operator!=(const result<T,E>& exp, const U& value)
+    noexcept -> bool;
+  template <typename T, typename U, typename E,
+            typename = typename std::enable_if<!std::is_same<U,void>::value>::type>
+  constexpr auto operator!=(const T& value, const result<U,E>& exp)
+    noexcept -> bool;
+  template <typename T, typename E, typename U,
+            typename = typename std::enable_if<!std::is_same<T,void>::value>::type>
+  constexpr auto operator<=(const result<T,E>& exp, const U& value)
+    noexcept -> bool;
+  template <typename T, typename U, typename E,
+            typename = typename std::enable_if<!std::is_same<U,void>::value>::type>
+  constexpr auto operator<=(const T& value, const result<U,E>& exp)
+    noexcept -> bool;
+  template <typename T, typename E, typename U,
+            typename = typename std::enable_if<!std::is_same<T,void>::value>::type>
+  constexpr auto operator>=(const result<T,E>& exp, const U& value)
+    noexcept -> bool;
+  template <typename T, typename U, typename E,
+            typename = typename std::enable_if<!std::is_same<U,void>::value>::type>
+  constexpr auto operator>=(const T& value, const result<U,E>& exp)
+    noexcept -> bool;
+  template <typename T, typename E, typename U,
+            typename = typename std::enable_if<!std::is_same<T,void>::value>::type>
+  constexpr auto operator<(const result<T,E>& exp, const U& value)
+    noexcept -> bool;
+  template <typename T, typename U, typename E,
+            typename = typename std::enable_if<!std::is_same<U,void>::value>::type>
+  constexpr auto operator<(const T& value, const result<U,E>& exp)
+    noexcept -> bool;
+  template <typename T, typename E, typename U,
+            typename = typename std::enable_if<!std::is_same<T,void>::value>::type>
+  constexpr auto operator>(const result<T,E>& exp, const U& value)
+    noexcept -> bool;
+  template <typename T, typename U, typename E,
+            typename = typename std::enable_if<!std::is_same<U,void>::value>::type>
+  constexpr auto operator>(const T& value, const result<U,E>& exp)
+    noexcept -> bool;
+
+  //---------------------------------------------------------------------------
+
+  template <typename T, typename E, typename U>
+  constexpr auto operator==(const result<T,E>& exp, const failure<U>& value)
+    noexcept -> bool;
+  template <typename T, typename U, typename E>
+  constexpr auto operator==(const failure<T>& value, const result<E,U>& exp)
+    noexcept -> bool;
+  template <typename T, typename E, typename U>
+  constexpr auto operator!=(const result<T,E>& exp, const failure<U>& value)
+    noexcept -> bool;
+  template <typename T, typename U, typename E>
+  constexpr auto operator!=(const failure<T>& value, const result<E,U>& exp)
+    noexcept -> bool;
+  template <typename T, typename E, typename U>
+  constexpr auto operator<=(const result<T,E>& exp, const failure<U>& value)
+    noexcept -> bool;
+  template <typename T, typename U, typename E>
+  constexpr auto operator<=(const failure<T>& value, const result<E,U>& exp)
+    noexcept -> bool;
+  template <typename T, typename E, typename U>
+  constexpr auto operator>=(const result<T,E>& exp, const failure<U>& value)
+    noexcept -> bool;
+  template <typename T, typename U, typename E>
+  constexpr auto operator>=(const failure<T>& value, const result<E,U>& exp)
+    noexcept -> bool;
+  template <typename T, typename E, typename U>
+  constexpr auto operator<(const result<T,E>& exp, const failure<U>& value)
+    noexcept -> bool;
+  template <typename T, typename U, typename E>
+  constexpr auto operator<(const failure<T>& value, const result<E,U>& exp)
+    noexcept -> bool;
+  template <typename T, typename E, typename U>
+  constexpr auto operator>(const result<T,E>& exp, const failure<U>& value)
+    noexcept -> bool;
+  template <typename T, typename U, typename E>
+  constexpr auto operator>(const failure<T>& value, const result<E,U>& exp)
+    noexcept -> bool;
+
+  //---------------------------------------------------------------------------
+  // Utilities
+  //---------------------------------------------------------------------------
+
+  /// \{
+  /// \brief Swaps the contents of \p lhs with \p rhs
+  ///
+  /// \param lhs the left result
+  /// \param rhs the right result
+  template <typename T, typename E>
+  RESULT_CPP20_CONSTEXPR auto swap(result<T,E>& lhs, result<T,E>& rhs)
+#if __cplusplus >= 201703L
+    noexcept(std::is_nothrow_move_constructible<result<T,E>>::value &&
+             std::is_nothrow_move_assignable<result<T,E>>::value &&
+             std::is_nothrow_swappable<T>::value &&
+             std::is_nothrow_swappable<E>::value)
+#else
+    noexcept(std::is_nothrow_move_constructible<result<T,E>>::value &&
+             std::is_nothrow_move_assignable<result<T,E>>::value)
+#endif
+    -> void;
+  template <typename E>
+  RESULT_CPP20_CONSTEXPR auto swap(result<void,E>& lhs, result<void,E>& rhs)
+#if __cplusplus >= 201703L
+    noexcept(std::is_nothrow_move_constructible<result<void,E>>::value &&
+             std::is_nothrow_move_assignable<result<void,E>>::value &&
+             std::is_nothrow_swappable<E>::value)
+#else
+    noexcept(std::is_nothrow_move_constructible<result<void,E>>::value &&
+             std::is_nothrow_move_assignable<result<void,E>>::value)
+#endif
+     -> void;
+  /// \}
+
+  /// \brief Relocates the objects in the range [\p first, \p last) into the
+  ///        uninitialized storage starting at \p destination
+  ///
+  /// Each object in the source range is moved into the destination, and the
+  /// source object is destroyed. If `T` is trivially relocatable (see
+  /// `is_trivially_relocatable`), this is performed with a single
+  /// `std::memcpy`.
+  ///
+  /// \pre the source and destination ranges do not overlap
+  /// \pre `T` is nothrow move-constructible, or trivially relocatable
+  ///
+  /// \param first the start of the range to relocate
+  /// \param last the end of the range to relocate
+  /// \param destination the start of the uninitialized destination storage
+  /// \return a pointer to the end of the destination range
+  template <typename T>
+  auto uninitialized_relocate(T* first, T* last, T* destination) noexcept -> T*;
+
+  namespace detail {
+
+    template <typename T>
+    auto uninitialized_relocate_impl(std::true_type, T* first, T* last, T* destination)
+      noexcept -> T*;
+
+    template <typename T>
+    auto uninitialized_relocate_impl(std::false_type, T* first, T* last, T* destination)
+      noexcept -> T*;
+
+  } // namespace detail
+
+} // inline namespace bitwizeshift
+} // namespace EXPECTED_NAMESPACE
+
+namespace std {
+
+  template <typename T, typename E>
+  struct hash<::RESULT_NS_IMPL::result<T,E>>
+  {
+    auto operator()(const RESULT_NS_IMPL::result<T,E>& x) const -> std::size_t
+    {
+      if (x.has_value()) {
+        return std::hash<T>{}(*x) + 1; // add '1' to differentiate from error case
+      }
+      return std::hash<E>{}(::RESULT_NS_IMPL::detail::extract_error(x));
+    }
+  };
+
+  template <typename E>
+  struct hash<::RESULT_NS_IMPL::result<void,E>>
+  {
+    auto operator()(const RESULT_NS_IMPL::result<void,E>& x) const -> std::size_t
+    {
+      if (x.has_value()) {
+        return 0;
+      }
+      return std::hash<E>{}(::RESULT_NS_IMPL::detail::extract_error(x));
+    }
+  };
+
+  /// \brief A result uses an allocator if either of its alternatives does,
+  ///        which opts it into uses-allocator construction by
+  ///        allocator-aware containers
+  template <typename T, typename E, typename Alloc>
+  struct uses_allocator<::RESULT_NS_IMPL::result<T,E>, Alloc>
+    : integral_constant<bool,(
+        uses_allocator<T,Alloc>::value || uses_allocator<E,Alloc>::value
+      )>{};
+
+  template <typename E, typename Alloc>
+  struct uses_allocator<::RESULT_NS_IMPL::result<void,E>, Alloc>
+    : uses_allocator<E,Alloc>{};
+
+} // namespace std
+
+//=============================================================================
+// class : source_location
+//=============================================================================
+
+inline constexpr
+auto RESULT_NS_IMPL::source_location::current(const char* file,
+                                             const char* function,
+                                             unsigned line)
+  noexcept -> source_location
+{
+  return source_location{file, function, line};
+}
+
+inline constexpr
+RESULT_NS_IMPL::source_location::source_location(const char* file,
+                                                 const char* function,
+                                                 unsigned line)
+  noexcept
+  : m_file{file},
+    m_function{function},
+    m_line{line}
+{
+
+}
+
+inline constexpr
+auto RESULT_NS_IMPL::source_location::file_name()
+  const noexcept -> const char*
+{
+  return m_file;
+}
+
+inline constexpr
+auto RESULT_NS_IMPL::source_location::function_name()
+  const noexcept -> const char*
+{
+  return m_function;
+}
+
+inline constexpr
+auto RESULT_NS_IMPL::source_location::line()
+  const noexcept -> unsigned
+{
+  return m_line;
+}
+
+//=============================================================================
+// class : bad_result_access_info
+//=============================================================================
+
+template <typename E>
+inline
+RESULT_NS_IMPL::bad_result_access_info::bad_result_access_info(
+  const char* message,
+  const E& error,
+  source_location where
+) noexcept
+  : m_message{message},
+    m_error{std::addressof(error)},
+    m_error_type{&detail::type_id<E>::value},
+    m_where{where}
+{
+
+}
+
+inline
+auto RESULT_NS_IMPL::bad_result_access_info::message()
+  const noexcept -> const char*
+{
+  return m_message;
+}
+
+inline
+auto RESULT_NS_IMPL::bad_result_access_info::where()
+  const noexcept -> source_location
+{
+  return m_where;
+}
+
+template <typename E>
+inline
+auto RESULT_NS_IMPL::bad_result_access_info::error_if()
+  const noexcept -> const E*
+{
+  return m_error_type == &detail::type_id<E>::value
+    ? static_cast<const E*>(m_error)
+    : nullptr;
+}
+
+//=============================================================================
+// utilities : bad_result_access_handler
+//=============================================================================
+
+inline
+auto RESULT_NS_IMPL::set_bad_result_access_handler(
+  bad_result_access_handler handler
+) noexcept -> bad_result_access_handler
+{
+  return detail::bad_result_access_handler_storage().exchange(handler);
+}
+
+inline
+auto RESULT_NS_IMPL::get_bad_result_access_handler()
+  noexcept -> bad_result_access_handler
+{
+  return detail::bad_result_access_handler_storage().load();
+}
+
+inline
+auto RESULT_NS_IMPL::detail::bad_result_access_handler_storage()
+  noexcept -> std::atomic<bad_result_access_handler>&
+{
+  static std::atomic<bad_result_access_handler> handler{nullptr};
+
+  return handler;
+}
+
+#if defined(RESULT_ENABLE_STATS) || defined(RESULT_ENABLE_TRACE)
+
+//=============================================================================
+// utilities : failure type names
+//=============================================================================
+
+template <typename E>
+inline
+auto RESULT_NS_IMPL::detail::failure_type_signature()
+  noexcept -> const char*
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+  return __FUNCSIG__;
+#else
+  return __PRETTY_FUNCTION__;
+#endif
+}
+
+inline
+auto RESULT_NS_IMPL::detail::failure_type_name(const char* signature)
+  -> std::string
+{
+  // The signature names the type as a template argument, spelled as
+  // '[with E = <type>]' (gcc), '[E = <type>]' (clang), or
+  // 'failure_type_signature<<type>>(void)' (msvc).
+  const auto spelling = std::string{signature};
+#if defined(_MSC_VER) && !defined(__clang__)
+  const auto prefix = std::string{"failure_type_signature<"};
+  const auto suffix = std::string{">(void)"};
+#else
+  const auto prefix = std::string{"E = "};
+  const auto suffix = std::string{"]"};
+#endif
+  const auto first = spelling.find(prefix);
+  const auto last = spelling.rfind(suffix);
+
+  if (first == std::string::npos || last == std::string::npos ||
+      last < first + prefix.size()) {
+    return spelling;
+  }
+  return spelling.substr(first + prefix.size(), last - first - prefix.size());
+}
+
+#endif
+
+#if defined(RESULT_ENABLE_STATS)
+
+//=============================================================================
+// class : failure_count
+//=============================================================================
+
+inline
+RESULT_NS_IMPL::failure_count::failure_count(const void* type,
+                                             const char* signature,
+                                             source_location where,
+                                             std::uint64_t count) noexcept
+  : m_type{type},
+    m_signature{signature},
+    m_where{where},
+    m_count{count}
+{
+
+}
+
+template <typename E>
+inline
+auto RESULT_NS_IMPL::failure_count::is()
+  const noexcept -> bool
+{
+  return m_type == &detail::type_id<E>::value;
+}
+
+inline
+auto RESULT_NS_IMPL::failure_count::error_type()
+  const -> std::string
+{
+  return detail::failure_type_name(m_signature);
+}
+
+inline
+auto RESULT_NS_IMPL::failure_count::where()
+  const noexcept -> source_location
+{
+  return m_where;
+}
+
+inline
+auto RESULT_NS_IMPL::failure_count::count()
+  const noexcept -> std::uint64_t
+{
+  return m_count;
+}
+
+//=============================================================================
+// class : failure_stats
+//=============================================================================
+
+inline
+auto RESULT_NS_IMPL::failure_stats::snapshot()
+  -> failure_stats
+{
+  return detail::failure_stats_registry::instance().snapshot();
+}
+
+inline
+auto RESULT_NS_IMPL::failure_stats::reset()
+  -> void
+{
+  detail::failure_stats_registry::instance().reset();
+}
+
+inline
+auto RESULT_NS_IMPL::failure_stats::counts()
+  const noexcept -> const std::vector<failure_count>&
+{
+  return m_counts;
+}
+
+template <typename E>
+inline
+auto RESULT_NS_IMPL::failure_stats::count_of()
+  const noexcept -> std::uint64_t
+{
+  return count_of(&detail::type_id<E>::value);
+}
+
+inline
+auto RESULT_NS_IMPL::failure_stats::total()
+  const noexcept -> std::uint64_t
+{
+  auto total = std::uint64_t{0u};
+  for (const auto& count : m_counts) {
+    total += count.count();
+  }
+  return total;
+}
+
+inline
+auto RESULT_NS_IMPL::failure_stats::dropped()
+  const noexcept -> std::uint64_t
+{
+  return m_dropped;
+}
+
+inline
+auto RESULT_NS_IMPL::failure_stats::count_of(const void* type)
+  const noexcept -> std::uint64_t
+{
+  auto total = std::uint64_t{0u};
+  for (const auto& count : m_counts) {
+    if (count.m_type == type) {
+      total += count.m_count;
+    }
+  }
+  return total;
+}
+
+//=============================================================================
+// class : detail::failure_stats_table
+//=============================================================================
+
+inline
+auto RESULT_NS_IMPL::detail::failure_stats_table::local()
+  noexcept -> failure_stats_table*
+{
+  // The owner is only constructed on the first failure of each thread, and
+  // returns the table to the registry when the thread exits. Failures
+  // recorded after that, from other thread-local destructors, are not
+  // counted.
+  static thread_local failure_stats_table* current = nullptr;
+  static thread_local bool exited = false;
+
+  struct owner
+  {
+    owner() noexcept
+      : table{new (std::nothrow) failure_stats_table{}}
+    {
+      if (table != nullptr) {
+        failure_stats_registry::instance().attach(table);
+      }
+    }
+
+    ~owner()
+    {
+      current = nullptr;
+      exited = true;
+      if (table != nullptr) {
+        failure_stats_registry::instance().detach(table);
+        delete table;
+      }
+    }
+
+    failure_stats_table* table;
+  };
+
+  if (current == nullptr && !exited) {
+    static thread_local owner local_owner;
+    current = local_owner.table;
+  }
+  return current;
+}
+
+inline
+auto RESULT_NS_IMPL::detail::failure_stats_table::record(const void* type,
+                                                         const char* signature,
+                                                         source_location where)
+  noexcept -> void
+{
+  static_assert(
+    RESULT_STATS_TABLE_SIZE > 0 &&
+    (RESULT_STATS_TABLE_SIZE & (RESULT_STATS_TABLE_SIZE - 1)) == 0,
+    "RESULT_STATS_TABLE_SIZE must be a power of two"
+  );
+  static_assert(
+    RESULT_STATS_SAMPLE_PERIOD > 0,
+    "RESULT_STATS_SAMPLE_PERIOD must be at least 1"
+  );
+
+  if (--until_sample != 0u) {
+    where = source_location{};
+  } else {
+    until_sample = RESULT_STATS_SAMPLE_PERIOD;
+  }
+
+  const auto mask = std::size_t{RESULT_STATS_TABLE_SIZE - 1};
+  auto hash = reinterpret_cast<std::uintptr_t>(type) ^
+              (reinterpret_cast<std::uintptr_t>(where.file_name()) * 31u) ^
+              (static_cast<std::uintptr_t>(where.line()) * 0x9e3779b9u);
+  hash ^= hash >> 16u;
+
+  for (auto probe = std::size_t{0u}; probe <= mask; ++probe) {
+    auto& e = entries[(hash + probe) & mask];
+    const auto key = e.type.load(std::memory_order_relaxed);
+
+    if (key == nullptr) {
+      e.signature = signature;
+      e.where = where;
+      e.count.store(1u, std::memory_order_relaxed);
+      e.type.store(type, std::memory_order_release);
+      return;
+    }
+    if (key == type &&
+        e.where.line() == where.line() &&
+        e.where.file_name() == where.file_name() &&
+        e.where.function_name() == where.function_name()) {
+      // Only this thread writes the count, so this does not need to be an
+      // atomic read-modify-write
+      e.count.store(
+        e.count.load(std::memory_order_relaxed) + 1u,
+        std::memory_order_relaxed
+      );
+      return;
+    }
+  }
+  dropped.store(
+    dropped.load(std::memory_order_relaxed) + 1u,
+    std::memory_order_relaxed
+  );
+}
+
+//=============================================================================
+// class : detail::failure_stats_registry
+//=============================================================================
+
+inline
+auto RESULT_NS_IMPL::detail::failure_stats_registry::instance()
+  noexcept -> failure_stats_registry&
+{
+  // Never destroyed, so that threads exiting during static destruction may
+  // still return their tables
+  static auto* const registry = new failure_stats_registry{};
+
+  return *registry;
+}
+
+inline
+auto RESULT_NS_IMPL::detail::failure_stats_registry::attach(
+  failure_stats_table* table
+) -> void
+{
+  std::lock_guard<std::mutex> lock{m_mutex};
+
+  table->next = m_tables;
+  m_tables = table;
+}
+
+inline
+auto RESULT_NS_IMPL::detail::failure_stats_registry::detach(
+  failure_stats_table* table
+) -> void
+{
+  std::lock_guard<std::mutex> lock{m_mutex};
+
+  auto* link = &m_tables;
+  while (*link != table) {
+    link = &(*link)->next;
+  }
+  *link = table->next;
+  merge(m_exited, *table);
+}
+
+inline
+auto RESULT_NS_IMPL::detail::failure_stats_registry::snapshot()
+  -> failure_stats
+{
+  std::lock_guard<std::mutex> lock{m_mutex};
+
+  auto stats = collect();
+  for (const auto& count : m_baseline.m_counts) {
+    merge(stats, count, true);
+  }
+  stats.m_dropped -= m_baseline.m_dropped;
+
+  auto& counts = stats.m_counts;
+  auto it = counts.begin();
+  while (it != counts.end()) {
+    it = (it->m_count == 0u) ? counts.erase(it) : it + 1;
+  }
+  return stats;
+}
+
+inline
+auto RESULT_NS_IMPL::detail::failure_stats_registry::reset()
+  -> void
+{
+  std::lock_guard<std::mutex> lock{m_mutex};
+
+  m_baseline = collect();
+}
+
+inline
+auto RESULT_NS_IMPL::detail::failure_stats_registry::merge(
+  failure_stats& stats,
+  const failure_stats_table& table
+) -> void
+{
+  for (const auto& e : table.entries) {
+    const auto type = e.type.load(std::memory_order_acquire);
+    if (type == nullptr) {
+      continue;
+    }
+    const auto count = failure_count{
+      type,
+      e.signature,
+      e.where,
+      e.count.load(std::memory_order_relaxed)
+    };
+    merge(stats, count, false);
+  }
+  stats.m_dropped += table.dropped.load(std::memory_order_relaxed);
+}
+
+inline
+auto RESULT_NS_IMPL::detail::failure_stats_registry::merge(
+  failure_stats& stats,
+  const failure_count& count,
+  bool subtract
+) -> void
+{
+  // The same location may be spelled by different string literals in
+  // different translation units, so locations are compared by value
+  const auto is_same_location = [](source_location lhs, source_location rhs) {
+    return lhs.line() == rhs.line() &&
+           std::strcmp(lhs.file_name(), rhs.file_name()) == 0 &&
+           std::strcmp(lhs.function_name(), rhs.function_name()) == 0;
+  };
+
+  for (auto& existing : stats.m_counts) {
+    if (existing.m_type == count.m_type &&
+        is_same_location(existing.m_where, count.m_where)) {
+      if (subtract) {
+        existing.m_count -= count.m_count;
+      } else {
+        existing.m_count += count.m_count;
+      }
+      return;
+    }
+  }
+  if (!subtract) {
+    stats.m_counts.push_back(count);
+  }
+}
+
+inline
+auto RESULT_NS_IMPL::detail::failure_stats_registry::collect()
+  -> failure_stats
+{
+  auto stats = m_exited;
+  for (auto* table = m_tables; table != nullptr; table = table->next) {
+    merge(stats, *table);
+  }
+  return stats;
+}
+
+//=============================================================================
+// utilities : failure statistics
+//=============================================================================
+
+template <typename E>
+inline RESULT_INLINE_VISIBILITY constexpr
+auto RESULT_NS_IMPL::detail::record_failure(source_location where)
+  noexcept -> bool
+{
+#if RESULT_HAS_BUILTIN_IS_CONSTANT_EVALUATED
+  return __builtin_is_constant_evaluated() || record_failure(
+    &type_id<E>::value,
+    failure_type_signature<E>(),
+    where
+  );
+#else
+  return record_failure(
+    &type_id<E>::value,
+    failure_type_signature<E>(),
+    where
+  );
+#endif
+}
+
+inline
+auto RESULT_NS_IMPL::detail::record_failure(const void* type,
+                                            const char* signature,
+                                            source_location where)
+  noexcept -> bool
+{
+  if (auto* const table = failure_stats_table::local()) {
+    table->record(type, signature, where);
+  }
+  return true;
+}
+
+#endif // defined(RESULT_ENABLE_STATS)
+
+template <typename E>
+inline RESULT_INLINE_VISIBILITY constexpr
+auto RESULT_NS_IMPL::detail::recorded_in_place_error()
+  noexcept -> in_place_error_t
+{
+#if defined(RESULT_ENABLE_STATS)
+  return static_cast<void>(record_failure<E>(source_location{})), in_place_error;
+#else
+  return in_place_error;
+#endif
+}
+
+#if defined(RESULT_ENABLE_TRACE)
+
+//=============================================================================
+// class : failure_trace_entry
+//=============================================================================
+
+inline
+auto RESULT_NS_IMPL::failure_trace_entry::timestamp()
+  const noexcept -> std::uint64_t
+{
+  return m_timestamp;
+}
+
+inline
+auto RESULT_NS_IMPL::failure_trace_entry::where()
+  const noexcept -> source_location
+{
+  return m_where;
+}
+
+template <typename E>
+inline
+auto RESULT_NS_IMPL::failure_trace_entry::is()
+  const noexcept -> bool
+{
+  return m_type == &detail::type_id<E>::value;
+}
+
+template <typename E>
+inline
+auto RESULT_NS_IMPL::failure_trace_entry::error_if()
+  const noexcept -> const E*
+{
+  return (is<E>() && m_payload_size == sizeof(E))
+    ? reinterpret_cast<const E*>(m_payload)
+    : nullptr;
+}
+
+inline
+auto RESULT_NS_IMPL::failure_trace_entry::error_type()
+  const -> std::string
+{
+  return detail::failure_type_name(m_signature);
+}
+
+//=============================================================================
+// class : failure_trace
+//=============================================================================
+
+inline
+auto RESULT_NS_IMPL::failure_trace::local()
+  noexcept -> failure_trace&
+{
+  static_assert(
+    RESULT_TRACE_BUFFER_SIZE > 1,
+    "RESULT_TRACE_BUFFER_SIZE must be at least 2"
+  );
+
+  // Constant-initialized and trivially destructible, so accessing this never
+  // allocates or registers a destructor
+  static thread_local failure_trace trace;
+
+  return trace;
+}
+
+inline constexpr
+auto RESULT_NS_IMPL::failure_trace::capacity()
+  noexcept -> std::size_t
+{
+  return RESULT_TRACE_BUFFER_SIZE - 1u;
+}
+
+inline
+auto RESULT_NS_IMPL::failure_trace::size()
+  const noexcept -> std::size_t
+{
+  const auto written = m_written.load(std::memory_order_acquire);
+  const auto size = written - m_cleared.load(std::memory_order_relaxed);
+
+  return size < capacity() ? static_cast<std::size_t>(size) : capacity();
+}
+
+inline
+auto RESULT_NS_IMPL::failure_trace::copy(failure_trace_entry* out,
+                                         std::size_t count)
+  const noexcept -> std::size_t
+{
+  const auto written = m_written.load(std::memory_order_acquire);
+  auto available = written - m_cleared.load(std::memory_order_relaxed);
+  if (available > capacity()) {
+    available = capacity();
+  }
+  const auto n = count < available ? count : static_cast<std::size_t>(available);
+
+  for (auto i = std::size_t{0u}; i < n; ++i) {
+    out[i] = m_entries[(written - n + i) % RESULT_TRACE_BUFFER_SIZE];
+  }
+  return n;
+}
+
+inline
+auto RESULT_NS_IMPL::failure_trace::clear()
+  noexcept -> void
+{
+  m_cleared.store(m_written.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+inline
+auto RESULT_NS_IMPL::failure_trace::record(const void* type,
+                                           const char* signature,
+                                           source_location where,
+                                           const void* payload,
+                                           std::size_t size)
+  noexcept -> void
+{
+  // Only this thread writes the trace, so the entry is filled in before the
+  // new count is published; a reader interrupting this never reads the entry
+  // being written, since it is one past the capacity.
+  const auto written = m_written.load(std::memory_order_relaxed);
+  auto& entry = m_entries[written % RESULT_TRACE_BUFFER_SIZE];
+
+  entry.m_timestamp = detail::trace_timestamp();
+  entry.m_where = where;
+  entry.m_type = type;
+  entry.m_signature = signature;
+  entry.m_payload_size = size;
+  if (size != 0u) {
+    std::memcpy(entry.m_payload, payload, size);
+  }
+
+  m_written.store(written + 1u, std::memory_order_release);
+}
+
+//=============================================================================
+// utilities : failure tracing
+//=============================================================================
+
+inline
+auto RESULT_NS_IMPL::detail::trace_timestamp()
+  noexcept -> std::uint64_t
+{
+#if defined(_MSC_VER) && !defined(__clang__) && (defined(_M_X64) || defined(_M_IX86))
+  return __rdtsc();
+#elif defined(__x86_64__) || defined(__i386__)
+  return __builtin_ia32_rdtsc();
+#elif defined(__aarch64__)
+  auto ticks = std::uint64_t{};
+  __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(ticks));
+  return ticks;
+#else
+  return static_cast<std::uint64_t>(
+    std::chrono::steady_clock::now().time_since_epoch().count()
+  );
+#endif
+}
+
+template <typename E, typename E2>
+inline RESULT_INLINE_VISIBILITY constexpr
+auto RESULT_NS_IMPL::detail::trace_failure(const E2& error, source_location where)
+  noexcept -> bool
+{
+#if RESULT_HAS_BUILTIN_IS_CONSTANT_EVALUATED
+  return __builtin_is_constant_evaluated() ||
+    trace_failure<E>(is_trace_payload<E, E2>{}, error, where);
+#else
+  return trace_failure<E>(is_trace_payload<E, E2>{}, error, where);
+#endif
+}
+
+template <typename E, typename E2>
+inline
+auto RESULT_NS_IMPL::detail::trace_failure(std::true_type,
+                                           const E2& error,
+                                           source_location where)
+  noexcept -> bool
+{
+  failure_trace::local().record(
+    &type_id<E>::value,
+    failure_type_signature<E>(),
+    where,
+    std::addressof(error),
+    sizeof(E)
+  );
+  return true;
+}
+
+template <typename E, typename E2>
+inline
+auto RESULT_NS_IMPL::detail::trace_failure(std::false_type,
+                                           const E2&,
+                                           source_location where)
+  noexcept -> bool
+{
+  failure_trace::local().record(
+    &type_id<E>::value,
+    failure_type_signature<E>(),
+    where,
+    nullptr,
+    0u
+  );
+  return true;
+}
+
+template <typename E, typename E2>
+inline RESULT_INLINE_VISIBILITY constexpr
+auto RESULT_NS_IMPL::detail::traced_in_place_error(const E2& error,
+                                                   source_location where)
+  noexcept -> in_place_error_t
+{
+  return static_cast<void>(trace_failure<E>(error, where)), in_place_error;
+}
+
+#endif // defined(RESULT_ENABLE_TRACE)
+
+#if !defined(RESULT_DISABLE_EXCEPTIONS)
+
+#if defined(RESULT_NONALLOCATING_BAD_RESULT_ACCESS)
+
+//=============================================================================
+// class : bad_result_access_base
+//=============================================================================
+
+inline
+RESULT_NS_IMPL::detail::bad_result_access_base::bad_result_access_base(
+  const char* what_arg
+) noexcept
+{
+  const auto size = std::strlen(what_arg);
+  const auto length = size < sizeof(m_what) ? size : sizeof(m_what) - 1u;
+
+  std::memcpy(m_what, what_arg, length);
+  m_what[length] = '\0';
+}
+
+inline
+RESULT_NS_IMPL::detail::bad_result_access_base::bad_result_access_base(
+  const std::string& what_arg
+) noexcept
+  : bad_result_access_base{what_arg.c_str()}
+{
+
+}
+
+inline
+auto RESULT_NS_IMPL::detail::bad_result_access_base::what()
+  const noexcept -> const char*
+{
+  return m_what;
+}
+
+#endif
+
+//=============================================================================
+// class : bad_result_access
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors
+//-----------------------------------------------------------------------------
+
+template <typename E>
+template <typename E2, typename>
+inline RESULT_INLINE_VISIBILITY
+RESULT_NS_IMPL::bad_result_access<E>::bad_result_access(E2&& error)
+  : detail::bad_result_access_base{detail::bad_result_access_default_message()},
+    m_error(detail::forward<E2>(error))
+{
+
+}
+
+template <typename E>
+template <typename E2, typename>
+inline RESULT_INLINE_VISIBILITY
+RESULT_NS_IMPL::bad_result_access<E>::bad_result_access(
+  const char* what_arg,
+  E2&& error
+) : detail::bad_result_access_base{what_arg},
+    m_error(detail::forward<E2>(error))
+{
+
+}
+
+template <typename E>
+template <typename E2, typename>
+inline RESULT_INLINE_VISIBILITY
+RESULT_NS_IMPL::bad_result_access<E>::bad_result_access(
+  const std::string& what_arg,
+  E2&& error
+) : detail::bad_result_access_base{what_arg},
+    m_error(detail::forward<E2>(error))
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
+
+template <typename E>
+inline RESULT_INLINE_VISIBILITY
+auto RESULT_NS_IMPL::bad_result_access<E>::error()
+  & noexcept -> E&
+{
+  return m_error;
+}
+
+template <typename E>
+inline RESULT_INLINE_VISIBILITY
+auto RESULT_NS_IMPL::bad_result_access<E>::error()
+  && noexcept -> E&&
+{
+  return static_cast<E&&>(m_error);
+}
+
+template <typename E>
+inline RESULT_INLINE_VISIBILITY
+auto RESULT_NS_IMPL::bad_result_access<E>::error()
+  const & noexcept -> const E&
+{
+  return m_error;
+}
+
+template <typename E>
+inline RESULT_INLINE_VISIBILITY
+auto RESULT_NS_IMPL::bad_result_access<E>::error()
+  const && noexcept -> const E&&
+{
+  return static_cast<const E&&>(m_error);
+}
+
+#endif
+
+//=============================================================================
+// class : failure
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors
+//-----------------------------------------------------------------------------
+
+template <typename E>
+template <typename...Args, typename>
+inline RESULT_INLINE_VISIBILITY constexpr
+RESULT_NS_IMPL::failure<E>::failure(in_place_t, Args&&...args)
+  noexcept(std::is_nothrow_constructible<E, Args...>::value)
+  : m_failure(detail::forward<Args>(args)...)
+{
+
+}
+
+template <typename E>
+template <typename U, typename...Args, typename>
+inline RESULT_INLINE_VISIBILITY constexpr
+RESULT_NS_IMPL::failure<E>::failure(
+  in_place_t,
+  std::initializer_list<U> ilist,
+  Args&&...args
+) noexcept(std::is_nothrow_constructible<E, std::initializer_list<U>, Args...>::value)
+  : m_failure(ilist, detail::forward<Args>(args)...)
+{
+
+}
+
+template <typename E>
+template <typename E2,
+          typename std::enable_if<RESULT_NS_IMPL::detail::failure_is_explicit_value_convertible<E,E2>::value,int>::type>
+inline RESULT_INLINE_VISIBILITY constexpr
+RESULT_NS_IMPL::failure<E>::failure(E2&& error)
+  noexcept(std::is_nothrow_constructible<E,E2>::value)
+  : m_failure(detail::forward<E2>(error))
+{
+
+}
+
+template <typename E>
+template <typename E2,
+          typename std::enable_if<RESULT_NS_IMPL::detail::failure_is_implicit_value_convertible<E,E2>::value,int>::type>
+inline RESULT_INLINE_VISIBILITY constexpr
+RESULT_NS_IMPL::failure<E>::failure(E2&& error)
+  noexcept(std::is_nothrow_constructible<E,E2>::value)
+  : m_failure(detail::forward<E2>(error))
+{
+
+}
+
+template <typename E>
+template <typename E2, typename>
+inline RESULT_INLINE_VISIBILITY constexpr
+RESULT_NS_IMPL::failure<E>::failure(const failure<E2>& other)
+  noexcept(std::is_nothrow_constructible<E,const E2&>::value)
+  : m_failure(other.error())
+{
 
-    //-------------------------------------------------------------------------
+}
 
-    /// \brief Returns a result containing \p value if this result contains
-    ///        a value, otherwise returns a result containing the current
-    ///        error.
-    ///
-    /// ### Examples
-    ///
-    /// Basic Usage:
-    ///
-    /// ```cpp
-    /// auto r = cpp::result<int,int>{42};
-    /// assert(r.and_then(100) == 100);
-    ///
-    /// auto r = cpp::result<int,int>{cpp::fail(42)};
-    /// assert(r.and_then(100) == cpp::fail(42));
-    /// ```
-    ///
-    /// \param value the value to return as a result
-    /// \return a result of \p value if this contains a value
-    template <typename U>
-    RESULT_WARN_UNUSED
-    constexpr auto and_then(U&& value) const -> result<typename std::decay<U>::type,E>;
+template <typename E>
+template <typename E2, typename>
+inline RESULT_INLINE_VISIBILITY constexpr
+RESULT_NS_IMPL::failure<E>::failure(failure<E2>&& other)
+  noexcept(std::is_nothrow_constructible<E,E2&&>::value)
+  : m_failure(static_cast<failure<E2>&&>(other).error())
+{
 
-    /// \{
-    /// \brief Invokes the function \p fn with the value of this result as
-    ///        the argument
-    ///
-    /// If this result contains an error, a result of the error is returned
-    ///
-    /// The function being called must return a `result` type or the program
-    /// is ill-formed
-    ///
-    /// If this is called on an rvalue of `result` which contains an error,
-    /// the returned `result` is constructed from an rvalue of that error.
-    ///
-    /// ### Examples
-    ///
-    /// Basic Usage:
-    ///
-    /// ```cpp
-    /// auto to_string(int) -> cpp::result<std::string,int>;
-    /// auto r = cpp::result<int,int>{42};
-    /// assert(r.flat_map(to_string) == "42");
-    ///
-    /// auto r = cpp::result<int,int>{cpp::fail(42)};
-    /// assert(r.flat_map(to_string) == cpp::fail(42));
-    /// ```
-    ///
-    /// \param fn the function to invoke with this
-    /// \return The result of the function being called
-    template <typename Fn>
-    RESULT_WARN_UNUSED
-    constexpr auto flat_map(Fn&& fn) const & -> detail::invoke_result_t<Fn, const T&>;
-    template <typename Fn>
-    RESULT_WARN_UNUSED
-    RESULT_CPP14_CONSTEXPR auto flat_map(Fn&& fn) && -> detail::invoke_result_t<Fn, T&&>;
-    /// \}
+}
 
-    /// \{
-    /// \brief Invokes the function \p fn with the value of this result as
-    ///        the argument
-    ///
-    /// If this result is an error, the result of this function is that
-    /// error. Otherwise this function wraps the result and returns it as an
-    /// result.
-    ///
-    /// If this is called on an rvalue of `result` which contains an error,
-    /// the returned `result` is constructed from an rvalue of that error.
-    ///
-    /// ### Examples
-    ///
-    /// Basic Usage:
-    ///
-    /// ```cpp
-    /// auto to_string(int) -> std::string;
-    /// auto r = cpp::result<int,int>{42};
-    /// assert(r.map(to_string) == "42");
-    ///
-    /// auto r = cpp::result<int,int>{cpp::fail(42)};
-    /// assert(r.map(to_string) == cpp::fail(42));
-    /// ```
-    ///
-    /// \param fn the function to invoke with this
-    /// \return The result result of the function invoked
-    template <typename Fn>
-    RESULT_WARN_UNUSED
-    constexpr auto map(Fn&& fn) const & -> result<detail::invoke_result_t<Fn,const T&>,E>;
-    template <typename Fn>
-    RESULT_WARN_UNUSED
-    RESULT_CPP14_CONSTEXPR auto map(Fn&& fn) && -> result<detail::invoke_result_t<Fn,T&&>,E>;
-    /// \}
+//-----------------------------------------------------------------------------
 
-    /// \{
-    /// \brief Invokes the function \p fn with the error of this result as
-    ///        the argument
-    ///
-    /// If this result contains a value, the result of this function is that
-    /// value. Otherwise the function is called with that error and returns the
-    /// result as a result.
-    ///
-    /// If this is called on an rvalue of `result` which contains a value,
-    /// the returned `result` is constructed from an rvalue of that value.
-    ///
-    /// ### Examples
-    ///
-    /// Basic Usage:
-    ///
-    /// ```cpp
-    /// auto to_string(int) -> std::string;
-    /// auto r = cpp::result<int,int>{42};
-    /// assert(r.map_error(to_string) == 42);
-    ///
-    /// auto r = cpp::result<int,int>{cpp::fail(42)};
-    /// assert(r.map_error(to_string) == cpp::fail("42"));
-    ///
-    /// auto r = cpp::result<std::string,int>{};
-    /// auto s = r.map(std::string::size); // 's' contains 'result<size_t,int>'
-    /// ```
-    ///
-    /// \param fn the function to invoke with this
-    /// \return The result result of the function invoked
-    template <typename Fn>
-    RESULT_WARN_UNUSED
-    constexpr auto map_error(Fn&& fn)
-      const & -> result<T, detail::invoke_result_t<Fn,const E&>>;
-    template <typename Fn>
-    RESULT_WARN_UNUSED
-    RESULT_CPP14_CONSTEXPR auto map_error(Fn&& fn)
-      && -> result<T, detail::invoke_result_t<Fn,E&&>>;
-    /// \}
+template <typename E>
+template <typename E2, typename>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP14_CONSTEXPR
+auto RESULT_NS_IMPL::failure<E>::operator=(E2&& error)
+  noexcept(
+    std::is_nothrow_assignable<E,E2>::value ||
+    std::is_lvalue_reference<E>::value
+  ) -> failure&
+{
+  m_failure = detail::forward<E2>(error);
 
-    /// \{
-    /// \brief Invokes the function \p fn with the error of this result as
-    ///        the argument
-    ///
-    /// If this result contains a value, a result of the value is returned
-    ///
-    /// The function being called must return a `result` type or the program
-    /// is ill-formed
-    ///
-    /// If this is called on an rvalue of `result` which contains an error,
-    /// the returned `result` is constructed from an rvalue of that error.
-    ///
-    /// ### Examples
-    ///
-    /// Basic Usage:
-    ///
-    /// ```cpp
-    /// auto to_string(int) -> cpp::result<int,std::string>;
-    /// auto r = cpp::result<int,int>{42};
-    /// assert(r.flat_map(to_string) == 42);
-    ///
-    /// auto r = cpp::result<int,int>{cpp::fail(42)};
-    /// assert(r.flat_map(to_string) == cpp::fail("42"));
-    /// ```
-    ///
-    /// \param fn the function to invoke with this
-    /// \return The result of the function being called
-    template <typename Fn>
-    RESULT_WARN_UNUSED
-    constexpr auto flat_map_error(Fn&& fn)
-      const & -> detail::invoke_result_t<Fn, const E&>;
-    template <typename Fn>
-    RESULT_WARN_UNUSED
-    RESULT_CPP14_CONSTEXPR auto flat_map_error(Fn&& fn)
-      && -> detail::invoke_result_t<Fn, E&&>;
-    /// \}
+  return (*this);
+}
 
-    //-------------------------------------------------------------------------
-    // Private Members
-    //-------------------------------------------------------------------------
-  private:
+template <typename E>
+template <typename E2, typename>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP14_CONSTEXPR
+auto RESULT_NS_IMPL::failure<E>::operator=(const failure<E2>& other)
+  noexcept(std::is_nothrow_assignable<E,const E2&>::value)
+  -> failure&
+{
+  m_failure = other.error();
 
-    detail::result_storage<T,E> m_storage;
+  return (*this);
+}
 
-    //-------------------------------------------------------------------------
-    // Private Monadic Functions
-    //-------------------------------------------------------------------------
-  private:
+template <typename E>
+template <typename E2, typename>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP14_CONSTEXPR
+auto RESULT_NS_IMPL::failure<E>::operator=(failure<E2>&& other)
+  noexcept(std::is_nothrow_assignable<E,E2&&>::value)
+  -> failure&
+{
+  m_failure = static_cast<failure<E2>&&>(other).error();
 
-    /// \{
-    /// \brief Map implementations for void and non-void functions
-    ///
-    /// \param fn the function
-    template <typename Fn>
-    constexpr auto map_impl(std::true_type, Fn&& fn) const & -> result<void,E>;
-    template <typename Fn>
-    constexpr auto map_impl(std::false_type, Fn&& fn) const & -> result<detail::invoke_result_t<Fn,const T&>,E>;
-    template <typename Fn>
-    RESULT_CPP14_CONSTEXPR auto map_impl(std::true_type, Fn&& fn) && -> result<void,E>;
-    template <typename Fn>
-    RESULT_CPP14_CONSTEXPR auto map_impl(std::false_type, Fn&& fn) && -> result<detail::invoke_result_t<Fn,T&&>,E>;
-    /// \}
-  };
+  return (*this);
+}
+
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
+
+template <typename E>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP14_CONSTEXPR
+auto RESULT_NS_IMPL::failure<E>::error()
+  & noexcept -> typename std::add_lvalue_reference<E>::type
+{
+  return m_failure;
+}
+
+template <typename E>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP14_CONSTEXPR
+auto RESULT_NS_IMPL::failure<E>::error()
+  && noexcept -> typename std::add_rvalue_reference<E>::type
+{
+  using reference = typename std::add_rvalue_reference<E>::type;
+
+  return static_cast<reference>(m_failure);
+}
+
+template <typename E>
+inline RESULT_INLINE_VISIBILITY constexpr
+auto RESULT_NS_IMPL::failure<E>::error()
+  const & noexcept
+  -> typename std::add_lvalue_reference<typename std::add_const<E>::type>::type
+{
+  return m_failure;
+}
 
-  //===========================================================================
-  // class : result<void,E>
-  //===========================================================================
+template <typename E>
+inline RESULT_INLINE_VISIBILITY constexpr
+auto RESULT_NS_IMPL::failure<E>::error()
+  const && noexcept
+  -> typename std::add_rvalue_reference<typename std::add_const<E>::type>::type
+{
+  using reference = typename std::add_rvalue_reference<typename std::add_const<E>::type>::type;
 
-  /////////////////////////////////////////////////////////////////////////////
-  /// \brief Partial specialization of `result<void, E>`
-  ///
-  /// \tparam E the underlying error type
-  /////////////////////////////////////////////////////////////////////////////
-  template <typename E>
-  class RESULT_NODISCARD result<void,E>
-  {
-    // Type requirements
+  return static_cast<reference>(m_failure);
+}
 
-    static_assert(
-      !std::is_void<typename std::decay<E>::type>::value,
-      "It is ill-formed for E to be (possibly CV-qualified) void type"
-    );
-    static_assert(
-      !std::is_abstract<E>::value,
-      "It is ill-formed for E to be abstract type"
-    );
-    static_assert(
-      !is_failure<typename std::decay<E>::type>::value,
-      "It is ill-formed for E to be a (possibly CV-qualified) 'failure' type"
-    );
-    static_assert(
-      !std::is_reference<E>::value,
-      "It is ill-formed for E to be a reference type. "
-      "Only T types may be lvalue references"
-    );
+//=============================================================================
+// non-member functions : class : failure
+//=============================================================================
 
-    // Friendship
+//-----------------------------------------------------------------------------
+// Comparison
+//-----------------------------------------------------------------------------
 
-    friend detail::result_error_extractor;
+template <typename E1, typename E2>
+inline RESULT_INLINE_VISIBILITY constexpr
+auto RESULT_NS_IMPL::operator==(const failure<E1>& lhs, const failure<E2>& rhs)
+  noexcept -> bool
+{
+  return lhs.error() == rhs.error();
+}
 
-    template <typename T2, typename E2>
-    friend class result;
+template <typename E1, typename E2>
+inline RESULT_INLINE_VISIBILITY constexpr
+auto RESULT_NS_IMPL::operator!=(const failure<E1>& lhs, const failure<E2>& rhs)
+  noexcept -> bool
+{
+  return lhs.error() != rhs.error();
+}
 
-    //-------------------------------------------------------------------------
-    // Public Member Types
-    //-------------------------------------------------------------------------
-  public:
+template <typename E1, typename E2>
+inline RESULT_INLINE_VISIBILITY constexpr
+auto RESULT_NS_IMPL::operator<(const failure<E1>& lhs, const failure<E2>& rhs)
+  noexcept -> bool
+{
+  return lhs.error() < rhs.error();
+}
 
-    using value_type = void; ///< The value type of this result
-    using error_type = E;    ///< The error type of this result
-    using failure_type = failure<E>; ///< The failure type
+template <typename E1, typename E2>
+inline RESULT_INLINE_VISIBILITY constexpr
+auto RESULT_NS_IMPL::operator>(const failure<E1>& lhs, const failure<E2>& rhs)
+  noexcept -> bool
+{
+  return lhs.error() > rhs.error();
+}
 
-    template <typename U>
-    using rebind = result<U,E>; ///< Rebinds the result type
+template <typename E1, typename E2>
+inline RESULT_INLINE_VISIBILITY constexpr
+auto RESULT_NS_IMPL::operator<=(const failure<E1>& lhs, const failure<E2>& rhs)
+  noexcept -> bool
+{
+  return lhs.error() <= rhs.error();
+}
 
-    //-------------------------------------------------------------------------
-    // Constructor / Assignment
-    //-------------------------------------------------------------------------
-  public:
+template <typename E1, typename E2>
+inline RESULT_INLINE_VISIBILITY constexpr
+auto RESULT_NS_IMPL::operator>=(const failure<E1>& lhs, const failure<E2>& rhs)
+  noexcept -> bool
+{
+  return lhs.error() >= rhs.error();
+}
 
-    /// \brief Constructs a `result` object in a value state
-    ///
-    /// ### Examples
-    ///
-    /// Basic Usage:
-    ///
-    /// ```cpp
-    /// auto r = cpp::result<void,int>{};
-    /// ```
-    constexpr result() noexcept;
+//-----------------------------------------------------------------------------
+// Utilities
+//-----------------------------------------------------------------------------
 
-    /// \brief Copy constructs this result
-    ///
-    /// If other contains an error, constructs an object that contains a copy
-    /// of that error.
-    ///
-    /// \note This constructor is defined as deleted if
-    ///       `std::is_copy_constructible<E>::value` is `false`
-    ///
-    /// \note This constructor is defined as trivial if both
-    ///       `std::is_trivially_copy_constructible<E>::value` are `true`
-    ///
-    /// ### Examples
-    ///
-    /// Basic Usage:
-    ///
-    /// ```cpp
-    /// const auto r = cpp::result<void,int>{};
-    /// const auto s = r;
-    /// ```
-    ///
-    /// \param other the result to copy
-    constexpr result(const result& other) = default;
+#if defined(RESULT_ENABLE_STATS)
 
-    /// \brief Move constructs a result
-    ///
-    /// If other contains an error, move-constructs this result from that
-    /// error.
-    ///
-    /// \note This constructor is defined as deleted if
-    ///       `std::is_move_constructible<E>::value` is `false`
-    ///
-    /// \note This constructor is defined as trivial if both
-    ///       `std::is_trivially_move_constructible<E>::value` are `true`
-    ///
-    /// ### Examples
-    ///
-    /// Basic Usage:
-    ///
-    /// ```cpp
-    /// auto r = cpp::result<void,std::string>{};
-    /// auto s = std::move(r);
-    /// ```
-    ///
-    /// \param other the result to move
-    constexpr result(result&& other) = default;
+template <typename E>
+inline RESULT_INLINE_VISIBILITY constexpr
+auto RESULT_NS_IMPL::fail(E&& e, source_location where)
+  noexcept(std::is_nothrow_constructible<typename std::decay<E>::type,E>::value)
+  -> failure<typename std::decay<E>::type>
+{
+  using result_type = failure<typename std::decay<E>::type>;
 
-    /// \brief Converting copy constructor
-    ///
-    /// If \p other contains a value, constructs a result object that is not
-    /// in an error state -- ignoring the value.
-    ///
-    /// If \p other contains an error, constructs a result object that
-    /// contains an error, initialized as if direct-initializing
-    /// (but not direct-list-initializing) an object of type `E`.
-    ///
-    /// \note This constructor does not participate in overload resolution
-    ///       unless the following conditions are met:
-    ///       - `std::is_constructible_v<E, const E2&>` is `true`
-    ///
-    /// ### Examples
-    ///
-    /// Basic Usage:
-    ///
-    /// ```cpp
-    /// const auto r = cpp::result<int,int>{42};
-    /// const auto s = cpp::result<void,int>{r};
-    /// ```
-    ///
-    /// \param other the other type to convert
-    template <typename U, typename E2,
-              typename = typename std::enable_if<std::is_constructible<E,E2>::value>::type>
-    explicit result(const result<U,E2>& other)
-      noexcept(std::is_nothrow_constructible<E,const E2&>::value);
+  return static_cast<void>(
+    detail::record_failure<typename std::decay<E>::type>(where)
+  ), result_type(
+    detail::forward<E>(e)
+  );
+}
 
-    /// \brief Converting move constructor
-    ///
-    /// If \p other contains an error, constructs a result object that
-    /// contains an error, initialized as if direct-initializing
-    /// (but not direct-list-initializing) an object of type E&&.
-    ///
-    /// \note This constructor does not participate in overload resolution
-    ///       unless the following conditions are met:
-    ///       - `std::is_constructible_v<E, const E2&>` is `true`
-    ///
-    /// ### Examples
-    ///
-    /// Basic Usage:
-    ///
-    /// ```cpp
-    /// auto r = cpp::result<int,std::string>{42};
-    /// auto s = cpp::result<void,std::string>{
-    ///   std::move(r)
-    /// };
-    /// ```
-    ///
-    /// \param other the other type to convert
-    template <typename U, typename E2,
-              typename = typename std::enable_if<std::is_constructible<E,E2>::value>::type>
-    explicit result(result<U,E2>&& other)
-      noexcept(std::is_nothrow_constructible<E,E2&&>::value);
+template <typename E>
+inline RESULT_INLINE_VISIBILITY constexpr
+auto RESULT_NS_IMPL::fail(std::reference_wrapper<E> e, source_location where)
+  noexcept -> failure<E&>
+{
+  using result_type = failure<E&>;
 
-    //-------------------------------------------------------------------------
+  return static_cast<void>(
+    detail::record_failure<typename std::remove_cv<E>::type>(where)
+  ), result_type{e.get()};
+}
 
-    /// \brief Constructs a result object in a value state
-    ///
-    /// This constructor exists primarily for symmetry with the `result<T,E>`
-    /// constructor. Unlike the `T` overload, no variadic arguments may be
-    /// supplied.
-    ///
-    /// ### Examples
-    ///
-    /// Basic Usage:
-    ///
-    /// ```cpp
-    /// auto r = cpp::result<void,std::string>{cpp::in_place};
-    /// ```
-    constexpr explicit result(in_place_t) noexcept;
+template <typename E, typename...Args, typename>
+inline RESULT_INLINE_VISIBILITY constexpr
+auto RESULT_NS_IMPL::fail(Args&&...args)
+  noexcept(std::is_nothrow_constructible<E, Args...>::value)
+  -> failure<E>
+{
+  return static_cast<void>(
+    detail::record_failure<E>(source_location{})
+  ), failure<E>(in_place, detail::forward<Args>(args)...);
+}
+
+template <typename E, typename U, typename...Args, typename>
+inline RESULT_INLINE_VISIBILITY constexpr
+auto RESULT_NS_IMPL::fail(std::initializer_list<U> ilist, Args&&...args)
+  noexcept(std::is_nothrow_constructible<E, std::initializer_list<U>, Args...>::value)
+  -> failure<E>
+{
+  return static_cast<void>(
+    detail::record_failure<E>(source_location{})
+  ), failure<E>(in_place, ilist, detail::forward<Args>(args)...);
+}
 
-    /// \brief Constructs a result object that contains an error
-    ///
-    /// the value is initialized as if direct-initializing (but not
-    /// direct-list-initializing) an object of type `E` from the arguments
-    /// `std::forward<Args>(args)...`
-    ///
-    /// ### Examples
-    ///
-    /// Basic Usage:
-    ///
-    /// ```cpp
-    /// auto r = cpp::result<void,std::string>{
-    ///   cpp::in_place_error, "Hello world"
-    /// };
-    /// ```
-    ///
-    /// \param args the arguments to pass to `E`'s constructor
-    template <typename...Args,
-              typename = typename std::enable_if<std::is_constructible<E,Args...>::value>::type>
-    constexpr explicit result(in_place_error_t, Args&&... args)
-      noexcept(std::is_nothrow_constructible<E, Args...>::value);
+#else
 
-    /// \brief Constructs a result object that contains an error
-    ///
-    /// The value is initialized as if direct-initializing (but not
-    /// direct-list-initializing) an object of type `E` from the arguments
-    /// `std::forward<std::initializer_list<U>>(ilist)`,
-    /// `std::forward<Args>(args)...`
-    ///
-    /// ### Examples
-    ///
-    /// Basic Usage:
-    ///
-    /// ```cpp
-    /// auto r = cpp::result<void,std::string>{
-    ///   cpp::in_place_error, {'H','e','l','l','o'}
-    /// };
-    /// ```
-    ///
-    /// \param ilist An initializer list of entries to forward
-    /// \param args  the arguments to pass to Es constructor
-    template <typename U, typename...Args,
-              typename = typename std::enable_if<std::is_constructible<E, std::initializer_list<U>&, Args...>::value>::type>
-    constexpr explicit result(in_place_error_t,
-                              std::initializer_list<U> ilist,
-                              Args&&...args)
-      noexcept(std::is_nothrow_constructible<E, std::initializer_list<U>, Args...>::value);
+template <typename E>
+inline RESULT_INLINE_VISIBILITY constexpr
+auto RESULT_NS_IMPL::fail(E&& e)
+  noexcept(std::is_nothrow_constructible<typename std::decay<E>::type,E>::value)
+  -> failure<typename std::decay<E>::type>
+{
+  using result_type = failure<typename std::decay<E>::type>;
 
-    //-------------------------------------------------------------------------
+  return result_type(
+    detail::forward<E>(e)
+  );
+}
 
-    /// \{
-    /// \brief Constructs the underlying error of this result
-    ///
-    /// \note This constructor only participates in overload resolution if
-    ///       `E` is constructible from \p e
-    ///
-    /// ### Examples
-    ///
-    /// Basic Usage:
-    ///
-    /// ```cpp
-    /// cpp::result<void,int> r = cpp::fail(42);
-    ///
-    /// auto get_error_result() -> cpp::result<void,std::string> {
-    ///   return cpp::fail("hello world!");
-    /// }
-    /// ```
-    ///
-    /// \param e the failure error
-    template <typename E2,
-              typename = typename std::enable_if<std::is_constructible<E,const E2&>::value>::type>
-    constexpr /* implicit */ result(const failure<E2>& e)
-      noexcept(std::is_nothrow_constructible<E,const E2&>::value);
-    template <typename E2,
-              typename = typename std::enable_if<std::is_constructible<E,E2&&>::value>::type>
-    constexpr /* implicit */ result(failure<E2>&& e)
-      noexcept(std::is_nothrow_constructible<E,E2&&>::value);
-    /// \}
+template <typename E>
+inline RESULT_INLINE_VISIBILITY constexpr
+auto RESULT_NS_IMPL::fail(std::reference_wrapper<E> e)
+  noexcept -> failure<E&>
+{
+  using result_type = failure<E&>;
 
-    //-------------------------------------------------------------------------
+  return result_type{e.get()};
+}
 
-    /// \brief Copy assigns the result stored in \p other
-    ///
-    /// \note The function does not participate in overload resolution unless
-    ///       - `std::is_nothrow_copy_constructible_v<E>` is `true`
-    ///       this restriction guarantees that no 'valueless_by_exception` state
-    ///       may occur.
-    ///
-    /// \note This assignment operator is defined as trivial if the following
-    ///       conditions are all `true`:
-    ///       - `std::is_trivially_copy_constructible<E>::value`
-    ///       - `std::is_trivially_copy_assignable<E>::value`
-    ///       - `std::is_trivially_destructible<E>::value`
-    ///
-    /// \param other the other result to copy
-    auto operator=(const result& other) -> result& = default;
+template <typename E, typename...Args, typename>
+inline RESULT_INLINE_VISIBILITY constexpr
+auto RESULT_NS_IMPL::fail(Args&&...args)
+  noexcept(std::is_nothrow_constructible<E, Args...>::value)
+  -> failure<E>
+{
+  return failure<E>(in_place, detail::forward<Args>(args)...);
+}
 
-    /// \brief Move assigns the result stored in \p other
-    ///
-    /// \note The function does not participate in overload resolution unless
-    ///       - `std::is_nothrow_copy_constructible_v<E>` is `true`
-    ///       this restriction guarantees that no 'valueless_by_exception` state
-    ///       may occur.
-    ///
-    /// \note This assignment operator is defined as trivial if the following
-    ///       conditions are all `true`:
-    ///       - `std::is_trivially_move_constructible<E>::value`
-    ///       - `std::is_trivially_move_assignable<E>::value`
-    ///       - `std::is_trivially_destructible<E>::value`
-    ///
-    /// \param other the other result to copy
-    auto operator=(result&& other) -> result& = default;
+template <typename E, typename U, typename...Args, typename>
+inline RESULT_INLINE_VISIBILITY constexpr
+auto RESULT_NS_IMPL::fail(std::initializer_list<U> ilist, Args&&...args)
+  noexcept(std::is_nothrow_constructible<E, std::initializer_list<U>, Args...>::value)
+  -> failure<E>
+{
+  return failure<E>(in_place, ilist, detail::forward<Args>(args)...);
+}
 
-    /// \brief Copy-converts the state of \p other
-    ///
-    /// If both this and \p other contain an error, the underlying error is
-    /// assigned through copy-assignment.
-    ///
-    /// If \p other contains a value state, this result is constructed in a
-    /// value state.
-    ///
-    /// If \p other contans an error state, and this contains a value state,
-    /// the underlying error is constructed through copy-construction.
-    ///
-    /// \note The function does not participate in overload resolution unless
-    ///       - `std::is_nothrow_constructible_v<E, const E2&>`,
-    ///         `std::is_assignable_v<E&, const E2&>` are all `true`.
-    ///
-    /// \param other the other result object to convert
-    /// \return reference to `(*this)`
-    template <typename E2,
-              typename = typename std::enable_if<std::is_nothrow_constructible<E,const E2&>::value &&
-                                                 std::is_assignable<E&,const E2&>::value>::type>
-    auto operator=(const result<void,E2>& other)
-      noexcept(std::is_nothrow_assignable<E, const E2&>::value) -> result&;
+#endif // defined(RESULT_ENABLE_STATS)
 
-    /// \brief Move-converts the state of \p other
-    ///
-    /// If both this and \p other contain an error, the underlying error is
-    /// assigned through move-assignment.
-    ///
-    /// If \p other contains a value state, this result is constructed in a
-    /// value state.
-    ///
-    /// If \p other contans an error state, and this contains a value state,
-    /// the underlying error is constructed through move-construction.
-    ///
-    /// \note The function does not participate in overload resolution unless
-    ///       - `std::is_nothrow_constructible_v<E, E2&&>`,
-    ///         `std::is_assignable_v<E&, E2&&>` are all `true`.
-    ///
-    /// \param other the other result object to convert
-    /// \return reference to `(*this)`
-    template <typename E2,
-              typename = typename std::enable_if<std::is_nothrow_constructible<E,E2&&>::value &&
-                                                 std::is_assignable<E&,E2&&>::value>::type>
-    auto operator=(result<void,E2>&& other)
-      noexcept(std::is_nothrow_assignable<E, E2&&>::value) -> result&;
+template <typename E>
+inline RESULT_INLINE_VISIBILITY
+auto RESULT_NS_IMPL::swap(failure<E>& lhs, failure<E>& rhs)
+#if __cplusplus >= 201703L
+  noexcept(std::is_nothrow_swappable<E>::value) -> void
+#else
+  noexcept(std::is_nothrow_move_constructible<E>::value)
+   -> void
+#endif
+{
+  using std::swap;
 
-    /// \{
-    /// \brief Perfect-forwarded assignment
-    ///
-    /// Depending on whether `*this` contains an error before the call, the
-    /// contained error is either direct-initialized via forwarding the error,
-    /// or assigned from forwarding the error
-    ///
-    /// \note The function does not participate in overload resolution unless
-    ///       - `std::is_nothrow_constructible_v<E, E2>` is `true`, and
-    ///       - `std::is_assignable_v<E&, E2>` is `true`
-    ///
-    /// \param other the failure value to assign to this
-    /// \return reference to `(*this)`
-    template <typename E2,
-              typename = typename std::enable_if<detail::result_is_failure_assignable<E,const E2&>::value>::type>
-    auto operator=(const failure<E2>& other)
-      noexcept(std::is_nothrow_assignable<E, const E2&>::value) -> result&;
-    template <typename E2,
-              typename = typename std::enable_if<detail::result_is_failure_assignable<E,E2&&>::value>::type>
-    auto operator=(failure<E2>&& other)
-      noexcept(std::is_nothrow_assignable<E, E2&&>::value) -> result&;
-    /// \}
+  swap(lhs.error(), rhs.error());
+}
 
-    //-------------------------------------------------------------------------
-    // Observers
-    //-------------------------------------------------------------------------
-  public:
+//=============================================================================
+// struct : enum_niche_traits<T, Last>
+//=============================================================================
 
+#if __cplusplus < 201703L
+template <typename T, T Last>
+constexpr std::size_t RESULT_NS_IMPL::enum_niche_traits<T, Last>::payload_bits;
+#endif
 
-    /// \brief Contextually convertible to `true` if `*this` does not contain
-    ///        an error
-    ///
-    /// This function exists to allow for simple, terse checks for containing
-    /// a value.
-    ///
-    /// ### Examples
-    ///
-    /// Basic Usage:
-    ///
-    /// ```cpp
-    /// auto get_result() -> cpp::result<void, int>;
-    /// auto r = get_result();
-    /// if (r) { ... }
-    ///
-    /// assert(static_cast<bool>(cpp::result<void,int>{}));
-    ///
-    /// assert(!static_cast<bool>(cpp::result<void,int>{cpp::fail(42)}));
-    /// ```
-    ///
-    /// \return `true` if `*this` contains a value, `false` if `*this`
-    ///         does not contain a value
-    RESULT_WARN_UNUSED
-    constexpr explicit operator bool() const noexcept;
+template <typename T, T Last>
+inline RESULT_INLINE_VISIBILITY constexpr
+auto RESULT_NS_IMPL::enum_niche_traits<T, Last>::make_niche(std::uintmax_t payload)
+  noexcept -> T
+{
+  return static_cast<T>(static_cast<underlying_type>(
+    static_cast<std::uintmax_t>(static_cast<underlying_type>(Last)) + payload + 1u
+  ));
+}
 
-    /// \copydoc result<T,E>::has_value
-    RESULT_WARN_UNUSED
-    constexpr auto has_value() const noexcept -> bool;
+template <typename T, T Last>
+inline RESULT_INLINE_VISIBILITY constexpr
+auto RESULT_NS_IMPL::enum_niche_traits<T, Last>::is_niche(const T& value)
+  noexcept -> bool
+{
+  return static_cast<underlying_type>(value) > static_cast<underlying_type>(Last);
+}
+
+template <typename T, T Last>
+inline RESULT_INLINE_VISIBILITY constexpr
+auto RESULT_NS_IMPL::enum_niche_traits<T, Last>::niche_payload(const T& value)
+  noexcept -> std::uintmax_t
+{
+  return static_cast<std::uintmax_t>(static_cast<underlying_type>(value)) -
+    static_cast<std::uintmax_t>(static_cast<underlying_type>(Last)) - 1u;
+}
 
-    /// \copydoc result<T,E>::has_error
-    RESULT_WARN_UNUSED
-    constexpr auto has_error() const noexcept -> bool;
+//=============================================================================
+// struct : pointer_niche_traits<T>
+//=============================================================================
 
-    //-------------------------------------------------------------------------
+template <typename T>
+inline RESULT_INLINE_VISIBILITY
+auto RESULT_NS_IMPL::pointer_niche_traits<T>::make_niche(std::uintmax_t payload)
+  noexcept -> T*
+{
+  return reinterpret_cast<T*>(
+    static_cast<std::uintptr_t>((payload << 1u) | 1u)
+  );
+}
 
-    /// \{
-    /// \brief Throws an exception if `(*this)` is in an error state
-    ///
-    /// This function exists for symmetry with `cpp::result<T,E>` objects where
-    /// `T` contains a value.
-    ///
-    /// If this contains an error, an exception is thrown containing the
-    /// underlying error. The error is consumed propagating the same constness
-    /// and refness of this result.
-    ///
-    /// ### Examples
-    ///
-    /// Basic Usage:
-    ///
-    /// ```cpp
-    /// cpp::result<void,int>{}.value(); // no exception
-    ///
-    /// auto r = cpp::result<void,std::unique_ptr<int>>{
-    ///   cpp::fail(std::make_unique<int>(42))
-    /// };
-    /// std::move(r).value(); // throws bad_result_access<std::unique_ptr<int>>
-    ///
-    /// try {
-    ///   auto r = cpp::result<void,int>{ cpp::fail(42) }.value();
-    /// } catch (const cpp::bad_result_access<int>& e) {
-    ///   assert(e.error() == 42);
-    /// }
-    /// ```
-    ///
-    /// \throws bad_result_access<E> if `*this` does not contain a value.
-    RESULT_CPP14_CONSTEXPR auto value() && -> void;
-    RESULT_CPP14_CONSTEXPR auto value() const & -> void;
-    /// \}
+template <typename T>
+inline RESULT_INLINE_VISIBILITY
+auto RESULT_NS_IMPL::pointer_niche_traits<T>::is_niche(T* const& value)
+  noexcept -> bool
+{
+  return (reinterpret_cast<std::uintptr_t>(value) & 1u) != 0u;
+}
 
-    /// \{
-    /// \copydoc result<T,E>::error
-    RESULT_WARN_UNUSED
-    constexpr auto error() const &
-      noexcept(std::is_nothrow_constructible<E>::value &&
-               std::is_nothrow_copy_constructible<E>::value) -> E;
-    RESULT_WARN_UNUSED
-    RESULT_CPP14_CONSTEXPR auto error() &&
-      noexcept(std::is_nothrow_constructible<E>::value &&
-               std::is_nothrow_copy_constructible<E>::value) -> E;
-    /// \}
+template <typename T>
+inline RESULT_INLINE_VISIBILITY
+auto RESULT_NS_IMPL::pointer_niche_traits<T>::niche_payload(T* const& value)
+  noexcept -> std::uintmax_t
+{
+  return static_cast<std::uintmax_t>(reinterpret_cast<std::uintptr_t>(value) >> 1u);
+}
 
-    /// \{
-    /// \copydoc result<T,E>::expect
-    template <typename String,
-              typename = typename std::enable_if<(
-                std::is_convertible<String,const std::string&>::value &&
-                std::is_copy_constructible<E>::value
-              )>::type>
-    RESULT_CPP14_CONSTEXPR auto expect(String&& message) const & -> void;
-    template <typename String,
-              typename = typename std::enable_if<(
-                std::is_convertible<String,const std::string&>::value &&
-                std::is_move_constructible<E>::value
-              )>::type>
-    RESULT_CPP14_CONSTEXPR auto expect(String&& message) && -> void;
-    /// \}
+//=============================================================================
+// struct : result_niche_traits<detail::niche_reference<T>>
+//=============================================================================
 
-    //-------------------------------------------------------------------------
-    // Monadic Functionalities
-    //-------------------------------------------------------------------------
-  public:
+template <typename T>
+inline RESULT_INLINE_VISIBILITY
+auto RESULT_NS_IMPL::result_niche_traits<RESULT_NS_IMPL::detail::niche_reference<T>>
+  ::make_niche(std::uintmax_t payload)
+  noexcept -> detail::niche_reference<T>
+{
+  return detail::niche_reference<T>{result_niche_traits<T*>::make_niche(payload)};
+}
 
-    /// \{
-    /// \copydoc result<T,E>::error_or
-    template <typename U>
-    RESULT_WARN_UNUSED
-    constexpr auto error_or(U&& default_error) const & -> error_type;
-    template <typename U>
-    RESULT_WARN_UNUSED
-    RESULT_CPP14_CONSTEXPR auto error_or(U&& default_error) && -> error_type;
-    /// \}
+template <typename T>
+inline RESULT_INLINE_VISIBILITY
+auto RESULT_NS_IMPL::result_niche_traits<RESULT_NS_IMPL::detail::niche_reference<T>>
+  ::is_niche(const detail::niche_reference<T>& value)
+  noexcept -> bool
+{
+  return result_niche_traits<T*>::is_niche(value.m_pointer);
+}
 
-    //-------------------------------------------------------------------------
+template <typename T>
+inline RESULT_INLINE_VISIBILITY
+auto RESULT_NS_IMPL::result_niche_traits<RESULT_NS_IMPL::detail::niche_reference<T>>
+  ::niche_payload(const detail::niche_reference<T>& value)
+  noexcept -> std::uintmax_t
+{
+  return result_niche_traits<T*>::niche_payload(value.m_pointer);
+}
 
-    /// \copydoc result<T,E>::and_then
-    template <typename U>
-    RESULT_WARN_UNUSED
-    constexpr auto and_then(U&& value) const -> result<typename std::decay<U>::type,E>;
+//=============================================================================
+// class : detail::niche_reference<T>
+//=============================================================================
 
-    /// \{
-    /// \brief Invokes the function \p fn if `(*this)` contains no value
-    ///
-    /// If this result contains an error, a result of the error is returned
-    ///
-    /// The function being called must return a `result` type or the program
-    /// is ill-formed
-    ///
-    /// If this is called on an rvalue of `result` which contains an error,
-    /// the returned `result` is constructed from an rvalue of that error.
-    ///
-    /// ### Examples
-    ///
-    /// Basic Usage:
-    ///
-    /// ```cpp
-    /// auto generate_int() -> cpp::result<int,int> { return 42; }
-    /// auto r = cpp::result<void,int>{};
-    /// assert(r.flat_map(generate_int) == 42);
-    ///
-    /// auto r = cpp::result<void,int>{cpp::fail(42)};
-    /// assert(r.flat_map(generate_int) == cpp::fail(42));
-    /// ```
-    ///
-    /// \param fn the function to invoke with this
-    /// \return The result of the function being called
-    template <typename Fn>
-    RESULT_WARN_UNUSED
-    constexpr auto flat_map(Fn&& fn) const & -> detail::invoke_result_t<Fn>;
-    template <typename Fn>
-    RESULT_WARN_UNUSED
-    RESULT_CPP14_CONSTEXPR auto flat_map(Fn&& fn) && -> detail::invoke_result_t<Fn>;
-    /// \}
+//-----------------------------------------------------------------------------
+// Constructors
+//-----------------------------------------------------------------------------
 
-    /// \{
-    /// \brief Invokes the function \p fn if `(*this)` contains no value
-    ///
-    /// If this result is an error, the result of this function is that
-    /// error. Otherwise this function wraps the result and returns it as an
-    /// result.
-    ///
-    /// If this is called on an rvalue of `result` which contains an error,
-    /// the returned `result` is constructed from an rvalue of that error.
-    ///
-    /// ### Examples
-    ///
-    /// Basic Usage:
-    ///
-    /// ```cpp
-    /// auto generate_int() -> int { return 42; }
-    /// auto r = cpp::result<void,int>{};
-    /// assert(r.map(generate_int) == 42);
-    ///
-    /// auto r = cpp::result<void,int>{cpp::fail(42)};
-    /// assert(r.map(generate_int) == cpp::fail(42));
-    /// ```
-    ///
-    /// \param fn the function to invoke with this
-    /// \return The result result of the function invoked
-    template <typename Fn>
-    RESULT_WARN_UNUSED
-    constexpr auto map(Fn&& fn) const & -> result<detail::invoke_result_t<Fn>,E>;
-    template <typename Fn>
-    RESULT_WARN_UNUSED
-    RESULT_CPP14_CONSTEXPR auto map(Fn&& fn) && -> result<detail::invoke_result_t<Fn>,E>;
-    /// \}
+template <typename T>
+inline RESULT_INLINE_VISIBILITY
+RESULT_NS_IMPL::detail::niche_reference<T>::niche_reference(T& reference)
+  noexcept
+  : m_pointer{std::addressof(reference)}
+{
+}
 
-    /// \{
-    /// \copydoc result<T,E>::map_error
-    template <typename Fn>
-    constexpr auto map_error(Fn&& fn) const & -> result<void, detail::invoke_result_t<Fn,const E&>>;
-    template <typename Fn>
-    RESULT_CPP14_CONSTEXPR
-    auto map_error(Fn&& fn) && -> result<void, detail::invoke_result_t<Fn,E&&>>;
-    /// \}
+template <typename T>
+inline RESULT_INLINE_VISIBILITY
+RESULT_NS_IMPL::detail::niche_reference<T>::niche_reference(T* pointer)
+  noexcept
+  : m_pointer{pointer}
+{
+}
 
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
 
-    /// \{
-    /// \copydoc result<T,E>::flat_map_error
-    template <typename Fn>
-    RESULT_WARN_UNUSED
-    constexpr auto flat_map_error(Fn&& fn) const & -> detail::invoke_result_t<Fn, const E&>;
-    template <typename Fn>
-    RESULT_WARN_UNUSED
-    RESULT_CPP14_CONSTEXPR auto flat_map_error(Fn&& fn) && -> detail::invoke_result_t<Fn, E&&>;
-    /// \}
+template <typename T>
+inline RESULT_INLINE_VISIBILITY constexpr
+RESULT_NS_IMPL::detail::niche_reference<T>::operator T&()
+  const noexcept
+{
+  return *m_pointer;
+}
 
-    //-------------------------------------------------------------------------
-    // Private Members
-    //-------------------------------------------------------------------------
-  private:
+template <typename T>
+inline RESULT_INLINE_VISIBILITY constexpr
+auto RESULT_NS_IMPL::detail::niche_reference<T>::get()
+  const noexcept -> T&
+{
+  return *m_pointer;
+}
 
-    detail::result_storage<detail::unit,E> m_storage;
+//=============================================================================
+// struct : detail::niche_error_traits<E, true>
+//=============================================================================
 
-    //-------------------------------------------------------------------------
-    // Private Monadic Functions
-    //-------------------------------------------------------------------------
-  private:
+template <typename E>
+inline RESULT_INLINE_VISIBILITY constexpr
+auto RESULT_NS_IMPL::detail::niche_error_traits<E, true>::encode(E error)
+  noexcept -> std::uintmax_t
+{
+  return static_cast<std::uintmax_t>(static_cast<unsigned_type>(error));
+}
 
-    /// \{
-    /// \brief Map implementations for void and non-void functions
-    ///
-    /// \param fn the function
-    template <typename Fn>
-    constexpr auto map_impl(std::true_type, Fn&& fn) const & -> result<void,E>;
-    template <typename Fn>
-    constexpr auto map_impl(std::false_type, Fn&& fn) const & -> result<detail::invoke_result_t<Fn>,E>;
-    template <typename Fn>
-    RESULT_CPP14_CONSTEXPR auto map_impl(std::true_type, Fn&& fn) && -> result<void,E>;
-    template <typename Fn>
-    RESULT_CPP14_CONSTEXPR auto map_impl(std::false_type, Fn&& fn) && -> result<detail::invoke_result_t<Fn>,E>;
-    /// \}
-  };
+template <typename E>
+inline RESULT_INLINE_VISIBILITY constexpr
+auto RESULT_NS_IMPL::detail::niche_error_traits<E, true>::decode(std::uintmax_t payload)
+  noexcept -> E
+{
+  return static_cast<E>(
+    static_cast<integral_type>(static_cast<unsigned_type>(payload))
+  );
+}
 
-  //===========================================================================
-  // non-member functions : class : result
-  //===========================================================================
+//=============================================================================
+// class : detail::result_union<T, E, IsTrivial>
+//=============================================================================
 
-  //---------------------------------------------------------------------------
-  // Comparison
-  //---------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+// Constructors / Assignment
+//-----------------------------------------------------------------------------
 
-  template <typename T1, typename E1, typename T2, typename E2>
-  constexpr auto operator==(const result<T1,E1>& lhs, const result<T2,E2>& rhs)
-    noexcept -> bool;
-  template <typename T1, typename E1, typename T2, typename E2>
-  constexpr auto operator!=(const result<T1,E1>& lhs, const result<T2,E2>& rhs)
-    noexcept -> bool;
-  template <typename T1, typename E1, typename T2, typename E2>
-  constexpr auto operator>=(const result<T1,E1>& lhs, const result<T2,E2>& rhs)
-    noexcept -> bool;
-  template <typename T1, typename E1, typename T2, typename E2>
-  constexpr auto operator<=(const result<T1,E1>& lhs, const result<T2,E2>& rhs)
-    noexcept -> bool;
-  template <typename T1, typename E1, typename T2, typename E2>
-  constexpr auto operator>(const result<T1,E1>& lhs, const result<T2,E2>& rhs)
-    noexcept -> bool;
-  template <typename T1, typename E1, typename T2, typename E2>
-  constexpr auto operator<(const result<T1,E1>& lhs, const result<T2,E2>& rhs)
-    noexcept -> bool;
+template <typename T, typename E, bool IsTrivial>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+RESULT_NS_IMPL::detail::result_union<T, E, IsTrivial>
+  ::result_union(unit)
+  noexcept
+  : m_empty{}
+{
+  // m_has_value intentionally not set
+}
 
-  //---------------------------------------------------------------------------
+template <typename T, typename E, bool IsTrivial>
+template <typename...Args>
+inline RESULT_INLINE_VISIBILITY constexpr
+RESULT_NS_IMPL::detail::result_union<T,E,IsTrivial>
+  ::result_union(in_place_t, Args&&...args)
+  noexcept(std::is_nothrow_constructible<T, Args...>::value)
+  : m_value(detail::forward<Args>(args)...),
+    m_has_value{true}
+{
+}
 
-  template <typename E1, typename E2>
-  constexpr auto operator==(const result<void,E1>& lhs, const result<void,E2>& rhs)
-    noexcept -> bool;
-  template <typename E1, typename E2>
-  constexpr auto operator!=(const result<void,E1>& lhs, const result<void,E2>& rhs)
-    noexcept -> bool;
-  template <typename E1, typename E2>
-  constexpr auto operator>=(const result<void,E1>& lhs, const result<void,E2>& rhs)
-    noexcept -> bool;
-  template <typename E1, typename E2>
-  constexpr auto operator<=(const result<void,E1>& lhs, const result<void,E2>& rhs)
-    noexcept -> bool;
-  template <typename E1, typename E2>
-  constexpr auto operator>(const result<void,E1>& lhs, const result<void,E2>& rhs)
-    noexcept -> bool;
-  template <typename E1, typename E2>
-  constexpr auto operator<(const result<void,E1>& lhs, const result<void,E2>& rhs)
-    noexcept -> bool;
+template <typename T, typename E, bool IsTrivial>
+template <typename...Args>
+inline RESULT_INLINE_VISIBILITY constexpr
+RESULT_NS_IMPL::detail::result_union<T,E,IsTrivial>
+  ::result_union(in_place_error_t, Args&&...args)
+  noexcept(std::is_nothrow_constructible<E, Args...>::value)
+  : m_error(detail::forward<Args>(args)...),
+    m_has_value{false}
+{
+}
 
-  //---------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
 
-  template <typename T, typename E, typename U,
-            typename = typename std::enable_if<!std::is_same<T,void>::value>::type>
-  constexpr auto operator==(const result<T,E>& exp, const U& value)
-    noexcept -> bool;
-  template <typename T, typename U, typename E,
-            typename = typename std::enable_if<!std::is_same<U,void>::value>::type>
-  constexpr auto operator==(const T& value, const result<U,E>& exp)
-    noexcept -> bool;
-  template <typename T, typename E, typename U,
-            typename = typename std::enable_if<!std::is_same<T,void>::value>::type>
-  constexpr auto operator!=(const result<T,E>& exp, const U& value)
-    noexcept -> bool;
-  template <typename T, typename U, typename E,
-            typename = typename std::enable_if<!std::is_same<U,void>::value>::type>
-  constexpr auto operator!=(const T& value, const result<U,E>& exp)
-    noexcept -> bool;
-  template <typename T, typename E, typename U,
-            typename = typename std::enable_if<!std::is_same<T,void>::value>::type>
-  constexpr auto operator<=(const result<T,E>& exp, const U& value)
-    noexcept -> bool;
-  template <typename T, typename U, typename E,
-            typename = typename std::enable_if<!std::is_same<U,void>::value>::type>
-  constexpr auto operator<=(const T& value, const result<U,E>& exp)
-    noexcept -> bool;
-  template <typename T, typename E, typename U,
-            typename = typename std::enable_if<!std::is_same<T,void>::value>::type>
-  constexpr auto operator>=(const result<T,E>& exp, const U& value)
-    noexcept -> bool;
-  template <typename T, typename U, typename E,
-            typename = typename std::enable_if<!std::is_same<U,void>::value>::type>
-  constexpr auto operator>=(const T& value, const result<U,E>& exp)
-    noexcept -> bool;
-  template <typename T, typename E, typename U,
-            typename = typename std::enable_if<!std::is_same<T,void>::value>::type>
-  constexpr auto operator<(const result<T,E>& exp, const U& value)
-    noexcept -> bool;
-  template <typename T, typename U, typename E,
-            typename = typename std::enable_if<!std::is_same<U,void>::value>::type>
-  constexpr auto operator<(const T& value, const result<U,E>& exp)
-    noexcept -> bool;
-  template <typename T, typename E, typename U,
-            typename = typename std::enable_if<!std::is_same<T,void>::value>::type>
-  constexpr auto operator>(const result<T,E>& exp, const U& value)
-    noexcept -> bool;
-  template <typename T, typename U, typename E,
-            typename = typename std::enable_if<!std::is_same<U,void>::value>::type>
-  constexpr auto operator>(const T& value, const result<U,E>& exp)
-    noexcept -> bool;
+template <typename T, typename E, bool IsTrivial>
+inline RESULT_INLINE_VISIBILITY constexpr
+auto RESULT_NS_IMPL::detail::result_union<T, E, IsTrivial>::has_value()
+  const noexcept -> bool
+{
+  return m_has_value;
+}
 
-  //---------------------------------------------------------------------------
+template <typename T, typename E, bool IsTrivial>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP14_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_union<T, E, IsTrivial>::error()
+  & noexcept -> E&
+{
+  return m_error;
+}
 
-  template <typename T, typename E, typename U>
-  constexpr auto operator==(const result<T,E>& exp, const failure<U>& value)
-    noexcept -> bool;
-  template <typename T, typename U, typename E>
-  constexpr auto operator==(const failure<T>& value, const result<E,U>& exp)
-    noexcept -> bool;
-  template <typename T, typename E, typename U>
-  constexpr auto operator!=(const result<T,E>& exp, const failure<U>& value)
-    noexcept -> bool;
-  template <typename T, typename U, typename E>
-  constexpr auto operator!=(const failure<T>& value, const result<E,U>& exp)
-    noexcept -> bool;
-  template <typename T, typename E, typename U>
-  constexpr auto operator<=(const result<T,E>& exp, const failure<U>& value)
-    noexcept -> bool;
-  template <typename T, typename U, typename E>
-  constexpr auto operator<=(const failure<T>& value, const result<E,U>& exp)
-    noexcept -> bool;
-  template <typename T, typename E, typename U>
-  constexpr auto operator>=(const result<T,E>& exp, const failure<U>& value)
-    noexcept -> bool;
-  template <typename T, typename U, typename E>
-  constexpr auto operator>=(const failure<T>& value, const result<E,U>& exp)
-    noexcept -> bool;
-  template <typename T, typename E, typename U>
-  constexpr auto operator<(const result<T,E>& exp, const failure<U>& value)
-    noexcept -> bool;
-  template <typename T, typename U, typename E>
-  constexpr auto operator<(const failure<T>& value, const result<E,U>& exp)
-    noexcept -> bool;
-  template <typename T, typename E, typename U>
-  constexpr auto operator>(const result<T,E>& exp, const failure<U>& value)
-    noexcept -> bool;
-  template <typename T, typename U, typename E>
-  constexpr auto operator>(const failure<T>& value, const result<E,U>& exp)
-    noexcept -> bool;
+template <typename T, typename E, bool IsTrivial>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP14_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_union<T, E, IsTrivial>::error()
+  && noexcept -> E&&
+{
+  return static_cast<E&&>(m_error);
+}
 
-  //---------------------------------------------------------------------------
-  // Utilities
-  //---------------------------------------------------------------------------
+template <typename T, typename E, bool IsTrivial>
+inline RESULT_INLINE_VISIBILITY constexpr
+auto RESULT_NS_IMPL::detail::result_union<T, E, IsTrivial>::error()
+  const & noexcept -> const E&
+{
+  return m_error;
+}
 
-  /// \{
-  /// \brief Swaps the contents of \p lhs with \p rhs
-  ///
-  /// \param lhs the left result
-  /// \param rhs the right result
-  template <typename T, typename E>
-  auto swap(result<T,E>& lhs, result<T,E>& rhs)
-#if __cplusplus >= 201703L
-    noexcept(std::is_nothrow_move_constructible<result<T,E>>::value &&
-             std::is_nothrow_move_assignable<result<T,E>>::value &&
-             std::is_nothrow_swappable<T>::value &&
-             std::is_nothrow_swappable<E>::value)
-#else
-    noexcept(std::is_nothrow_move_constructible<result<T,E>>::value &&
-             std::is_nothrow_move_assignable<result<T,E>>::value)
-#endif
-    -> void;
-  template <typename E>
-  auto swap(result<void,E>& lhs, result<void,E>& rhs)
-#if __cplusplus >= 201703L
-    noexcept(std::is_nothrow_move_constructible<result<void,E>>::value &&
-             std::is_nothrow_move_assignable<result<void,E>>::value &&
-             std::is_nothrow_swappable<E>::value)
-#else
-    noexcept(std::is_nothrow_move_constructible<result<void,E>>::value &&
-             std::is_nothrow_move_assignable<result<void,E>>::value)
-#endif
-     -> void;
-  /// \}
+//-----------------------------------------------------------------------------
+// Modifiers
+//-----------------------------------------------------------------------------
 
-} // inline namespace bitwizeshift
-} // namespace EXPECTED_NAMESPACE
+template <typename T, typename E, bool IsTrivial>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_union<T, E, IsTrivial>::destroy()
+  const noexcept -> void
+{
+  // do nothing
+}
 
-namespace std {
+template <typename T, typename E, bool IsTrivial>
+template <typename...Args>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_union<T, E, IsTrivial>::construct_value(Args&&...args)
+  noexcept(std::is_nothrow_constructible<underlying_value_type,Args...>::value)
+  -> void
+{
+  detail::construct_at(std::addressof(m_value), detail::forward<Args>(args)...);
+  m_has_value = true;
+}
 
-  template <typename T, typename E>
-  struct hash<::RESULT_NS_IMPL::result<T,E>>
-  {
-    auto operator()(const RESULT_NS_IMPL::result<T,E>& x) const -> std::size_t
-    {
-      if (x.has_value()) {
-        return std::hash<T>{}(*x) + 1; // add '1' to differentiate from error case
-      }
-      return std::hash<E>{}(::RESULT_NS_IMPL::detail::extract_error(x));
-    }
-  };
+template <typename T, typename E, bool IsTrivial>
+template <typename...Args>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_union<T, E, IsTrivial>::construct_error(Args&&...args)
+  noexcept(std::is_nothrow_constructible<E,Args...>::value)
+  -> void
+{
+  detail::construct_at(std::addressof(m_error), detail::forward<Args>(args)...);
+  m_has_value = false;
+}
 
-  template <typename E>
-  struct hash<::RESULT_NS_IMPL::result<void,E>>
-  {
-    auto operator()(const RESULT_NS_IMPL::result<void,E>& x) const -> std::size_t
-    {
-      if (x.has_value()) {
-        return 0;
-      }
-      return std::hash<E>{}(::RESULT_NS_IMPL::detail::extract_error(x));
-    }
-  };
+template <typename T, typename E, bool IsTrivial>
+template <typename Error>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_union<T, E, IsTrivial>::assign_error(Error&& error)
+  noexcept(std::is_nothrow_assignable<E&,Error>::value)
+  -> void
+{
+  m_error = detail::forward<Error>(error);
+}
 
-} // namespace std
+template <typename T, typename E, bool IsTrivial>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_union<T, E, IsTrivial>::swap_error(result_union& other)
+  -> void
+{
+  using std::swap;
 
-#if !defined(RESULT_DISABLE_EXCEPTIONS)
+  swap(m_error, other.m_error);
+}
 
 //=============================================================================
-// class : bad_result_access
+// class : detail::result_union<T, E, false>
 //=============================================================================
 
 //-----------------------------------------------------------------------------
-// Constructors
+// Constructors / Destructor / Assignment
 //-----------------------------------------------------------------------------
 
-template <typename E>
-template <typename E2, typename>
-inline RESULT_INLINE_VISIBILITY
-RESULT_NS_IMPL::bad_result_access<E>::bad_result_access(E2&& error)
-  : logic_error{"error attempting to access value from result containing error"},
-    m_error(detail::forward<E2>(error))
+template <typename T, typename E>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+RESULT_NS_IMPL::detail::result_union<T, E, false>
+  ::result_union(unit)
+  noexcept
+  : m_empty{}
 {
-
+  // m_has_value intentionally not set
 }
 
-template <typename E>
-template <typename E2, typename>
-inline RESULT_INLINE_VISIBILITY
-RESULT_NS_IMPL::bad_result_access<E>::bad_result_access(
-  const char* what_arg,
-  E2&& error
-) : logic_error{what_arg},
-    m_error(detail::forward<E2>(error))
+template <typename T, typename E>
+template <typename...Args>
+inline RESULT_INLINE_VISIBILITY constexpr
+RESULT_NS_IMPL::detail::result_union<T,E,false>
+  ::result_union(in_place_t, Args&&...args)
+  noexcept(std::is_nothrow_constructible<T, Args...>::value)
+  : m_value(detail::forward<Args>(args)...),
+    m_has_value{true}
 {
-
 }
 
-template <typename E>
-template <typename E2, typename>
-inline RESULT_INLINE_VISIBILITY
-RESULT_NS_IMPL::bad_result_access<E>::bad_result_access(
-  const std::string& what_arg,
-  E2&& error
-) : logic_error{what_arg},
-    m_error(detail::forward<E2>(error))
+template <typename T, typename E>
+template <typename...Args>
+inline RESULT_INLINE_VISIBILITY constexpr
+RESULT_NS_IMPL::detail::result_union<T,E,false>
+  ::result_union(in_place_error_t, Args&&...args)
+  noexcept(std::is_nothrow_constructible<E, Args...>::value)
+  : m_error(detail::forward<Args>(args)...),
+    m_has_value{false}
 {
+}
 
+//-----------------------------------------------------------------------------
+
+template <typename T, typename E>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+RESULT_NS_IMPL::detail::result_union<T,E,false>
+  ::~result_union()
+  noexcept(std::is_nothrow_destructible<T>::value && std::is_nothrow_destructible<E>::value)
+{
+  destroy();
 }
 
 //-----------------------------------------------------------------------------
 // Observers
 //-----------------------------------------------------------------------------
 
-template <typename E>
-inline RESULT_INLINE_VISIBILITY
-auto RESULT_NS_IMPL::bad_result_access<E>::error()
+template <typename T, typename E>
+inline RESULT_INLINE_VISIBILITY constexpr
+auto RESULT_NS_IMPL::detail::result_union<T, E, false>::has_value()
+  const noexcept -> bool
+{
+  return m_has_value;
+}
+
+template <typename T, typename E>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP14_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_union<T, E, false>::error()
   & noexcept -> E&
 {
   return m_error;
 }
 
-template <typename E>
-inline RESULT_INLINE_VISIBILITY
-auto RESULT_NS_IMPL::bad_result_access<E>::error()
+template <typename T, typename E>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP14_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_union<T, E, false>::error()
   && noexcept -> E&&
 {
   return static_cast<E&&>(m_error);
 }
 
-template <typename E>
-inline RESULT_INLINE_VISIBILITY
-auto RESULT_NS_IMPL::bad_result_access<E>::error()
+template <typename T, typename E>
+inline RESULT_INLINE_VISIBILITY constexpr
+auto RESULT_NS_IMPL::detail::result_union<T, E, false>::error()
   const & noexcept -> const E&
 {
   return m_error;
 }
 
-template <typename E>
-inline RESULT_INLINE_VISIBILITY
-auto RESULT_NS_IMPL::bad_result_access<E>::error()
-  const && noexcept -> const E&&
+//-----------------------------------------------------------------------------
+// Modifiers
+//-----------------------------------------------------------------------------
+
+template <typename T, typename E>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_union<T, E, false>::destroy()
+  -> void
 {
-  return static_cast<const E&&>(m_error);
+  if (m_has_value) {
+    m_value.~underlying_value_type();
+  } else {
+    m_error.~underlying_error_type();
+  }
 }
 
-#endif
+template <typename T, typename E>
+template <typename...Args>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_union<T, E, false>::construct_value(Args&&...args)
+  noexcept(std::is_nothrow_constructible<underlying_value_type,Args...>::value)
+  -> void
+{
+  detail::construct_at(std::addressof(m_value), detail::forward<Args>(args)...);
+  m_has_value = true;
+}
+
+template <typename T, typename E>
+template <typename...Args>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_union<T, E, false>::construct_error(Args&&...args)
+  noexcept(std::is_nothrow_constructible<E,Args...>::value)
+  -> void
+{
+  detail::construct_at(std::addressof(m_error), detail::forward<Args>(args)...);
+  m_has_value = false;
+}
+
+template <typename T, typename E>
+template <typename Error>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_union<T, E, false>::assign_error(Error&& error)
+  noexcept(std::is_nothrow_assignable<E&,Error>::value)
+  -> void
+{
+  m_error = detail::forward<Error>(error);
+}
+
+template <typename T, typename E>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_union<T, E, false>::swap_error(result_union& other)
+  -> void
+{
+  using std::swap;
+
+  swap(m_error, other.m_error);
+}
 
 //=============================================================================
-// class : failure
+// class : detail::result_niche_union<T, E>
 //=============================================================================
 
 //-----------------------------------------------------------------------------
-// Constructors
+// Constructors / Assignment
 //-----------------------------------------------------------------------------
 
-template <typename E>
-template <typename...Args, typename>
+template <typename T, typename E>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+RESULT_NS_IMPL::detail::result_niche_union<T, E>
+  ::result_niche_union(unit)
+  noexcept
+  : m_empty{}
+{
+}
+
+template <typename T, typename E>
+template <typename...Args>
 inline RESULT_INLINE_VISIBILITY constexpr
-RESULT_NS_IMPL::failure<E>::failure(in_place_t, Args&&...args)
+RESULT_NS_IMPL::detail::result_niche_union<T, E>
+  ::result_niche_union(in_place_t, Args&&...args)
+  noexcept(std::is_nothrow_constructible<T, Args...>::value)
+  : m_value(detail::forward<Args>(args)...)
+{
+}
+
+template <typename T, typename E>
+template <typename...Args>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+RESULT_NS_IMPL::detail::result_niche_union<T, E>
+  ::result_niche_union(in_place_error_t, Args&&...args)
   noexcept(std::is_nothrow_constructible<E, Args...>::value)
-  : m_failure(detail::forward<Args>(args)...)
+  : m_value(niche_traits::make_niche(
+      error_traits::encode(E(detail::forward<Args>(args)...))
+    ))
 {
+}
+
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
 
+template <typename T, typename E>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_niche_union<T, E>::has_value()
+  const noexcept -> bool
+{
+  return !niche_traits::is_niche(m_value);
 }
 
-template <typename E>
-template <typename U, typename...Args, typename>
-inline RESULT_INLINE_VISIBILITY constexpr
-RESULT_NS_IMPL::failure<E>::failure(
-  in_place_t,
-  std::initializer_list<U> ilist,
-  Args&&...args
-) noexcept(std::is_nothrow_constructible<E, std::initializer_list<U>, Args...>::value)
-  : m_failure(ilist, detail::forward<Args>(args)...)
+template <typename T, typename E>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_niche_union<T, E>::error()
+  const noexcept -> E
+{
+  return error_traits::decode(niche_traits::niche_payload(m_value));
+}
+
+//-----------------------------------------------------------------------------
+// Modifiers
+//-----------------------------------------------------------------------------
+
+template <typename T, typename E>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_niche_union<T, E>::destroy()
+  const noexcept -> void
 {
+  // do nothing
+}
 
+template <typename T, typename E>
+template <typename...Args>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_niche_union<T, E>::construct_value(Args&&...args)
+  noexcept(std::is_nothrow_constructible<underlying_value_type,Args...>::value)
+  -> void
+{
+  detail::construct_at(std::addressof(m_value), detail::forward<Args>(args)...);
 }
 
-template <typename E>
-template <typename E2,
-          typename std::enable_if<RESULT_NS_IMPL::detail::failure_is_explicit_value_convertible<E,E2>::value,int>::type>
-inline RESULT_INLINE_VISIBILITY constexpr
-RESULT_NS_IMPL::failure<E>::failure(E2&& error)
-  noexcept(std::is_nothrow_constructible<E,E2>::value)
-  : m_failure(detail::forward<E2>(error))
+template <typename T, typename E>
+template <typename...Args>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_niche_union<T, E>::construct_error(Args&&...args)
+  noexcept(std::is_nothrow_constructible<E,Args...>::value)
+  -> void
 {
+  detail::construct_at(std::addressof(m_value), niche_traits::make_niche(
+    error_traits::encode(E(detail::forward<Args>(args)...))
+  ));
+}
 
+template <typename T, typename E>
+template <typename Error>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_niche_union<T, E>::assign_error(Error&& error)
+  noexcept(std::is_nothrow_constructible<E,Error>::value)
+  -> void
+{
+  construct_error(detail::forward<Error>(error));
 }
 
-template <typename E>
-template <typename E2,
-          typename std::enable_if<RESULT_NS_IMPL::detail::failure_is_implicit_value_convertible<E,E2>::value,int>::type>
-inline RESULT_INLINE_VISIBILITY constexpr
-RESULT_NS_IMPL::failure<E>::failure(E2&& error)
-  noexcept(std::is_nothrow_constructible<E,E2>::value)
-  : m_failure(detail::forward<E2>(error))
+template <typename T, typename E>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_niche_union<T, E>::swap_error(result_niche_union& other)
+  noexcept -> void
 {
+  // Both objects hold niche representations, which are trivially copyable
+  const auto temp = m_value;
+  m_value = other.m_value;
+  other.m_value = temp;
+}
 
+//=============================================================================
+// class : detail::result_compact_union<E>
+//=============================================================================
+
+#if __cplusplus < 201703L
+template <typename E>
+constexpr RESULT_NS_IMPL::detail::unit
+  RESULT_NS_IMPL::detail::result_compact_union<E>::m_value;
+#endif
+
+//-----------------------------------------------------------------------------
+// Constructors / Assignment
+//-----------------------------------------------------------------------------
+
+template <typename E>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+RESULT_NS_IMPL::detail::result_compact_union<E>::result_compact_union(unit)
+  noexcept
+  : m_empty{}
+{
 }
 
 template <typename E>
-template <typename E2, typename>
 inline RESULT_INLINE_VISIBILITY constexpr
-RESULT_NS_IMPL::failure<E>::failure(const failure<E2>& other)
-  noexcept(std::is_nothrow_constructible<E,const E2&>::value)
-  : m_failure(other.error())
+RESULT_NS_IMPL::detail::result_compact_union<E>::result_compact_union(in_place_t)
+  noexcept(std::is_nothrow_default_constructible<E>::value)
+  : m_error()
 {
-
 }
 
 template <typename E>
-template <typename E2, typename>
+template <typename...Args>
 inline RESULT_INLINE_VISIBILITY constexpr
-RESULT_NS_IMPL::failure<E>::failure(failure<E2>&& other)
-  noexcept(std::is_nothrow_constructible<E,E2&&>::value)
-  : m_failure(static_cast<failure<E2>&&>(other).error())
+RESULT_NS_IMPL::detail::result_compact_union<E>
+  ::result_compact_union(in_place_error_t, Args&&...args)
+  noexcept(std::is_nothrow_constructible<E, Args...>::value)
+  : m_error(detail::forward<Args>(args)...)
 {
-
 }
 
+//-----------------------------------------------------------------------------
+// Observers
 //-----------------------------------------------------------------------------
 
 template <typename E>
-template <typename E2, typename>
-inline RESULT_INLINE_VISIBILITY RESULT_CPP14_CONSTEXPR
-auto RESULT_NS_IMPL::failure<E>::operator=(E2&& error)
-  noexcept(
-    std::is_nothrow_assignable<E,E2>::value ||
-    std::is_lvalue_reference<E>::value
-  ) -> failure&
+inline RESULT_INLINE_VISIBILITY constexpr
+auto RESULT_NS_IMPL::detail::result_compact_union<E>::has_value()
+  const -> bool
 {
-  m_failure = detail::forward<E2>(error);
-
-  return (*this);
+  return m_error == E{};
 }
 
 template <typename E>
-template <typename E2, typename>
 inline RESULT_INLINE_VISIBILITY RESULT_CPP14_CONSTEXPR
-auto RESULT_NS_IMPL::failure<E>::operator=(const failure<E2>& other)
-  noexcept(std::is_nothrow_assignable<E,const E2&>::value)
-  -> failure&
-{
-  m_failure = other.error();
-
-  return (*this);
+auto RESULT_NS_IMPL::detail::result_compact_union<E>::error()
+  & noexcept -> E&
+{
+  return m_error;
 }
 
 template <typename E>
-template <typename E2, typename>
 inline RESULT_INLINE_VISIBILITY RESULT_CPP14_CONSTEXPR
-auto RESULT_NS_IMPL::failure<E>::operator=(failure<E2>&& other)
-  noexcept(std::is_nothrow_assignable<E,E2&&>::value)
-  -> failure&
+auto RESULT_NS_IMPL::detail::result_compact_union<E>::error()
+  && noexcept -> E&&
 {
-  m_failure = static_cast<failure<E2>&&>(other).error();
+  return static_cast<E&&>(m_error);
+}
 
-  return (*this);
+template <typename E>
+inline RESULT_INLINE_VISIBILITY constexpr
+auto RESULT_NS_IMPL::detail::result_compact_union<E>::error()
+  const & noexcept -> const E&
+{
+  return m_error;
 }
 
 //-----------------------------------------------------------------------------
-// Observers
+// Modifiers
 //-----------------------------------------------------------------------------
 
 template <typename E>
-inline RESULT_INLINE_VISIBILITY RESULT_CPP14_CONSTEXPR
-auto RESULT_NS_IMPL::failure<E>::error()
-  & noexcept -> typename std::add_lvalue_reference<E>::type
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_compact_union<E>::destroy()
+  const noexcept -> void
 {
-  return m_failure;
+  // do nothing
 }
 
 template <typename E>
-inline RESULT_INLINE_VISIBILITY RESULT_CPP14_CONSTEXPR
-auto RESULT_NS_IMPL::failure<E>::error()
-  && noexcept -> typename std::add_rvalue_reference<E>::type
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_compact_union<E>::construct_value(unit)
+  noexcept(std::is_nothrow_default_constructible<E>::value)
+  -> void
 {
-  using reference = typename std::add_rvalue_reference<E>::type;
+  detail::construct_at(std::addressof(m_error));
+}
 
-  return static_cast<reference>(m_failure);
+template <typename E>
+template <typename...Args>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_compact_union<E>::construct_error(Args&&...args)
+  noexcept(std::is_nothrow_constructible<E,Args...>::value)
+  -> void
+{
+  detail::construct_at(std::addressof(m_error), detail::forward<Args>(args)...);
 }
 
 template <typename E>
-inline RESULT_INLINE_VISIBILITY constexpr
-auto RESULT_NS_IMPL::failure<E>::error()
-  const & noexcept
-  -> typename std::add_lvalue_reference<typename std::add_const<E>::type>::type
+template <typename Error>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_compact_union<E>::assign_error(Error&& error)
+  noexcept(std::is_nothrow_assignable<E&,Error>::value)
+  -> void
 {
-  return m_failure;
+  m_error = detail::forward<Error>(error);
 }
 
 template <typename E>
-inline RESULT_INLINE_VISIBILITY constexpr
-auto RESULT_NS_IMPL::failure<E>::error()
-  const && noexcept
-  -> typename std::add_rvalue_reference<typename std::add_const<E>::type>::type
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_compact_union<E>::swap_error(result_compact_union& other)
+  -> void
 {
-  using reference = typename std::add_rvalue_reference<typename std::add_const<E>::type>::type;
+  using std::swap;
 
-  return static_cast<reference>(m_failure);
+  swap(m_error, other.m_error);
 }
 
 //=============================================================================
-// non-member functions : class : failure
+// class : result_construct_base<T, E>
 //=============================================================================
 
 //-----------------------------------------------------------------------------
-// Comparison
+// Constructors / Assignment
 //-----------------------------------------------------------------------------
 
-template <typename E1, typename E2>
-inline RESULT_INLINE_VISIBILITY constexpr
-auto RESULT_NS_IMPL::operator==(const failure<E1>& lhs, const failure<E2>& rhs)
-  noexcept -> bool
+template <typename T, typename E>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+RESULT_NS_IMPL::detail::result_construct_base<T,E>::result_construct_base(unit)
+  noexcept
+  : storage{unit{}}
 {
-  return lhs.error() == rhs.error();
 }
 
-template <typename E1, typename E2>
-inline RESULT_INLINE_VISIBILITY constexpr
-auto RESULT_NS_IMPL::operator!=(const failure<E1>& lhs, const failure<E2>& rhs)
-  noexcept -> bool
+template <typename T, typename E>
+template <typename...Args>
+inline constexpr RESULT_INLINE_VISIBILITY
+RESULT_NS_IMPL::detail::result_construct_base<T,E>::result_construct_base(
+  in_place_t,
+  Args&&...args
+) noexcept(std::is_nothrow_constructible<T, Args...>::value)
+  : storage{in_place, detail::forward<Args>(args)...}
 {
-  return lhs.error() != rhs.error();
 }
 
-template <typename E1, typename E2>
-inline RESULT_INLINE_VISIBILITY constexpr
-auto RESULT_NS_IMPL::operator<(const failure<E1>& lhs, const failure<E2>& rhs)
-  noexcept -> bool
+template <typename T, typename E>
+template <typename...Args>
+inline constexpr RESULT_INLINE_VISIBILITY
+RESULT_NS_IMPL::detail::result_construct_base<T,E>::result_construct_base(
+  in_place_error_t,
+  Args&&...args
+) noexcept(std::is_nothrow_constructible<E, Args...>::value)
+  : storage(in_place_error, detail::forward<Args>(args)...)
 {
-  return lhs.error() < rhs.error();
 }
 
-template <typename E1, typename E2>
-inline RESULT_INLINE_VISIBILITY constexpr
-auto RESULT_NS_IMPL::operator>(const failure<E1>& lhs, const failure<E2>& rhs)
-  noexcept -> bool
+//-----------------------------------------------------------------------------
+// Construction / Assignment
+//-----------------------------------------------------------------------------
+
+template <typename T, typename E>
+template <typename...Args>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::construct_value(Args&&...args)
+  noexcept(std::is_nothrow_constructible<T,Args...>::value)
+  -> void
 {
-  return lhs.error() > rhs.error();
+  storage.construct_value(detail::forward<Args>(args)...);
 }
 
-template <typename E1, typename E2>
-inline RESULT_INLINE_VISIBILITY constexpr
-auto RESULT_NS_IMPL::operator<=(const failure<E1>& lhs, const failure<E2>& rhs)
-  noexcept -> bool
+template <typename T, typename E>
+template <typename...Args>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::construct_error(Args&&...args)
+  noexcept(std::is_nothrow_constructible<E,Args...>::value)
+  -> void
 {
-  return lhs.error() <= rhs.error();
+  storage.construct_error(detail::forward<Args>(args)...);
 }
 
-template <typename E1, typename E2>
-inline RESULT_INLINE_VISIBILITY constexpr
-auto RESULT_NS_IMPL::operator>=(const failure<E1>& lhs, const failure<E2>& rhs)
-  noexcept -> bool
+template <typename T, typename E>
+template <typename Result>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::construct_error_from_result(
+  Result&& other
+) -> void
 {
-  return lhs.error() >= rhs.error();
+  if (other.storage.has_value()) {
+    construct_value();
+  } else {
+    construct_error(detail::forward<Result>(other).storage.error());
+  }
 }
 
-//-----------------------------------------------------------------------------
-// Utilities
-//-----------------------------------------------------------------------------
 
-template <typename E>
-inline RESULT_INLINE_VISIBILITY constexpr
-auto RESULT_NS_IMPL::fail(E&& e)
-  noexcept(std::is_nothrow_constructible<typename std::decay<E>::type,E>::value)
-  -> failure<typename std::decay<E>::type>
+template <typename T, typename E>
+template <typename Result>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::construct_from_result(
+  Result&& other
+) -> void
 {
-  using result_type = failure<typename std::decay<E>::type>;
+  if (other.storage.has_value()) {
+    construct_value_from_result_impl(
+      std::is_lvalue_reference<T>{},
+      detail::forward<Result>(other).storage.m_value
+    );
+  } else {
+    construct_error(detail::forward<Result>(other).storage.error());
+  }
+}
 
-  return result_type(
-    detail::forward<E>(e)
+template <typename T, typename E>
+template <typename Alloc, typename...Args>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::construct_value_with_allocator(
+  const Alloc& alloc,
+  Args&&...args
+) -> void
+{
+  using strategy = result_allocator_strategy<T,Alloc,Args...>;
+
+  static_assert(
+    strategy::value >= 0,
+    "T uses the allocator, but cannot be constructed from the arguments "
+    "with an allocator"
+  );
+
+  construct_with_allocator_impl(
+    in_place,
+    std::integral_constant<int,strategy::value>{},
+    alloc,
+    detail::forward<Args>(args)...
   );
 }
 
-template <typename E>
-inline RESULT_INLINE_VISIBILITY constexpr
-auto RESULT_NS_IMPL::fail(std::reference_wrapper<E> e)
-  noexcept -> failure<E&>
+template <typename T, typename E>
+template <typename Alloc, typename...Args>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::construct_error_with_allocator(
+  const Alloc& alloc,
+  Args&&...args
+) -> void
 {
-  using result_type = failure<E&>;
+  using strategy = result_allocator_strategy<E,Alloc,Args...>;
 
-  return result_type{e.get()};
+  static_assert(
+    strategy::value >= 0,
+    "E uses the allocator, but cannot be constructed from the arguments "
+    "with an allocator"
+  );
+
+  construct_with_allocator_impl(
+    in_place_error,
+    std::integral_constant<int,strategy::value>{},
+    alloc,
+    detail::forward<Args>(args)...
+  );
 }
 
-template <typename E, typename...Args, typename>
-inline RESULT_INLINE_VISIBILITY constexpr
-auto RESULT_NS_IMPL::fail(Args&&...args)
-  noexcept(std::is_nothrow_constructible<E, Args...>::value)
-  -> failure<E>
+template <typename T, typename E>
+template <typename Alloc, typename Result>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::construct_from_result_with_allocator(
+  const Alloc& alloc,
+  Result&& other
+) -> void
 {
-  return failure<E>(in_place, detail::forward<Args>(args)...);
+  if (other.storage.has_value()) {
+    construct_value_from_result_with_allocator_impl(
+      std::is_lvalue_reference<T>{},
+      alloc,
+      detail::forward<Result>(other).storage.m_value
+    );
+  } else {
+    construct_error_with_allocator(alloc, detail::forward<Result>(other).storage.error());
+  }
 }
 
-template <typename E, typename U, typename...Args, typename>
-inline RESULT_INLINE_VISIBILITY constexpr
-auto RESULT_NS_IMPL::fail(std::initializer_list<U> ilist, Args&&...args)
-  noexcept(std::is_nothrow_constructible<E, std::initializer_list<U>, Args...>::value)
-  -> failure<E>
+template <typename T, typename E>
+template <typename Value>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::assign_value(Value&& value)
+  noexcept(std::is_nothrow_constructible<T,Value>::value &&
+           std::is_nothrow_assignable<T,Value>::value)
+  -> void
 {
-  return failure<E>(in_place, ilist, detail::forward<Args>(args)...);
+  if (!storage.has_value()) {
+    replace_error(detail::forward<Value>(value));
+  } else {
+    storage.m_value = detail::forward<Value>(value);
+  }
 }
 
-template <typename E>
-inline RESULT_INLINE_VISIBILITY
-auto RESULT_NS_IMPL::swap(failure<E>& lhs, failure<E>& rhs)
-#if __cplusplus >= 201703L
-  noexcept(std::is_nothrow_swappable<E>::value) -> void
-#else
-  noexcept(std::is_nothrow_move_constructible<E>::value)
-   -> void
-#endif
+template <typename T, typename E>
+template <typename Error>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::assign_error(Error&& error)
+  noexcept(std::is_nothrow_constructible<E,Error>::value &&
+           std::is_nothrow_assignable<E,Error>::value)
+  -> void
 {
-  using std::swap;
-
-  swap(lhs.error(), rhs.error());
+  if (storage.has_value()) {
+    replace_value(detail::forward<Error>(error));
+  } else {
+    storage.assign_error(detail::forward<Error>(error));
+  }
 }
 
-//=============================================================================
-// class : detail::result_union<T, E, IsTrivial>
-//=============================================================================
+template <typename T, typename E>
+template <typename Result>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::assign_from_result(Result&& other)
+  -> void
+{
+  if (other.storage.has_value() != storage.has_value()) {
+    if (other.storage.has_value()) {
+      replace_error_from_result_impl(
+        std::is_lvalue_reference<T>{},
+        detail::forward<Result>(other).storage.m_value
+      );
+    } else {
+      replace_value(detail::forward<Result>(other).storage.error());
+    }
+  } else if (storage.has_value()) {
+    assign_value_from_result_impl(
+      std::is_lvalue_reference<T>{},
+      detail::forward<Result>(other)
+    );
+  } else {
+    storage.assign_error(detail::forward<Result>(other).storage.error());
+  }
+}
 
-//-----------------------------------------------------------------------------
-// Constructors / Assignment
-//-----------------------------------------------------------------------------
+template <typename T, typename E>
+template <typename ReferenceWrapper>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::construct_value_from_result_impl(
+  std::true_type,
+  ReferenceWrapper&& reference
+) noexcept -> void
+{
+  storage.construct_value(reference.get());
+}
 
-template <typename T, typename E, bool IsTrivial>
-inline RESULT_INLINE_VISIBILITY
-RESULT_NS_IMPL::detail::result_union<T, E, IsTrivial>
-  ::result_union(unit)
-  noexcept
-  : m_empty{}
+template <typename T, typename E>
+template <typename Value>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::construct_value_from_result_impl(
+  std::false_type,
+  Value&& value
+) noexcept(std::is_nothrow_constructible<T,Value>::value) -> void
 {
-  // m_has_value intentionally not set
+  storage.construct_value(detail::forward<Value>(value));
 }
 
-template <typename T, typename E, bool IsTrivial>
+template <typename T, typename E>
 template <typename...Args>
-inline RESULT_INLINE_VISIBILITY constexpr
-RESULT_NS_IMPL::detail::result_union<T,E,IsTrivial>
-  ::result_union(in_place_t, Args&&...args)
-  noexcept(std::is_nothrow_constructible<T, Args...>::value)
-  : m_value(detail::forward<Args>(args)...),
-    m_has_value{true}
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::construct_tagged(
+  in_place_t,
+  Args&&...args
+) -> void
 {
+  storage.construct_value(detail::forward<Args>(args)...);
 }
 
-template <typename T, typename E, bool IsTrivial>
+template <typename T, typename E>
 template <typename...Args>
-inline RESULT_INLINE_VISIBILITY constexpr
-RESULT_NS_IMPL::detail::result_union<T,E,IsTrivial>
-  ::result_union(in_place_error_t, Args&&...args)
-  noexcept(std::is_nothrow_constructible<E, Args...>::value)
-  : m_error(detail::forward<Args>(args)...),
-    m_has_value{false}
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::construct_tagged(
+  in_place_error_t,
+  Args&&...args
+) -> void
 {
+  storage.construct_error(detail::forward<Args>(args)...);
 }
 
-//-----------------------------------------------------------------------------
-// Modifiers
-//-----------------------------------------------------------------------------
-
-template <typename T, typename E, bool IsTrivial>
-inline RESULT_INLINE_VISIBILITY
-auto RESULT_NS_IMPL::detail::result_union<T, E, IsTrivial>::destroy()
-  const noexcept -> void
+template <typename T, typename E>
+template <typename Tag, typename Alloc, typename...Args>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::construct_with_allocator_impl(
+  Tag tag,
+  std::integral_constant<int,0>,
+  const Alloc&,
+  Args&&...args
+) -> void
 {
-  // do nothing
+  construct_tagged(tag, detail::forward<Args>(args)...);
 }
 
-//=============================================================================
-// class : detail::result_union<T, E, false>
-//=============================================================================
-
-//-----------------------------------------------------------------------------
-// Constructors / Destructor / Assignment
-//-----------------------------------------------------------------------------
-
 template <typename T, typename E>
-inline RESULT_INLINE_VISIBILITY
-RESULT_NS_IMPL::detail::result_union<T, E, false>
-  ::result_union(unit)
-  noexcept
-  : m_empty{}
+template <typename Tag, typename Alloc, typename...Args>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::construct_with_allocator_impl(
+  Tag tag,
+  std::integral_constant<int,1>,
+  const Alloc& alloc,
+  Args&&...args
+) -> void
 {
-  // m_has_value intentionally not set
+  construct_tagged(tag, std::allocator_arg, alloc, detail::forward<Args>(args)...);
 }
 
 template <typename T, typename E>
-template <typename...Args>
-inline RESULT_INLINE_VISIBILITY constexpr
-RESULT_NS_IMPL::detail::result_union<T,E,false>
-  ::result_union(in_place_t, Args&&...args)
-  noexcept(std::is_nothrow_constructible<T, Args...>::value)
-  : m_value(detail::forward<Args>(args)...),
-    m_has_value{true}
+template <typename Tag, typename Alloc, typename...Args>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::construct_with_allocator_impl(
+  Tag tag,
+  std::integral_constant<int,2>,
+  const Alloc& alloc,
+  Args&&...args
+) -> void
 {
+  construct_tagged(tag, detail::forward<Args>(args)..., alloc);
 }
 
 template <typename T, typename E>
-template <typename...Args>
-inline RESULT_INLINE_VISIBILITY constexpr
-RESULT_NS_IMPL::detail::result_union<T,E,false>
-  ::result_union(in_place_error_t, Args&&...args)
-  noexcept(std::is_nothrow_constructible<E, Args...>::value)
-  : m_error(detail::forward<Args>(args)...),
-    m_has_value{false}
+template <typename Alloc, typename ReferenceWrapper>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::construct_value_from_result_with_allocator_impl(
+  std::true_type,
+  const Alloc&,
+  ReferenceWrapper&& reference
+) noexcept -> void
 {
+  storage.construct_value(reference.get());
 }
 
-//-----------------------------------------------------------------------------
+template <typename T, typename E>
+template <typename Alloc, typename Value>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::construct_value_from_result_with_allocator_impl(
+  std::false_type,
+  const Alloc& alloc,
+  Value&& value
+) -> void
+{
+  construct_value_with_allocator(alloc, detail::forward<Value>(value));
+}
 
 template <typename T, typename E>
-inline RESULT_INLINE_VISIBILITY
-RESULT_NS_IMPL::detail::result_union<T,E,false>
-  ::~result_union()
-  noexcept(std::is_nothrow_destructible<T>::value && std::is_nothrow_destructible<E>::value)
+template <typename Result>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::assign_value_from_result_impl(
+  std::true_type,
+  Result&& other
+) -> void
 {
-  destroy();
+  // T is a reference; unwrap it
+  storage.m_value = other.storage.m_value.get();
 }
 
-//-----------------------------------------------------------------------------
-// Modifiers
-//-----------------------------------------------------------------------------
+template <typename T, typename E>
+template <typename Result>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::assign_value_from_result_impl(
+  std::false_type,
+  Result&& other
+) -> void
+{
+  storage.m_value = detail::forward<Result>(other).storage.m_value;
+}
 
 template <typename T, typename E>
-inline RESULT_INLINE_VISIBILITY
-auto RESULT_NS_IMPL::detail::result_union<T, E, false>::destroy()
+template <typename...Args>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::replace_error(Args&&...args)
   -> void
 {
-  if (m_has_value) {
-    m_value.~underlying_value_type();
-  } else {
-    m_error.~underlying_error_type();
-  }
+  using strategy = result_replace_strategy<wrapped_result_type<T>,E,Args...>;
+  static_assert(
+    strategy::value >= 0,
+    "the error of this result cannot be replaced without risking a valueless state"
+  );
+
+  replace_error_impl(
+    std::integral_constant<int,strategy::value>{},
+    detail::forward<Args>(args)...
+  );
 }
 
-//=============================================================================
-// class : result_construct_base<T, E>
-//=============================================================================
+template <typename T, typename E>
+template <typename...Args>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::replace_value(Args&&...args)
+  -> void
+{
+  using strategy = result_replace_strategy<E,wrapped_result_type<T>,Args...>;
+  static_assert(
+    strategy::value >= 0,
+    "the value of this result cannot be replaced without risking a valueless state"
+  );
 
-//-----------------------------------------------------------------------------
-// Constructors / Assignment
-//-----------------------------------------------------------------------------
+  replace_value_impl(
+    std::integral_constant<int,strategy::value>{},
+    detail::forward<Args>(args)...
+  );
+}
 
 template <typename T, typename E>
-inline RESULT_INLINE_VISIBILITY
-RESULT_NS_IMPL::detail::result_construct_base<T,E>::result_construct_base(unit)
-  noexcept
-  : storage{unit{}}
+template <typename...Args>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::replace_error_impl(
+  std::integral_constant<int,0>,
+  Args&&...args
+) -> void
 {
+  storage.destroy();
+  construct_value(detail::forward<Args>(args)...);
 }
 
 template <typename T, typename E>
 template <typename...Args>
-inline constexpr RESULT_INLINE_VISIBILITY
-RESULT_NS_IMPL::detail::result_construct_base<T,E>::result_construct_base(
-  in_place_t,
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::replace_error_impl(
+  std::integral_constant<int,1>,
   Args&&...args
-) noexcept(std::is_nothrow_constructible<T, Args...>::value)
-  : storage{in_place, detail::forward<Args>(args)...}
+) -> void
 {
+  auto value = wrapped_result_type<T>(detail::forward<Args>(args)...);
+
+  storage.destroy();
+  construct_value(static_cast<wrapped_result_type<T>&&>(value));
 }
 
 template <typename T, typename E>
 template <typename...Args>
-inline constexpr RESULT_INLINE_VISIBILITY
-RESULT_NS_IMPL::detail::result_construct_base<T,E>::result_construct_base(
-  in_place_error_t,
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::replace_error_impl(
+  std::integral_constant<int,2>,
   Args&&...args
-) noexcept(std::is_nothrow_constructible<E, Args...>::value)
-  : storage(in_place_error, detail::forward<Args>(args)...)
+) -> void
 {
+#if defined(RESULT_DISABLE_EXCEPTIONS)
+  storage.destroy();
+  construct_value(detail::forward<Args>(args)...);
+#else
+  auto error = E(static_cast<storage_type&&>(storage).error());
+
+  storage.destroy();
+  try {
+    construct_value(detail::forward<Args>(args)...);
+  } catch (...) {
+    construct_error(static_cast<E&&>(error));
+    throw;
+  }
+#endif
 }
 
-//-----------------------------------------------------------------------------
-// Construction / Assignment
-//-----------------------------------------------------------------------------
-
 template <typename T, typename E>
 template <typename...Args>
-inline RESULT_INLINE_VISIBILITY
-auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::construct_value(Args&&...args)
-  noexcept(std::is_nothrow_constructible<T,Args...>::value)
-  -> void
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::replace_value_impl(
+  std::integral_constant<int,0>,
+  Args&&...args
+) -> void
 {
-  using value_type = typename storage_type::underlying_value_type;
-
-  auto* p = static_cast<void*>(std::addressof(storage.m_value));
-  new (p) value_type(detail::forward<Args>(args)...);
-  storage.m_has_value = true;
+  storage.destroy();
+  construct_error(detail::forward<Args>(args)...);
 }
 
 template <typename T, typename E>
 template <typename...Args>
-inline RESULT_INLINE_VISIBILITY
-auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::construct_error(Args&&...args)
-  noexcept(std::is_nothrow_constructible<E,Args...>::value)
-  -> void
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::replace_value_impl(
+  std::integral_constant<int,1>,
+  Args&&...args
+) -> void
 {
-  using error_type = typename storage_type::underlying_error_type;
+  auto error = E(detail::forward<Args>(args)...);
 
-  auto* p = static_cast<void*>(std::addressof(storage.m_error));
-  new (p) error_type(detail::forward<Args>(args)...);
-  storage.m_has_value = false;
+  storage.destroy();
+  construct_error(static_cast<E&&>(error));
 }
 
 template <typename T, typename E>
-template <typename Result>
-inline RESULT_INLINE_VISIBILITY
-auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::construct_error_from_result(
-  Result&& other
+template <typename...Args>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::replace_value_impl(
+  std::integral_constant<int,2>,
+  Args&&...args
 ) -> void
 {
-  if (other.storage.m_has_value) {
-    construct_value();
-  } else {
-    construct_error(detail::forward<Result>(other).storage.m_error);
+#if defined(RESULT_DISABLE_EXCEPTIONS)
+  storage.destroy();
+  construct_error(detail::forward<Args>(args)...);
+#else
+  using value_type = wrapped_result_type<T>;
+
+  auto value = value_type(static_cast<value_type&&>(storage.m_value));
+
+  storage.destroy();
+  try {
+    construct_error(detail::forward<Args>(args)...);
+  } catch (...) {
+    construct_value(static_cast<value_type&&>(value));
+    throw;
   }
+#endif
 }
 
-
 template <typename T, typename E>
-template <typename Result>
-inline RESULT_INLINE_VISIBILITY
-auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::construct_from_result(
-  Result&& other
+template <typename ReferenceWrapper>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::replace_error_from_result_impl(
+  std::true_type,
+  ReferenceWrapper&& reference
 ) -> void
 {
-  if (other.storage.m_has_value) {
-    construct_value_from_result_impl(
-      std::is_lvalue_reference<T>{},
-      detail::forward<Result>(other).storage.m_value
-    );
-  } else {
-    construct_error(detail::forward<Result>(other).storage.m_error);
-  }
+  replace_error(reference.get());
 }
 
 template <typename T, typename E>
 template <typename Value>
-inline RESULT_INLINE_VISIBILITY
-auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::assign_value(Value&& value)
-  noexcept(std::is_nothrow_assignable<T,Value>::value)
-  -> void
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::replace_error_from_result_impl(
+  std::false_type,
+  Value&& value
+) -> void
 {
-  if (!storage.m_has_value) {
-    storage.destroy();
-    construct_value(detail::forward<Value>(value));
-  } else {
-    storage.m_value = detail::forward<Value>(value);
-  }
+  replace_error(detail::forward<Value>(value));
 }
 
 template <typename T, typename E>
-template <typename Error>
-inline RESULT_INLINE_VISIBILITY
-auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::assign_error(Error&& error)
-  noexcept(std::is_nothrow_assignable<E,Error>::value)
+template <typename...Args>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::emplace_value(Args&&...args)
   -> void
 {
-  if (storage.m_has_value) {
-    storage.destroy();
-    construct_error(detail::forward<Error>(error));
-  } else {
-    storage.m_error = detail::forward<Error>(error);
-  }
+  emplace_value_impl(
+    std::is_nothrow_constructible<T,Args...>{},
+    detail::forward<Args>(args)...
+  );
 }
 
 template <typename T, typename E>
-template <typename Result>
-inline RESULT_INLINE_VISIBILITY
-auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::assign_from_result(Result&& other)
+template <typename Value>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::assign_or_reuse_value(Value&& value)
   -> void
 {
-  if (other.storage.m_has_value != storage.m_has_value) {
-    storage.destroy();
-    construct_from_result(detail::forward<Result>(other));
-  } else if (storage.m_has_value) {
-    assign_value_from_result_impl(
-      std::is_lvalue_reference<T>{},
-      detail::forward<Result>(other)
-    );
+  if (storage.has_value()) {
+    // Assigning into the existing value lets it keep any resources it owns,
+    // such as the capacity of a container
+    storage.m_value = detail::forward<Value>(value);
   } else {
-    storage.m_error = detail::forward<Result>(other).storage.m_error;
+    emplace_value(detail::forward<Value>(value));
   }
 }
 
 template <typename T, typename E>
-template <typename ReferenceWrapper>
-inline RESULT_INLINE_VISIBILITY
-auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::construct_value_from_result_impl(
+template <typename...Args>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::emplace_value_impl(
   std::true_type,
-  ReferenceWrapper&& reference
-) noexcept -> void
+  Args&&...args
+) -> void
 {
-  using value_type = typename storage_type::underlying_value_type;
-
-  auto* p = static_cast<void*>(std::addressof(storage.m_value));
-  new (p) value_type(reference.get());
-  storage.m_has_value = true;
+  storage.destroy();
+  construct_value(detail::forward<Args>(args)...);
 }
 
 template <typename T, typename E>
-template <typename Value>
-inline RESULT_INLINE_VISIBILITY
-auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::construct_value_from_result_impl(
+template <typename...Args>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::emplace_value_impl(
   std::false_type,
-  Value&& value
-) noexcept(std::is_nothrow_constructible<T,Value>::value) -> void
+  Args&&...args
+) -> void
+{
+  // Construct first, so that a throwing constructor leaves the current state
+  // intact rather than leaving the result valueless
+  auto value = T(detail::forward<Args>(args)...);
+
+  storage.destroy();
+  construct_value(static_cast<T&&>(value));
+}
+
+
+#if RESULT_HAS_CONDITIONALLY_TRIVIAL_SPECIAL_MEMBERS
+
+//=============================================================================
+// class : result_storage
+//=============================================================================
+
+template <typename T, typename E>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+RESULT_NS_IMPL::detail::result_storage<T,E>
+  ::result_storage(const result_storage& other)
+  noexcept(std::is_nothrow_copy_constructible<T>::value &&
+           std::is_nothrow_copy_constructible<E>::value)
+  requires(traits::copy_constructible &&
+           !traits::trivially_copy_constructible)
+  : base_type(unit{})
+{
+  base_type::construct_from_result(static_cast<const base_type&>(other));
+}
+
+template <typename T, typename E>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+RESULT_NS_IMPL::detail::result_storage<T,E>
+  ::result_storage(result_storage&& other)
+  noexcept(std::is_nothrow_move_constructible<T>::value &&
+           std::is_nothrow_move_constructible<E>::value)
+  requires(traits::move_constructible &&
+           !traits::trivially_move_constructible)
+  : base_type(unit{})
 {
-  using value_type = typename storage_type::underlying_value_type;
-
-  auto* p = static_cast<void*>(std::addressof(storage.m_value));
-  new (p) value_type(detail::forward<Value>(value));
-  storage.m_has_value = true;
+  base_type::construct_from_result(static_cast<base_type&&>(other));
 }
 
 template <typename T, typename E>
-template <typename Result>
-inline RESULT_INLINE_VISIBILITY
-auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::assign_value_from_result_impl(
-  std::true_type,
-  Result&& other
-) -> void
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_storage<T,E>
+  ::operator=(const result_storage& other)
+  noexcept(std::is_nothrow_copy_constructible<T>::value &&
+           std::is_nothrow_copy_constructible<E>::value &&
+           std::is_nothrow_copy_assignable<T>::value &&
+           std::is_nothrow_copy_assignable<E>::value)
+  -> result_storage&
+  requires(traits::copy_assignable &&
+           !traits::trivially_copy_assignable)
 {
-  // T is a reference; unwrap it
-  storage.m_value = other.storage.m_value.get();
+  base_type::assign_from_result(static_cast<const base_type&>(other));
+  return (*this);
 }
 
 template <typename T, typename E>
-template <typename Result>
-inline RESULT_INLINE_VISIBILITY
-auto RESULT_NS_IMPL::detail::result_construct_base<T,E>::assign_value_from_result_impl(
-  std::false_type,
-  Result&& other
-) -> void
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_storage<T,E>
+  ::operator=(result_storage&& other)
+  noexcept(std::is_nothrow_move_constructible<T>::value &&
+           std::is_nothrow_move_constructible<E>::value &&
+           std::is_nothrow_move_assignable<T>::value &&
+           std::is_nothrow_move_assignable<E>::value)
+  -> result_storage&
+  requires(traits::move_assignable &&
+           !traits::trivially_move_assignable)
 {
-  storage.m_value = detail::forward<Result>(other).storage.m_value;
+  base_type::assign_from_result(static_cast<base_type&&>(other));
+  return (*this);
 }
 
+#else // RESULT_HAS_CONDITIONALLY_TRIVIAL_SPECIAL_MEMBERS
 
 //=============================================================================
 // class : result_trivial_copy_ctor_base_impl
 //=============================================================================
 
 template <typename T, typename E>
-inline RESULT_INLINE_VISIBILITY
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
 RESULT_NS_IMPL::detail::result_trivial_copy_ctor_base_impl<T,E>
   ::result_trivial_copy_ctor_base_impl(const result_trivial_copy_ctor_base_impl& other)
   noexcept(std::is_nothrow_copy_constructible<T>::value &&
@@ -4168,7 +8775,7 @@ RESULT_NS_IMPL::detail::result_trivial_copy_ctor_base_impl<T,E>
 //=============================================================================
 
 template <typename T, typename E>
-inline RESULT_INLINE_VISIBILITY
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
 RESULT_NS_IMPL::detail::result_trivial_move_ctor_base_impl<T, E>
   ::result_trivial_move_ctor_base_impl(result_trivial_move_ctor_base_impl&& other)
   noexcept(std::is_nothrow_move_constructible<T>::value &&
@@ -4185,7 +8792,7 @@ RESULT_NS_IMPL::detail::result_trivial_move_ctor_base_impl<T, E>
 //=============================================================================
 
 template <typename T, typename E>
-inline RESULT_INLINE_VISIBILITY
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
 auto RESULT_NS_IMPL::detail::result_trivial_copy_assign_base_impl<T, E>
   ::operator=(const result_trivial_copy_assign_base_impl& other)
   noexcept(std::is_nothrow_copy_constructible<T>::value &&
@@ -4205,7 +8812,7 @@ auto RESULT_NS_IMPL::detail::result_trivial_copy_assign_base_impl<T, E>
 //=========================================================================
 
 template <typename T, typename E>
-inline RESULT_INLINE_VISIBILITY
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
 auto RESULT_NS_IMPL::detail::result_trivial_move_assign_base_impl<T, E>
   ::operator=(result_trivial_move_assign_base_impl&& other)
   noexcept(std::is_nothrow_move_constructible<T>::value &&
@@ -4220,37 +8827,195 @@ auto RESULT_NS_IMPL::detail::result_trivial_move_assign_base_impl<T, E>
   return (*this);
 }
 
+#endif // RESULT_HAS_CONDITIONALLY_TRIVIAL_SPECIAL_MEMBERS
+
 template <typename T, typename E>
 inline RESULT_INLINE_VISIBILITY constexpr
 auto RESULT_NS_IMPL::detail::result_error_extractor::get(const result<T,E>& exp)
-  noexcept -> const E&
+  noexcept -> result_const_error_reference<T,E>
 {
-  return exp.m_storage.storage.m_error;
+  return exp.m_storage.storage.error();
 }
 
 template <typename T, typename E>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_error_extractor::take(result<T,E>&& exp)
+  noexcept -> result_error_rvalue_reference<T,E>
+{
+  using storage_type = decltype(exp.m_storage.storage);
+
+  return static_cast<storage_type&&>(exp.m_storage.storage).error();
+}
+
+template <typename T, typename E>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::result_error_extractor::swap(result<T,E>& lhs,
+                                                          result<T,E>& rhs)
+  -> void
+{
+  lhs.m_storage.storage.swap_error(rhs.m_storage.storage);
+}
+
+template <typename R, typename...Args>
 inline RESULT_INLINE_VISIBILITY constexpr
-auto RESULT_NS_IMPL::detail::result_error_extractor::get(result<T,E>& exp)
-  noexcept -> E&
+auto RESULT_NS_IMPL::detail::result_error_extractor::propagate(Args&&...args)
+  noexcept(std::is_nothrow_constructible<typename R::error_type, Args...>::value)
+  -> R
 {
-  return exp.m_storage.storage.m_error;
+  return R(propagated_error, detail::forward<Args>(args)...);
 }
 
 template <typename T, typename E>
 inline RESULT_INLINE_VISIBILITY constexpr
-auto RESULT_NS_IMPL::detail::extract_error(const result<T,E>& exp) noexcept -> const E&
+auto RESULT_NS_IMPL::detail::extract_error(const result<T,E>& exp)
+  noexcept -> result_const_error_reference<T,E>
 {
   return result_error_extractor::get(exp);
 }
 
+//=============================================================================
+// utilities : RESULT_TRY
+//=============================================================================
+
+template <typename T, typename E>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::try_extract_failure(const result<T,E>& r)
+  -> failure<E>
+{
+  return failure<E>{result_error_extractor::get(r)};
+}
+
+template <typename T, typename E>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::try_extract_failure(result<T,E>&& r)
+  -> failure<E>
+{
+  return failure<E>{
+    result_error_extractor::take(static_cast<result<T,E>&&>(r))
+  };
+}
+
+template <typename T, typename E>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::try_extract_value(const result<T,E>& r)
+  -> decltype(*r)
+{
+  return *r;
+}
+
+template <typename T, typename E>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::try_extract_value(result<T,E>&& r)
+  -> decltype(*static_cast<result<T,E>&&>(r))
+{
+  return *static_cast<result<T,E>&&>(r);
+}
+
 template <typename E>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::detail::try_extract_value(const result<void,E>&)
+  noexcept -> void
+{
+}
+
+//=============================================================================
+// class : erased_message
+//=============================================================================
+
+template <typename String>
+inline RESULT_INLINE_VISIBILITY
+RESULT_NS_IMPL::detail::erased_message::erased_message(String&& message)
+  noexcept
+  : erased_message{
+      std::is_convertible<String,const char*>{},
+      detail::forward<String>(message)
+    }
+{
+
+}
+
+template <typename String>
+inline RESULT_INLINE_VISIBILITY
+RESULT_NS_IMPL::detail::erased_message::erased_message(std::true_type,
+                                                       String&& message)
+  noexcept
+  : m_message{static_cast<const char*>(message)},
+    m_convert{nullptr}
+{
+
+}
+
+template <typename String>
 inline RESULT_INLINE_VISIBILITY
-auto RESULT_NS_IMPL::detail::throw_bad_result_access(E&& error) -> void
+RESULT_NS_IMPL::detail::erased_message::erased_message(std::false_type,
+                                                       String&& message)
+  noexcept
+  : m_message{std::addressof(message)},
+    m_convert{&erased_message::convert<String>}
+{
+
+}
+
+inline
+auto RESULT_NS_IMPL::detail::erased_message::c_str()
+  const noexcept -> const char*
+{
+  return m_convert == nullptr
+    ? static_cast<const char*>(m_message)
+    : nullptr;
+}
+
+inline RESULT_COLD
+auto RESULT_NS_IMPL::detail::erased_message::str()
+  const -> std::string
+{
+  return m_convert == nullptr
+    ? std::string{static_cast<const char*>(m_message)}
+    : m_convert(m_message);
+}
+
+template <typename String>
+inline RESULT_COLD
+auto RESULT_NS_IMPL::detail::erased_message::convert(const void* message)
+  -> std::string
+{
+  using message_type = typename std::remove_reference<String>::type;
+
+  auto* const p = static_cast<message_type*>(const_cast<void*>(message));
+  return std::string(detail::forward<String>(*p));
+}
+
+//=============================================================================
+// utilities : throw_bad_result_access
+//=============================================================================
+
+inline constexpr
+auto RESULT_NS_IMPL::detail::bad_result_access_default_message()
+  noexcept -> const char*
+{
+  return "error attempting to access value from result containing error";
+}
+
+template <typename E>
+inline RESULT_COLD
+auto RESULT_NS_IMPL::detail::throw_bad_result_access(E&& error,
+                                                     source_location where)
+  -> void
 {
+  if (const auto handler = get_bad_result_access_handler()) {
+    handler(bad_result_access_info{
+      bad_result_access_default_message(),
+      error,
+      where
+    });
+  }
 #if defined(RESULT_DISABLE_EXCEPTIONS)
   std::fprintf(
     stderr,
-    "error attempting to access value from result containing error\n"
+    "%s:%u: %s\n",
+    where.file_name(),
+    where.line(),
+    bad_result_access_default_message()
   );
   std::abort();
 #else
@@ -4266,18 +9031,42 @@ auto RESULT_NS_IMPL::detail::throw_bad_result_access(E&& error) -> void
 #endif
 }
 
-template <typename String, typename E>
-inline RESULT_INLINE_VISIBILITY
-auto RESULT_NS_IMPL::detail::throw_bad_result_access_message(
-  String&& message,
-  E&& error
+template <typename E>
+inline RESULT_COLD
+auto RESULT_NS_IMPL::detail::throw_bad_result_access_erased(
+  const erased_message& message,
+  E&& error,
+  source_location where
 ) -> void
 {
+  const auto handler = get_bad_result_access_handler();
+
 #if defined(RESULT_DISABLE_EXCEPTIONS)
-  const auto message_string = std::string{
-    detail::forward<String>(message)
-  };
-  std::fprintf(stderr, "%s\n", message_string.c_str());
+  const auto has_consumer = true;
+#else
+  const auto has_consumer = handler != nullptr;
+#endif
+
+  // A 'std::string' is only constructed for messages that are not C strings,
+  // and only when something other than the exception consumes the message
+  auto message_string = std::string{};
+  auto* message_c_str = message.c_str();
+  if (message_c_str == nullptr && has_consumer) {
+    message_string = message.str();
+    message_c_str = message_string.c_str();
+  }
+
+  if (handler != nullptr) {
+    handler(bad_result_access_info{message_c_str, error, where});
+  }
+#if defined(RESULT_DISABLE_EXCEPTIONS)
+  std::fprintf(
+    stderr,
+    "%s:%u: %s\n",
+    where.file_name(),
+    where.line(),
+    message_c_str
+  );
   std::abort();
 #else
   using exception_type = bad_result_access<
@@ -4286,13 +9075,34 @@ auto RESULT_NS_IMPL::detail::throw_bad_result_access_message(
     >::type
   >;
 
+  if (message_c_str != nullptr) {
+    throw exception_type{
+      message_c_str,
+      detail::forward<E>(error)
+    };
+  }
   throw exception_type{
-    detail::forward<String>(message),
+    message.str(),
     detail::forward<E>(error)
   };
 #endif
 }
 
+template <typename String, typename E>
+inline RESULT_INLINE_VISIBILITY
+auto RESULT_NS_IMPL::detail::throw_bad_result_access_message(
+  String&& message,
+  E&& error,
+  source_location where
+) -> void
+{
+  detail::throw_bad_result_access_erased(
+    erased_message{detail::forward<String>(message)},
+    detail::forward<E>(error),
+    where
+  );
+}
+
 //=============================================================================
 // class : result<T,E>
 //=============================================================================
@@ -4310,7 +9120,7 @@ RESULT_NS_IMPL::result<T, E>::result()
 template <typename T, typename E>
 template <typename T2, typename E2,
           typename std::enable_if<RESULT_NS_IMPL::detail::result_is_implicit_copy_convertible<T,E,T2,E2>::value,int>::type>
-inline RESULT_INLINE_VISIBILITY
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
 RESULT_NS_IMPL::result<T, E>::result(const result<T2,E2>& other)
   noexcept(std::is_nothrow_constructible<T,const T2&>::value &&
            std::is_nothrow_constructible<E,const E2&>::value)
@@ -4324,7 +9134,7 @@ RESULT_NS_IMPL::result<T, E>::result(const result<T2,E2>& other)
 template <typename T, typename E>
 template <typename T2, typename E2,
           typename std::enable_if<RESULT_NS_IMPL::detail::result_is_explicit_copy_convertible<T,E,T2,E2>::value,int>::type>
-inline RESULT_INLINE_VISIBILITY
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
 RESULT_NS_IMPL::result<T, E>::result(const result<T2,E2>& other)
   noexcept(std::is_nothrow_constructible<T,const T2&>::value &&
            std::is_nothrow_constructible<E,const E2&>::value)
@@ -4338,7 +9148,7 @@ RESULT_NS_IMPL::result<T, E>::result(const result<T2,E2>& other)
 template <typename T, typename E>
 template <typename T2, typename E2,
           typename std::enable_if<RESULT_NS_IMPL::detail::result_is_implicit_move_convertible<T,E,T2,E2>::value,int>::type>
-inline RESULT_INLINE_VISIBILITY
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
 RESULT_NS_IMPL::result<T, E>::result(result<T2,E2>&& other)
   noexcept(std::is_nothrow_constructible<T,T2&&>::value &&
            std::is_nothrow_constructible<E,E2&&>::value)
@@ -4352,7 +9162,7 @@ RESULT_NS_IMPL::result<T, E>::result(result<T2,E2>&& other)
 template <typename T, typename E>
 template <typename T2, typename E2,
           typename std::enable_if<RESULT_NS_IMPL::detail::result_is_explicit_move_convertible<T,E,T2,E2>::value,int>::type>
-inline RESULT_INLINE_VISIBILITY
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
 RESULT_NS_IMPL::result<T, E>::result(result<T2,E2>&& other)
   noexcept(std::is_nothrow_constructible<T,T2&&>::value &&
            std::is_nothrow_constructible<E,E2&&>::value)
@@ -4395,7 +9205,7 @@ template <typename...Args, typename>
 inline RESULT_INLINE_VISIBILITY constexpr
 RESULT_NS_IMPL::result<T, E>::result(in_place_error_t, Args&&...args)
   noexcept(std::is_nothrow_constructible<E, Args...>::value)
-  : m_storage(in_place_error, detail::forward<Args>(args)...)
+  : m_storage(detail::recorded_in_place_error<E>(), detail::forward<Args>(args)...)
 {
 
 }
@@ -4408,13 +9218,50 @@ RESULT_NS_IMPL::result<T, E>::result(
   std::initializer_list<U> ilist,
   Args&&...args
 ) noexcept(std::is_nothrow_constructible<E, std::initializer_list<U>, Args...>::value)
-  : m_storage(in_place_error, ilist, detail::forward<Args>(args)...)
+  : m_storage(detail::recorded_in_place_error<E>(), ilist, detail::forward<Args>(args)...)
+{
+
+}
+
+template <typename T, typename E>
+template <typename...Args>
+inline RESULT_INLINE_VISIBILITY constexpr
+RESULT_NS_IMPL::result<T, E>::result(detail::propagated_error_t, Args&&...args)
+  noexcept(std::is_nothrow_constructible<E, Args...>::value)
+  : m_storage(in_place_error, detail::forward<Args>(args)...)
 {
 
 }
 
 //-------------------------------------------------------------------------
 
+#if defined(RESULT_ENABLE_TRACE)
+
+template <typename T, typename E>
+template <typename E2, typename>
+inline RESULT_INLINE_VISIBILITY constexpr
+RESULT_NS_IMPL::result<T, E>::result(const failure<E2>& e, source_location where)
+  noexcept(std::is_nothrow_constructible<E,const E2&>::value)
+  : m_storage(detail::traced_in_place_error<E>(e.error(), where), e.error())
+{
+
+}
+
+template <typename T, typename E>
+template <typename E2, typename>
+inline RESULT_INLINE_VISIBILITY constexpr
+RESULT_NS_IMPL::result<T, E>::result(failure<E2>&& e, source_location where)
+  noexcept(std::is_nothrow_constructible<E,E2&&>::value)
+  : m_storage(detail::traced_in_place_error<E>(
+                static_cast<const failure<E2>&>(e).error(), where
+              ),
+              static_cast<E2&&>(e.error()))
+{
+
+}
+
+#else
+
 template <typename T, typename E>
 template <typename E2, typename>
 inline RESULT_INLINE_VISIBILITY constexpr
@@ -4435,6 +9282,8 @@ RESULT_NS_IMPL::result<T, E>::result(failure<E2>&& e)
 
 }
 
+#endif // defined(RESULT_ENABLE_TRACE)
+
 template <typename T, typename E>
 template <typename U,
           typename std::enable_if<RESULT_NS_IMPL::detail::result_is_explicit_value_convertible<T,U>::value,int>::type>
@@ -4459,11 +9308,141 @@ RESULT_NS_IMPL::result<T, E>::result(U&& value)
 
 //-----------------------------------------------------------------------------
 
+template <typename T, typename E>
+template <typename Alloc, typename U, typename>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+RESULT_NS_IMPL::result<T, E>::result(std::allocator_arg_t, const Alloc& alloc)
+  : m_storage(detail::unit{})
+{
+  m_storage.construct_value_with_allocator(alloc);
+}
+
+template <typename T, typename E>
+template <typename Alloc, typename U, typename>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+RESULT_NS_IMPL::result<T, E>::result(std::allocator_arg_t,
+                                     const Alloc& alloc,
+                                     const result& other)
+  : m_storage(detail::unit{})
+{
+  m_storage.construct_from_result_with_allocator(alloc, other.m_storage);
+}
+
+template <typename T, typename E>
+template <typename Alloc, typename U, typename>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+RESULT_NS_IMPL::result<T, E>::result(std::allocator_arg_t,
+                                     const Alloc& alloc,
+                                     result&& other)
+  : m_storage(detail::unit{})
+{
+  m_storage.construct_from_result_with_allocator(
+    alloc,
+    static_cast<result&&>(other).m_storage
+  );
+}
+
+template <typename T, typename E>
+template <typename Alloc, typename T2, typename E2, typename>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+RESULT_NS_IMPL::result<T, E>::result(std::allocator_arg_t,
+                                     const Alloc& alloc,
+                                     const result<T2,E2>& other)
+  : m_storage(detail::unit{})
+{
+  m_storage.construct_from_result_with_allocator(
+    alloc,
+    static_cast<const result<T2,E2>&>(other).m_storage
+  );
+}
+
+template <typename T, typename E>
+template <typename Alloc, typename T2, typename E2, typename>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+RESULT_NS_IMPL::result<T, E>::result(std::allocator_arg_t,
+                                     const Alloc& alloc,
+                                     result<T2,E2>&& other)
+  : m_storage(detail::unit{})
+{
+  m_storage.construct_from_result_with_allocator(
+    alloc,
+    static_cast<result<T2,E2>&&>(other).m_storage
+  );
+}
+
+template <typename T, typename E>
+template <typename Alloc, typename...Args, typename>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+RESULT_NS_IMPL::result<T, E>::result(std::allocator_arg_t,
+                                     const Alloc& alloc,
+                                     in_place_t,
+                                     Args&&...args)
+  : m_storage(detail::unit{})
+{
+  m_storage.construct_value_with_allocator(alloc, detail::forward<Args>(args)...);
+}
+
+template <typename T, typename E>
+template <typename Alloc, typename...Args, typename>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+RESULT_NS_IMPL::result<T, E>::result(std::allocator_arg_t,
+                                     const Alloc& alloc,
+                                     in_place_error_t,
+                                     Args&&...args)
+  : m_storage(detail::unit{})
+{
+  static_cast<void>(detail::recorded_in_place_error<E>());
+  m_storage.construct_error_with_allocator(alloc, detail::forward<Args>(args)...);
+}
+
+template <typename T, typename E>
+template <typename Alloc, typename E2, typename>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+RESULT_NS_IMPL::result<T, E>::result(std::allocator_arg_t,
+                                     const Alloc& alloc,
+                                     const failure<E2>& e)
+  : m_storage(detail::unit{})
+{
+#if defined(RESULT_ENABLE_TRACE)
+  detail::trace_failure<E>(e.error(), source_location{});
+#endif
+  m_storage.construct_error_with_allocator(alloc, e.error());
+}
+
+template <typename T, typename E>
+template <typename Alloc, typename E2, typename>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+RESULT_NS_IMPL::result<T, E>::result(std::allocator_arg_t,
+                                     const Alloc& alloc,
+                                     failure<E2>&& e)
+  : m_storage(detail::unit{})
+{
+#if defined(RESULT_ENABLE_TRACE)
+  detail::trace_failure<E>(e.error(), source_location{});
+#endif
+  m_storage.construct_error_with_allocator(alloc, static_cast<E2&&>(e.error()));
+}
+
+template <typename T, typename E>
+template <typename Alloc, typename U, typename>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+RESULT_NS_IMPL::result<T, E>::result(std::allocator_arg_t,
+                                     const Alloc& alloc,
+                                     U&& value)
+  : m_storage(detail::unit{})
+{
+  m_storage.construct_value_with_allocator(alloc, detail::forward<U>(value));
+}
+
+//-----------------------------------------------------------------------------
+
 template <typename T, typename E>
 template <typename T2, typename E2, typename>
-inline RESULT_INLINE_VISIBILITY
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
 auto RESULT_NS_IMPL::result<T, E>::operator=(const result<T2,E2>& other)
-  noexcept(std::is_nothrow_assignable<T, const T2&>::value &&
+  noexcept(std::is_nothrow_constructible<T, const T2&>::value &&
+           std::is_nothrow_assignable<T, const T2&>::value &&
+           std::is_nothrow_constructible<E, const E2&>::value &&
            std::is_nothrow_assignable<E, const E2&>::value)
   -> result&
 {
@@ -4475,9 +9454,11 @@ auto RESULT_NS_IMPL::result<T, E>::operator=(const result<T2,E2>& other)
 
 template <typename T, typename E>
 template <typename T2, typename E2, typename>
-inline RESULT_INLINE_VISIBILITY
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
 auto RESULT_NS_IMPL::result<T, E>::operator=(result<T2,E2>&& other)
-  noexcept(std::is_nothrow_assignable<T, T2&&>::value &&
+  noexcept(std::is_nothrow_constructible<T, T2&&>::value &&
+           std::is_nothrow_assignable<T, T2&&>::value &&
+           std::is_nothrow_constructible<E, E2&&>::value &&
            std::is_nothrow_assignable<E, E2&&>::value)
   -> result&
 {
@@ -4489,9 +9470,10 @@ auto RESULT_NS_IMPL::result<T, E>::operator=(result<T2,E2>&& other)
 
 template <typename T, typename E>
 template <typename U, typename>
-inline RESULT_INLINE_VISIBILITY
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
 auto RESULT_NS_IMPL::result<T, E>::operator=(U&& value)
-  noexcept(std::is_nothrow_assignable<T, U>::value)
+  noexcept(std::is_nothrow_constructible<T, U>::value &&
+           std::is_nothrow_assignable<T, U>::value)
   -> result&
 {
   m_storage.assign_value(detail::forward<U>(value));
@@ -4500,26 +9482,69 @@ auto RESULT_NS_IMPL::result<T, E>::operator=(U&& value)
 
 template <typename T, typename E>
 template <typename E2, typename>
-inline RESULT_INLINE_VISIBILITY
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
 auto RESULT_NS_IMPL::result<T, E>::operator=(const failure<E2>& other)
-  noexcept(std::is_nothrow_assignable<E, const E2&>::value)
+  noexcept(std::is_nothrow_constructible<E, const E2&>::value &&
+           std::is_nothrow_assignable<E, const E2&>::value)
   -> result&
 {
+#if defined(RESULT_ENABLE_TRACE)
+  detail::trace_failure<E>(other.error(), source_location{});
+#endif
   m_storage.assign_error(other.error());
   return (*this);
 }
 
 template <typename T, typename E>
 template <typename E2, typename>
-inline RESULT_INLINE_VISIBILITY
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
 auto RESULT_NS_IMPL::result<T, E>::operator=(failure<E2>&& other)
-  noexcept(std::is_nothrow_assignable<E, E2&&>::value)
+  noexcept(std::is_nothrow_constructible<E, E2&&>::value &&
+           std::is_nothrow_assignable<E, E2&&>::value)
   -> result&
 {
+#if defined(RESULT_ENABLE_TRACE)
+  detail::trace_failure<E>(other.error(), source_location{});
+#endif
   m_storage.assign_error(static_cast<E2&&>(other.error()));
   return (*this);
 }
 
+//-----------------------------------------------------------------------------
+// Modifiers
+//-----------------------------------------------------------------------------
+
+template <typename T, typename E>
+template <typename...Args, typename>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::result<T, E>::emplace(Args&&...args)
+  -> T&
+{
+  m_storage.emplace_value(detail::forward<Args>(args)...);
+  return m_storage.storage.m_value;
+}
+
+template <typename T, typename E>
+template <typename U, typename...Args, typename>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::result<T, E>::emplace(std::initializer_list<U> ilist,
+                                           Args&&...args)
+  -> T&
+{
+  m_storage.emplace_value(ilist, detail::forward<Args>(args)...);
+  return m_storage.storage.m_value;
+}
+
+template <typename T, typename E>
+template <typename U, typename>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::result<T, E>::assign_or_reuse(U&& value)
+  -> T&
+{
+  m_storage.assign_or_reuse_value(detail::forward<U>(value));
+  return m_storage.storage.m_value;
+}
+
 //-----------------------------------------------------------------------------
 // Observers
 //-----------------------------------------------------------------------------
@@ -4595,7 +9620,7 @@ inline RESULT_INLINE_VISIBILITY constexpr
 RESULT_NS_IMPL::result<T,E>::operator bool()
   const noexcept
 {
-  return m_storage.storage.m_has_value;
+  return m_storage.storage.has_value();
 }
 
 template <typename T, typename E>
@@ -4603,7 +9628,7 @@ inline RESULT_INLINE_VISIBILITY constexpr
 auto RESULT_NS_IMPL::result<T,E>::has_value()
   const noexcept -> bool
 {
-  return m_storage.storage.m_has_value;
+  return m_storage.storage.has_value();
 }
 
 template <typename T, typename E>
@@ -4611,7 +9636,7 @@ inline RESULT_INLINE_VISIBILITY constexpr
 auto RESULT_NS_IMPL::result<T,E>::has_error()
   const noexcept -> bool
 {
-  return !m_storage.storage.m_has_value;
+  return !m_storage.storage.has_value();
 }
 
 //-----------------------------------------------------------------------------
@@ -4634,48 +9659,48 @@ auto RESULT_NS_IMPL::result<T,E>::has_error()
 
 template <typename T, typename E>
 inline RESULT_INLINE_VISIBILITY RESULT_CPP14_CONSTEXPR
-auto RESULT_NS_IMPL::result<T,E>::value()
+auto RESULT_NS_IMPL::result<T,E>::value(source_location where)
   & -> typename std::add_lvalue_reference<T>::type
 {
   return (has_value() ||
-    (detail::throw_bad_result_access(m_storage.storage.m_error), false),
+    (detail::throw_bad_result_access(m_storage.storage.error(), where), false),
     m_storage.storage.m_value
   );
 }
 
 template <typename T, typename E>
 inline RESULT_INLINE_VISIBILITY RESULT_CPP14_CONSTEXPR
-auto RESULT_NS_IMPL::result<T,E>::value()
+auto RESULT_NS_IMPL::result<T,E>::value(source_location where)
   && -> typename std::add_rvalue_reference<T>::type
 {
   using reference = typename std::add_rvalue_reference<T>::type;
 
   return (has_value() ||
-    (detail::throw_bad_result_access(static_cast<E&&>(m_storage.storage.m_error)), true),
+    (detail::throw_bad_result_access(static_cast<E&&>(m_storage.storage.error()), where), true),
     static_cast<reference>(m_storage.storage.m_value)
   );
 }
 
 template <typename T, typename E>
 inline RESULT_INLINE_VISIBILITY constexpr
-auto RESULT_NS_IMPL::result<T,E>::value()
+auto RESULT_NS_IMPL::result<T,E>::value(source_location where)
   const & -> typename std::add_lvalue_reference<typename std::add_const<T>::type>::type
 {
   return (has_value() ||
-    (detail::throw_bad_result_access(m_storage.storage.m_error), true),
+    (detail::throw_bad_result_access(m_storage.storage.error(), where), true),
     m_storage.storage.m_value
   );
 }
 
 template <typename T, typename E>
 inline RESULT_INLINE_VISIBILITY constexpr
-auto RESULT_NS_IMPL::result<T,E>::value()
+auto RESULT_NS_IMPL::result<T,E>::value(source_location where)
   const && -> typename std::add_rvalue_reference<typename std::add_const<T>::type>::type
 {
   using reference = typename std::add_rvalue_reference<typename std::add_const<T>::type>::type;
 
   return (has_value() ||
-    (detail::throw_bad_result_access(static_cast<const E&&>(m_storage.storage.m_error)), true),
+    (detail::throw_bad_result_access(static_cast<const E&&>(m_storage.storage.error()), where), true),
     (static_cast<reference>(m_storage.storage.m_value))
   );
 }
@@ -4701,9 +9726,18 @@ auto RESULT_NS_IMPL::result<T,E>::error() const &
     "'good' state"
   );
 
-  return m_storage.storage.m_has_value
+#if __cplusplus >= 201402L
+  // Not a conditional expression, since GCC cannot constant-evaluate one
+  // whose operands are temporaries of non-trivial types
+  if (m_storage.storage.has_value()) {
+    return E{};
+  }
+  return m_storage.storage.error();
+#else
+  return m_storage.storage.has_value()
     ? E{}
-    : m_storage.storage.m_error;
+    : m_storage.storage.error();
+#endif
 }
 
 template <typename T, typename E>
@@ -4719,9 +9753,73 @@ auto RESULT_NS_IMPL::result<T,E>::error() &&
     "'good' state"
   );
 
-  return m_storage.storage.m_has_value
-    ? E{}
-    : static_cast<E&&>(m_storage.storage.m_error);
+  if (m_storage.storage.has_value()) {
+    return E{};
+  }
+  return static_cast<E&&>(m_storage.storage.error());
+}
+
+template <typename T, typename E>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP14_CONSTEXPR
+auto RESULT_NS_IMPL::result<T,E>::error_ref()
+  & noexcept -> detail::result_error_reference<T,E>
+{
+  return m_storage.storage.error();
+}
+
+template <typename T, typename E>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP14_CONSTEXPR
+auto RESULT_NS_IMPL::result<T,E>::error_ref()
+  && noexcept -> detail::result_error_rvalue_reference<T,E>
+{
+  return static_cast<decltype(m_storage.storage)&&>(m_storage.storage).error();
+}
+
+template <typename T, typename E>
+inline RESULT_INLINE_VISIBILITY constexpr
+auto RESULT_NS_IMPL::result<T,E>::error_ref()
+  const & noexcept -> detail::result_const_error_reference<T,E>
+{
+  return m_storage.storage.error();
+}
+
+template <typename T, typename E>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP14_CONSTEXPR
+auto RESULT_NS_IMPL::result<T,E>::error_if()
+  noexcept -> E*
+{
+  static_assert(
+    std::is_reference<detail::result_error_reference<T,E>>::value,
+    "error_if() is not available when the error is encoded in the niche of "
+    "the value, since there is no error object to point to; use error_ref()"
+  );
+
+  if (m_storage.storage.has_value()) {
+    return nullptr;
+  }
+#if __cplusplus >= 201703L
+  return std::addressof(m_storage.storage.error());
+#else
+  return &m_storage.storage.error();
+#endif
+}
+
+template <typename T, typename E>
+inline RESULT_INLINE_VISIBILITY constexpr
+auto RESULT_NS_IMPL::result<T,E>::error_if()
+  const noexcept -> const E*
+{
+  static_assert(
+    std::is_reference<detail::result_const_error_reference<T,E>>::value,
+    "error_if() is not available when the error is encoded in the niche of "
+    "the value, since there is no error object to point to; use error_ref()"
+  );
+
+#if __cplusplus >= 201703L
+  return m_storage.storage.has_value() ? nullptr : std::addressof(error_ref());
+#else
+  return m_storage.storage.has_value() ? nullptr : &error_ref();
+#endif
 }
 
 //-----------------------------------------------------------------------------
@@ -4729,13 +9827,14 @@ auto RESULT_NS_IMPL::result<T,E>::error() &&
 template <typename T, typename E>
 template <typename String, typename>
 inline RESULT_CPP14_CONSTEXPR
-auto RESULT_NS_IMPL::result<T,E>::expect(String&& message)
+auto RESULT_NS_IMPL::result<T,E>::expect(String&& message, source_location where)
   & -> typename std::add_lvalue_reference<T>::type
 {
   return (has_value() ||
           (detail::throw_bad_result_access_message(
                   detail::forward<String>(message),
-                  m_storage.storage.m_error
+                  m_storage.storage.error(),
+                  where
           ), true),
           m_storage.storage.m_value
   );
@@ -4744,7 +9843,7 @@ auto RESULT_NS_IMPL::result<T,E>::expect(String&& message)
 template <typename T, typename E>
 template <typename String, typename>
 inline RESULT_CPP14_CONSTEXPR
-auto RESULT_NS_IMPL::result<T,E>::expect(String&& message)
+auto RESULT_NS_IMPL::result<T,E>::expect(String&& message, source_location where)
   && -> typename std::add_rvalue_reference<T>::type
 {
   using reference = typename std::add_rvalue_reference<T>::type;
@@ -4752,7 +9851,8 @@ auto RESULT_NS_IMPL::result<T,E>::expect(String&& message)
   return (has_value() ||
           (detail::throw_bad_result_access_message(
                   detail::forward<String>(message),
-                  static_cast<E&&>(m_storage.storage.m_error)
+                  static_cast<E&&>(m_storage.storage.error()),
+                  where
           ), true),
           static_cast<reference>(m_storage.storage.m_value)
   );
@@ -4761,13 +9861,14 @@ auto RESULT_NS_IMPL::result<T,E>::expect(String&& message)
 template <typename T, typename E>
 template <typename String, typename>
 inline RESULT_CPP14_CONSTEXPR
-auto RESULT_NS_IMPL::result<T,E>::expect(String&& message)
+auto RESULT_NS_IMPL::result<T,E>::expect(String&& message, source_location where)
   const & -> typename std::add_lvalue_reference<typename std::add_const<T>::type>::type
 {
     return (has_value() ||
             (detail::throw_bad_result_access_message(
                     detail::forward<String>(message),
-                    m_storage.storage.m_error
+                    m_storage.storage.error(),
+                    where
             ), true),
             m_storage.storage.m_value
     );
@@ -4776,7 +9877,7 @@ auto RESULT_NS_IMPL::result<T,E>::expect(String&& message)
 template <typename T, typename E>
 template <typename String, typename>
 inline RESULT_CPP14_CONSTEXPR
-auto RESULT_NS_IMPL::result<T,E>::expect(String&& message)
+auto RESULT_NS_IMPL::result<T,E>::expect(String&& message, source_location where)
   const && -> typename std::add_rvalue_reference<typename std::add_const<T>::type>::type
 {
     using reference = typename std::add_rvalue_reference<typename std::add_const<T>::type>::type;
@@ -4784,7 +9885,8 @@ auto RESULT_NS_IMPL::result<T,E>::expect(String&& message)
     return (has_value() ||
             (detail::throw_bad_result_access_message(
                     detail::forward<String>(message),
-                    static_cast<const E&&>(m_storage.storage.m_error)
+                    static_cast<const E&&>(m_storage.storage.error()),
+                    where
             ), true),
             (static_cast<reference>(m_storage.storage.m_value))
     );
@@ -4800,9 +9902,16 @@ inline RESULT_INLINE_VISIBILITY constexpr
 auto RESULT_NS_IMPL::result<T, E>::value_or(U&& default_value)
   const& -> typename std::remove_reference<T>::type
 {
-  return m_storage.storage.m_has_value
+#if __cplusplus >= 201402L
+  if (m_storage.storage.has_value()) {
+    return m_storage.storage.m_value;
+  }
+  return detail::forward<U>(default_value);
+#else
+  return m_storage.storage.has_value()
     ? m_storage.storage.m_value
     : detail::forward<U>(default_value);
+#endif
 }
 
 template <typename T, typename E>
@@ -4811,9 +9920,10 @@ inline RESULT_INLINE_VISIBILITY RESULT_CPP14_CONSTEXPR
 auto RESULT_NS_IMPL::result<T, E>::value_or(U&& default_value)
   && -> typename std::remove_reference<T>::type
 {
-  return m_storage.storage.m_has_value
-    ? static_cast<T&&>(**this)
-    : detail::forward<U>(default_value);
+  if (m_storage.storage.has_value()) {
+    return static_cast<T&&>(**this);
+  }
+  return detail::forward<U>(default_value);
 }
 
 template <typename T, typename E>
@@ -4822,9 +9932,16 @@ inline RESULT_INLINE_VISIBILITY constexpr
 auto RESULT_NS_IMPL::result<T, E>::error_or(U&& default_error)
   const& -> error_type
 {
-  return m_storage.storage.m_has_value
+#if __cplusplus >= 201402L
+  if (m_storage.storage.has_value()) {
+    return detail::forward<U>(default_error);
+  }
+  return m_storage.storage.error();
+#else
+  return m_storage.storage.has_value()
     ? detail::forward<U>(default_error)
-    : m_storage.storage.m_error;
+    : m_storage.storage.error();
+#endif
 }
 
 template <typename T, typename E>
@@ -4833,9 +9950,73 @@ inline RESULT_INLINE_VISIBILITY RESULT_CPP14_CONSTEXPR
 auto RESULT_NS_IMPL::result<T, E>::error_or(U&& default_error)
   && -> error_type
 {
-  return m_storage.storage.m_has_value
-    ? detail::forward<U>(default_error)
-    : static_cast<E&&>(m_storage.storage.m_error);
+  if (m_storage.storage.has_value()) {
+    return detail::forward<U>(default_error);
+  }
+  return static_cast<E&&>(m_storage.storage.error());
+}
+
+template <typename T, typename E>
+template <typename Fn>
+inline RESULT_INLINE_VISIBILITY constexpr
+auto RESULT_NS_IMPL::result<T, E>::value_or_else(Fn&& fn)
+  const& -> typename std::remove_reference<T>::type
+{
+#if __cplusplus >= 201402L
+  if (m_storage.storage.has_value()) {
+    return m_storage.storage.m_value;
+  }
+  return detail::invoke_fallback(detail::forward<Fn>(fn), m_storage.storage.error());
+#else
+  return m_storage.storage.has_value()
+    ? m_storage.storage.m_value
+    : detail::invoke_fallback(detail::forward<Fn>(fn), m_storage.storage.error());
+#endif
+}
+
+template <typename T, typename E>
+template <typename Fn>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP14_CONSTEXPR
+auto RESULT_NS_IMPL::result<T, E>::value_or_else(Fn&& fn)
+  && -> typename std::remove_reference<T>::type
+{
+  if (m_storage.storage.has_value()) {
+    return static_cast<T&&>(**this);
+  }
+  return detail::invoke_fallback(
+    detail::forward<Fn>(fn),
+    static_cast<E&&>(m_storage.storage.error())
+  );
+}
+
+template <typename T, typename E>
+template <typename Fn>
+inline RESULT_INLINE_VISIBILITY constexpr
+auto RESULT_NS_IMPL::result<T, E>::error_or_else(Fn&& fn)
+  const& -> error_type
+{
+#if __cplusplus >= 201402L
+  if (m_storage.storage.has_value()) {
+    return detail::invoke_fallback(detail::forward<Fn>(fn), **this);
+  }
+  return m_storage.storage.error();
+#else
+  return m_storage.storage.has_value()
+    ? detail::invoke_fallback(detail::forward<Fn>(fn), **this)
+    : m_storage.storage.error();
+#endif
+}
+
+template <typename T, typename E>
+template <typename Fn>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP14_CONSTEXPR
+auto RESULT_NS_IMPL::result<T, E>::error_or_else(Fn&& fn)
+  && -> error_type
+{
+  if (m_storage.storage.has_value()) {
+    return detail::invoke_fallback(detail::forward<Fn>(fn), static_cast<T&&>(**this));
+  }
+  return static_cast<E&&>(m_storage.storage.error());
 }
 
 template <typename T, typename E>
@@ -4864,9 +10045,16 @@ auto RESULT_NS_IMPL::result<T, E>::flat_map(Fn&& fn)
     "flat_map must return a result type or the program is ill-formed"
   );
 
+#if __cplusplus >= 201402L
+  if (has_value()) {
+    return detail::invoke(detail::forward<Fn>(fn), m_storage.storage.m_value);
+  }
+  return result_type(detail::propagated_error, m_storage.storage.error());
+#else
   return has_value()
     ? detail::invoke(detail::forward<Fn>(fn), m_storage.storage.m_value)
-    : result_type(in_place_error, m_storage.storage.m_error);
+    : result_type(detail::propagated_error, m_storage.storage.error());
+#endif
 }
 
 template <typename T, typename E>
@@ -4882,9 +10070,10 @@ auto RESULT_NS_IMPL::result<T, E>::flat_map(Fn&& fn)
     "flat_map must return a result type or the program is ill-formed"
   );
 
-  return has_value()
-    ? detail::invoke(detail::forward<Fn>(fn), static_cast<T&&>(m_storage.storage.m_value))
-    : result_type(in_place_error, static_cast<E&&>(m_storage.storage.m_error));
+  if (has_value()) {
+    return detail::invoke(detail::forward<Fn>(fn), static_cast<T&&>(m_storage.storage.m_value));
+  }
+  return result_type(detail::propagated_error, static_cast<E&&>(m_storage.storage.error()));
 }
 
 template <typename T, typename E>
@@ -4922,11 +10111,20 @@ auto RESULT_NS_IMPL::result<T, E>::map_error(Fn&& fn)
 {
   using result_type = result<T, detail::invoke_result_t<Fn, const E&>>;
 
+#if __cplusplus >= 201402L
+  if (has_error()) {
+    return result_type(detail::propagated_error, detail::invoke(
+      detail::forward<Fn>(fn), m_storage.storage.error()
+    ));
+  }
+  return result_type(in_place, m_storage.storage.m_value);
+#else
   return has_error()
-    ? result_type(in_place_error, detail::invoke(
-      detail::forward<Fn>(fn), m_storage.storage.m_error
+    ? result_type(detail::propagated_error, detail::invoke(
+      detail::forward<Fn>(fn), m_storage.storage.error()
     ))
     : result_type(in_place, m_storage.storage.m_value);
+#endif
 }
 
 template <typename T, typename E>
@@ -4937,11 +10135,12 @@ auto RESULT_NS_IMPL::result<T, E>::map_error(Fn&& fn)
 {
   using result_type = result<T, detail::invoke_result_t<Fn, E&&>>;
 
-  return has_error()
-    ? result_type(in_place_error, detail::invoke(
-      detail::forward<Fn>(fn), static_cast<E&&>(m_storage.storage.m_error)
-    ))
-    : result_type(static_cast<T&&>(m_storage.storage.m_value));
+  if (has_error()) {
+    return result_type(detail::propagated_error, detail::invoke(
+      detail::forward<Fn>(fn), static_cast<E&&>(m_storage.storage.error())
+    ));
+  }
+  return result_type(static_cast<T&&>(m_storage.storage.m_value));
 }
 
 template <typename T, typename E>
@@ -4957,9 +10156,16 @@ auto RESULT_NS_IMPL::result<T, E>::flat_map_error(Fn&& fn)
     "flat_map_error must return a result type or the program is ill-formed"
   );
 
+#if __cplusplus >= 201402L
+  if (has_value()) {
+    return result_type(in_place, m_storage.storage.m_value);
+  }
+  return detail::invoke(detail::forward<Fn>(fn), m_storage.storage.error());
+#else
   return has_value()
     ? result_type(in_place, m_storage.storage.m_value)
-    : detail::invoke(detail::forward<Fn>(fn), m_storage.storage.m_error);
+    : detail::invoke(detail::forward<Fn>(fn), m_storage.storage.error());
+#endif
 }
 
 template <typename T, typename E>
@@ -4975,9 +10181,65 @@ auto RESULT_NS_IMPL::result<T, E>::flat_map_error(Fn&& fn)
     "flat_map_error must return a result type or the program is ill-formed"
   );
 
+  if (has_value()) {
+    return result_type(in_place, static_cast<T&&>(m_storage.storage.m_value));
+  }
+  return detail::invoke(detail::forward<Fn>(fn), static_cast<E&&>(m_storage.storage.error()));
+}
+
+template <typename T, typename E>
+template <typename Fn>
+inline RESULT_INLINE_VISIBILITY constexpr
+auto RESULT_NS_IMPL::result<T, E>::or_else(Fn&& fn)
+  const & -> detail::fallback_result_t<Fn, const E&>
+{
+  using result_type = detail::fallback_result_t<Fn, const E&>;
+
+  static_assert(
+    is_result<result_type>::value,
+    "or_else must return a result type or the program is ill-formed"
+  );
+  static_assert(
+    std::is_same<typename result_type::value_type, T>::value,
+    "or_else must return a result with the same value type"
+  );
+
+#if __cplusplus >= 201402L
+  if (has_value()) {
+    return result_type(in_place, m_storage.storage.m_value);
+  }
+  return detail::invoke_fallback(detail::forward<Fn>(fn), m_storage.storage.error());
+#else
   return has_value()
-    ? result_type(in_place, static_cast<T&&>(m_storage.storage.m_value))
-    : detail::invoke(detail::forward<Fn>(fn), static_cast<E&&>(m_storage.storage.m_error));
+    ? result_type(in_place, m_storage.storage.m_value)
+    : detail::invoke_fallback(detail::forward<Fn>(fn), m_storage.storage.error());
+#endif
+}
+
+template <typename T, typename E>
+template <typename Fn>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP14_CONSTEXPR
+auto RESULT_NS_IMPL::result<T, E>::or_else(Fn&& fn)
+  && -> detail::fallback_result_t<Fn, E&&>
+{
+  using result_type = detail::fallback_result_t<Fn, E&&>;
+
+  static_assert(
+    is_result<result_type>::value,
+    "or_else must return a result type or the program is ill-formed"
+  );
+  static_assert(
+    std::is_same<typename result_type::value_type, T>::value,
+    "or_else must return a result with the same value type"
+  );
+
+  if (has_value()) {
+    return result_type(in_place, static_cast<T&&>(m_storage.storage.m_value));
+  }
+  return detail::invoke_fallback(
+    detail::forward<Fn>(fn),
+    static_cast<E&&>(m_storage.storage.error())
+  );
 }
 
 //-----------------------------------------------------------------------------
@@ -4992,9 +10254,17 @@ auto RESULT_NS_IMPL::result<T, E>::map_impl(std::true_type, Fn&& fn)
 {
   using result_type = result<void, E>;
 
+#if __cplusplus >= 201402L
+  if (has_value()) {
+    detail::invoke(detail::forward<Fn>(fn), m_storage.storage.m_value);
+    return result_type{};
+  }
+  return result_type(detail::propagated_error, m_storage.storage.error());
+#else
   return has_value()
     ? (detail::invoke(detail::forward<Fn>(fn), m_storage.storage.m_value), result_type{})
-    : result_type(in_place_error, m_storage.storage.m_error);
+    : result_type(detail::propagated_error, m_storage.storage.error());
+#endif
 }
 
 template <typename T, typename E>
@@ -5006,11 +10276,20 @@ auto RESULT_NS_IMPL::result<T, E>::map_impl(std::false_type, Fn&& fn)
   using invoke_result_type = detail::invoke_result_t<Fn,const T&>;
   using result_type = result<invoke_result_type, E>;
 
+#if __cplusplus >= 201402L
+  if (has_value()) {
+    return result_type(in_place, detail::invoke(
+      detail::forward<Fn>(fn), m_storage.storage.m_value
+    ));
+  }
+  return result_type(detail::propagated_error, m_storage.storage.error());
+#else
   return has_value()
     ? result_type(in_place, detail::invoke(
       detail::forward<Fn>(fn), m_storage.storage.m_value
     ))
-    : result_type(in_place_error, m_storage.storage.m_error);
+    : result_type(detail::propagated_error, m_storage.storage.error());
+#endif
 }
 
 template <typename T, typename E>
@@ -5021,11 +10300,13 @@ auto RESULT_NS_IMPL::result<T, E>::map_impl(std::true_type, Fn&& fn)
 {
   using result_type = result<void, E>;
 
-  return has_value()
-    ? (detail::invoke(
-        detail::forward<Fn>(fn), static_cast<T&&>(m_storage.storage.m_value)
-      ), result_type{})
-    : result_type(in_place_error, static_cast<E&&>(m_storage.storage.m_error));
+  if (has_value()) {
+    detail::invoke(
+      detail::forward<Fn>(fn), static_cast<T&&>(m_storage.storage.m_value)
+    );
+    return result_type{};
+  }
+  return result_type(detail::propagated_error, static_cast<E&&>(m_storage.storage.error()));
 }
 
 template <typename T, typename E>
@@ -5037,11 +10318,12 @@ auto RESULT_NS_IMPL::result<T, E>::map_impl(std::false_type, Fn&& fn)
   using invoke_result_type = detail::invoke_result_t<Fn,T&&>;
   using result_type = result<invoke_result_type, E>;
 
-  return has_value()
-    ? result_type(in_place, detail::invoke(
+  if (has_value()) {
+    return result_type(in_place, detail::invoke(
       detail::forward<Fn>(fn), static_cast<T&&>(m_storage.storage.m_value)
-    ))
-    : result_type(in_place_error, static_cast<E&&>(m_storage.storage.m_error));
+    ));
+  }
+  return result_type(detail::propagated_error, static_cast<E&&>(m_storage.storage.error()));
 }
 
 //=============================================================================
@@ -5058,68 +10340,193 @@ RESULT_NS_IMPL::result<void, E>::result()
   noexcept
   : m_storage(in_place)
 {
-
+
+}
+
+template <typename E>
+template <typename U, typename E2, typename>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+RESULT_NS_IMPL::result<void, E>::result(const result<U,E2>& other)
+  noexcept(std::is_nothrow_constructible<E,const E2&>::value)
+  : m_storage(detail::unit{})
+{
+  m_storage.construct_error_from_result(
+    static_cast<const result<U,E2>&>(other).m_storage
+  );
+}
+
+template <typename E>
+template <typename U, typename E2, typename>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+RESULT_NS_IMPL::result<void, E>::result(result<U,E2>&& other)
+  noexcept(std::is_nothrow_constructible<E,E2&&>::value)
+  : m_storage(detail::unit{})
+{
+  m_storage.construct_error_from_result(
+    static_cast<result<U,E2>&&>(other).m_storage
+  );
+}
+
+
+//-----------------------------------------------------------------------------
+
+template <typename E>
+inline RESULT_INLINE_VISIBILITY constexpr
+RESULT_NS_IMPL::result<void, E>::result(in_place_t)
+  noexcept
+  : m_storage(in_place)
+{
+
+}
+
+template <typename E>
+template <typename...Args, typename>
+inline RESULT_INLINE_VISIBILITY constexpr
+RESULT_NS_IMPL::result<void, E>::result(in_place_error_t, Args&&...args)
+  noexcept(std::is_nothrow_constructible<E, Args...>::value)
+  : m_storage(detail::recorded_in_place_error<E>(), detail::forward<Args>(args)...)
+{
+
+}
+
+template <typename E>
+template <typename U, typename...Args, typename>
+inline RESULT_INLINE_VISIBILITY constexpr
+RESULT_NS_IMPL::result<void, E>::result(in_place_error_t,
+                                        std::initializer_list<U> ilist,
+                                        Args&&...args)
+  noexcept(std::is_nothrow_constructible<E, std::initializer_list<U>, Args...>::value)
+  : m_storage(detail::recorded_in_place_error<E>(), ilist, detail::forward<Args>(args)...)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+
+template <typename E>
+template <typename Alloc>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+RESULT_NS_IMPL::result<void, E>::result(std::allocator_arg_t, const Alloc&)
+  : m_storage(in_place)
+{
+
+}
+
+template <typename E>
+template <typename Alloc, typename E2, typename>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+RESULT_NS_IMPL::result<void, E>::result(std::allocator_arg_t,
+                                        const Alloc& alloc,
+                                        const result& other)
+  : m_storage(detail::unit{})
+{
+  m_storage.construct_from_result_with_allocator(alloc, other.m_storage);
+}
+
+template <typename E>
+template <typename Alloc, typename E2, typename>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+RESULT_NS_IMPL::result<void, E>::result(std::allocator_arg_t,
+                                        const Alloc& alloc,
+                                        result&& other)
+  : m_storage(detail::unit{})
+{
+  m_storage.construct_from_result_with_allocator(
+    alloc,
+    static_cast<result&&>(other).m_storage
+  );
+}
+
+template <typename E>
+template <typename Alloc>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+RESULT_NS_IMPL::result<void, E>::result(std::allocator_arg_t,
+                                        const Alloc&,
+                                        in_place_t)
+  : m_storage(in_place)
+{
+
+}
+
+template <typename E>
+template <typename Alloc, typename...Args, typename>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+RESULT_NS_IMPL::result<void, E>::result(std::allocator_arg_t,
+                                        const Alloc& alloc,
+                                        in_place_error_t,
+                                        Args&&...args)
+  : m_storage(detail::unit{})
+{
+  static_cast<void>(detail::recorded_in_place_error<E>());
+  m_storage.construct_error_with_allocator(alloc, detail::forward<Args>(args)...);
 }
 
 template <typename E>
-template <typename U, typename E2, typename>
-inline RESULT_INLINE_VISIBILITY
-RESULT_NS_IMPL::result<void, E>::result(const result<U,E2>& other)
-  noexcept(std::is_nothrow_constructible<E,const E2&>::value)
+template <typename Alloc, typename E2, typename>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+RESULT_NS_IMPL::result<void, E>::result(std::allocator_arg_t,
+                                        const Alloc& alloc,
+                                        const failure<E2>& e)
   : m_storage(detail::unit{})
 {
-  m_storage.construct_error_from_result(
-    static_cast<const result<U,E2>&>(other).m_storage
-  );
+#if defined(RESULT_ENABLE_TRACE)
+  detail::trace_failure<E>(e.error(), source_location{});
+#endif
+  m_storage.construct_error_with_allocator(alloc, e.error());
 }
 
 template <typename E>
-template <typename U, typename E2, typename>
-inline RESULT_INLINE_VISIBILITY
-RESULT_NS_IMPL::result<void, E>::result(result<U,E2>&& other)
-  noexcept(std::is_nothrow_constructible<E,E2&&>::value)
+template <typename Alloc, typename E2, typename>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+RESULT_NS_IMPL::result<void, E>::result(std::allocator_arg_t,
+                                        const Alloc& alloc,
+                                        failure<E2>&& e)
   : m_storage(detail::unit{})
 {
-  m_storage.construct_error_from_result(
-    static_cast<result<U,E2>&&>(other).m_storage
-  );
+#if defined(RESULT_ENABLE_TRACE)
+  detail::trace_failure<E>(e.error(), source_location{});
+#endif
+  m_storage.construct_error_with_allocator(alloc, static_cast<E2&&>(e.error()));
 }
 
-
-//-----------------------------------------------------------------------------
-
 template <typename E>
+template <typename...Args>
 inline RESULT_INLINE_VISIBILITY constexpr
-RESULT_NS_IMPL::result<void, E>::result(in_place_t)
-  noexcept
-  : m_storage(in_place)
+RESULT_NS_IMPL::result<void, E>::result(detail::propagated_error_t, Args&&...args)
+  noexcept(std::is_nothrow_constructible<E, Args...>::value)
+  : m_storage(in_place_error, detail::forward<Args>(args)...)
 {
 
 }
 
+//-----------------------------------------------------------------------------
+
+#if defined(RESULT_ENABLE_TRACE)
+
 template <typename E>
-template <typename...Args, typename>
+template <typename E2, typename>
 inline RESULT_INLINE_VISIBILITY constexpr
-RESULT_NS_IMPL::result<void, E>::result(in_place_error_t, Args&&...args)
-  noexcept(std::is_nothrow_constructible<E, Args...>::value)
-  : m_storage(in_place_error, detail::forward<Args>(args)...)
+RESULT_NS_IMPL::result<void, E>::result(const failure<E2>& e, source_location where)
+  noexcept(std::is_nothrow_constructible<E,const E2&>::value)
+  : m_storage(detail::traced_in_place_error<E>(e.error(), where), e.error())
 {
 
 }
 
 template <typename E>
-template <typename U, typename...Args, typename>
+template <typename E2, typename>
 inline RESULT_INLINE_VISIBILITY constexpr
-RESULT_NS_IMPL::result<void, E>::result(in_place_error_t,
-                                        std::initializer_list<U> ilist,
-                                        Args&&...args)
-  noexcept(std::is_nothrow_constructible<E, std::initializer_list<U>, Args...>::value)
-  : m_storage(in_place_error, ilist, detail::forward<Args>(args)...)
+RESULT_NS_IMPL::result<void, E>::result(failure<E2>&& e, source_location where)
+  noexcept(std::is_nothrow_constructible<E,E2&&>::value)
+  : m_storage(detail::traced_in_place_error<E>(
+                static_cast<const failure<E2>&>(e).error(), where
+              ),
+              static_cast<E2&&>(e.error()))
 {
 
 }
 
-//-----------------------------------------------------------------------------
+#else
 
 template <typename E>
 template <typename E2, typename>
@@ -5141,13 +10548,16 @@ RESULT_NS_IMPL::result<void, E>::result(failure<E2>&& e)
 
 }
 
+#endif // defined(RESULT_ENABLE_TRACE)
+
 //-----------------------------------------------------------------------------
 
 template <typename E>
 template <typename E2, typename>
-inline RESULT_INLINE_VISIBILITY
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
 auto RESULT_NS_IMPL::result<void, E>::operator=(const result<void,E2>& other)
-  noexcept(std::is_nothrow_assignable<E, const E2&>::value)
+  noexcept(std::is_nothrow_constructible<E, const E2&>::value &&
+           std::is_nothrow_assignable<E, const E2&>::value)
   -> result&
 {
   m_storage.assign_from_result(other.m_storage);
@@ -5156,9 +10566,10 @@ auto RESULT_NS_IMPL::result<void, E>::operator=(const result<void,E2>& other)
 
 template <typename E>
 template <typename E2, typename>
-inline RESULT_INLINE_VISIBILITY
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
 auto RESULT_NS_IMPL::result<void, E>::operator=(result<void,E2>&& other)
-  noexcept(std::is_nothrow_assignable<E, E2&&>::value)
+  noexcept(std::is_nothrow_constructible<E, E2&&>::value &&
+           std::is_nothrow_assignable<E, E2&&>::value)
   -> result&
 {
   m_storage.assign_from_result(static_cast<result<void,E2>&&>(other).m_storage);
@@ -5167,26 +10578,48 @@ auto RESULT_NS_IMPL::result<void, E>::operator=(result<void,E2>&& other)
 
 template <typename E>
 template <typename E2, typename>
-inline RESULT_INLINE_VISIBILITY
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
 auto RESULT_NS_IMPL::result<void, E>::operator=(const failure<E2>& other)
-  noexcept(std::is_nothrow_assignable<E, const E2&>::value)
+  noexcept(std::is_nothrow_constructible<E, const E2&>::value &&
+           std::is_nothrow_assignable<E, const E2&>::value)
   -> result&
 {
+#if defined(RESULT_ENABLE_TRACE)
+  detail::trace_failure<E>(other.error(), source_location{});
+#endif
   m_storage.assign_error(other.error());
   return (*this);
 }
 
 template <typename E>
 template <typename E2, typename>
-inline RESULT_INLINE_VISIBILITY
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
 auto RESULT_NS_IMPL::result<void, E>::operator=(failure<E2>&& other)
-  noexcept(std::is_nothrow_assignable<E, E2&&>::value)
+  noexcept(std::is_nothrow_constructible<E, E2&&>::value &&
+           std::is_nothrow_assignable<E, E2&&>::value)
   -> result&
 {
+#if defined(RESULT_ENABLE_TRACE)
+  detail::trace_failure<E>(other.error(), source_location{});
+#endif
   m_storage.assign_error(static_cast<E2&&>(other.error()));
   return (*this);
 }
 
+//-----------------------------------------------------------------------------
+// Modifiers
+//-----------------------------------------------------------------------------
+
+template <typename E>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
+auto RESULT_NS_IMPL::result<void, E>::emplace()
+  noexcept -> void
+{
+  if (!m_storage.storage.has_value()) {
+    m_storage.emplace_value();
+  }
+}
+
 //-----------------------------------------------------------------------------
 // Observers
 //-----------------------------------------------------------------------------
@@ -5204,7 +10637,7 @@ inline RESULT_INLINE_VISIBILITY constexpr
 auto RESULT_NS_IMPL::result<void, E>::has_value()
   const noexcept -> bool
 {
-  return m_storage.storage.m_has_value;
+  return m_storage.storage.has_value();
 }
 
 template <typename E>
@@ -5219,23 +10652,23 @@ auto RESULT_NS_IMPL::result<void, E>::has_error()
 
 template <typename E>
 inline RESULT_INLINE_VISIBILITY RESULT_CPP14_CONSTEXPR
-auto RESULT_NS_IMPL::result<void, E>::value()
+auto RESULT_NS_IMPL::result<void, E>::value(source_location where)
   const & -> void
 {
   static_cast<void>(
     has_value() ||
-    (detail::throw_bad_result_access(m_storage.storage.m_error), true)
+    (detail::throw_bad_result_access(m_storage.storage.error(), where), true)
   );
 }
 
 template <typename E>
 inline RESULT_INLINE_VISIBILITY RESULT_CPP14_CONSTEXPR
-auto RESULT_NS_IMPL::result<void, E>::value()
+auto RESULT_NS_IMPL::result<void, E>::value(source_location where)
   && -> void
 {
   static_cast<void>(
     has_value() ||
-    (detail::throw_bad_result_access(static_cast<E&&>(m_storage.storage.m_error)), true)
+    (detail::throw_bad_result_access(static_cast<E&&>(m_storage.storage.error()), where), true)
   );
 }
 
@@ -5246,7 +10679,15 @@ auto RESULT_NS_IMPL::result<void, E>::error()
   noexcept(std::is_nothrow_constructible<E>::value &&
            std::is_nothrow_copy_constructible<E>::value) -> E
 {
-  return has_value() ? E{} : m_storage.storage.m_error;
+#if __cplusplus >= 201402L
+  // See result<T,E>::error() const &
+  if (has_value()) {
+    return E{};
+  }
+  return m_storage.storage.error();
+#else
+  return has_value() ? E{} : m_storage.storage.error();
+#endif
 }
 
 template <typename E>
@@ -5255,7 +10696,73 @@ auto RESULT_NS_IMPL::result<void, E>::error()
   && noexcept(std::is_nothrow_constructible<E>::value &&
               std::is_nothrow_copy_constructible<E>::value) -> E
 {
-  return has_value() ? E{} : static_cast<E&&>(m_storage.storage.m_error);
+  if (has_value()) {
+    return E{};
+  }
+  return static_cast<E&&>(m_storage.storage.error());
+}
+
+template <typename E>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP14_CONSTEXPR
+auto RESULT_NS_IMPL::result<void, E>::error_ref()
+  & noexcept -> detail::result_error_reference<void,E>
+{
+  return m_storage.storage.error();
+}
+
+template <typename E>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP14_CONSTEXPR
+auto RESULT_NS_IMPL::result<void, E>::error_ref()
+  && noexcept -> detail::result_error_rvalue_reference<void,E>
+{
+  return static_cast<decltype(m_storage.storage)&&>(m_storage.storage).error();
+}
+
+template <typename E>
+inline RESULT_INLINE_VISIBILITY constexpr
+auto RESULT_NS_IMPL::result<void, E>::error_ref()
+  const & noexcept -> detail::result_const_error_reference<void,E>
+{
+  return m_storage.storage.error();
+}
+
+template <typename E>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP14_CONSTEXPR
+auto RESULT_NS_IMPL::result<void, E>::error_if()
+  noexcept -> E*
+{
+  static_assert(
+    std::is_reference<detail::result_error_reference<void,E>>::value,
+    "error_if() is not available when the error is encoded in the niche of "
+    "the value, since there is no error object to point to; use error_ref()"
+  );
+
+  if (has_value()) {
+    return nullptr;
+  }
+#if __cplusplus >= 201703L
+  return std::addressof(m_storage.storage.error());
+#else
+  return &m_storage.storage.error();
+#endif
+}
+
+template <typename E>
+inline RESULT_INLINE_VISIBILITY constexpr
+auto RESULT_NS_IMPL::result<void, E>::error_if()
+  const noexcept -> const E*
+{
+  static_assert(
+    std::is_reference<detail::result_const_error_reference<void,E>>::value,
+    "error_if() is not available when the error is encoded in the niche of "
+    "the value, since there is no error object to point to; use error_ref()"
+  );
+
+#if __cplusplus >= 201703L
+  return has_value() ? nullptr : std::addressof(error_ref());
+#else
+  return has_value() ? nullptr : &error_ref();
+#endif
 }
 
 //-----------------------------------------------------------------------------
@@ -5263,13 +10770,14 @@ auto RESULT_NS_IMPL::result<void, E>::error()
 template <typename E>
 template <typename String, typename>
 inline RESULT_CPP14_CONSTEXPR
-auto RESULT_NS_IMPL::result<void,E>::expect(String&& message)
+auto RESULT_NS_IMPL::result<void,E>::expect(String&& message, source_location where)
   const & -> void
 {
   if (has_error()) {
     detail::throw_bad_result_access_message(
       detail::forward<String>(message),
-      m_storage.storage.m_error
+      m_storage.storage.error(),
+      where
     );
   }
 }
@@ -5277,13 +10785,14 @@ auto RESULT_NS_IMPL::result<void,E>::expect(String&& message)
 template <typename E>
 template <typename String, typename>
 inline RESULT_CPP14_CONSTEXPR
-auto RESULT_NS_IMPL::result<void,E>::expect(String&& message)
+auto RESULT_NS_IMPL::result<void,E>::expect(String&& message, source_location where)
   && -> void
 {
   if (has_error()) {
     detail::throw_bad_result_access_message(
       detail::forward<String>(message),
-      static_cast<E&&>(m_storage.storage.m_error)
+      static_cast<E&&>(m_storage.storage.error()),
+      where
     );
   }
 }
@@ -5298,9 +10807,16 @@ inline RESULT_INLINE_VISIBILITY constexpr
 auto RESULT_NS_IMPL::result<void, E>::error_or(U&& default_error)
   const & -> error_type
 {
+#if __cplusplus >= 201402L
+  if (has_value()) {
+    return detail::forward<U>(default_error);
+  }
+  return m_storage.storage.error();
+#else
   return has_value()
     ? detail::forward<U>(default_error)
-    : m_storage.storage.m_error;
+    : m_storage.storage.error();
+#endif
 }
 
 template <typename E>
@@ -5309,9 +10825,40 @@ inline RESULT_INLINE_VISIBILITY RESULT_CPP14_CONSTEXPR
 auto RESULT_NS_IMPL::result<void, E>::error_or(U&& default_error)
   && -> error_type
 {
+  if (has_value()) {
+    return detail::forward<U>(default_error);
+  }
+  return static_cast<E&&>(m_storage.storage.error());
+}
+
+template <typename E>
+template <typename Fn>
+inline RESULT_INLINE_VISIBILITY constexpr
+auto RESULT_NS_IMPL::result<void, E>::error_or_else(Fn&& fn)
+  const & -> error_type
+{
+#if __cplusplus >= 201402L
+  if (has_value()) {
+    return detail::invoke(detail::forward<Fn>(fn));
+  }
+  return m_storage.storage.error();
+#else
   return has_value()
-    ? detail::forward<U>(default_error)
-    : static_cast<E&&>(m_storage.storage.m_error);
+    ? detail::invoke(detail::forward<Fn>(fn))
+    : m_storage.storage.error();
+#endif
+}
+
+template <typename E>
+template <typename Fn>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP14_CONSTEXPR
+auto RESULT_NS_IMPL::result<void, E>::error_or_else(Fn&& fn)
+  && -> error_type
+{
+  if (has_value()) {
+    return detail::invoke(detail::forward<Fn>(fn));
+  }
+  return static_cast<E&&>(m_storage.storage.error());
 }
 
 template <typename E>
@@ -5340,9 +10887,16 @@ auto RESULT_NS_IMPL::result<void, E>::flat_map(Fn&& fn)
     "flat_map must return a result type or the program is ill-formed"
   );
 
+#if __cplusplus >= 201402L
+  if (has_value()) {
+    return detail::invoke(detail::forward<Fn>(fn));
+  }
+  return result_type(detail::propagated_error, m_storage.storage.error());
+#else
   return has_value()
     ? detail::invoke(detail::forward<Fn>(fn))
-    : result_type(in_place_error, m_storage.storage.m_error);
+    : result_type(detail::propagated_error, m_storage.storage.error());
+#endif
 }
 
 template <typename E>
@@ -5358,9 +10912,10 @@ auto RESULT_NS_IMPL::result<void, E>::flat_map(Fn&& fn)
     "flat_map must return a result type or the program is ill-formed"
   );
 
-  return has_value()
-    ? detail::invoke(detail::forward<Fn>(fn))
-    : result_type(in_place_error, static_cast<E&&>(m_storage.storage.m_error));
+  if (has_value()) {
+    return detail::invoke(detail::forward<Fn>(fn));
+  }
+  return result_type(detail::propagated_error, static_cast<E&&>(m_storage.storage.error()));
 }
 
 template <typename E>
@@ -5398,11 +10953,20 @@ auto RESULT_NS_IMPL::result<void, E>::map_error(Fn&& fn)
 {
   using result_type = result<void, detail::invoke_result_t<Fn, const E&>>;
 
+#if __cplusplus >= 201402L
+  if (has_value()) {
+    return result_type{};
+  }
+  return result_type(detail::propagated_error, detail::invoke(
+    detail::forward<Fn>(fn), m_storage.storage.error()
+  ));
+#else
   return has_value()
     ? result_type{}
-    : result_type(in_place_error, detail::invoke(
-      detail::forward<Fn>(fn), m_storage.storage.m_error
+    : result_type(detail::propagated_error, detail::invoke(
+      detail::forward<Fn>(fn), m_storage.storage.error()
     ));
+#endif
 }
 
 template <typename E>
@@ -5413,11 +10977,12 @@ auto RESULT_NS_IMPL::result<void, E>::map_error(Fn&& fn)
 {
   using result_type = result<void, detail::invoke_result_t<Fn, E&&>>;
 
-  return has_value()
-    ? result_type{}
-    : result_type(in_place_error,
-      detail::invoke(detail::forward<Fn>(fn), static_cast<E&&>(m_storage.storage.m_error)
-    ));
+  if (has_value()) {
+    return result_type{};
+  }
+  return result_type(detail::propagated_error,
+    detail::invoke(detail::forward<Fn>(fn), static_cast<E&&>(m_storage.storage.error())
+  ));
 }
 
 template <typename E>
@@ -5438,9 +11003,16 @@ auto RESULT_NS_IMPL::result<void, E>::flat_map_error(Fn&& fn)
     "constructible"
   );
 
+#if __cplusplus >= 201402L
+  if (has_value()) {
+    return result_type{};
+  }
+  return detail::invoke(detail::forward<Fn>(fn), m_storage.storage.error());
+#else
   return has_value()
     ? result_type{}
-    : detail::invoke(detail::forward<Fn>(fn), m_storage.storage.m_error);
+    : detail::invoke(detail::forward<Fn>(fn), m_storage.storage.error());
+#endif
 }
 
 template <typename E>
@@ -5461,9 +11033,65 @@ auto RESULT_NS_IMPL::result<void, E>::flat_map_error(Fn&& fn)
     "constructible"
   );
 
+  if (has_value()) {
+    return result_type{};
+  }
+  return detail::invoke(detail::forward<Fn>(fn), static_cast<E&&>(m_storage.storage.error()));
+}
+
+template <typename E>
+template <typename Fn>
+inline RESULT_INLINE_VISIBILITY constexpr
+auto RESULT_NS_IMPL::result<void, E>::or_else(Fn&& fn)
+  const & -> detail::fallback_result_t<Fn, const E&>
+{
+  using result_type = detail::fallback_result_t<Fn, const E&>;
+
+  static_assert(
+    is_result<result_type>::value,
+    "or_else must return a result type or the program is ill-formed"
+  );
+  static_assert(
+    std::is_void<typename result_type::value_type>::value,
+    "or_else must return a result with the same value type"
+  );
+
+#if __cplusplus >= 201402L
+  if (has_value()) {
+    return result_type{};
+  }
+  return detail::invoke_fallback(detail::forward<Fn>(fn), m_storage.storage.error());
+#else
   return has_value()
     ? result_type{}
-    : detail::invoke(detail::forward<Fn>(fn), static_cast<E&&>(m_storage.storage.m_error));
+    : detail::invoke_fallback(detail::forward<Fn>(fn), m_storage.storage.error());
+#endif
+}
+
+template <typename E>
+template <typename Fn>
+inline RESULT_INLINE_VISIBILITY RESULT_CPP14_CONSTEXPR
+auto RESULT_NS_IMPL::result<void, E>::or_else(Fn&& fn)
+  && -> detail::fallback_result_t<Fn, E&&>
+{
+  using result_type = detail::fallback_result_t<Fn, E&&>;
+
+  static_assert(
+    is_result<result_type>::value,
+    "or_else must return a result type or the program is ill-formed"
+  );
+  static_assert(
+    std::is_void<typename result_type::value_type>::value,
+    "or_else must return a result with the same value type"
+  );
+
+  if (has_value()) {
+    return result_type{};
+  }
+  return detail::invoke_fallback(
+    detail::forward<Fn>(fn),
+    static_cast<E&&>(m_storage.storage.error())
+  );
 }
 
 //-----------------------------------------------------------------------------
@@ -5478,9 +11106,17 @@ auto RESULT_NS_IMPL::result<void, E>::map_impl(std::true_type, Fn&& fn)
 {
   using result_type = result<void, E>;
 
+#if __cplusplus >= 201402L
+  if (has_value()) {
+    detail::invoke(detail::forward<Fn>(fn));
+    return result_type{};
+  }
+  return result_type(detail::propagated_error, m_storage.storage.error());
+#else
   return has_value()
     ? (detail::invoke(detail::forward<Fn>(fn)), result_type{})
-    : result_type(in_place_error, m_storage.storage.m_error);
+    : result_type(detail::propagated_error, m_storage.storage.error());
+#endif
 }
 
 template <typename E>
@@ -5492,9 +11128,16 @@ auto RESULT_NS_IMPL::result<void, E>::map_impl(std::false_type, Fn&& fn)
   using invoke_result_type = detail::invoke_result_t<Fn>;
   using result_type = result<invoke_result_type, E>;
 
+#if __cplusplus >= 201402L
+  if (has_value()) {
+    return result_type(in_place, detail::invoke(detail::forward<Fn>(fn)));
+  }
+  return result_type(detail::propagated_error, m_storage.storage.error());
+#else
   return has_value()
     ? result_type(in_place, detail::invoke(detail::forward<Fn>(fn)))
-    : result_type(in_place_error, m_storage.storage.m_error);
+    : result_type(detail::propagated_error, m_storage.storage.error());
+#endif
 }
 
 template <typename E>
@@ -5505,9 +11148,11 @@ auto RESULT_NS_IMPL::result<void, E>::map_impl(std::true_type, Fn&& fn)
 {
   using result_type = result<void, E>;
 
-  return has_value()
-    ? (detail::invoke(detail::forward<Fn>(fn)), result_type{})
-    : result_type(in_place_error, static_cast<E&&>(m_storage.storage.m_error));
+  if (has_value()) {
+    detail::invoke(detail::forward<Fn>(fn));
+    return result_type{};
+  }
+  return result_type(detail::propagated_error, static_cast<E&&>(m_storage.storage.error()));
 }
 
 template <typename E>
@@ -5519,9 +11164,10 @@ auto RESULT_NS_IMPL::result<void, E>::map_impl(std::false_type, Fn&& fn)
   using invoke_result_type = detail::invoke_result_t<Fn>;
   using result_type = result<invoke_result_type, E>;
 
-  return has_value()
-    ? result_type(in_place, detail::invoke(detail::forward<Fn>(fn)))
-    : result_type(in_place_error, static_cast<E&&>(m_storage.storage.m_error));
+  if (has_value()) {
+    return result_type(in_place, detail::invoke(detail::forward<Fn>(fn)));
+  }
+  return result_type(detail::propagated_error, static_cast<E&&>(m_storage.storage.error()));
 }
 
 //=============================================================================
@@ -5917,7 +11563,7 @@ auto RESULT_NS_IMPL::operator>(const failure<T>& error, const result<E,U>& exp)
 //-----------------------------------------------------------------------------
 
 template <typename T, typename E>
-inline RESULT_INLINE_VISIBILITY
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
 auto RESULT_NS_IMPL::swap(result<T,E>& lhs, result<T,E>& rhs)
 #if __cplusplus >= 201703L
   noexcept(std::is_nothrow_move_constructible<result<T,E>>::value &&
@@ -5936,10 +11582,7 @@ auto RESULT_NS_IMPL::swap(result<T,E>& lhs, result<T,E>& rhs)
     if (lhs.has_value()) {
       swap(*lhs, *rhs);
     } else {
-      auto& lhs_error = detail::result_error_extractor::get(lhs);
-      auto& rhs_error = detail::result_error_extractor::get(rhs);
-
-      swap(lhs_error, rhs_error);
+      detail::result_error_extractor::swap(lhs, rhs);
     }
     // If both `result`s contain values, do nothing
   } else {
@@ -5950,7 +11593,7 @@ auto RESULT_NS_IMPL::swap(result<T,E>& lhs, result<T,E>& rhs)
 }
 
 template <typename E>
-inline RESULT_INLINE_VISIBILITY
+inline RESULT_INLINE_VISIBILITY RESULT_CPP20_CONSTEXPR
 auto RESULT_NS_IMPL::swap(result<void,E>& lhs, result<void,E>& rhs)
 #if __cplusplus >= 201703L
   noexcept(std::is_nothrow_move_constructible<result<void,E>>::value &&
@@ -5966,10 +11609,7 @@ auto RESULT_NS_IMPL::swap(result<void,E>& lhs, result<void,E>& rhs)
 
   if (lhs.has_value() == rhs.has_value()) {
     if (lhs.has_error()) {
-      auto& lhs_error = detail::result_error_extractor::get(lhs);
-      auto& rhs_error = detail::result_error_extractor::get(rhs);
-
-      swap(lhs_error, rhs_error);
+      detail::result_error_extractor::swap(lhs, rhs);
     }
     // If both `result`s contain values, do nothing
   } else {
@@ -5979,6 +11619,87 @@ auto RESULT_NS_IMPL::swap(result<void,E>& lhs, result<void,E>& rhs)
   }
 }
 
+template <typename T>
+inline RESULT_INLINE_VISIBILITY
+auto RESULT_NS_IMPL::detail::uninitialized_relocate_impl(std::true_type,
+                                                         T* first,
+                                                         T* last,
+                                                         T* destination)
+  noexcept -> T*
+{
+  const auto size = static_cast<std::size_t>(last - first);
+
+  if (size != 0u) {
+    std::memcpy(
+      static_cast<void*>(destination),
+      static_cast<const void*>(first),
+      size * sizeof(T)
+    );
+  }
+  return destination + size;
+}
+
+template <typename T>
+inline RESULT_INLINE_VISIBILITY
+auto RESULT_NS_IMPL::detail::uninitialized_relocate_impl(std::false_type,
+                                                         T* first,
+                                                         T* last,
+                                                         T* destination)
+  noexcept -> T*
+{
+  static_assert(
+    std::is_nothrow_move_constructible<T>::value,
+    "uninitialized_relocate requires T to be nothrow move-constructible "
+    "or trivially relocatable"
+  );
+
+  for (; first != last; ++first, ++destination) {
+    ::new (static_cast<void*>(destination)) T(static_cast<T&&>(*first));
+    first->~T();
+  }
+  return destination;
+}
+
+template <typename T>
+inline RESULT_INLINE_VISIBILITY
+auto RESULT_NS_IMPL::uninitialized_relocate(T* first, T* last, T* destination)
+  noexcept -> T*
+{
+  return detail::uninitialized_relocate_impl(
+    is_trivially_relocatable<T>{},
+    first,
+    last,
+    destination
+  );
+}
+
+//=============================================================================
+// extern templates
+//=============================================================================
+
+// The compiled 'Result::compiled' library defines these explicit
+// instantiations, and defines 'RESULT_EXTERN_TEMPLATES' for its consumers so
+// that these pairings are not instantiated again in each translation unit.
+// Their layout and behavior are fixed when the library is compiled, so the
+// customization points ('result_niche_traits', 'enable_compact_void_result',
+// 'enable_throwing_assignment', and 'is_trivially_relocatable') must not be
+// specialized for any of the types below.
+#if defined(RESULT_EXTERN_TEMPLATES)
+namespace RESULT_NAMESPACE_INTERNAL {
+inline namespace bitwizeshift {
+
+  extern template class failure<std::error_code>;
+
+  extern template class result<void, std::error_code>;
+  extern template class result<bool, std::error_code>;
+  extern template class result<int, std::error_code>;
+  extern template class result<std::size_t, std::error_code>;
+  extern template class result<std::string, std::error_code>;
+
+} // inline namespace bitwizeshift
+} // namespace RESULT_NAMESPACE_INTERNAL
+#endif
+
 #if defined(__clang__)
 # pragma clang diagnostic pop
 #endif
@@ -5986,9 +11707,119 @@ auto RESULT_NS_IMPL::swap(result<void,E>& lhs, result<void,E>& rhs)
 #undef RESULT_NAMESPACE_INTERNAL
 #undef RESULT_NS_IMPL
 #undef RESULT_CPP14_CONSTEXPR
+#undef RESULT_CPP20_CONSTEXPR
+#undef RESULT_HAS_CONSTEXPR_DYNAMIC_ALLOC
 #undef RESULT_CPP17_INLINE
 #undef RESULT_INLINE_VISIBILITY
+#undef RESULT_COLD
+#undef RESULT_HAS_BUILTIN_SOURCE_LOCATION
+#undef RESULT_HAS_BUILTIN_IS_CONSTANT_EVALUATED
+#undef RESULT_HAS_CONDITIONALLY_TRIVIAL_SPECIAL_MEMBERS
 #undef RESULT_NODISCARD
 #undef RESULT_WARN_UNUSED
 
+//=============================================================================
+// macros : RESULT_TRY
+//=============================================================================
+
+// The macros below are expanded in user code, after the internal namespace
+// macros above have been undefined, so the namespace is spelled out again.
+#if defined(RESULT_NAMESPACE)
+# define RESULT_DETAIL_TRY_NS ::RESULT_NAMESPACE::bitwizeshift::detail
+#else
+# define RESULT_DETAIL_TRY_NS ::cpp::bitwizeshift::detail
+#endif
+
+#if defined(__clang__) || defined(__GNUC__)
+# define RESULT_DETAIL_TRY_UNLIKELY(x) __builtin_expect(!!(x), 0)
+# define RESULT_DETAIL_TRY_UNLIKELY_ATTRIBUTE
+#elif __cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)
+# define RESULT_DETAIL_TRY_UNLIKELY(x) (x)
+# define RESULT_DETAIL_TRY_UNLIKELY_ATTRIBUTE [[unlikely]]
+#else
+# define RESULT_DETAIL_TRY_UNLIKELY(x) (x)
+# define RESULT_DETAIL_TRY_UNLIKELY_ATTRIBUTE
+#endif
+
+#define RESULT_DETAIL_TRY_CONCAT_IMPL(a, b) a##b
+#define RESULT_DETAIL_TRY_CONCAT(a, b) RESULT_DETAIL_TRY_CONCAT_IMPL(a, b)
+
+/// \brief Returns the failure of the result \p tmp from the enclosing
+///        function, if it contains an error
+#define RESULT_DETAIL_TRY_RETURN_IF_ERROR(tmp)                                 \
+  if (RESULT_DETAIL_TRY_UNLIKELY(!tmp.has_value()))                            \
+    RESULT_DETAIL_TRY_UNLIKELY_ATTRIBUTE {                                     \
+    return RESULT_DETAIL_TRY_NS::try_extract_failure(                          \
+      static_cast<decltype(tmp)&&>(tmp)                                        \
+    );                                                                         \
+  }
+
+/// \brief Evaluates the result expression \p __VA_ARGS__, returning its
+///        error from the enclosing function if it contains one, and otherwise
+///        assigning its value to \p lhs
+///
+/// This form is a statement, and is available on all compilers. The value of
+/// an rvalue result is moved into \p lhs, and its error is moved into the
+/// returned failure.
+///
+/// ### Examples
+///
+/// Basic Usage:
+///
+/// ```cpp
+/// auto parse_pair(const std::string& a, const std::string& b)
+///   -> cpp::result<std::pair<int,int>,std::errc>
+/// {
+///   RESULT_TRY_ASSIGN(auto x, parse(a));
+///   RESULT_TRY_ASSIGN(auto y, parse(b));
+///   return std::make_pair(x, y);
+/// }
+/// ```
+#define RESULT_TRY_ASSIGN(lhs, ...)                                            \
+  auto&& RESULT_DETAIL_TRY_CONCAT(result_try_, __LINE__) = (__VA_ARGS__);      \
+  RESULT_DETAIL_TRY_RETURN_IF_ERROR(RESULT_DETAIL_TRY_CONCAT(result_try_, __LINE__)) \
+  lhs = RESULT_DETAIL_TRY_NS::try_extract_value(                               \
+    static_cast<decltype(RESULT_DETAIL_TRY_CONCAT(result_try_, __LINE__))&&>(  \
+      RESULT_DETAIL_TRY_CONCAT(result_try_, __LINE__)                          \
+    )                                                                          \
+  )
+
+#if defined(__clang__) || defined(__GNUC__)
+/// \brief Evaluates the result expression \p __VA_ARGS__, returning its
+///        error from the enclosing function if it contains one, and otherwise
+///        producing its value
+///
+/// On GCC and Clang this is an expression, implemented with a statement
+/// expression. On other compilers it may only be used as a statement that
+/// discards the value; use `RESULT_TRY_ASSIGN` to portably keep the value.
+///
+/// ### Examples
+///
+/// Basic Usage:
+///
+/// ```cpp
+/// auto sum(const std::string& a, const std::string& b)
+///   -> cpp::result<int,std::errc>
+/// {
+///   return RESULT_TRY(parse(a)) + RESULT_TRY(parse(b));
+/// }
+/// ```
+# define RESULT_TRY(...)                                                       \
+  __extension__ ({                                                             \
+    auto&& result_try_tmp = (__VA_ARGS__);                                     \
+    RESULT_DETAIL_TRY_RETURN_IF_ERROR(result_try_tmp)                          \
+    RESULT_DETAIL_TRY_NS::try_extract_value(                                   \
+      static_cast<decltype(result_try_tmp)&&>(result_try_tmp)                  \
+    );                                                                         \
+  })
+# define RESULT_HAS_TRY_EXPRESSION 1
+#else
+# define RESULT_TRY(...)                                                       \
+  do {                                                                         \
+    auto&& result_try_tmp = (__VA_ARGS__);                                     \
+    RESULT_DETAIL_TRY_RETURN_IF_ERROR(result_try_tmp)                          \
+  } while (false)
+# define RESULT_HAS_TRY_EXPRESSION 0
+#endif
+
 #endif /* RESULT_RESULT_HPP */
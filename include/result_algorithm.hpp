@@ -0,0 +1,889 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file result_algorithm.hpp
+///
+/// \brief This header contains algorithms that operate on ranges and groups
+///        of results
+////////////////////////////////////////////////////////////////////////////////
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2017-2021 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef RESULT_RESULT_ALGORITHM_HPP
+#define RESULT_RESULT_ALGORITHM_HPP
+
+#include "result.hpp"
+
+#include <algorithm>   // std::for_each, std::min
+#include <atomic>      // std::atomic
+#include <cstddef>     // std::size_t
+#include <iterator>    // std::begin, std::end, std::distance, std::iterator_traits
+#include <mutex>       // std::mutex, std::lock_guard
+#include <new>         // placement-new
+#include <thread>      // std::thread::hardware_concurrency
+#include <tuple>       // std::tuple
+#include <type_traits> // std::enable_if, std::decay
+#include <utility>     // std::move
+#include <vector>      // std::vector
+
+#if __cplusplus >= 201703L && defined(__has_include)
+# if __has_include(<execution>)
+#   include <execution> // std::is_execution_policy
+# endif
+#endif
+
+#if defined(__cpp_lib_execution) && __cpp_lib_execution >= 201603L
+# define RESULT_HAS_EXECUTION_POLICIES 1
+#else
+# define RESULT_HAS_EXECUTION_POLICIES 0
+#endif
+
+#if defined(RESULT_NAMESPACE)
+# define RESULT_NAMESPACE_INTERNAL RESULT_NAMESPACE
+#else
+# define RESULT_NAMESPACE_INTERNAL cpp
+#endif
+#define RESULT_NS_IMPL RESULT_NAMESPACE_INTERNAL::bitwizeshift
+
+namespace RESULT_NAMESPACE_INTERNAL {
+inline namespace bitwizeshift {
+
+  namespace detail {
+
+    //=========================================================================
+    // utilities : range traits
+    //=========================================================================
+
+    template <typename Range>
+    using range_reference_t = decltype(*std::begin(std::declval<Range&>()));
+
+    /// \brief The reference type to use when consuming elements from a
+    ///        range of type \p Range; elements of rvalue ranges are moved
+    template <typename Range>
+    using range_forward_t = typename std::conditional<
+      std::is_lvalue_reference<Range>::value,
+      range_reference_t<Range>,
+      typename std::remove_reference<range_reference_t<Range>>::type&&
+    >::type;
+
+    template <typename R>
+    struct collect_result_impl
+    {
+      static_assert(
+        is_result<R>::value,
+        "collect requires a range of 'result' objects"
+      );
+      static_assert(
+        !std::is_void<typename R::value_type>::value &&
+        !std::is_reference<typename R::value_type>::value,
+        "collect requires results of non-void, non-reference values"
+      );
+
+      using type = result<
+        std::vector<typename R::value_type>,
+        typename R::error_type
+      >;
+    };
+
+    /// \brief The type produced by collecting results of type \p R
+    template <typename R>
+    using collect_result_t = typename collect_result_impl<
+      typename std::decay<R>::type
+    >::type;
+
+    template <typename R>
+    struct partition_results_impl
+    {
+      static_assert(
+        is_result<R>::value,
+        "partition_results requires a range of 'result' objects"
+      );
+      static_assert(
+        !std::is_void<typename R::value_type>::value,
+        "partition_results requires results of non-void values"
+      );
+
+      using value_type = typename std::decay<typename R::value_type>::type;
+      using error_type = typename R::error_type;
+    };
+
+    /// \brief Gets the number of elements in \p range, if it can be
+    ///        determined without traversing it
+    ///
+    /// \return the size, or `0` if it is unknown
+    template <typename Range>
+    auto range_size_hint(const Range& range, int)
+      -> decltype(static_cast<std::size_t>(range.size()));
+    template <typename Range>
+    auto range_size_hint(const Range& range, long) -> std::size_t;
+
+    //=========================================================================
+    // utilities : zip traits
+    //=========================================================================
+
+    template <bool...>
+    struct bool_pack{};
+
+    /// \brief `true` if every one of \p Bs is `true`
+    template <bool...Bs>
+    using all_of_t = std::is_same<bool_pack<true, Bs...>, bool_pack<Bs..., true>>;
+
+    template <typename R, typename...Rs>
+    struct zip_traits
+    {
+      static_assert(
+        all_of_t<is_result<R>::value, is_result<Rs>::value...>::value,
+        "zip requires 'result' arguments"
+      );
+      static_assert(
+        all_of_t<std::is_same<typename R::error_type, typename Rs::error_type>::value...>::value,
+        "zip requires results that share an error type"
+      );
+      static_assert(
+        all_of_t<
+          !std::is_void<typename R::value_type>::value,
+          !std::is_void<typename Rs::value_type>::value...
+        >::value,
+        "zip requires results of non-void values, since a tuple cannot hold "
+        "'void'. Check 'result<void,E>' arguments before zipping the others."
+      );
+
+      using error_type = typename R::error_type;
+    };
+
+    /// \brief The type produced by zipping results of types \p Rs
+    template <typename...Rs>
+    using zip_result_t = result<
+      std::tuple<typename std::decay<Rs>::type::value_type...>,
+      typename zip_traits<typename std::decay<Rs>::type...>::error_type
+    >;
+
+    /// \brief The type produced by zipping results of types \p Rs with
+    ///        the function \p Fn
+    template <typename Fn, typename...Rs>
+    using zip_with_result_t = result<
+      invoke_result_t<Fn, decltype(*std::declval<Rs>())...>,
+      typename zip_traits<typename std::decay<Rs>::type...>::error_type
+    >;
+
+    /// \brief Checks whether every result contains a value
+    ///
+    /// The discriminants are combined without short-circuiting, so that this
+    /// compiles to a single branch rather than one per result.
+    constexpr auto zip_all_values() noexcept -> bool;
+    template <typename R, typename...Rs>
+    constexpr auto zip_all_values(const R& r, const Rs&...rs) noexcept -> bool;
+
+    /// \brief Gets the error of the first result that contains one
+    ///
+    /// \pre at least one result contains an error
+    template <typename E, typename R>
+    auto zip_first_error(R&& r) -> failure<E>;
+    template <typename E, typename R, typename R2, typename...Rs>
+    auto zip_first_error(R&& r, R2&& r2, Rs&&...rs) -> failure<E>;
+
+    template <typename Result, typename Fn, typename...Rs>
+    auto zip_with_invoke(std::false_type, Fn&& fn, Rs&&...rs) -> Result;
+    template <typename Result, typename Fn, typename...Rs>
+    auto zip_with_invoke(std::true_type, Fn&& fn, Rs&&...rs) -> Result;
+
+    //=========================================================================
+    // class : manual_storage<T>
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Uninitialized storage for a single T, whose lifetime is managed
+    ///        explicitly by the owner
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    class manual_storage
+    {
+    public:
+
+      template <typename...Args>
+      auto construct(Args&&...args) -> void
+      {
+        ::new (static_cast<void*>(&m_storage)) T(detail::forward<Args>(args)...);
+      }
+
+      auto destroy() noexcept -> void
+      {
+        get().~T();
+      }
+
+      auto get() noexcept -> T&
+      {
+        return *reinterpret_cast<T*>(&m_storage);
+      }
+
+    private:
+
+      alignas(T) unsigned char m_storage[sizeof(T)];
+    };
+
+  } // namespace detail
+
+  //===========================================================================
+  // algorithms : collect
+  //===========================================================================
+
+  /// \brief Collects a range of `result<T,E>` objects into a single
+  ///        `result<std::vector<T>,E>`
+  ///
+  /// Collection stops at the first error, which is returned as-is. Elements
+  /// of an rvalue \p range are moved rather than copied.
+  ///
+  /// ### Examples
+  ///
+  /// Basic Usage:
+  ///
+  /// ```cpp
+  /// auto results = std::vector<cpp::result<int,std::errc>>{1, 2, 3};
+  ///
+  /// assert(cpp::collect(results) == std::vector<int>{1, 2, 3});
+  /// ```
+  ///
+  /// \param range the range of results
+  /// \return the values of every result, or the first error
+  template <typename Range>
+  auto collect(Range&& range)
+    -> detail::collect_result_t<detail::range_reference_t<Range>>;
+
+  //===========================================================================
+  // algorithms : transform_collect
+  //===========================================================================
+
+  /// \brief Transforms each element of \p range with \p fn, collecting the
+  ///        resulting `result<U,E>` objects into a `result<std::vector<U>,E>`
+  ///
+  /// Transformation stops at the first error, which is returned as-is;
+  /// \p fn is not invoked on any element after it.
+  ///
+  /// ### Examples
+  ///
+  /// Basic Usage:
+  ///
+  /// ```cpp
+  /// auto parse = [](const std::string& s) -> cpp::result<int,std::errc> { ... };
+  /// auto inputs = std::vector<std::string>{"1", "2", "3"};
+  ///
+  /// assert(cpp::transform_collect(inputs, parse) == std::vector<int>{1, 2, 3});
+  /// ```
+  ///
+  /// \param range the range of inputs
+  /// \param fn the function to invoke on each element
+  /// \return the values of every transformation, or the first error
+  template <typename Range, typename Fn>
+  auto transform_collect(Range&& range, Fn&& fn)
+    -> detail::collect_result_t<
+      detail::invoke_result_t<Fn, detail::range_forward_t<Range>>
+    >;
+
+  //===========================================================================
+  // algorithms : partition_results
+  //===========================================================================
+
+  /////////////////////////////////////////////////////////////////////////////
+  /// \brief The outputs of partitioning a range of results with an output
+  ///        iterator for each
+  ///
+  /// \tparam ValueOut the output iterator that values are written to
+  /// \tparam ErrorOut the output iterator that errors are written to
+  /////////////////////////////////////////////////////////////////////////////
+  template <typename ValueOut, typename ErrorOut>
+  struct partition_results_result
+  {
+    ValueOut values_out;      ///< The iterator past the last value written
+    ErrorOut errors_out;      ///< The iterator past the last error written
+    std::size_t value_count;  ///< The number of values written
+    std::size_t error_count;  ///< The number of errors written
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  /// \brief The values and errors of a range of `result<T,E>` objects
+  ///
+  /// \tparam T the value type
+  /// \tparam E the error type
+  /////////////////////////////////////////////////////////////////////////////
+  template <typename T, typename E>
+  struct partitioned_results
+  {
+    std::vector<T> values; ///< The values, in order
+    std::vector<E> errors; ///< The errors, in order
+  };
+
+  /// \brief The type produced by partitioning a range of type \p Range
+  template <typename Range>
+  using partitioned_results_t = partitioned_results<
+    typename detail::partition_results_impl<
+      typename std::decay<detail::range_reference_t<Range>>::type
+    >::value_type,
+    typename detail::partition_results_impl<
+      typename std::decay<detail::range_reference_t<Range>>::type
+    >::error_type
+  >;
+
+  /// \brief Writes the values of the results in [\p first, \p last) to
+  ///        \p values_out, and the errors to \p errors_out, in a single pass
+  ///
+  /// The relative order of the values, and of the errors, is preserved. The
+  /// results are moved from if dereferencing \p first produces an rvalue,
+  /// such as with `std::make_move_iterator`.
+  ///
+  /// ### Examples
+  ///
+  /// Basic Usage:
+  ///
+  /// ```cpp
+  /// auto results = std::vector<cpp::result<int,std::errc>>{...};
+  /// auto values = std::vector<int>{};
+  /// auto errors = std::vector<std::errc>{};
+  ///
+  /// auto out = cpp::partition_results(
+  ///   results.begin(), results.end(),
+  ///   std::back_inserter(values), std::back_inserter(errors)
+  /// );
+  /// assert(out.value_count == values.size());
+  /// ```
+  ///
+  /// \param first the start of the range of results
+  /// \param last the end of the range of results
+  /// \param values_out the output for values
+  /// \param errors_out the output for errors
+  /// \return the output iterators past the last elements written, and the
+  ///         number of values and errors written
+  template <typename InputIt, typename ValueOut, typename ErrorOut>
+  auto partition_results(InputIt first, InputIt last,
+                          ValueOut values_out, ErrorOut errors_out)
+    -> partition_results_result<ValueOut,ErrorOut>;
+
+  /// \brief Partitions a range of `result<T,E>` objects into a vector of its
+  ///        values and a vector of its errors, in a single pass
+  ///
+  /// Elements of an rvalue \p range are moved rather than copied. When the
+  /// size of \p range is known without traversing it, the values reserve
+  /// capacity for every element up front, and the errors reserve capacity
+  /// for the remaining elements once the first error is found; neither
+  /// reallocates during the pass, and no storage is allocated for errors if
+  /// there are none.
+  ///
+  /// \note A `result_vector` already stores its values and errors
+  ///       separately; use its `values()` and `errors()` instead.
+  ///
+  /// ### Examples
+  ///
+  /// Basic Usage:
+  ///
+  /// ```cpp
+  /// auto results = std::vector<cpp::result<int,std::errc>>{...};
+  ///
+  /// auto partitioned = cpp::partition_results(std::move(results));
+  /// for (auto e : partitioned.errors) { ... }
+  /// ```
+  ///
+  /// \param range the range of results
+  /// \return the values and errors of every result, in order
+  template <typename Range>
+  auto partition_results(Range&& range) -> partitioned_results_t<Range>;
+
+  //===========================================================================
+  // algorithms : zip
+  //===========================================================================
+
+  /// \brief Combines the values of several results into a single
+  ///        `result<std::tuple<T1,...,Tn>,E>`
+  ///
+  /// Every result must share the same error type, and have a non-void value
+  /// type. The discriminants of all of the results are checked together in a
+  /// single branch; if any of them contains an error, the first such error
+  /// is returned. Otherwise the values are moved out of rvalue results, and
+  /// copied out of lvalue results, directly into the tuple.
+  ///
+  /// ### Examples
+  ///
+  /// Basic Usage:
+  ///
+  /// ```cpp
+  /// auto parse_name(string_view) -> cpp::result<std::string,parse_error>;
+  /// auto parse_age(string_view) -> cpp::result<int,parse_error>;
+  ///
+  /// auto r = cpp::zip(parse_name(fields[0]), parse_age(fields[1]));
+  /// // 'r' is a 'cpp::result<std::tuple<std::string,int>,parse_error>'
+  /// ```
+  ///
+  /// \param r the first result
+  /// \param rs the remaining results
+  /// \return a tuple of every value, or the first error
+  template <typename R, typename...Rs>
+  auto zip(R&& r, Rs&&...rs) -> detail::zip_result_t<R, Rs...>;
+
+  /// \brief Invokes \p fn with the values of several results, if all of
+  ///        them contain a value
+  ///
+  /// This behaves as `zip` followed by applying \p fn to the tuple's
+  /// elements, but passes the values straight to \p fn without
+  /// constructing the intermediate tuple. As with `map`, the value returned
+  /// by \p fn is wrapped in a `result`; \p fn is not invoked if any result
+  /// contains an error, and the first such error is returned instead.
+  ///
+  /// ### Examples
+  ///
+  /// Basic Usage:
+  ///
+  /// ```cpp
+  /// auto r = cpp::zip_with([](std::string name, int age) {
+  ///   return person{std::move(name), age};
+  /// }, parse_name(fields[0]), parse_age(fields[1]));
+  /// // 'r' is a 'cpp::result<person,parse_error>'
+  /// ```
+  ///
+  /// \param fn the function to invoke with every value
+  /// \param r the first result
+  /// \param rs the remaining results
+  /// \return the result of \p fn, or the first error
+  template <typename Fn, typename R, typename...Rs>
+  auto zip_with(Fn&& fn, R&& r, Rs&&...rs) -> detail::zip_with_result_t<Fn, R, Rs...>;
+
+#if RESULT_HAS_EXECUTION_POLICIES
+
+  /// \brief Transforms each element of \p range with \p fn under the
+  ///        execution policy \p policy, collecting the resulting
+  ///        `result<U,E>` objects into a `result<std::vector<U>,E>`
+  ///
+  /// The range is split into blocks which are processed under \p policy. As
+  /// soon as any invocation of \p fn produces an error, every worker stops
+  /// invoking \p fn on elements that follow that error, and drains
+  /// cooperatively. Elements preceding the error are still transformed, so
+  /// that the error returned is always the same error that the sequential
+  /// overload would produce.
+  ///
+  /// \note As with standard parallel algorithms, \p fn may be invoked
+  ///       concurrently and must not introduce data races. If \p fn throws,
+  ///       `std::terminate` is called.
+  ///
+  /// \param policy the execution policy
+  /// \param range a range with random-access iterators
+  /// \param fn the function to invoke on each element
+  /// \return the values of every transformation, or the first error
+  template <typename ExecutionPolicy, typename Range, typename Fn,
+            typename = typename std::enable_if<
+              std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value
+            >::type>
+  auto transform_collect(ExecutionPolicy&& policy, Range&& range, Fn&& fn)
+    -> detail::collect_result_t<
+      detail::invoke_result_t<Fn, detail::range_forward_t<Range>>
+    >;
+
+  /// \brief Collects a range of `result<T,E>` objects into a single
+  ///        `result<std::vector<T>,E>` under the execution policy \p policy
+  ///
+  /// \param policy the execution policy
+  /// \param range a range of results with random-access iterators
+  /// \return the values of every result, or the first error
+  template <typename ExecutionPolicy, typename Range,
+            typename = typename std::enable_if<
+              std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value
+            >::type>
+  auto collect(ExecutionPolicy&& policy, Range&& range)
+    -> detail::collect_result_t<detail::range_reference_t<Range>>;
+
+#endif // RESULT_HAS_EXECUTION_POLICIES
+
+} // inline namespace bitwizeshift
+} // namespace RESULT_NAMESPACE_INTERNAL
+
+//=============================================================================
+// utilities : range traits
+//=============================================================================
+
+template <typename Range>
+inline
+auto RESULT_NS_IMPL::detail::range_size_hint(const Range& range, int)
+  -> decltype(static_cast<std::size_t>(range.size()))
+{
+  return static_cast<std::size_t>(range.size());
+}
+
+template <typename Range>
+inline
+auto RESULT_NS_IMPL::detail::range_size_hint(const Range& range, long)
+  -> std::size_t
+{
+  using iterator = decltype(std::begin(range));
+  using category = typename std::iterator_traits<iterator>::iterator_category;
+
+  if (!std::is_base_of<std::random_access_iterator_tag,category>::value) {
+    return 0u;
+  }
+  return static_cast<std::size_t>(std::distance(std::begin(range), std::end(range)));
+}
+
+//=============================================================================
+// utilities : zip traits
+//=============================================================================
+
+inline constexpr
+auto RESULT_NS_IMPL::detail::zip_all_values() noexcept -> bool
+{
+  return true;
+}
+
+template <typename R, typename...Rs>
+inline constexpr
+auto RESULT_NS_IMPL::detail::zip_all_values(const R& r, const Rs&...rs)
+  noexcept -> bool
+{
+  return r.has_value() & zip_all_values(rs...);
+}
+
+template <typename E, typename R>
+inline
+auto RESULT_NS_IMPL::detail::zip_first_error(R&& r) -> failure<E>
+{
+  return detail::try_extract_failure(detail::forward<R>(r));
+}
+
+template <typename E, typename R, typename R2, typename...Rs>
+inline
+auto RESULT_NS_IMPL::detail::zip_first_error(R&& r, R2&& r2, Rs&&...rs)
+  -> failure<E>
+{
+  if (!r.has_value()) {
+    return detail::try_extract_failure(detail::forward<R>(r));
+  }
+  return zip_first_error<E>(detail::forward<R2>(r2), detail::forward<Rs>(rs)...);
+}
+
+template <typename Result, typename Fn, typename...Rs>
+inline
+auto RESULT_NS_IMPL::detail::zip_with_invoke(std::false_type, Fn&& fn, Rs&&...rs)
+  -> Result
+{
+  return Result(
+    in_place,
+    detail::invoke(detail::forward<Fn>(fn), *detail::forward<Rs>(rs)...)
+  );
+}
+
+template <typename Result, typename Fn, typename...Rs>
+inline
+auto RESULT_NS_IMPL::detail::zip_with_invoke(std::true_type, Fn&& fn, Rs&&...rs)
+  -> Result
+{
+  detail::invoke(detail::forward<Fn>(fn), *detail::forward<Rs>(rs)...);
+  return Result{};
+}
+
+//=============================================================================
+// algorithms : collect
+//=============================================================================
+
+template <typename Range>
+inline
+auto RESULT_NS_IMPL::collect(Range&& range)
+  -> detail::collect_result_t<detail::range_reference_t<Range>>
+{
+  using element_type = detail::range_forward_t<Range>;
+
+  return transform_collect(
+    detail::forward<Range>(range),
+    [](element_type element) -> element_type {
+      return static_cast<element_type>(element);
+    }
+  );
+}
+
+//=============================================================================
+// algorithms : transform_collect
+//=============================================================================
+
+template <typename Range, typename Fn>
+inline
+auto RESULT_NS_IMPL::transform_collect(Range&& range, Fn&& fn)
+  -> detail::collect_result_t<
+    detail::invoke_result_t<Fn, detail::range_forward_t<Range>>
+  >
+{
+  using element_type = detail::range_forward_t<Range>;
+  using vector_type = typename detail::collect_result_t<
+    detail::invoke_result_t<Fn, element_type>
+  >::value_type;
+
+  auto values = vector_type{};
+
+  const auto last = std::end(range);
+  for (auto it = std::begin(range); it != last; ++it) {
+    auto r = detail::invoke(fn, static_cast<element_type>(*it));
+    if (!r.has_value()) {
+      return detail::try_extract_failure(std::move(r));
+    }
+    values.push_back(*(std::move(r)));
+  }
+  return values;
+}
+
+//=============================================================================
+// algorithms : partition_results
+//=============================================================================
+
+template <typename InputIt, typename ValueOut, typename ErrorOut>
+inline
+auto RESULT_NS_IMPL::partition_results(InputIt first, InputIt last,
+                                        ValueOut values_out, ErrorOut errors_out)
+  -> partition_results_result<ValueOut,ErrorOut>
+{
+  using element_type = decltype(*first);
+
+  using result_type = typename std::decay<element_type>::type;
+
+  static_assert(
+    is_result<result_type>::value,
+    "partition_results requires a range of 'result' objects"
+  );
+  static_assert(
+    !std::is_void<typename result_type::value_type>::value,
+    "partition_results requires results of non-void values"
+  );
+
+  auto output = partition_results_result<ValueOut,ErrorOut>{
+    std::move(values_out), std::move(errors_out), 0u, 0u
+  };
+
+  for (; first != last; ++first) {
+    // 'element' is declared as a forwarding reference so that results
+    // returned by value from proxy iterators are moved from
+    auto&& element = *first;
+    if (element.has_value()) {
+      *output.values_out = *static_cast<element_type&&>(element);
+      ++output.values_out;
+      ++output.value_count;
+    } else {
+      *output.errors_out = static_cast<element_type&&>(element).error();
+      ++output.errors_out;
+      ++output.error_count;
+    }
+  }
+  return output;
+}
+
+template <typename Range>
+inline
+auto RESULT_NS_IMPL::partition_results(Range&& range)
+  -> partitioned_results_t<Range>
+{
+  using element_type = detail::range_forward_t<Range>;
+
+  auto output = partitioned_results_t<Range>{};
+
+  const auto size = detail::range_size_hint(range, 0);
+  output.values.reserve(size);
+
+  const auto last = std::end(range);
+  for (auto it = std::begin(range); it != last; ++it) {
+    auto&& element = *it;
+    if (element.has_value()) {
+      output.values.push_back(*static_cast<element_type>(element));
+      continue;
+    }
+    if (output.errors.empty() && size != 0u) {
+      output.errors.reserve(size - output.values.size());
+    }
+    output.errors.push_back(static_cast<element_type>(element).error());
+  }
+  return output;
+}
+
+//=============================================================================
+// algorithms : zip
+//=============================================================================
+
+template <typename R, typename...Rs>
+inline
+auto RESULT_NS_IMPL::zip(R&& r, Rs&&...rs) -> detail::zip_result_t<R, Rs...>
+{
+  using result_type = detail::zip_result_t<R, Rs...>;
+  using error_type = typename result_type::error_type;
+
+  if (detail::zip_all_values(r, rs...)) {
+    return result_type(in_place, *detail::forward<R>(r), *detail::forward<Rs>(rs)...);
+  }
+  return detail::zip_first_error<error_type>(
+    detail::forward<R>(r),
+    detail::forward<Rs>(rs)...
+  );
+}
+
+template <typename Fn, typename R, typename...Rs>
+inline
+auto RESULT_NS_IMPL::zip_with(Fn&& fn, R&& r, Rs&&...rs)
+  -> detail::zip_with_result_t<Fn, R, Rs...>
+{
+  using result_type = detail::zip_with_result_t<Fn, R, Rs...>;
+  using error_type = typename result_type::error_type;
+
+  if (detail::zip_all_values(r, rs...)) {
+    return detail::zip_with_invoke<result_type>(
+      std::is_void<typename result_type::value_type>{},
+      detail::forward<Fn>(fn),
+      detail::forward<R>(r),
+      detail::forward<Rs>(rs)...
+    );
+  }
+  return detail::zip_first_error<error_type>(
+    detail::forward<R>(r),
+    detail::forward<Rs>(rs)...
+  );
+}
+
+#if RESULT_HAS_EXECUTION_POLICIES
+
+template <typename ExecutionPolicy, typename Range, typename Fn, typename>
+inline
+auto RESULT_NS_IMPL::transform_collect(ExecutionPolicy&& policy, Range&& range, Fn&& fn)
+  -> detail::collect_result_t<
+    detail::invoke_result_t<Fn, detail::range_forward_t<Range>>
+  >
+{
+  using iterator = decltype(std::begin(range));
+  using element_type = detail::range_forward_t<Range>;
+  using result_type = typename std::decay<
+    detail::invoke_result_t<Fn, element_type>
+  >::type;
+  using value_type = typename result_type::value_type;
+  using error_type = typename result_type::error_type;
+  using output_type = detail::collect_result_t<result_type>;
+
+  static_assert(
+    std::is_base_of<
+      std::random_access_iterator_tag,
+      typename std::iterator_traits<iterator>::iterator_category
+    >::value,
+    "parallel transform_collect requires a random-access range"
+  );
+
+  const auto first = std::begin(range);
+  const auto size = static_cast<std::size_t>(std::distance(first, std::end(range)));
+
+  // Blocks are oversubscribed relative to the hardware so that uneven work
+  // can still be balanced by the policy's scheduler.
+  const auto workers = std::max(std::thread::hardware_concurrency(), 1u);
+  const auto block_size = std::max<std::size_t>(size / (workers * 4u), 1u);
+  const auto block_count = (size + block_size - 1u) / block_size;
+
+  auto blocks = std::vector<std::size_t>(block_count);
+  for (auto i = std::size_t{0u}; i < block_count; ++i) {
+    blocks[i] = i;
+  }
+
+  // 'constructed' uses 'char' rather than 'bool' so that concurrent writes to
+  // distinct elements do not race as they would within a 'std::vector<bool>'
+  auto slots = std::vector<detail::manual_storage<value_type>>(size);
+  auto constructed = std::vector<char>(size, 0);
+
+  // Index of the first error seen so far; 'size' when no error has occurred.
+  // Workers stop as soon as they pass this index.
+  auto error_index = std::atomic<std::size_t>{size};
+  auto error_mutex = std::mutex{};
+  auto error = detail::manual_storage<error_type>{};
+
+  std::for_each(detail::forward<ExecutionPolicy>(policy), blocks.begin(), blocks.end(),
+    [&](std::size_t block) {
+      const auto begin = block * block_size;
+      const auto end = std::min(begin + block_size, size);
+
+      for (auto i = begin; i < end; ++i) {
+        if (i > error_index.load(std::memory_order_relaxed)) {
+          return;
+        }
+        // Each element is visited at most once, so elements of rvalue ranges
+        // may be moved from
+        auto r = detail::invoke(
+          fn,
+          static_cast<element_type>(first[static_cast<std::ptrdiff_t>(i)])
+        );
+        if (r.has_value()) {
+          slots[i].construct(*std::move(r));
+          constructed[i] = 1;
+          continue;
+        }
+
+        const auto lock = std::lock_guard<std::mutex>{error_mutex};
+        const auto current = error_index.load(std::memory_order_relaxed);
+        if (i < current) {
+          if (current != size) {
+            error.destroy();
+          }
+          error.construct(std::move(r).error());
+          error_index.store(i, std::memory_order_relaxed);
+        }
+        return;
+      }
+    }
+  );
+
+  // The output is constructed directly rather than assigned, since result
+  // assignment is disabled for errors that may throw
+  if (error_index.load() != size) {
+    for (auto i = std::size_t{0u}; i < size; ++i) {
+      if (constructed[i] != 0) {
+        slots[i].destroy();
+      }
+    }
+    auto output = detail::result_error_extractor::propagate<output_type>(
+      std::move(error.get())
+    );
+    error.destroy();
+    return output;
+  }
+
+  auto values = typename output_type::value_type{};
+  values.reserve(size);
+  for (auto i = std::size_t{0u}; i < size; ++i) {
+    values.push_back(std::move(slots[i].get()));
+    slots[i].destroy();
+  }
+  return output_type{in_place, std::move(values)};
+}
+
+template <typename ExecutionPolicy, typename Range, typename>
+inline
+auto RESULT_NS_IMPL::collect(ExecutionPolicy&& policy, Range&& range)
+  -> detail::collect_result_t<detail::range_reference_t<Range>>
+{
+  using element_type = detail::range_forward_t<Range>;
+
+  return transform_collect(
+    detail::forward<ExecutionPolicy>(policy),
+    detail::forward<Range>(range),
+    [](element_type element) -> element_type {
+      return static_cast<element_type>(element);
+    }
+  );
+}
+
+#endif // RESULT_HAS_EXECUTION_POLICIES
+
+#undef RESULT_HAS_EXECUTION_POLICIES
+#undef RESULT_NAMESPACE_INTERNAL
+#undef RESULT_NS_IMPL
+
+#endif /* RESULT_RESULT_ALGORITHM_HPP */
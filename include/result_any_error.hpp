@@ -0,0 +1,805 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file result_any_error.hpp
+///
+/// \brief This header provides a type-erased error type that stores small
+///        errors inline, for layers that propagate errors of many types
+////////////////////////////////////////////////////////////////////////////////
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020-2021 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef RESULT_RESULT_ANY_ERROR_HPP
+#define RESULT_RESULT_ANY_ERROR_HPP
+
+#include "result.hpp"
+
+#include <cstddef>     // std::size_t
+#include <memory>      // std::addressof
+#include <new>         // placement-new
+#include <type_traits> // std::enable_if, std::decay, std::integral_constant
+#include <utility>     // std::forward, std::move, std::declval
+
+#if !defined(RESULT_ANY_ERROR_BUFFER_SIZE)
+/// \brief The number of bytes that `any_error` reserves for storing errors
+///        inline, without allocating
+# define RESULT_ANY_ERROR_BUFFER_SIZE 32
+#endif
+
+#if defined(RESULT_NAMESPACE)
+# define RESULT_NAMESPACE_INTERNAL RESULT_NAMESPACE
+#else
+# define RESULT_NAMESPACE_INTERNAL cpp
+#endif
+#define RESULT_NS_IMPL RESULT_NAMESPACE_INTERNAL::bitwizeshift
+
+namespace RESULT_NAMESPACE_INTERNAL {
+inline namespace bitwizeshift {
+
+  class any_error;
+
+  namespace detail {
+
+    //=========================================================================
+    // union : any_error_storage
+    //=========================================================================
+
+    /// \brief The buffer that an `any_error` stores its error in, or a
+    ///        pointer to the error if it does not fit
+    union any_error_storage
+    {
+      void* pointer;
+      unsigned char bytes[RESULT_ANY_ERROR_BUFFER_SIZE];
+    };
+
+    static_assert(
+      RESULT_ANY_ERROR_BUFFER_SIZE >= sizeof(void*),
+      "RESULT_ANY_ERROR_BUFFER_SIZE must be able to hold a pointer"
+    );
+
+    //=========================================================================
+    // struct : any_error_vtable
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief The operations of the error type stored in an `any_error`
+    ///
+    /// A single vtable exists for each stored type, so the vtable pointer
+    /// doubles as the identity of the type.
+    ///////////////////////////////////////////////////////////////////////////
+    struct any_error_vtable
+    {
+      /// \brief Copy-constructs the error in \p from into \p to
+      auto (*copy)(const any_error_storage& from, any_error_storage& to) -> void;
+
+      /// \brief Moves the error in \p from into \p to, and destroys the
+      ///        source. This never throws.
+      auto (*relocate)(any_error_storage& from, any_error_storage& to) -> void;
+
+      /// \brief Destroys the error in \p storage
+      auto (*destroy)(any_error_storage& storage) -> void;
+
+      /// \brief Compares the errors in \p lhs and \p rhs
+      auto (*equal)(const any_error_storage& lhs,
+                    const any_error_storage& rhs) -> bool;
+    };
+
+    //=========================================================================
+    // traits
+    //=========================================================================
+
+    template <typename E>
+    struct any_error_fits_inline : std::integral_constant<bool,(
+      sizeof(E) <= sizeof(any_error_storage) &&
+      alignof(E) <= alignof(any_error_storage) &&
+      std::is_nothrow_move_constructible<E>::value
+    )>{};
+
+    template <typename E, typename = void>
+    struct any_error_is_equality_comparable : std::false_type{};
+
+    template <typename E>
+    struct any_error_is_equality_comparable<E,decltype(void(
+      static_cast<bool>(std::declval<const E&>() == std::declval<const E&>())
+    ))> : std::true_type{};
+
+    template <typename E>
+    struct any_error_is_storable : std::integral_constant<bool,(
+      std::is_object<E>::value &&
+      !std::is_array<E>::value &&
+      !std::is_const<E>::value &&
+      !std::is_volatile<E>::value &&
+      !std::is_same<E,any_error>::value &&
+      !is_failure<E>::value &&
+      !is_result<E>::value &&
+      std::is_copy_constructible<E>::value &&
+      any_error_is_equality_comparable<E>::value
+    )>{};
+
+    //=========================================================================
+    // class : any_error_handler<E>
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Implements the vtable operations for an \p E, which is stored
+    ///        inline when it fits, and allocated on the heap otherwise
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename E, bool Inline = any_error_fits_inline<E>::value>
+    struct any_error_handler;
+
+    template <typename E>
+    struct any_error_handler<E,true>
+    {
+      template <typename...Args>
+      static auto construct(any_error_storage& storage, Args&&...args) -> E&;
+      static auto get(any_error_storage& storage) noexcept -> E*;
+      static auto get(const any_error_storage& storage) noexcept -> const E*;
+
+      static auto copy(const any_error_storage& from, any_error_storage& to) -> void;
+      static auto relocate(any_error_storage& from, any_error_storage& to) -> void;
+      static auto destroy(any_error_storage& storage) -> void;
+    };
+
+    template <typename E>
+    struct any_error_handler<E,false>
+    {
+      template <typename...Args>
+      static auto construct(any_error_storage& storage, Args&&...args) -> E&;
+      static auto get(any_error_storage& storage) noexcept -> E*;
+      static auto get(const any_error_storage& storage) noexcept -> const E*;
+
+      static auto copy(const any_error_storage& from, any_error_storage& to) -> void;
+      static auto relocate(any_error_storage& from, any_error_storage& to) -> void;
+      static auto destroy(any_error_storage& storage) -> void;
+    };
+
+    template <typename E>
+    struct any_error_comparator
+    {
+      static auto equal(const any_error_storage& lhs,
+                        const any_error_storage& rhs) -> bool;
+    };
+
+    /// \brief The vtable for errors of type \p E
+    template <typename E>
+    struct any_error_vtable_for
+    {
+      static constexpr any_error_vtable value = {
+        &any_error_handler<E>::copy,
+        &any_error_handler<E>::relocate,
+        &any_error_handler<E>::destroy,
+        &any_error_comparator<E>::equal
+      };
+    };
+
+#if __cplusplus < 201703L
+    template <typename E>
+    constexpr any_error_vtable any_error_vtable_for<E>::value;
+#endif
+
+  } // namespace detail
+
+  //===========================================================================
+  // class : any_error
+  //===========================================================================
+
+  /////////////////////////////////////////////////////////////////////////////
+  /// \brief A type-erased error that can hold an error of any copyable,
+  ///        equality-comparable type
+  ///
+  /// `any_error` allows a layer that calls into many components to propagate
+  /// each of their errors through a single `result<T,any_error>`, without
+  /// converting them to a common error type or losing the original error.
+  /// The stored error can be queried with `is<E>()` and `get_if<E>()`, which
+  /// compare a single pointer and do not require RTTI. Stored errors must be
+  /// equality comparable, so that comparing two `any_error`s always compares
+  /// their errors.
+  ///
+  /// Errors that are no larger than `RESULT_ANY_ERROR_BUFFER_SIZE` bytes
+  /// (32 by default), no more aligned than a pointer, and nothrow
+  /// move-constructible are stored inline, so failing with ordinary error
+  /// payloads such as enums, `std::error_code`, or small structs never
+  /// allocates. Larger errors are allocated on the heap. Moving an
+  /// `any_error` never throws.
+  ///
+  /// A default-constructed `any_error` holds no error, which represents the
+  /// success state; this is what `result<T,any_error>::error()` returns when
+  /// the result contains a value. Failing with an empty `any_error` is
+  /// therefore not meaningful.
+  ///
+  /// ### Examples
+  ///
+  /// Basic Usage:
+  ///
+  /// ```cpp
+  /// auto load(const std::string& path) -> cpp::result<config, cpp::any_error>
+  /// {
+  ///   auto file = open(path);    // result<file, std::error_code>
+  ///   if (!file) {
+  ///     return cpp::fail(file.error());
+  ///   }
+  ///   auto c = parse(*file);     // result<config, parse_error>
+  ///   if (!c) {
+  ///     return cpp::fail(c.error());
+  ///   }
+  ///   return *c;
+  /// }
+  ///
+  /// auto r = load("app.cfg");
+  /// if (const auto* ec = r.error().get_if<std::error_code>()) {
+  ///   std::cerr << ec->message() << "\n";
+  /// } else if (r.error().is<parse_error>()) {
+  ///   ...
+  /// }
+  /// ```
+  /////////////////////////////////////////////////////////////////////////////
+  class any_error
+  {
+    //-------------------------------------------------------------------------
+    // Static Members
+    //-------------------------------------------------------------------------
+  public:
+
+    /// \brief Queries whether an error of type \p E is stored without
+    ///        allocating
+    ///
+    /// \return `true` if \p E fits in the inline buffer
+    template <typename E>
+    static constexpr auto fits_inline() noexcept -> bool;
+
+    //-------------------------------------------------------------------------
+    // Constructors / Destructor / Assignment
+    //-------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs an `any_error` that holds no error
+    any_error() noexcept;
+
+    /// \brief Constructs an `any_error` that holds \p error
+    ///
+    /// This only allocates if the error does not fit inline.
+    ///
+    /// \param error the error to store
+    template <typename E,
+              typename = typename std::enable_if<
+                detail::any_error_is_storable<typename std::decay<E>::type>::value
+              >::type>
+    any_error(E&& error)
+      noexcept(detail::any_error_fits_inline<typename std::decay<E>::type>::value &&
+               std::is_nothrow_constructible<typename std::decay<E>::type,E>::value);
+
+    /// \brief Copies the error held by \p other
+    ///
+    /// \param other the error to copy
+    any_error(const any_error& other);
+
+    /// \brief Moves the error held by \p other, leaving \p other without an
+    ///        error
+    ///
+    /// \param other the error to move
+    any_error(any_error&& other) noexcept;
+
+    ~any_error();
+
+    auto operator=(const any_error& other) -> any_error&;
+    auto operator=(any_error&& other) noexcept -> any_error&;
+
+    /// \brief Replaces the held error with \p error
+    ///
+    /// \param error the error to store
+    template <typename E,
+              typename = typename std::enable_if<
+                detail::any_error_is_storable<typename std::decay<E>::type>::value
+              >::type>
+    auto operator=(E&& error) -> any_error&;
+
+    //-------------------------------------------------------------------------
+    // Observers
+    //-------------------------------------------------------------------------
+  public:
+
+    /// \brief Queries whether this holds an error
+    ///
+    /// \return `true` if an error is held
+    auto has_error() const noexcept -> bool;
+
+    /// \copydoc has_error
+    explicit operator bool() const noexcept;
+
+    /// \brief Queries whether the held error is of type \p E
+    ///
+    /// \return `true` if an error of exactly type \p E is held
+    template <typename E>
+    auto is() const noexcept -> bool;
+
+    /// \{
+    /// \brief Gets a pointer to the held error, if it is of type \p E
+    ///
+    /// \return a pointer to the error, or `nullptr` if no error of exactly
+    ///         type \p E is held
+    template <typename E>
+    auto get_if() noexcept -> E*;
+    template <typename E>
+    auto get_if() const noexcept -> const E*;
+    /// \}
+
+    //-------------------------------------------------------------------------
+    // Modifiers
+    //-------------------------------------------------------------------------
+  public:
+
+    /// \brief Replaces the held error with an \p E constructed from \p args
+    ///
+    /// If constructing the error throws, this holds no error.
+    ///
+    /// \param args the arguments to forward to E's constructor
+    /// \return a reference to the new error
+    template <typename E, typename...Args>
+    auto emplace(Args&&...args) -> E&;
+
+    /// \brief Destroys the held error, if any
+    auto reset() noexcept -> void;
+
+    /// \brief Swaps the errors held by this and \p other
+    ///
+    /// \param other the error to swap with
+    auto swap(any_error& other) noexcept -> void;
+
+    //-------------------------------------------------------------------------
+    // Private Members
+    //-------------------------------------------------------------------------
+  private:
+
+    const detail::any_error_vtable* m_vtable;
+    detail::any_error_storage m_storage;
+
+    friend auto operator==(const any_error&, const any_error&) -> bool;
+  };
+
+  //===========================================================================
+  // non-member functions : class : any_error
+  //===========================================================================
+
+  //---------------------------------------------------------------------------
+  // Comparison
+  //---------------------------------------------------------------------------
+
+  /// \brief Compares two `any_error` objects for equality
+  ///
+  /// Two errors are equal if neither holds an error, or if both hold an error
+  /// of the same type that compares equal.
+  ///
+  /// \param lhs the left error
+  /// \param rhs the right error
+  /// \return `true` if the errors are equal
+  auto operator==(const any_error& lhs, const any_error& rhs) -> bool;
+
+  /// \brief Compares two `any_error` objects for inequality
+  ///
+  /// \param lhs the left error
+  /// \param rhs the right error
+  /// \return `true` if the errors are not equal
+  auto operator!=(const any_error& lhs, const any_error& rhs) -> bool;
+
+  //---------------------------------------------------------------------------
+  // Utilities
+  //---------------------------------------------------------------------------
+
+  /// \brief Swaps the errors held by \p lhs and \p rhs
+  ///
+  /// \param lhs the left error to swap
+  /// \param rhs the right error to swap
+  auto swap(any_error& lhs, any_error& rhs) noexcept -> void;
+
+} // inline namespace bitwizeshift
+} // namespace RESULT_NAMESPACE_INTERNAL
+
+//=============================================================================
+// class : detail::any_error_handler<E>
+//=============================================================================
+
+template <typename E>
+template <typename...Args>
+inline
+auto RESULT_NS_IMPL::detail::any_error_handler<E,true>
+  ::construct(any_error_storage& storage, Args&&...args)
+  -> E&
+{
+  return *detail::construct_at(
+    static_cast<E*>(static_cast<void*>(storage.bytes)),
+    std::forward<Args>(args)...
+  );
+}
+
+template <typename E>
+inline
+auto RESULT_NS_IMPL::detail::any_error_handler<E,true>
+  ::get(any_error_storage& storage)
+  noexcept -> E*
+{
+  return static_cast<E*>(static_cast<void*>(storage.bytes));
+}
+
+template <typename E>
+inline
+auto RESULT_NS_IMPL::detail::any_error_handler<E,true>
+  ::get(const any_error_storage& storage)
+  noexcept -> const E*
+{
+  return static_cast<const E*>(static_cast<const void*>(storage.bytes));
+}
+
+template <typename E>
+inline
+auto RESULT_NS_IMPL::detail::any_error_handler<E,true>
+  ::copy(const any_error_storage& from, any_error_storage& to)
+  -> void
+{
+  construct(to, *get(from));
+}
+
+template <typename E>
+inline
+auto RESULT_NS_IMPL::detail::any_error_handler<E,true>
+  ::relocate(any_error_storage& from, any_error_storage& to)
+  -> void
+{
+  construct(to, std::move(*get(from)));
+  destroy(from);
+}
+
+template <typename E>
+inline
+auto RESULT_NS_IMPL::detail::any_error_handler<E,true>
+  ::destroy(any_error_storage& storage)
+  -> void
+{
+  get(storage)->~E();
+}
+
+//-----------------------------------------------------------------------------
+
+template <typename E>
+template <typename...Args>
+inline
+auto RESULT_NS_IMPL::detail::any_error_handler<E,false>
+  ::construct(any_error_storage& storage, Args&&...args)
+  -> E&
+{
+  auto* error = new E(std::forward<Args>(args)...);
+  storage.pointer = error;
+  return *error;
+}
+
+template <typename E>
+inline
+auto RESULT_NS_IMPL::detail::any_error_handler<E,false>
+  ::get(any_error_storage& storage)
+  noexcept -> E*
+{
+  return static_cast<E*>(storage.pointer);
+}
+
+template <typename E>
+inline
+auto RESULT_NS_IMPL::detail::any_error_handler<E,false>
+  ::get(const any_error_storage& storage)
+  noexcept -> const E*
+{
+  return static_cast<const E*>(storage.pointer);
+}
+
+template <typename E>
+inline
+auto RESULT_NS_IMPL::detail::any_error_handler<E,false>
+  ::copy(const any_error_storage& from, any_error_storage& to)
+  -> void
+{
+  construct(to, *get(from));
+}
+
+template <typename E>
+inline
+auto RESULT_NS_IMPL::detail::any_error_handler<E,false>
+  ::relocate(any_error_storage& from, any_error_storage& to)
+  -> void
+{
+  // Heap-allocated errors are relocated by transferring ownership
+  to.pointer = from.pointer;
+  from.pointer = nullptr;
+}
+
+template <typename E>
+inline
+auto RESULT_NS_IMPL::detail::any_error_handler<E,false>
+  ::destroy(any_error_storage& storage)
+  -> void
+{
+  delete get(storage);
+}
+
+//=============================================================================
+// class : detail::any_error_comparator<E>
+//=============================================================================
+
+template <typename E>
+inline
+auto RESULT_NS_IMPL::detail::any_error_comparator<E>
+  ::equal(const any_error_storage& lhs, const any_error_storage& rhs)
+  -> bool
+{
+  return static_cast<bool>(
+    *any_error_handler<E>::get(lhs) == *any_error_handler<E>::get(rhs)
+  );
+}
+
+//=============================================================================
+// class : any_error
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Static Members
+//-----------------------------------------------------------------------------
+
+template <typename E>
+inline constexpr
+auto RESULT_NS_IMPL::any_error::fits_inline()
+  noexcept -> bool
+{
+  return detail::any_error_fits_inline<E>::value;
+}
+
+//-----------------------------------------------------------------------------
+// Constructors / Destructor / Assignment
+//-----------------------------------------------------------------------------
+
+inline
+RESULT_NS_IMPL::any_error::any_error()
+  noexcept
+  : m_vtable{nullptr}
+{
+
+}
+
+template <typename E, typename>
+inline
+RESULT_NS_IMPL::any_error::any_error(E&& error)
+  noexcept(detail::any_error_fits_inline<typename std::decay<E>::type>::value &&
+           std::is_nothrow_constructible<typename std::decay<E>::type,E>::value)
+  : m_vtable{nullptr}
+{
+  using error_type = typename std::decay<E>::type;
+
+  detail::any_error_handler<error_type>::construct(m_storage, std::forward<E>(error));
+  m_vtable = &detail::any_error_vtable_for<error_type>::value;
+}
+
+inline
+RESULT_NS_IMPL::any_error::any_error(const any_error& other)
+  : m_vtable{nullptr}
+{
+  if (other.m_vtable != nullptr) {
+    other.m_vtable->copy(other.m_storage, m_storage);
+    m_vtable = other.m_vtable;
+  }
+}
+
+inline
+RESULT_NS_IMPL::any_error::any_error(any_error&& other)
+  noexcept
+  : m_vtable{other.m_vtable}
+{
+  if (other.m_vtable != nullptr) {
+    other.m_vtable->relocate(other.m_storage, m_storage);
+    other.m_vtable = nullptr;
+  }
+}
+
+inline
+RESULT_NS_IMPL::any_error::~any_error()
+{
+  reset();
+}
+
+inline
+auto RESULT_NS_IMPL::any_error::operator=(const any_error& other)
+  -> any_error&
+{
+  if (this != &other) {
+    // Copy first, so that this is unchanged if copying throws
+    auto copy = other;
+    swap(copy);
+  }
+  return (*this);
+}
+
+inline
+auto RESULT_NS_IMPL::any_error::operator=(any_error&& other)
+  noexcept -> any_error&
+{
+  if (this != &other) {
+    reset();
+    if (other.m_vtable != nullptr) {
+      other.m_vtable->relocate(other.m_storage, m_storage);
+      m_vtable = other.m_vtable;
+      other.m_vtable = nullptr;
+    }
+  }
+  return (*this);
+}
+
+template <typename E, typename>
+inline
+auto RESULT_NS_IMPL::any_error::operator=(E&& error)
+  -> any_error&
+{
+  emplace<typename std::decay<E>::type>(std::forward<E>(error));
+  return (*this);
+}
+
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
+
+inline
+auto RESULT_NS_IMPL::any_error::has_error()
+  const noexcept -> bool
+{
+  return m_vtable != nullptr;
+}
+
+inline
+RESULT_NS_IMPL::any_error::operator bool()
+  const noexcept
+{
+  return m_vtable != nullptr;
+}
+
+template <typename E>
+inline
+auto RESULT_NS_IMPL::any_error::is()
+  const noexcept -> bool
+{
+  return m_vtable == &detail::any_error_vtable_for<E>::value;
+}
+
+template <typename E>
+inline
+auto RESULT_NS_IMPL::any_error::get_if()
+  noexcept -> E*
+{
+  static_assert(
+    detail::any_error_is_storable<E>::value,
+    "get_if may only be used with types that any_error can store"
+  );
+
+  if (!is<E>()) {
+    return nullptr;
+  }
+  return detail::any_error_handler<E>::get(m_storage);
+}
+
+template <typename E>
+inline
+auto RESULT_NS_IMPL::any_error::get_if()
+  const noexcept -> const E*
+{
+  static_assert(
+    detail::any_error_is_storable<E>::value,
+    "get_if may only be used with types that any_error can store"
+  );
+
+  if (!is<E>()) {
+    return nullptr;
+  }
+  return detail::any_error_handler<E>::get(m_storage);
+}
+
+//-----------------------------------------------------------------------------
+// Modifiers
+//-----------------------------------------------------------------------------
+
+template <typename E, typename...Args>
+inline
+auto RESULT_NS_IMPL::any_error::emplace(Args&&...args)
+  -> E&
+{
+  static_assert(
+    detail::any_error_is_storable<E>::value,
+    "any_error may only store copy-constructible, equality-comparable, "
+    "non-cv-qualified object types that are not failures or results"
+  );
+
+  reset();
+  auto& error = detail::any_error_handler<E>::construct(
+    m_storage,
+    std::forward<Args>(args)...
+  );
+  m_vtable = &detail::any_error_vtable_for<E>::value;
+  return error;
+}
+
+inline
+auto RESULT_NS_IMPL::any_error::reset()
+  noexcept -> void
+{
+  if (m_vtable != nullptr) {
+    m_vtable->destroy(m_storage);
+    m_vtable = nullptr;
+  }
+}
+
+inline
+auto RESULT_NS_IMPL::any_error::swap(any_error& other)
+  noexcept -> void
+{
+  if (this == &other) {
+    return;
+  }
+  auto temporary = std::move(other);
+  other = std::move(*this);
+  *this = std::move(temporary);
+}
+
+//=============================================================================
+// non-member functions : class : any_error
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Comparison
+//-----------------------------------------------------------------------------
+
+inline
+auto RESULT_NS_IMPL::operator==(const any_error& lhs, const any_error& rhs)
+  -> bool
+{
+  if (lhs.m_vtable != rhs.m_vtable) {
+    return false;
+  }
+  if (lhs.m_vtable == nullptr) {
+    return true;
+  }
+  return lhs.m_vtable->equal(lhs.m_storage, rhs.m_storage);
+}
+
+inline
+auto RESULT_NS_IMPL::operator!=(const any_error& lhs, const any_error& rhs)
+  -> bool
+{
+  return !(lhs == rhs);
+}
+
+//-----------------------------------------------------------------------------
+// Utilities
+//-----------------------------------------------------------------------------
+
+inline
+auto RESULT_NS_IMPL::swap(any_error& lhs, any_error& rhs)
+  noexcept -> void
+{
+  lhs.swap(rhs);
+}
+
+#undef RESULT_NAMESPACE_INTERNAL
+#undef RESULT_NS_IMPL
+
+#endif /* RESULT_RESULT_ANY_ERROR_HPP */
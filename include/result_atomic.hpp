@@ -0,0 +1,633 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file result_atomic.hpp
+///
+/// \brief This header provides an atomic wrapper for results of small,
+///        trivially copyable types
+////////////////////////////////////////////////////////////////////////////////
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020-2021 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef RESULT_RESULT_ATOMIC_HPP
+#define RESULT_RESULT_ATOMIC_HPP
+
+#include "result.hpp"
+
+#include <atomic>      // std::atomic, std::memory_order
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint32_t, std::uint64_t
+#include <cstring>     // std::memcpy
+#include <type_traits> // std::conditional, std::has_unique_object_representations
+
+#if defined(RESULT_NAMESPACE)
+# define RESULT_NAMESPACE_INTERNAL RESULT_NAMESPACE
+#else
+# define RESULT_NAMESPACE_INTERNAL cpp
+#endif
+#define RESULT_NS_IMPL RESULT_NAMESPACE_INTERNAL::bitwizeshift
+
+namespace RESULT_NAMESPACE_INTERNAL {
+inline namespace bitwizeshift {
+  namespace detail {
+
+    //=========================================================================
+    // struct : atomic_result_wide_word
+    //=========================================================================
+
+    /// \brief A 16-byte word, for results that do not fit in 8 bytes
+    struct alignas(16) atomic_result_wide_word
+    {
+      unsigned char bytes[16];
+    };
+
+    //=========================================================================
+    // class : atomic_result_packer<T, E>
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Packs a `result<T,E>` into a single word, and back
+    ///
+    /// Results that encode their discriminant into their value or error --
+    /// through niche storage, or the compact storage of `result<void,E>` --
+    /// are packed by copying the whole result. Other results are packed as a
+    /// tag byte followed by the bytes of the value or the error.
+    ///
+    /// Bytes of the word after the packed result are always zero. Bytes
+    /// within it are the object representation of `T` or `E`, so words of
+    /// equal results only compare equal if neither has padding bits.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename E>
+    class atomic_result_packer
+    {
+      static_assert(
+        std::is_void<T>::value ||
+        (std::is_object<T>::value && std::is_trivially_copyable<T>::value),
+        "atomic_result requires T to be void or a trivially copyable object type"
+      );
+      static_assert(
+        std::is_object<E>::value && std::is_trivially_copyable<E>::value,
+        "atomic_result requires E to be a trivially copyable object type"
+      );
+#if __cplusplus >= 201703L
+      static_assert(
+        std::is_void<T>::value || std::has_unique_object_representations<T>::value,
+        "atomic_result requires T to have no padding bits, since its words "
+        "are compared by representation"
+      );
+      static_assert(
+        std::has_unique_object_representations<E>::value,
+        "atomic_result requires E to have no padding bits, since its words "
+        "are compared by representation"
+      );
+#endif
+
+      using value_type = typename std::conditional<
+        std::is_void<T>::value, unit, T
+      >::type;
+
+      static constexpr std::size_t value_size = std::is_void<T>::value
+        ? 0u
+        : sizeof(value_type);
+
+    public:
+
+      using result_type = result<T,E>;
+
+      /// \brief Whether the result encodes its own discriminant
+      static constexpr bool is_direct = (
+        sizeof(result_type) == (std::is_void<T>::value ? sizeof(E) : value_size)
+      );
+
+      /// \brief The number of bytes of the word that are used
+      static constexpr std::size_t packed_size = is_direct
+        ? sizeof(result_type)
+        : 1u + (value_size > sizeof(E) ? value_size : sizeof(E));
+
+      static_assert(
+        packed_size <= sizeof(atomic_result_wide_word),
+        "atomic_result requires the result to pack into at most 16 bytes"
+      );
+
+      using word_type = typename std::conditional<
+        (packed_size <= sizeof(std::uint32_t)),
+        std::uint32_t,
+        typename std::conditional<
+          (packed_size <= sizeof(std::uint64_t)),
+          std::uint64_t,
+          atomic_result_wide_word
+        >::type
+      >::type;
+
+      static auto pack(const result_type& r) noexcept -> word_type;
+      static auto unpack(const word_type& word) noexcept -> result_type;
+
+    private:
+
+      static auto pack(const result_type& r, std::true_type) noexcept -> word_type;
+      static auto pack(const result_type& r, std::false_type) noexcept -> word_type;
+
+      static auto unpack(const word_type& word, std::true_type) noexcept -> result_type;
+      static auto unpack(const word_type& word, std::false_type) noexcept -> result_type;
+
+      static auto pack_value(const result_type& r, unsigned char* bytes,
+                             std::false_type) noexcept -> void;
+      static auto pack_value(const result_type& r, unsigned char* bytes,
+                             std::true_type) noexcept -> void;
+
+      static auto unpack_value(const unsigned char* bytes, std::false_type) noexcept -> result_type;
+      static auto unpack_value(const unsigned char* bytes, std::true_type) noexcept -> result_type;
+    };
+
+  } // namespace detail
+
+  //===========================================================================
+  // class : atomic_result<T, E>
+  //===========================================================================
+
+  /////////////////////////////////////////////////////////////////////////////
+  /// \brief An atomic `result<T,E>` of trivially copyable types, for
+  ///        publishing results between threads without a lock
+  ///
+  /// The result is packed into a single 4, 8, or 16-byte word that is
+  /// operated on with `std::atomic`. Results that use niche storage, such
+  /// as an opted-in `result<T*,std::errc>`, or compact `result<void,E>`
+  /// storage are packed as-is; other results take a tag byte in addition to
+  /// the larger of `T` and `E`, so that `atomic_result<std::uint32_t,std::errc>`
+  /// fits in 8 bytes.
+  ///
+  /// 4 and 8-byte words are lock-free on all common platforms. Whether a
+  /// 16-byte word is lock-free depends on the platform and the compiler
+  /// flags, and GCC may require linking `libatomic` to use one; use
+  /// `is_lock_free()` to check.
+  ///
+  /// \note As with `std::atomic`, `compare_exchange_weak` and
+  ///       `compare_exchange_strong` compare representations rather than
+  ///       using `operator==`. `T` and `E` must therefore have unique object
+  ///       representations -- no padding bits, and no distinct
+  ///       representations of equal values, such as `0.0` and `-0.0`.
+  ///       This is enforced in C++17 and above; in earlier standards, a type
+  ///       with padding makes the comparison depend on indeterminate bytes.
+  ///
+  /// ### Examples
+  ///
+  /// Basic Usage:
+  ///
+  /// ```cpp
+  /// auto status = cpp::atomic_result<std::uint32_t,std::errc>{0u};
+  ///
+  /// // on a worker thread
+  /// status.store(cpp::fail(std::errc::timed_out));
+  ///
+  /// // on the monitor thread
+  /// if (auto s = status.load(); !s) {
+  ///   report(s.error());
+  /// }
+  /// ```
+  ///
+  /// \tparam T the value type; either `void` or trivially copyable with
+  ///           unique object representations
+  /// \tparam E the error type; trivially copyable with unique object
+  ///           representations
+  /////////////////////////////////////////////////////////////////////////////
+  template <typename T, typename E>
+  class atomic_result
+  {
+    using packer = detail::atomic_result_packer<T,E>;
+    using word_type = typename packer::word_type;
+
+    //-------------------------------------------------------------------------
+    // Public Member Types
+    //-------------------------------------------------------------------------
+  public:
+
+    using value_type = result<T,E>;
+
+    //-------------------------------------------------------------------------
+    // Public Static Members
+    //-------------------------------------------------------------------------
+  public:
+
+#if defined(__cpp_lib_atomic_is_always_lock_free) && __cpp_lib_atomic_is_always_lock_free >= 201603L
+    /// \brief Whether this type is lock-free on every object
+    static constexpr bool is_always_lock_free = std::atomic<word_type>::is_always_lock_free;
+#endif
+
+    //-------------------------------------------------------------------------
+    // Constructors / Assignment
+    //-------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs this from a value-initialized result
+    atomic_result() noexcept;
+
+    /// \brief Constructs this from \p desired
+    ///
+    /// \note The initialization is not atomic
+    ///
+    /// \param desired the result to store
+    atomic_result(const value_type& desired) noexcept;
+
+    atomic_result(const atomic_result&) = delete;
+
+    //-------------------------------------------------------------------------
+
+    /// \brief Atomically stores \p desired
+    ///
+    /// \param desired the result to store
+    /// \return \p desired
+    auto operator=(const value_type& desired) noexcept -> value_type;
+
+    auto operator=(const atomic_result&) -> atomic_result& = delete;
+
+    //-------------------------------------------------------------------------
+    // Observers
+    //-------------------------------------------------------------------------
+  public:
+
+    /// \brief Queries whether operations on this object are lock-free
+    ///
+    /// \return `true` if operations are lock-free
+    auto is_lock_free() const noexcept -> bool;
+
+    /// \brief Atomically loads the stored result
+    ///
+    /// \param order the memory order of the load
+    /// \return the stored result
+    auto load(std::memory_order order = std::memory_order_seq_cst)
+      const noexcept -> value_type;
+
+    /// \copydoc load
+    operator value_type() const noexcept;
+
+    //-------------------------------------------------------------------------
+    // Modifiers
+    //-------------------------------------------------------------------------
+  public:
+
+    /// \brief Atomically replaces the stored result with \p desired
+    ///
+    /// \param desired the result to store
+    /// \param order the memory order of the store
+    auto store(const value_type& desired,
+               std::memory_order order = std::memory_order_seq_cst) noexcept -> void;
+
+    /// \brief Atomically replaces the stored result with \p desired, and
+    ///        returns the previous result
+    ///
+    /// \param desired the result to store
+    /// \param order the memory order of the operation
+    /// \return the previously stored result
+    auto exchange(const value_type& desired,
+                  std::memory_order order = std::memory_order_seq_cst) noexcept -> value_type;
+
+    /// \{
+    /// \brief Atomically replaces the stored result with \p desired if it is
+    ///        equal to \p expected; otherwise loads it into \p expected
+    ///
+    /// The weak form may fail spuriously, and should be used in a loop.
+    ///
+    /// \param expected the result expected to be stored
+    /// \param desired the result to store
+    /// \param success the memory order if the results are equal
+    /// \param failure the memory order if the results are not equal
+    /// \param order the memory order of the operation
+    /// \return `true` if the result was replaced
+    auto compare_exchange_weak(value_type& expected,
+                               const value_type& desired,
+                               std::memory_order success,
+                               std::memory_order failure) noexcept -> bool;
+    auto compare_exchange_weak(value_type& expected,
+                               const value_type& desired,
+                               std::memory_order order = std::memory_order_seq_cst) noexcept -> bool;
+    auto compare_exchange_strong(value_type& expected,
+                                 const value_type& desired,
+                                 std::memory_order success,
+                                 std::memory_order failure) noexcept -> bool;
+    auto compare_exchange_strong(value_type& expected,
+                                 const value_type& desired,
+                                 std::memory_order order = std::memory_order_seq_cst) noexcept -> bool;
+    /// \}
+
+    //-------------------------------------------------------------------------
+    // Private Members
+    //-------------------------------------------------------------------------
+  private:
+
+    std::atomic<word_type> m_word;
+  };
+
+} // inline namespace bitwizeshift
+} // namespace RESULT_NAMESPACE_INTERNAL
+
+//=============================================================================
+// class : detail::atomic_result_packer<T, E>
+//=============================================================================
+
+#if __cplusplus < 201703L
+template <typename T, typename E>
+constexpr std::size_t RESULT_NS_IMPL::detail::atomic_result_packer<T,E>::value_size;
+
+template <typename T, typename E>
+constexpr bool RESULT_NS_IMPL::detail::atomic_result_packer<T,E>::is_direct;
+
+template <typename T, typename E>
+constexpr std::size_t RESULT_NS_IMPL::detail::atomic_result_packer<T,E>::packed_size;
+#endif
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::detail::atomic_result_packer<T,E>::pack(const result_type& r)
+  noexcept -> word_type
+{
+  return pack(r, std::integral_constant<bool,is_direct>{});
+}
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::detail::atomic_result_packer<T,E>::unpack(const word_type& word)
+  noexcept -> result_type
+{
+  return unpack(word, std::integral_constant<bool,is_direct>{});
+}
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::detail::atomic_result_packer<T,E>::pack(const result_type& r,
+                                                             std::true_type)
+  noexcept -> word_type
+{
+  static_assert(
+    std::is_trivially_copyable<result_type>::value,
+    "results that encode their discriminant must be trivially copyable"
+  );
+
+  auto word = word_type{};
+  std::memcpy(&word, &r, sizeof(result_type));
+  return word;
+}
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::detail::atomic_result_packer<T,E>::pack(const result_type& r,
+                                                             std::false_type)
+  noexcept -> word_type
+{
+  auto word = word_type{};
+  auto* bytes = reinterpret_cast<unsigned char*>(&word);
+
+  if (r.has_value()) {
+    bytes[0] = 1u;
+    pack_value(r, bytes + 1, std::is_void<T>{});
+  } else {
+    const auto error = r.error();
+    std::memcpy(bytes + 1, &error, sizeof(E));
+  }
+  return word;
+}
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::detail::atomic_result_packer<T,E>::unpack(const word_type& word,
+                                                               std::true_type)
+  noexcept -> result_type
+{
+  alignas(result_type) unsigned char storage[sizeof(result_type)];
+  std::memcpy(storage, &word, sizeof(result_type));
+  return *reinterpret_cast<const result_type*>(storage);
+}
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::detail::atomic_result_packer<T,E>::unpack(const word_type& word,
+                                                               std::false_type)
+  noexcept -> result_type
+{
+  const auto* bytes = reinterpret_cast<const unsigned char*>(&word);
+
+  if (bytes[0] != 0u) {
+    return unpack_value(bytes + 1, std::is_void<T>{});
+  }
+  alignas(E) unsigned char storage[sizeof(E)];
+  std::memcpy(storage, bytes + 1, sizeof(E));
+  return detail::result_error_extractor::propagate<result_type>(
+    *reinterpret_cast<const E*>(storage)
+  );
+}
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::detail::atomic_result_packer<T,E>::pack_value(const result_type& r,
+                                                                   unsigned char* bytes,
+                                                                   std::false_type)
+  noexcept -> void
+{
+  std::memcpy(bytes, &*r, value_size);
+}
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::detail::atomic_result_packer<T,E>::pack_value(const result_type&,
+                                                                   unsigned char*,
+                                                                   std::true_type)
+  noexcept -> void
+{
+  // 'void' values have no representation
+}
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::detail::atomic_result_packer<T,E>::unpack_value(const unsigned char* bytes,
+                                                                     std::false_type)
+  noexcept -> result_type
+{
+  alignas(value_type) unsigned char storage[sizeof(value_type)];
+  std::memcpy(storage, bytes, value_size);
+  return result_type{in_place, *reinterpret_cast<const value_type*>(storage)};
+}
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::detail::atomic_result_packer<T,E>::unpack_value(const unsigned char*,
+                                                                     std::true_type)
+  noexcept -> result_type
+{
+  return result_type{};
+}
+
+//=============================================================================
+// class : atomic_result<T, E>
+//=============================================================================
+
+#if defined(__cpp_lib_atomic_is_always_lock_free) && __cpp_lib_atomic_is_always_lock_free >= 201603L && \
+    __cplusplus < 201703L
+template <typename T, typename E>
+constexpr bool RESULT_NS_IMPL::atomic_result<T,E>::is_always_lock_free;
+#endif
+
+//-----------------------------------------------------------------------------
+// Constructors / Assignment
+//-----------------------------------------------------------------------------
+
+template <typename T, typename E>
+inline
+RESULT_NS_IMPL::atomic_result<T,E>::atomic_result()
+  noexcept
+  : m_word{packer::pack(value_type{})}
+{
+
+}
+
+template <typename T, typename E>
+inline
+RESULT_NS_IMPL::atomic_result<T,E>::atomic_result(const value_type& desired)
+  noexcept
+  : m_word{packer::pack(desired)}
+{
+
+}
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::atomic_result<T,E>::operator=(const value_type& desired)
+  noexcept -> value_type
+{
+  store(desired);
+  return desired;
+}
+
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::atomic_result<T,E>::is_lock_free()
+  const noexcept -> bool
+{
+  return m_word.is_lock_free();
+}
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::atomic_result<T,E>::load(std::memory_order order)
+  const noexcept -> value_type
+{
+  return packer::unpack(m_word.load(order));
+}
+
+template <typename T, typename E>
+inline
+RESULT_NS_IMPL::atomic_result<T,E>::operator value_type()
+  const noexcept
+{
+  return load();
+}
+
+//-----------------------------------------------------------------------------
+// Modifiers
+//-----------------------------------------------------------------------------
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::atomic_result<T,E>::store(const value_type& desired,
+                                               std::memory_order order)
+  noexcept -> void
+{
+  m_word.store(packer::pack(desired), order);
+}
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::atomic_result<T,E>::exchange(const value_type& desired,
+                                                  std::memory_order order)
+  noexcept -> value_type
+{
+  return packer::unpack(m_word.exchange(packer::pack(desired), order));
+}
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::atomic_result<T,E>::compare_exchange_weak(value_type& expected,
+                                                               const value_type& desired,
+                                                               std::memory_order success,
+                                                               std::memory_order failure)
+  noexcept -> bool
+{
+  auto word = packer::pack(expected);
+  if (m_word.compare_exchange_weak(word, packer::pack(desired), success, failure)) {
+    return true;
+  }
+  expected = packer::unpack(word);
+  return false;
+}
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::atomic_result<T,E>::compare_exchange_weak(value_type& expected,
+                                                               const value_type& desired,
+                                                               std::memory_order order)
+  noexcept -> bool
+{
+  auto word = packer::pack(expected);
+  if (m_word.compare_exchange_weak(word, packer::pack(desired), order)) {
+    return true;
+  }
+  expected = packer::unpack(word);
+  return false;
+}
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::atomic_result<T,E>::compare_exchange_strong(value_type& expected,
+                                                                 const value_type& desired,
+                                                                 std::memory_order success,
+                                                                 std::memory_order failure)
+  noexcept -> bool
+{
+  auto word = packer::pack(expected);
+  if (m_word.compare_exchange_strong(word, packer::pack(desired), success, failure)) {
+    return true;
+  }
+  expected = packer::unpack(word);
+  return false;
+}
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::atomic_result<T,E>::compare_exchange_strong(value_type& expected,
+                                                                 const value_type& desired,
+                                                                 std::memory_order order)
+  noexcept -> bool
+{
+  auto word = packer::pack(expected);
+  if (m_word.compare_exchange_strong(word, packer::pack(desired), order)) {
+    return true;
+  }
+  expected = packer::unpack(word);
+  return false;
+}
+
+#undef RESULT_NAMESPACE_INTERNAL
+#undef RESULT_NS_IMPL
+
+#endif /* RESULT_RESULT_ATOMIC_HPP */
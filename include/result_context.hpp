@@ -0,0 +1,1287 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file result_context.hpp
+///
+/// \brief This header provides an error type that accumulates human-readable
+///        context as it propagates, without allocating on each frame
+////////////////////////////////////////////////////////////////////////////////
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2017-2021 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef RESULT_RESULT_CONTEXT_HPP
+#define RESULT_RESULT_CONTEXT_HPP
+
+#include "result.hpp"
+
+#include <atomic>      // std::atomic
+#include <cstddef>     // std::size_t
+#include <cstring>     // std::strlen, std::memcpy
+#include <iterator>    // std::input_iterator_tag
+#include <new>         // ::operator new, ::operator delete, placement-new
+#include <string>      // std::string
+#include <type_traits> // std::enable_if, std::is_default_constructible
+#include <utility>     // std::move, std::swap
+
+#if !defined(RESULT_CONTEXT_ARENA_BLOCK_SIZE)
+/// \brief The number of bytes of context frames that are bump-allocated from
+///        each per-thread block before another block is allocated
+# define RESULT_CONTEXT_ARENA_BLOCK_SIZE 4096
+#endif
+
+#if defined(RESULT_NAMESPACE)
+# define RESULT_NAMESPACE_INTERNAL RESULT_NAMESPACE
+#else
+# define RESULT_NAMESPACE_INTERNAL cpp
+#endif
+#define RESULT_NS_IMPL RESULT_NAMESPACE_INTERNAL::bitwizeshift
+
+namespace RESULT_NAMESPACE_INTERNAL {
+inline namespace bitwizeshift {
+
+  template <typename E>
+  class contextual_error;
+
+  /// \brief Trait to determine whether \p T is a `contextual_error`
+  template <typename T>
+  struct is_contextual_error : std::false_type{};
+
+  template <typename E>
+  struct is_contextual_error<contextual_error<E>> : std::true_type{};
+
+  //===========================================================================
+  // class : context_piece
+  //===========================================================================
+
+  /////////////////////////////////////////////////////////////////////////////
+  /// \brief A non-owning view of part of a context message
+  ///
+  /// Context messages are given as a sequence of pieces, which are copied
+  /// into the arena back-to-back. This allows messages such as
+  /// `"while reading ", path` to be formed without first building a
+  /// `std::string`, which would allocate on every propagated error.
+  /////////////////////////////////////////////////////////////////////////////
+  class context_piece
+  {
+    //-------------------------------------------------------------------------
+    // Constructors
+    //-------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs a piece from the null-terminated string \p s
+    ///
+    /// \param s the string
+    context_piece(const char* s) noexcept;
+
+    /// \brief Constructs a piece from the first \p size characters of \p s
+    ///
+    /// \param s the string
+    /// \param size the number of characters
+    context_piece(const char* s, std::size_t size) noexcept;
+
+    /// \brief Constructs a piece that views \p s
+    ///
+    /// \param s the string
+    context_piece(const std::string& s) noexcept;
+
+    //-------------------------------------------------------------------------
+    // Observers
+    //-------------------------------------------------------------------------
+  public:
+
+    auto data() const noexcept -> const char*;
+    auto size() const noexcept -> std::size_t;
+
+    //-------------------------------------------------------------------------
+    // Private Members
+    //-------------------------------------------------------------------------
+  private:
+
+    const char* m_data;
+    std::size_t m_size;
+  };
+
+  namespace detail {
+
+    class context_block;
+
+    //=========================================================================
+    // struct : context_frame
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A single context message, linked to the frame that was added
+    ///        before it
+    ///
+    /// The null-terminated message is stored immediately after the frame in
+    /// its block. A frame whose previous frame lives in a different block
+    /// holds a reference to that block.
+    ///////////////////////////////////////////////////////////////////////////
+    struct context_frame
+    {
+      context_block* block;
+      const context_frame* previous;
+      std::size_t size;
+
+      auto message() const noexcept -> const char*;
+    };
+
+    //=========================================================================
+    // class : context_block
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A reference-counted block that context frames are
+    ///        bump-allocated from
+    ///
+    /// A block is referenced by the arena of the thread that allocates from
+    /// it, by every `contextual_error` whose newest frame it holds, and by
+    /// every frame in another block that continues into it. Frames are only
+    /// ever written by the owning thread, so the count is the only state
+    /// shared between threads.
+    ///
+    /// Once the owning thread holds the only reference, none of the frames
+    /// are reachable and the block is rewound and reused.
+    ///////////////////////////////////////////////////////////////////////////
+    class context_block
+    {
+      //-----------------------------------------------------------------------
+      // Static Members
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Creates a block with \p capacity bytes for frames, holding a
+      ///        single reference
+      static auto create(std::size_t capacity) -> context_block*;
+
+      /// \brief Gets the number of bytes needed for a frame with a message of
+      ///        \p size characters
+      static auto frame_stride(std::size_t size) noexcept -> std::size_t;
+
+      //-----------------------------------------------------------------------
+      // Constructors
+      //-----------------------------------------------------------------------
+    public:
+
+      context_block(const context_block&) = delete;
+
+      auto operator=(const context_block&) -> context_block& = delete;
+
+      //-----------------------------------------------------------------------
+      // References
+      //-----------------------------------------------------------------------
+    public:
+
+      auto acquire() noexcept -> void;
+
+      /// \brief Releases a reference, destroying this block if it was the
+      ///        last one
+      auto release() noexcept -> void;
+
+      /// \brief Queries whether the caller holds the only reference
+      auto is_unique() const noexcept -> bool;
+
+      //-----------------------------------------------------------------------
+      // Allocation
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Allocates a frame that continues from \p previous, whose
+      ///        message is the concatenation of the \p count \p pieces
+      ///
+      /// \param size the total size of the pieces
+      /// \return the frame, or `nullptr` if it does not fit in this block
+      auto allocate(const context_frame* previous,
+                    const context_piece* pieces,
+                    std::size_t count,
+                    std::size_t size) noexcept -> const context_frame*;
+
+      /// \brief Discards every frame in this block
+      auto clear() noexcept -> void;
+
+      //-----------------------------------------------------------------------
+      // Private Constructors
+      //-----------------------------------------------------------------------
+    private:
+
+      explicit context_block(std::size_t capacity) noexcept;
+
+      auto data() noexcept -> unsigned char*;
+
+      //-----------------------------------------------------------------------
+      // Private Members
+      //-----------------------------------------------------------------------
+    private:
+
+      std::atomic<std::size_t> m_references;
+      std::size_t m_capacity;
+      std::size_t m_size;
+    };
+
+    //=========================================================================
+    // class : context_arena
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief The per-thread source of context frames
+    ///
+    /// Frames are allocated from the current block until it is full, at
+    /// which point it is released to the errors still referring to it and a
+    /// new block is started. An error may therefore be destroyed on a
+    /// different thread than the one that added its context.
+    ///////////////////////////////////////////////////////////////////////////
+    class context_arena
+    {
+      //-----------------------------------------------------------------------
+      // Static Members
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the arena for the current thread
+      static auto local() noexcept -> context_arena&;
+
+      //-----------------------------------------------------------------------
+      // Constructors / Destructor
+      //-----------------------------------------------------------------------
+    public:
+
+      context_arena() = default;
+      context_arena(const context_arena&) = delete;
+      ~context_arena();
+
+      auto operator=(const context_arena&) -> context_arena& = delete;
+
+      //-----------------------------------------------------------------------
+      // Allocation
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Allocates a frame that continues from \p previous, whose
+      ///        message is the concatenation of the \p count \p pieces
+      ///
+      /// The returned frame's block is not referenced on behalf of the
+      /// caller.
+      auto push(const context_frame* previous,
+                const context_piece* pieces,
+                std::size_t count) -> const context_frame*;
+
+      //-----------------------------------------------------------------------
+      // Private Members
+      //-----------------------------------------------------------------------
+    private:
+
+      context_block* m_block = nullptr;
+    };
+
+  } // namespace detail
+
+  //===========================================================================
+  // class : error_context
+  //===========================================================================
+
+  /////////////////////////////////////////////////////////////////////////////
+  /// \brief A non-owning range over the context messages of a
+  ///        `contextual_error`, from the most recently added to the first
+  ///
+  /// The range is valid until the `contextual_error` it was obtained from is
+  /// modified or destroyed.
+  /////////////////////////////////////////////////////////////////////////////
+  class error_context
+  {
+    //-------------------------------------------------------------------------
+    // Public Member Types
+    //-------------------------------------------------------------------------
+  public:
+
+    class iterator
+    {
+    public:
+
+      using iterator_category = std::input_iterator_tag;
+      using value_type = const char*;
+      using difference_type = std::ptrdiff_t;
+      using pointer = const char* const*;
+      using reference = const char*;
+
+      iterator() = default;
+
+      /// \brief Gets the null-terminated message of the current frame
+      auto operator*() const noexcept -> const char*;
+
+      auto operator++() noexcept -> iterator&;
+      auto operator++(int) noexcept -> iterator;
+
+      friend auto operator==(const iterator& lhs, const iterator& rhs) noexcept
+        -> bool
+      {
+        return lhs.m_frame == rhs.m_frame;
+      }
+
+      friend auto operator!=(const iterator& lhs, const iterator& rhs) noexcept
+        -> bool
+      {
+        return lhs.m_frame != rhs.m_frame;
+      }
+
+    private:
+
+      explicit iterator(const detail::context_frame* frame) noexcept;
+
+      const detail::context_frame* m_frame = nullptr;
+
+      friend class error_context;
+    };
+
+    using const_iterator = iterator;
+
+    //-------------------------------------------------------------------------
+    // Constructors
+    //-------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs an empty context
+    error_context() = default;
+
+    //-------------------------------------------------------------------------
+    // Observers
+    //-------------------------------------------------------------------------
+  public:
+
+    auto begin() const noexcept -> iterator;
+    auto end() const noexcept -> iterator;
+
+    /// \brief Queries whether there are no context messages
+    auto empty() const noexcept -> bool;
+
+    /// \brief Joins every context message, most recent first, with
+    ///        \p separator
+    ///
+    /// \param separator the string to place between messages
+    /// \return the joined messages
+    auto to_string(const char* separator = ": ") const -> std::string;
+
+    //-------------------------------------------------------------------------
+    // Private Constructors / Members
+    //-------------------------------------------------------------------------
+  private:
+
+    explicit error_context(const detail::context_frame* frame) noexcept;
+
+    const detail::context_frame* m_frame = nullptr;
+
+    template <typename E>
+    friend class contextual_error;
+  };
+
+  //===========================================================================
+  // class : contextual_error<E>
+  //===========================================================================
+
+  /////////////////////////////////////////////////////////////////////////////
+  /// \brief An error of type \p E that accumulates context messages as it is
+  ///        propagated
+  ///
+  /// Messages are copied into a per-thread arena of reference-counted blocks
+  /// rather than being allocated individually, and the error itself stores
+  /// only a pointer to its most recent message. Adding context is therefore
+  /// a bump allocation and a copy of the message, and copying or moving the
+  /// error never copies the messages.
+  ///
+  /// Context is shared between copies, and is not considered when comparing
+  /// errors.
+  ///
+  /// ### Examples
+  ///
+  /// Basic Usage:
+  ///
+  /// ```cpp
+  /// auto read_header(const std::string& path)
+  ///   -> cpp::result<header, cpp::contextual_error<std::error_code>>
+  /// {
+  ///   return cpp::with_context(parse_header(open(path)), "while reading ", path);
+  /// }
+  ///
+  /// auto r = read_header("a.bin");
+  /// if (!r) {
+  ///   std::cerr << r.error().context().to_string() << ": "
+  ///             << r.error().error().message() << "\n";
+  /// }
+  /// ```
+  /////////////////////////////////////////////////////////////////////////////
+  template <typename E>
+  class contextual_error
+  {
+    //-------------------------------------------------------------------------
+    // Public Member Types
+    //-------------------------------------------------------------------------
+  public:
+
+    using error_type = E;
+
+    //-------------------------------------------------------------------------
+    // Constructors / Destructor / Assignment
+    //-------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs a default-constructed error without context
+    template <typename U=E,
+              typename = typename std::enable_if<std::is_default_constructible<U>::value>::type>
+    contextual_error()
+      noexcept(std::is_nothrow_default_constructible<E>::value);
+
+    /// \{
+    /// \brief Constructs an error without context from \p error
+    ///
+    /// \param error the underlying error
+    contextual_error(const E& error)
+      noexcept(std::is_nothrow_copy_constructible<E>::value);
+    contextual_error(E&& error)
+      noexcept(std::is_nothrow_move_constructible<E>::value);
+    /// \}
+
+    /// \brief Constructs the underlying error in-place from \p args
+    ///
+    /// \param args the arguments to forward to E's constructor
+    template <typename...Args>
+    explicit contextual_error(in_place_t, Args&&...args)
+      noexcept(std::is_nothrow_constructible<E,Args...>::value);
+
+    /// \brief Copies the error of \p other, sharing its context
+    ///
+    /// \param other the error to copy
+    contextual_error(const contextual_error& other)
+      noexcept(std::is_nothrow_copy_constructible<E>::value);
+
+    /// \brief Moves the error and context of \p other, leaving \p other
+    ///        without context
+    ///
+    /// \param other the error to move
+    contextual_error(contextual_error&& other)
+      noexcept(std::is_nothrow_move_constructible<E>::value);
+
+    ~contextual_error();
+
+    auto operator=(const contextual_error& other)
+      noexcept(std::is_nothrow_copy_assignable<E>::value) -> contextual_error&;
+    auto operator=(contextual_error&& other)
+      noexcept(std::is_nothrow_move_assignable<E>::value) -> contextual_error&;
+
+    //-------------------------------------------------------------------------
+    // Observers
+    //-------------------------------------------------------------------------
+  public:
+
+    /// \{
+    /// \brief Gets the underlying error
+    ///
+    /// \return the underlying error
+    auto error() & noexcept -> E&;
+    auto error() && noexcept -> E&&;
+    auto error() const & noexcept -> const E&;
+    /// \}
+
+    /// \brief Gets the context messages added to this error
+    ///
+    /// \return the context, most recent message first
+    auto context() const noexcept -> error_context;
+
+    //-------------------------------------------------------------------------
+    // Modifiers
+    //-------------------------------------------------------------------------
+  public:
+
+    /// \brief Adds a context message formed by concatenating \p pieces
+    ///
+    /// For example, `e.add_context("while reading ", path)` adds the single
+    /// message "while reading <path>".
+    ///
+    /// \param piece the first part of the message
+    /// \param pieces the remaining parts of the message
+    template <typename Piece, typename...Pieces>
+    auto add_context(const Piece& piece, const Pieces&...pieces) -> void;
+
+    /// \brief Removes every context message from this error
+    auto clear_context() noexcept -> void;
+
+    /// \brief Swaps the error and context of this with \p other
+    ///
+    /// \param other the error to swap with
+    auto swap(contextual_error& other) -> void;
+
+    //-------------------------------------------------------------------------
+    // Private Members
+    //-------------------------------------------------------------------------
+  private:
+
+    E m_error;
+    const detail::context_frame* m_frame;
+  };
+
+  //===========================================================================
+  // non-member functions : class : contextual_error<E>
+  //===========================================================================
+
+  //---------------------------------------------------------------------------
+  // Comparison
+  //---------------------------------------------------------------------------
+
+  /// \{
+  /// \brief Compares the underlying errors of \p lhs and \p rhs, ignoring
+  ///        any context
+  template <typename E1, typename E2>
+  auto operator==(const contextual_error<E1>& lhs,
+                  const contextual_error<E2>& rhs) -> bool;
+  template <typename E1, typename E2>
+  auto operator!=(const contextual_error<E1>& lhs,
+                  const contextual_error<E2>& rhs) -> bool;
+  template <typename E, typename U,
+            typename = typename std::enable_if<!is_contextual_error<U>::value>::type>
+  auto operator==(const contextual_error<E>& lhs, const U& rhs) -> bool;
+  template <typename E, typename U,
+            typename = typename std::enable_if<!is_contextual_error<U>::value>::type>
+  auto operator==(const U& lhs, const contextual_error<E>& rhs) -> bool;
+  template <typename E, typename U,
+            typename = typename std::enable_if<!is_contextual_error<U>::value>::type>
+  auto operator!=(const contextual_error<E>& lhs, const U& rhs) -> bool;
+  template <typename E, typename U,
+            typename = typename std::enable_if<!is_contextual_error<U>::value>::type>
+  auto operator!=(const U& lhs, const contextual_error<E>& rhs) -> bool;
+  /// \}
+
+  //---------------------------------------------------------------------------
+  // Utilities
+  //---------------------------------------------------------------------------
+
+  /// \brief Swaps \p lhs and \p rhs
+  template <typename E>
+  auto swap(contextual_error<E>& lhs, contextual_error<E>& rhs) -> void;
+
+  //===========================================================================
+  // utilities : with_context
+  //===========================================================================
+
+  /// \{
+  /// \brief Adds a context message to the error of \p r, if it has one
+  ///
+  /// The message is the concatenation of \p pieces, and is only copied into
+  /// the arena if \p r contains an error. Plain errors are wrapped in a
+  /// `contextual_error`, so that a `result<T,E>` from another API can be
+  /// given context as it is propagated.
+  ///
+  /// ### Examples
+  ///
+  /// Basic Usage:
+  ///
+  /// ```cpp
+  /// auto load(const std::string& path)
+  ///   -> cpp::result<config, cpp::contextual_error<std::errc>>
+  /// {
+  ///   auto text = cpp::with_context(read_file(path), "while reading ", path);
+  ///   if (!text) {
+  ///     return std::move(text).error();
+  ///   }
+  ///   return cpp::with_context(parse(*text), "while parsing ", path);
+  /// }
+  /// ```
+  ///
+  /// \param r the result to add context to
+  /// \param piece the first part of the message
+  /// \param pieces the remaining parts of the message
+  /// \return \p r, with the context added to its error
+  template <typename T, typename E, typename Piece, typename...Pieces>
+  auto with_context(const result<T,contextual_error<E>>& r,
+                    const Piece& piece, const Pieces&...pieces)
+    -> result<T,contextual_error<E>>;
+  template <typename T, typename E, typename Piece, typename...Pieces>
+  auto with_context(result<T,contextual_error<E>>&& r,
+                    const Piece& piece, const Pieces&...pieces)
+    -> result<T,contextual_error<E>>;
+  template <typename T, typename E, typename Piece, typename...Pieces,
+            typename = typename std::enable_if<!is_contextual_error<E>::value>::type>
+  auto with_context(const result<T,E>& r,
+                    const Piece& piece, const Pieces&...pieces)
+    -> result<T,contextual_error<E>>;
+  template <typename T, typename E, typename Piece, typename...Pieces,
+            typename = typename std::enable_if<!is_contextual_error<E>::value>::type>
+  auto with_context(result<T,E>&& r,
+                    const Piece& piece, const Pieces&...pieces)
+    -> result<T,contextual_error<E>>;
+  /// \}
+
+} // inline namespace bitwizeshift
+} // namespace RESULT_NAMESPACE_INTERNAL
+
+//=============================================================================
+// class : context_piece
+//=============================================================================
+
+inline
+RESULT_NS_IMPL::context_piece::context_piece(const char* s)
+  noexcept
+  : m_data{s},
+    m_size{std::strlen(s)}
+{
+
+}
+
+inline
+RESULT_NS_IMPL::context_piece::context_piece(const char* s, std::size_t size)
+  noexcept
+  : m_data{s},
+    m_size{size}
+{
+
+}
+
+inline
+RESULT_NS_IMPL::context_piece::context_piece(const std::string& s)
+  noexcept
+  : m_data{s.data()},
+    m_size{s.size()}
+{
+
+}
+
+inline
+auto RESULT_NS_IMPL::context_piece::data()
+  const noexcept -> const char*
+{
+  return m_data;
+}
+
+inline
+auto RESULT_NS_IMPL::context_piece::size()
+  const noexcept -> std::size_t
+{
+  return m_size;
+}
+
+//=============================================================================
+// struct : context_frame
+//=============================================================================
+
+inline
+auto RESULT_NS_IMPL::detail::context_frame::message()
+  const noexcept -> const char*
+{
+  return reinterpret_cast<const char*>(this + 1);
+}
+
+//=============================================================================
+// class : context_block
+//=============================================================================
+
+inline
+auto RESULT_NS_IMPL::detail::context_block::create(std::size_t capacity)
+  -> context_block*
+{
+  static_assert(
+    sizeof(context_block) % alignof(context_frame) == 0,
+    "frames must be suitably aligned at the start of a block"
+  );
+
+  void* const p = ::operator new(sizeof(context_block) + capacity);
+  return ::new (p) context_block{capacity};
+}
+
+inline
+auto RESULT_NS_IMPL::detail::context_block::frame_stride(std::size_t size)
+  noexcept -> std::size_t
+{
+  const auto bytes = sizeof(context_frame) + size + 1u;
+  const auto alignment = alignof(context_frame);
+
+  return (bytes + alignment - 1u) / alignment * alignment;
+}
+
+inline
+RESULT_NS_IMPL::detail::context_block::context_block(std::size_t capacity)
+  noexcept
+  : m_references{1u},
+    m_capacity{capacity},
+    m_size{0u}
+{
+
+}
+
+inline
+auto RESULT_NS_IMPL::detail::context_block::acquire()
+  noexcept -> void
+{
+  m_references.fetch_add(1u, std::memory_order_relaxed);
+}
+
+inline
+auto RESULT_NS_IMPL::detail::context_block::release()
+  noexcept -> void
+{
+  if (m_references.fetch_sub(1u, std::memory_order_acq_rel) != 1u) {
+    return;
+  }
+  clear();
+  this->~context_block();
+  ::operator delete(static_cast<void*>(this));
+}
+
+inline
+auto RESULT_NS_IMPL::detail::context_block::is_unique()
+  const noexcept -> bool
+{
+  return m_references.load(std::memory_order_acquire) == 1u;
+}
+
+inline
+auto RESULT_NS_IMPL::detail::context_block::allocate(const context_frame* previous,
+                                                     const context_piece* pieces,
+                                                     std::size_t count,
+                                                     std::size_t size)
+  noexcept -> const context_frame*
+{
+  const auto stride = frame_stride(size);
+
+  if (m_capacity - m_size < stride) {
+    return nullptr;
+  }
+
+  auto* const bytes = data() + m_size;
+  auto* const frame = ::new (static_cast<void*>(bytes)) context_frame{
+    this, previous, size
+  };
+
+  auto* out = reinterpret_cast<char*>(bytes + sizeof(context_frame));
+  for (auto i = std::size_t{0u}; i < count; ++i) {
+    if (pieces[i].size() != 0u) {
+      std::memcpy(out, pieces[i].data(), pieces[i].size());
+      out += pieces[i].size();
+    }
+  }
+  *out = '\0';
+
+  m_size += stride;
+  return frame;
+}
+
+inline
+auto RESULT_NS_IMPL::detail::context_block::clear()
+  noexcept -> void
+{
+  auto offset = std::size_t{0u};
+  while (offset < m_size) {
+    const auto* const frame = reinterpret_cast<const context_frame*>(data() + offset);
+    if (frame->previous != nullptr && frame->previous->block != this) {
+      frame->previous->block->release();
+    }
+    offset += frame_stride(frame->size);
+  }
+  m_size = 0u;
+}
+
+inline
+auto RESULT_NS_IMPL::detail::context_block::data()
+  noexcept -> unsigned char*
+{
+  return reinterpret_cast<unsigned char*>(this + 1);
+}
+
+//=============================================================================
+// class : context_arena
+//=============================================================================
+
+inline
+auto RESULT_NS_IMPL::detail::context_arena::local()
+  noexcept -> context_arena&
+{
+  thread_local context_arena arena;
+
+  return arena;
+}
+
+inline
+RESULT_NS_IMPL::detail::context_arena::~context_arena()
+{
+  if (m_block != nullptr) {
+    m_block->release();
+  }
+}
+
+inline
+auto RESULT_NS_IMPL::detail::context_arena::push(const context_frame* previous,
+                                                 const context_piece* pieces,
+                                                 std::size_t count)
+  -> const context_frame*
+{
+  auto size = std::size_t{0u};
+  for (auto i = std::size_t{0u}; i < count; ++i) {
+    size += pieces[i].size();
+  }
+
+  // No error refers to any frame of the block, so it can be reused as-is
+  if (m_block != nullptr && m_block->is_unique()) {
+    m_block->clear();
+  }
+
+  const auto* frame = (m_block != nullptr)
+    ? m_block->allocate(previous, pieces, count, size)
+    : nullptr;
+  if (frame == nullptr) {
+    const auto stride = context_block::frame_stride(size);
+    const auto capacity = std::size_t{RESULT_CONTEXT_ARENA_BLOCK_SIZE};
+    auto* const block = context_block::create(stride > capacity ? stride : capacity);
+
+    if (m_block != nullptr) {
+      m_block->release();
+    }
+    m_block = block;
+    frame = m_block->allocate(previous, pieces, count, size);
+  }
+  return frame;
+}
+
+//=============================================================================
+// class : error_context
+//=============================================================================
+
+inline
+RESULT_NS_IMPL::error_context::iterator::iterator(const detail::context_frame* frame)
+  noexcept
+  : m_frame{frame}
+{
+
+}
+
+inline
+auto RESULT_NS_IMPL::error_context::iterator::operator*()
+  const noexcept -> const char*
+{
+  return m_frame->message();
+}
+
+inline
+auto RESULT_NS_IMPL::error_context::iterator::operator++()
+  noexcept -> iterator&
+{
+  m_frame = m_frame->previous;
+  return (*this);
+}
+
+inline
+auto RESULT_NS_IMPL::error_context::iterator::operator++(int)
+  noexcept -> iterator
+{
+  const auto copy = *this;
+  ++(*this);
+  return copy;
+}
+
+inline
+RESULT_NS_IMPL::error_context::error_context(const detail::context_frame* frame)
+  noexcept
+  : m_frame{frame}
+{
+
+}
+
+inline
+auto RESULT_NS_IMPL::error_context::begin()
+  const noexcept -> iterator
+{
+  return iterator{m_frame};
+}
+
+inline
+auto RESULT_NS_IMPL::error_context::end()
+  const noexcept -> iterator
+{
+  return iterator{};
+}
+
+inline
+auto RESULT_NS_IMPL::error_context::empty()
+  const noexcept -> bool
+{
+  return m_frame == nullptr;
+}
+
+inline
+auto RESULT_NS_IMPL::error_context::to_string(const char* separator)
+  const -> std::string
+{
+  const auto separator_size = std::strlen(separator);
+
+  auto size = std::size_t{0u};
+  for (auto* frame = m_frame; frame != nullptr; frame = frame->previous) {
+    size += frame->size + (frame != m_frame ? separator_size : 0u);
+  }
+
+  auto out = std::string{};
+  out.reserve(size);
+  for (auto* frame = m_frame; frame != nullptr; frame = frame->previous) {
+    if (frame != m_frame) {
+      out.append(separator, separator_size);
+    }
+    out.append(frame->message(), frame->size);
+  }
+  return out;
+}
+
+//=============================================================================
+// class : contextual_error<E>
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors / Destructor / Assignment
+//-----------------------------------------------------------------------------
+
+template <typename E>
+template <typename U, typename>
+inline
+RESULT_NS_IMPL::contextual_error<E>::contextual_error()
+  noexcept(std::is_nothrow_default_constructible<E>::value)
+  : m_error(),
+    m_frame{nullptr}
+{
+
+}
+
+template <typename E>
+inline
+RESULT_NS_IMPL::contextual_error<E>::contextual_error(const E& error)
+  noexcept(std::is_nothrow_copy_constructible<E>::value)
+  : m_error(error),
+    m_frame{nullptr}
+{
+
+}
+
+template <typename E>
+inline
+RESULT_NS_IMPL::contextual_error<E>::contextual_error(E&& error)
+  noexcept(std::is_nothrow_move_constructible<E>::value)
+  : m_error(static_cast<E&&>(error)),
+    m_frame{nullptr}
+{
+
+}
+
+template <typename E>
+template <typename...Args>
+inline
+RESULT_NS_IMPL::contextual_error<E>::contextual_error(in_place_t, Args&&...args)
+  noexcept(std::is_nothrow_constructible<E,Args...>::value)
+  : m_error(detail::forward<Args>(args)...),
+    m_frame{nullptr}
+{
+
+}
+
+template <typename E>
+inline
+RESULT_NS_IMPL::contextual_error<E>::contextual_error(const contextual_error& other)
+  noexcept(std::is_nothrow_copy_constructible<E>::value)
+  : m_error(other.m_error),
+    m_frame{other.m_frame}
+{
+  if (m_frame != nullptr) {
+    m_frame->block->acquire();
+  }
+}
+
+template <typename E>
+inline
+RESULT_NS_IMPL::contextual_error<E>::contextual_error(contextual_error&& other)
+  noexcept(std::is_nothrow_move_constructible<E>::value)
+  : m_error(static_cast<E&&>(other.m_error)),
+    m_frame{other.m_frame}
+{
+  other.m_frame = nullptr;
+}
+
+template <typename E>
+inline
+RESULT_NS_IMPL::contextual_error<E>::~contextual_error()
+{
+  clear_context();
+}
+
+template <typename E>
+inline
+auto RESULT_NS_IMPL::contextual_error<E>::operator=(const contextual_error& other)
+  noexcept(std::is_nothrow_copy_assignable<E>::value) -> contextual_error&
+{
+  m_error = other.m_error;
+  if (other.m_frame != nullptr) {
+    other.m_frame->block->acquire();
+  }
+  clear_context();
+  m_frame = other.m_frame;
+
+  return (*this);
+}
+
+template <typename E>
+inline
+auto RESULT_NS_IMPL::contextual_error<E>::operator=(contextual_error&& other)
+  noexcept(std::is_nothrow_move_assignable<E>::value) -> contextual_error&
+{
+  m_error = static_cast<E&&>(other.m_error);
+  if (this != &other) {
+    clear_context();
+    m_frame = other.m_frame;
+    other.m_frame = nullptr;
+  }
+
+  return (*this);
+}
+
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
+
+template <typename E>
+inline
+auto RESULT_NS_IMPL::contextual_error<E>::error()
+  & noexcept -> E&
+{
+  return m_error;
+}
+
+template <typename E>
+inline
+auto RESULT_NS_IMPL::contextual_error<E>::error()
+  && noexcept -> E&&
+{
+  return static_cast<E&&>(m_error);
+}
+
+template <typename E>
+inline
+auto RESULT_NS_IMPL::contextual_error<E>::error()
+  const & noexcept -> const E&
+{
+  return m_error;
+}
+
+template <typename E>
+inline
+auto RESULT_NS_IMPL::contextual_error<E>::context()
+  const noexcept -> error_context
+{
+  return error_context{m_frame};
+}
+
+//-----------------------------------------------------------------------------
+// Modifiers
+//-----------------------------------------------------------------------------
+
+template <typename E>
+template <typename Piece, typename...Pieces>
+inline
+auto RESULT_NS_IMPL::contextual_error<E>::add_context(const Piece& piece,
+                                                      const Pieces&...pieces)
+  -> void
+{
+  const context_piece parts[] = {context_piece(piece), context_piece(pieces)...};
+
+  const auto* const frame = detail::context_arena::local().push(
+    m_frame, parts, sizeof(parts) / sizeof(parts[0])
+  );
+
+  // The reference held on the previous block, if any, now belongs to the
+  // new frame whenever the two differ
+  if (m_frame == nullptr || m_frame->block != frame->block) {
+    frame->block->acquire();
+  }
+  m_frame = frame;
+}
+
+template <typename E>
+inline
+auto RESULT_NS_IMPL::contextual_error<E>::clear_context()
+  noexcept -> void
+{
+  if (m_frame != nullptr) {
+    m_frame->block->release();
+    m_frame = nullptr;
+  }
+}
+
+template <typename E>
+inline
+auto RESULT_NS_IMPL::contextual_error<E>::swap(contextual_error& other)
+  -> void
+{
+  using std::swap;
+
+  swap(m_error, other.m_error);
+  swap(m_frame, other.m_frame);
+}
+
+//=============================================================================
+// non-member functions : class : contextual_error<E>
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Comparison
+//-----------------------------------------------------------------------------
+
+template <typename E1, typename E2>
+inline
+auto RESULT_NS_IMPL::operator==(const contextual_error<E1>& lhs,
+                                const contextual_error<E2>& rhs)
+  -> bool
+{
+  return lhs.error() == rhs.error();
+}
+
+template <typename E1, typename E2>
+inline
+auto RESULT_NS_IMPL::operator!=(const contextual_error<E1>& lhs,
+                                const contextual_error<E2>& rhs)
+  -> bool
+{
+  return lhs.error() != rhs.error();
+}
+
+template <typename E, typename U, typename>
+inline
+auto RESULT_NS_IMPL::operator==(const contextual_error<E>& lhs, const U& rhs)
+  -> bool
+{
+  return lhs.error() == rhs;
+}
+
+template <typename E, typename U, typename>
+inline
+auto RESULT_NS_IMPL::operator==(const U& lhs, const contextual_error<E>& rhs)
+  -> bool
+{
+  return lhs == rhs.error();
+}
+
+template <typename E, typename U, typename>
+inline
+auto RESULT_NS_IMPL::operator!=(const contextual_error<E>& lhs, const U& rhs)
+  -> bool
+{
+  return lhs.error() != rhs;
+}
+
+template <typename E, typename U, typename>
+inline
+auto RESULT_NS_IMPL::operator!=(const U& lhs, const contextual_error<E>& rhs)
+  -> bool
+{
+  return lhs != rhs.error();
+}
+
+//-----------------------------------------------------------------------------
+// Utilities
+//-----------------------------------------------------------------------------
+
+template <typename E>
+inline
+auto RESULT_NS_IMPL::swap(contextual_error<E>& lhs, contextual_error<E>& rhs)
+  -> void
+{
+  lhs.swap(rhs);
+}
+
+//=============================================================================
+// utilities : with_context
+//=============================================================================
+
+template <typename T, typename E, typename Piece, typename...Pieces>
+inline
+auto RESULT_NS_IMPL::with_context(const result<T,contextual_error<E>>& r,
+                                  const Piece& piece, const Pieces&...pieces)
+  -> result<T,contextual_error<E>>
+{
+  if (r.has_value()) {
+    return r;
+  }
+  auto error = detail::result_error_extractor::get(r);
+  error.add_context(piece, pieces...);
+
+  return detail::result_error_extractor::propagate<result<T,contextual_error<E>>>(
+    std::move(error)
+  );
+}
+
+template <typename T, typename E, typename Piece, typename...Pieces>
+inline
+auto RESULT_NS_IMPL::with_context(result<T,contextual_error<E>>&& r,
+                                  const Piece& piece, const Pieces&...pieces)
+  -> result<T,contextual_error<E>>
+{
+  if (r.has_value()) {
+    return static_cast<result<T,contextual_error<E>>&&>(r);
+  }
+  auto error = contextual_error<E>{
+    detail::result_error_extractor::take(static_cast<result<T,contextual_error<E>>&&>(r))
+  };
+  error.add_context(piece, pieces...);
+
+  return detail::result_error_extractor::propagate<result<T,contextual_error<E>>>(
+    std::move(error)
+  );
+}
+
+template <typename T, typename E, typename Piece, typename...Pieces, typename>
+inline
+auto RESULT_NS_IMPL::with_context(const result<T,E>& r,
+                                  const Piece& piece, const Pieces&...pieces)
+  -> result<T,contextual_error<E>>
+{
+  if (r.has_value()) {
+    return result<T,contextual_error<E>>{r};
+  }
+  auto error = contextual_error<E>{detail::result_error_extractor::get(r)};
+  error.add_context(piece, pieces...);
+
+  return detail::result_error_extractor::propagate<result<T,contextual_error<E>>>(
+    std::move(error)
+  );
+}
+
+template <typename T, typename E, typename Piece, typename...Pieces, typename>
+inline
+auto RESULT_NS_IMPL::with_context(result<T,E>&& r,
+                                  const Piece& piece, const Pieces&...pieces)
+  -> result<T,contextual_error<E>>
+{
+  if (r.has_value()) {
+    return result<T,contextual_error<E>>{static_cast<result<T,E>&&>(r)};
+  }
+  auto error = contextual_error<E>{
+    detail::result_error_extractor::take(static_cast<result<T,E>&&>(r))
+  };
+  error.add_context(piece, pieces...);
+
+  return detail::result_error_extractor::propagate<result<T,contextual_error<E>>>(
+    std::move(error)
+  );
+}
+
+#undef RESULT_NAMESPACE_INTERNAL
+#undef RESULT_NS_IMPL
+
+#endif /* RESULT_RESULT_CONTEXT_HPP */
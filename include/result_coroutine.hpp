@@ -0,0 +1,540 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file result_coroutine.hpp
+///
+/// \brief This header enables 'result' objects to be used as the return type
+///        of C++20 coroutines, where 'co_await' propagates errors
+////////////////////////////////////////////////////////////////////////////////
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2017-2021 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef RESULT_RESULT_COROUTINE_HPP
+#define RESULT_RESULT_COROUTINE_HPP
+
+#include "result.hpp"
+
+#include <cstddef>     // std::size_t, std::max_align_t
+#include <new>         // ::operator new, ::operator delete, placement-new
+#include <type_traits> // std::is_lvalue_reference, std::decay
+#include <utility>     // std::move
+
+#if __cplusplus >= 202002L && defined(__has_include)
+# if __has_include(<coroutine>)
+#   include <coroutine> // std::coroutine_traits, std::coroutine_handle
+# endif
+#endif
+
+// Coroutine support relies on the conversion from the object returned by
+// 'get_return_object()' to 'result' being delayed until the coroutine first
+// returns to its caller, which is what GCC and Clang (16+) do when the types
+// differ. MSVC and older Clang perform this conversion eagerly, and are not
+// supported.
+#if defined(__cpp_impl_coroutine) && defined(__cpp_lib_coroutine) && \
+    !(defined(_MSC_VER) && !defined(__clang__)) && \
+    (!defined(__clang__) || __clang_major__ >= 16)
+# define RESULT_HAS_COROUTINES 1
+#else
+# define RESULT_HAS_COROUTINES 0
+#endif
+
+#if !defined(RESULT_COROUTINE_FRAME_ARENA_SIZE)
+/// \brief The number of bytes reserved per-thread for result coroutine
+///        frames before falling back to the global allocator
+# define RESULT_COROUTINE_FRAME_ARENA_SIZE 16384
+#endif
+
+#if RESULT_HAS_COROUTINES
+
+#if defined(RESULT_NAMESPACE)
+# define RESULT_NAMESPACE_INTERNAL RESULT_NAMESPACE
+#else
+# define RESULT_NAMESPACE_INTERNAL cpp
+#endif
+#define RESULT_NS_IMPL RESULT_NAMESPACE_INTERNAL::bitwizeshift
+
+namespace RESULT_NAMESPACE_INTERNAL {
+inline namespace bitwizeshift {
+  namespace detail {
+
+    //=========================================================================
+    // class : coroutine_frame_arena
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A per-thread stack allocator for result coroutine frames
+    ///
+    /// A result coroutine never suspends without also being destroyed, so it
+    /// always completes before control returns to its caller. Frames are
+    /// therefore created and destroyed in strict LIFO order on a single
+    /// thread, which allows them to be bump-allocated from a thread-local
+    /// buffer. This removes the heap allocation for the frame regardless of
+    /// whether the compiler is able to elide it.
+    ///
+    /// Frames that do not fit in the remaining buffer are allocated with the
+    /// global allocator instead.
+    ///////////////////////////////////////////////////////////////////////////
+    class coroutine_frame_arena
+    {
+      //-----------------------------------------------------------------------
+      // Static Members
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the arena for the current thread
+      static auto local() noexcept -> coroutine_frame_arena&;
+
+      //-----------------------------------------------------------------------
+      // Constructors / Destructor
+      //-----------------------------------------------------------------------
+    public:
+
+      coroutine_frame_arena() = default;
+      coroutine_frame_arena(const coroutine_frame_arena&) = delete;
+      ~coroutine_frame_arena();
+
+      auto operator=(const coroutine_frame_arena&) -> coroutine_frame_arena& = delete;
+
+      //-----------------------------------------------------------------------
+      // Allocation
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Allocates \p size bytes for a coroutine frame
+      auto allocate(std::size_t size) -> void*;
+
+      /// \brief Deallocates the most recently allocated frame \p p
+      auto deallocate(void* p, std::size_t size) noexcept -> void;
+
+      //-----------------------------------------------------------------------
+      // Private Static Members
+      //-----------------------------------------------------------------------
+    private:
+
+      static constexpr std::size_t capacity = RESULT_COROUTINE_FRAME_ARENA_SIZE;
+      static constexpr std::size_t alignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+      static constexpr auto align(std::size_t size) noexcept -> std::size_t
+      {
+        return (size + alignment - 1u) & ~(alignment - 1u);
+      }
+
+      //-----------------------------------------------------------------------
+      // Private Members
+      //-----------------------------------------------------------------------
+    private:
+
+      unsigned char* m_buffer = nullptr; ///< lazily allocated once per thread
+      std::size_t m_top = 0u;
+    };
+
+    template <typename T, typename E>
+    class result_promise;
+
+    //=========================================================================
+    // class : result_return_object<T, E>
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief The object returned from `get_return_object()`, which owns the
+    ///        storage that the coroutine writes its result into
+    ///
+    /// The conversion to `result<T,E>` is only performed once the coroutine
+    /// has returned to its caller, at which point the result has always been
+    /// written.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename E>
+    class result_return_object
+    {
+    public:
+
+      explicit result_return_object(result_promise<T,E>& promise) noexcept;
+      result_return_object(result_return_object&& other) noexcept;
+      result_return_object(const result_return_object&) = delete;
+      ~result_return_object();
+
+      auto operator=(const result_return_object&) -> result_return_object& = delete;
+
+      //-----------------------------------------------------------------------
+
+      template <typename...Args>
+      auto emplace(Args&&...args) -> void;
+
+      operator result<T,E>();
+
+      //-----------------------------------------------------------------------
+      // Private Members
+      //-----------------------------------------------------------------------
+    private:
+
+      union {
+        result<T,E> m_result;
+      };
+      bool m_has_result;
+      result_promise<T,E>* m_promise;
+    };
+
+    //=========================================================================
+    // class : result_awaiter_value<R>
+    //=========================================================================
+
+    /// \brief Extracts the value that a `co_await` expression on the result
+    ///        \p R produces
+    ///
+    /// Values of lvalue results are referenced, and values of rvalue results
+    /// are moved out, since the rvalue does not outlive the `co_await`
+    /// expression.
+    template <typename R, typename T = typename std::decay<R>::type::value_type>
+    struct result_awaiter_value
+    {
+      using type = typename std::conditional<
+        std::is_lvalue_reference<R>::value,
+        decltype(*std::declval<R>()),
+        T
+      >::type;
+
+      static auto get(R r) -> type
+      {
+        return static_cast<type>(*static_cast<R>(r));
+      }
+    };
+
+    template <typename R>
+    struct result_awaiter_value<R, void>
+    {
+      using type = void;
+
+      static auto get(R) noexcept -> void {}
+    };
+
+    //=========================================================================
+    // class : result_awaiter<R>
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief The awaiter produced by `co_await`-ing a result
+    ///
+    /// If the result contains an error, the error is written to the awaiting
+    /// coroutine's return object and the coroutine is destroyed without being
+    /// resumed.
+    ///
+    /// \tparam R a reference to the awaited result
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename R>
+    class result_awaiter
+    {
+      using resume_type = typename result_awaiter_value<R>::type;
+
+    public:
+
+      explicit result_awaiter(R r) noexcept
+        : m_result{static_cast<R>(r)}
+      {
+      }
+
+      //-----------------------------------------------------------------------
+
+      auto await_ready() const noexcept -> bool
+      {
+        return m_result.has_value();
+      }
+
+      template <typename T, typename E>
+      auto await_suspend(std::coroutine_handle<result_promise<T,E>> handle)
+        -> void
+      {
+        handle.promise().return_error(static_cast<R>(m_result).error());
+        handle.destroy();
+      }
+
+      auto await_resume() -> resume_type
+      {
+        return result_awaiter_value<R>::get(static_cast<R>(m_result));
+      }
+
+      //-----------------------------------------------------------------------
+      // Private Members
+      //-----------------------------------------------------------------------
+    private:
+
+      R m_result;
+    };
+
+    //=========================================================================
+    // class : result_promise_base<T, E>
+    //=========================================================================
+
+    template <typename T, typename E>
+    class result_promise_base
+    {
+    public:
+
+      template <typename...Args>
+      auto emplace(Args&&...args) -> void
+      {
+        m_return->emplace(detail::forward<Args>(args)...);
+      }
+
+      template <typename E2>
+      auto return_error(E2&& error) -> void
+      {
+        emplace(result_error_extractor::propagate<result<T,E>>(
+          detail::forward<E2>(error)
+        ));
+      }
+
+    private:
+
+      friend class result_return_object<T,E>;
+
+      result_return_object<T,E>* m_return = nullptr;
+    };
+
+    //=========================================================================
+    // class : result_promise_return<T, E>
+    //=========================================================================
+
+    /// \brief Provides 'return_value' or 'return_void', since a promise may
+    ///        only define one of the two
+    template <typename T, typename E>
+    class result_promise_return : public result_promise_base<T,E>
+    {
+    public:
+
+      template <typename U = T,
+                typename = typename std::enable_if<std::is_constructible<result<T,E>,U&&>::value>::type>
+      auto return_value(U&& value) -> void
+      {
+        this->emplace(detail::forward<U>(value));
+      }
+    };
+
+    template <typename E>
+    class result_promise_return<void,E> : public result_promise_base<void,E>
+    {
+    public:
+
+      auto return_void() -> void
+      {
+        this->emplace();
+      }
+    };
+
+    //=========================================================================
+    // class : result_promise<T, E>
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief The promise type of a coroutine returning `result<T,E>`
+    ///
+    /// The coroutine runs eagerly to completion, and only results may be
+    /// `co_await`-ed within it.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename E>
+    class result_promise : public result_promise_return<T,E>
+    {
+    public:
+
+      static auto operator new(std::size_t size) -> void*
+      {
+        return coroutine_frame_arena::local().allocate(size);
+      }
+
+      static auto operator delete(void* p, std::size_t size) noexcept -> void
+      {
+        coroutine_frame_arena::local().deallocate(p, size);
+      }
+
+      //-----------------------------------------------------------------------
+
+      auto get_return_object() noexcept -> result_return_object<T,E>
+      {
+        return result_return_object<T,E>{*this};
+      }
+
+      auto initial_suspend() const noexcept -> std::suspend_never { return {}; }
+      auto final_suspend() const noexcept -> std::suspend_never { return {}; }
+
+      [[noreturn]]
+      auto unhandled_exception() -> void
+      {
+        throw;
+      }
+
+      //-----------------------------------------------------------------------
+
+      template <typename U, typename E2,
+                typename = typename std::enable_if<std::is_constructible<E,const E2&>::value>::type>
+      auto await_transform(const result<U,E2>& r) noexcept
+        -> result_awaiter<const result<U,E2>&>
+      {
+        return result_awaiter<const result<U,E2>&>{r};
+      }
+
+      template <typename U, typename E2,
+                typename = typename std::enable_if<std::is_constructible<E,E2&&>::value>::type>
+      auto await_transform(result<U,E2>&& r) noexcept
+        -> result_awaiter<result<U,E2>&&>
+      {
+        return result_awaiter<result<U,E2>&&>{static_cast<result<U,E2>&&>(r)};
+      }
+    };
+
+  } // namespace detail
+} // inline namespace bitwizeshift
+} // namespace RESULT_NAMESPACE_INTERNAL
+
+//=============================================================================
+// struct : std::coroutine_traits<result<T,E>, Args...>
+//=============================================================================
+
+/// \brief Enables `result<T,E>` to be used as the return type of a coroutine
+///
+/// ### Examples
+///
+/// Basic Usage:
+///
+/// ```cpp
+/// auto parse(const std::string& s) -> cpp::result<int,std::errc>;
+///
+/// auto sum(const std::string& a, const std::string& b)
+///   -> cpp::result<int,std::errc>
+/// {
+///   auto x = co_await parse(a); // returns the error if parsing fails
+///   auto y = co_await parse(b);
+///   co_return x + y;
+/// }
+/// ```
+template <typename T, typename E, typename...Args>
+struct std::coroutine_traits<RESULT_NS_IMPL::result<T,E>, Args...>
+{
+  using promise_type = RESULT_NS_IMPL::detail::result_promise<T,E>;
+};
+
+//=============================================================================
+// class : coroutine_frame_arena
+//=============================================================================
+
+inline
+auto RESULT_NS_IMPL::detail::coroutine_frame_arena::local()
+  noexcept -> coroutine_frame_arena&
+{
+  thread_local auto arena = coroutine_frame_arena{};
+
+  return arena;
+}
+
+inline
+RESULT_NS_IMPL::detail::coroutine_frame_arena::~coroutine_frame_arena()
+{
+  ::operator delete(m_buffer);
+}
+
+inline
+auto RESULT_NS_IMPL::detail::coroutine_frame_arena::allocate(std::size_t size)
+  -> void*
+{
+  const auto aligned_size = align(size);
+
+  if (m_buffer == nullptr) {
+    m_buffer = static_cast<unsigned char*>(::operator new(capacity));
+  }
+  if (capacity - m_top < aligned_size) {
+    return ::operator new(size);
+  }
+
+  auto* const p = m_buffer + m_top;
+  m_top += aligned_size;
+  return p;
+}
+
+inline
+auto RESULT_NS_IMPL::detail::coroutine_frame_arena::deallocate(void* p, std::size_t size)
+  noexcept -> void
+{
+  auto* const bytes = static_cast<unsigned char*>(p);
+
+  if (m_buffer == nullptr || bytes < m_buffer || bytes >= m_buffer + capacity) {
+    ::operator delete(p, size);
+    return;
+  }
+  m_top = static_cast<std::size_t>(bytes - m_buffer);
+}
+
+//=============================================================================
+// class : result_return_object<T, E>
+//=============================================================================
+
+template <typename T, typename E>
+inline
+RESULT_NS_IMPL::detail::result_return_object<T,E>::result_return_object(
+  result_promise<T,E>& promise
+) noexcept
+  : m_has_result{false},
+    m_promise{&promise}
+{
+  m_promise->m_return = this;
+}
+
+template <typename T, typename E>
+inline
+RESULT_NS_IMPL::detail::result_return_object<T,E>::result_return_object(
+  result_return_object&& other
+) noexcept
+  : result_return_object{*other.m_promise}
+{
+  // The return object may only be moved before the coroutine has started
+  // writing to it
+}
+
+template <typename T, typename E>
+inline
+RESULT_NS_IMPL::detail::result_return_object<T,E>::~result_return_object()
+{
+  if (m_has_result) {
+    m_result.~result<T,E>();
+  }
+}
+
+template <typename T, typename E>
+template <typename...Args>
+inline
+auto RESULT_NS_IMPL::detail::result_return_object<T,E>::emplace(Args&&...args)
+  -> void
+{
+  ::new (static_cast<void*>(&m_result)) result<T,E>(detail::forward<Args>(args)...);
+  m_has_result = true;
+}
+
+template <typename T, typename E>
+inline
+RESULT_NS_IMPL::detail::result_return_object<T,E>::operator result<T,E>()
+{
+  return static_cast<result<T,E>&&>(m_result);
+}
+
+#undef RESULT_NAMESPACE_INTERNAL
+#undef RESULT_NS_IMPL
+
+#endif // RESULT_HAS_COROUTINES
+
+#endif /* RESULT_RESULT_COROUTINE_HPP */
@@ -0,0 +1,288 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file result_lazy.hpp
+///
+/// \brief This header provides a thread-safe cache for a result that is
+///        computed on first use
+////////////////////////////////////////////////////////////////////////////////
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020-2021 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef RESULT_RESULT_LAZY_HPP
+#define RESULT_RESULT_LAZY_HPP
+
+#include "result.hpp"
+
+#include <atomic>      // std::atomic, std::memory_order
+#include <mutex>       // std::mutex, std::lock_guard
+#include <type_traits> // std::is_object, std::is_convertible
+#include <utility>     // std::move, std::forward
+
+#if defined(RESULT_NAMESPACE)
+# define RESULT_NAMESPACE_INTERNAL RESULT_NAMESPACE
+#else
+# define RESULT_NAMESPACE_INTERNAL cpp
+#endif
+#define RESULT_NS_IMPL RESULT_NAMESPACE_INTERNAL::bitwizeshift
+
+namespace RESULT_NAMESPACE_INTERNAL {
+inline namespace bitwizeshift {
+
+  //===========================================================================
+  // enum : lazy_error_policy
+  //===========================================================================
+
+  /////////////////////////////////////////////////////////////////////////////
+  /// \brief Determines what a `lazy_result` does when its initializer
+  ///        produces an error
+  /////////////////////////////////////////////////////////////////////////////
+  enum class lazy_error_policy
+  {
+    cache, ///< The error is cached, and returned by every later call
+    retry, ///< The error is returned, and the next call runs the initializer
+  };
+
+  //===========================================================================
+  // class : lazy_result<T, E, Policy>
+  //===========================================================================
+
+  /////////////////////////////////////////////////////////////////////////////
+  /// \brief A `result<T,E>` that is computed by the first call that needs it
+  ///        and is cached for every call after
+  ///
+  /// The initializer is run at most once at a time; concurrent callers wait
+  /// for it to finish rather than running it themselves. Once a result has
+  /// been published, reading it is a single acquire load and no lock is
+  /// taken.
+  ///
+  /// Values are returned as `result<const T&,E>` views of the cached value,
+  /// so readers never copy it. Errors are returned by copy. Whether an error
+  /// is cached is chosen by \p Policy; with `lazy_error_policy::retry`, each
+  /// call that finds no cached value runs the initializer again until it
+  /// succeeds. If the initializer throws, nothing is cached, and the
+  /// exception propagates to the caller.
+  ///
+  /// The default constructor is `constexpr`, so that a `lazy_result` with
+  /// static storage duration is constant-initialized.
+  ///
+  /// ### Examples
+  ///
+  /// Basic Usage:
+  ///
+  /// ```cpp
+  /// auto tls_context() -> cpp::result<const context&,std::error_code>
+  /// {
+  ///   static cpp::lazy_result<context,std::error_code> s_context;
+  ///
+  ///   return s_context.get_or_init([]{ return load_context("certs/"); });
+  /// }
+  /// ```
+  ///
+  /// \tparam T the value type
+  /// \tparam E the error type
+  /// \tparam Policy whether errors are cached, or retried on the next call
+  /////////////////////////////////////////////////////////////////////////////
+  template <typename T, typename E,
+            lazy_error_policy Policy = lazy_error_policy::cache>
+  class lazy_result
+  {
+    static_assert(
+      std::is_object<T>::value,
+      "lazy_result requires T to be an object type"
+    );
+
+    //-------------------------------------------------------------------------
+    // Public Member Types
+    //-------------------------------------------------------------------------
+  public:
+
+    using value_type = T;
+    using error_type = E;
+
+    /// \brief The type of the view returned to readers
+    using view_type = result<const T&,E>;
+
+    //-------------------------------------------------------------------------
+    // Constructors / Destructor / Assignment
+    //-------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs a lazy_result that has not been initialized
+    constexpr lazy_result() noexcept;
+
+    lazy_result(const lazy_result&) = delete;
+
+    ~lazy_result();
+
+    auto operator=(const lazy_result&) -> lazy_result& = delete;
+
+    //-------------------------------------------------------------------------
+    // Observers
+    //-------------------------------------------------------------------------
+  public:
+
+    /// \brief Gets the cached result, running \p initializer to compute it
+    ///        if it has not been computed yet
+    ///
+    /// \param initializer a function returning a type convertible to
+    ///        `result<T,E>`
+    /// \return a view of the cached value, or the error
+    template <typename Fn>
+    auto get_or_init(Fn&& initializer) -> view_type;
+
+    /// \brief Queries whether a value has been cached
+    ///
+    /// \return `true` if a value has been cached
+    auto has_value() const noexcept -> bool;
+
+    //-------------------------------------------------------------------------
+    // Private Member Types
+    //-------------------------------------------------------------------------
+  private:
+
+    enum class state : unsigned char
+    {
+      empty,
+      value,
+      error,
+    };
+
+    //-------------------------------------------------------------------------
+    // Private Observers
+    //-------------------------------------------------------------------------
+  private:
+
+    auto view() const -> view_type;
+
+    //-------------------------------------------------------------------------
+    // Private Members
+    //-------------------------------------------------------------------------
+  private:
+
+    std::atomic<state> m_state;
+    std::mutex m_mutex;
+
+    union {
+      detail::unit m_empty;
+      result<T,E> m_result;
+    };
+  };
+
+} // inline namespace bitwizeshift
+} // namespace RESULT_NAMESPACE_INTERNAL
+
+//=============================================================================
+// class : lazy_result<T, E, Policy>
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors / Destructor / Assignment
+//-----------------------------------------------------------------------------
+
+template <typename T, typename E, RESULT_NS_IMPL::lazy_error_policy Policy>
+inline constexpr
+RESULT_NS_IMPL::lazy_result<T,E,Policy>::lazy_result()
+  noexcept
+  : m_state{state::empty},
+    m_mutex{},
+    m_empty{}
+{
+
+}
+
+template <typename T, typename E, RESULT_NS_IMPL::lazy_error_policy Policy>
+inline
+RESULT_NS_IMPL::lazy_result<T,E,Policy>::~lazy_result()
+{
+  if (m_state.load(std::memory_order_relaxed) != state::empty) {
+    m_result.~result();
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
+
+template <typename T, typename E, RESULT_NS_IMPL::lazy_error_policy Policy>
+template <typename Fn>
+inline
+auto RESULT_NS_IMPL::lazy_result<T,E,Policy>::get_or_init(Fn&& initializer)
+  -> view_type
+{
+  static_assert(
+    std::is_convertible<detail::invoke_result_t<Fn>,result<T,E>>::value,
+    "the initializer of a lazy_result must return a type convertible to "
+    "result<T,E>"
+  );
+
+  // Errors are only ever published with the cache policy, so the state alone
+  // determines whether a result can be read without the lock
+  if (m_state.load(std::memory_order_acquire) != state::empty) {
+    return view();
+  }
+
+  std::lock_guard<std::mutex> lock{m_mutex};
+  if (m_state.load(std::memory_order_relaxed) != state::empty) {
+    return view();
+  }
+
+  auto r = result<T,E>(detail::invoke(detail::forward<Fn>(initializer)));
+  if (Policy == lazy_error_policy::retry && r.has_error()) {
+    return detail::result_error_extractor::propagate<view_type>(std::move(r).error());
+  }
+
+  detail::construct_at(&m_result, std::move(r));
+  m_state.store(
+    m_result.has_value() ? state::value : state::error,
+    std::memory_order_release
+  );
+  return view();
+}
+
+template <typename T, typename E, RESULT_NS_IMPL::lazy_error_policy Policy>
+inline
+auto RESULT_NS_IMPL::lazy_result<T,E,Policy>::has_value()
+  const noexcept -> bool
+{
+  return m_state.load(std::memory_order_acquire) == state::value;
+}
+
+//-----------------------------------------------------------------------------
+// Private Observers
+//-----------------------------------------------------------------------------
+
+template <typename T, typename E, RESULT_NS_IMPL::lazy_error_policy Policy>
+inline
+auto RESULT_NS_IMPL::lazy_result<T,E,Policy>::view()
+  const -> view_type
+{
+  if (m_result.has_value()) {
+    return view_type{*m_result};
+  }
+  return detail::result_error_extractor::propagate<view_type>(m_result.error());
+}
+
+#undef RESULT_NAMESPACE_INTERNAL
+#undef RESULT_NS_IMPL
+
+#endif /* RESULT_RESULT_LAZY_HPP */
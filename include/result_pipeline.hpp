@@ -0,0 +1,860 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file result_pipeline.hpp
+///
+/// \brief This header contains lazy, fused pipelines of monadic operations
+///        on `result` objects
+////////////////////////////////////////////////////////////////////////////////
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2017-2021 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef RESULT_RESULT_PIPELINE_HPP
+#define RESULT_RESULT_PIPELINE_HPP
+
+#include "result.hpp"
+
+#include <type_traits> // std::enable_if, std::decay, std::is_same
+#include <utility>     // std::move
+
+#if defined(RESULT_NAMESPACE)
+# define RESULT_NAMESPACE_INTERNAL RESULT_NAMESPACE
+#else
+# define RESULT_NAMESPACE_INTERNAL cpp
+#endif
+#define RESULT_NS_IMPL RESULT_NAMESPACE_INTERNAL::bitwizeshift
+
+namespace RESULT_NAMESPACE_INTERNAL {
+inline namespace bitwizeshift {
+namespace pipeline {
+
+  //===========================================================================
+  // stages
+  //===========================================================================
+
+  /// \brief A stage that transforms the value; see `pipeline::map`
+  template <typename Fn>
+  struct map_stage { Fn fn; };
+
+  /// \brief A stage that transforms the value into a new result; see
+  ///        `pipeline::flat_map`
+  template <typename Fn>
+  struct flat_map_stage { Fn fn; };
+
+  /// \brief A stage that transforms the error; see `pipeline::map_error`
+  template <typename Fn>
+  struct map_error_stage { Fn fn; };
+
+  /// \brief A stage that transforms the error into a new result; see
+  ///        `pipeline::flat_map_error`
+  template <typename Fn>
+  struct flat_map_error_stage { Fn fn; };
+
+  /// \brief The terminal stage that evaluates a pipeline; see
+  ///        `pipeline::collect`
+  struct collect_stage {};
+
+  /// \brief Trait to determine whether \p T is a non-terminal pipeline stage
+  template <typename T>
+  struct is_stage : std::false_type{};
+
+  template <typename Fn>
+  struct is_stage<map_stage<Fn>> : std::true_type{};
+  template <typename Fn>
+  struct is_stage<flat_map_stage<Fn>> : std::true_type{};
+  template <typename Fn>
+  struct is_stage<map_error_stage<Fn>> : std::true_type{};
+  template <typename Fn>
+  struct is_stage<flat_map_error_stage<Fn>> : std::true_type{};
+
+  template <typename Source, typename Stage>
+  class expression;
+
+} // namespace pipeline
+
+  namespace detail {
+
+    //=========================================================================
+    // utilities : pipeline traits
+    //=========================================================================
+
+    /// \brief The result of invoking \p Fn with an argument of type \p Arg,
+    ///        or with no arguments if \p Arg is `void`
+    template <typename Fn, typename Arg>
+    struct pipeline_invoke_result
+    {
+      using type = invoke_result_t<Fn, Arg>;
+    };
+
+    template <typename Fn>
+    struct pipeline_invoke_result<Fn, void>
+    {
+      using type = invoke_result_t<Fn>;
+    };
+
+    template <typename Fn, typename Arg>
+    using pipeline_invoke_result_t = typename pipeline_invoke_result<Fn,Arg>::type;
+
+    template <typename Result, bool = std::is_void<
+      typename std::decay<Result>::type::value_type
+    >::value>
+    struct pipeline_dereference
+    {
+      using type = decltype(*std::declval<Result>());
+    };
+
+    template <typename Result>
+    struct pipeline_dereference<Result, true>
+    {
+      using type = void;
+    };
+
+    //=========================================================================
+    // utilities : pipeline_forward_result
+    //=========================================================================
+
+    template <typename Sink, typename Result>
+    inline auto pipeline_forward_value(std::true_type, Sink& sink, Result&&)
+      -> typename Sink::result_type
+    {
+      return sink.on_value();
+    }
+
+    template <typename Sink, typename Result>
+    inline auto pipeline_forward_value(std::false_type, Sink& sink, Result&& r)
+      -> typename Sink::result_type
+    {
+      return sink.on_value(*static_cast<Result&&>(r));
+    }
+
+    /// \brief Forwards the value or error of the rvalue result \p r to
+    ///        \p sink
+    template <typename Sink, typename Result>
+    inline auto pipeline_forward_result(Sink& sink, Result&& r)
+      -> typename Sink::result_type
+    {
+      using value_type = typename std::decay<Result>::type::value_type;
+
+      if (r.has_value()) {
+        return detail::pipeline_forward_value(
+          std::is_void<value_type>{},
+          sink,
+          static_cast<Result&&>(r)
+        );
+      }
+      return sink.on_error(
+        result_error_extractor::take(static_cast<Result&&>(r))
+      );
+    }
+
+    //=========================================================================
+    // class : pipeline_source<Result>
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief The source of a pipeline, which refers to either a
+    ///        `const result<T,E>&` or a `result<T,E>&&`
+    ///
+    /// Values and errors of a const result are observed by const reference,
+    /// and those of an rvalue result are moved.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Result>
+    class pipeline_source
+    {
+      using result_type = typename std::decay<Result>::type;
+
+    public:
+
+      using value_type = typename result_type::value_type;
+      using error_type = typename result_type::error_type;
+      using value_reference = typename pipeline_dereference<Result>::type;
+      using error_reference = typename std::conditional<
+        std::is_lvalue_reference<Result>::value,
+        result_const_error_reference<value_type, error_type>,
+        result_error_rvalue_reference<value_type, error_type>
+      >::type;
+
+      explicit pipeline_source(Result r) noexcept
+        : m_result(static_cast<Result>(r))
+      {
+      }
+
+      template <typename Sink>
+      auto run(Sink& sink) -> typename Sink::result_type
+      {
+        if (m_result.has_value()) {
+          return detail::pipeline_forward_value(
+            std::is_void<value_type>{},
+            sink,
+            static_cast<Result>(m_result)
+          );
+        }
+        return run_error(std::is_lvalue_reference<Result>{}, sink);
+      }
+
+    private:
+
+      template <typename Sink>
+      auto run_error(std::true_type, Sink& sink) -> typename Sink::result_type
+      {
+        return sink.on_error(result_error_extractor::get(m_result));
+      }
+
+      template <typename Sink>
+      auto run_error(std::false_type, Sink& sink) -> typename Sink::result_type
+      {
+        return sink.on_error(
+          result_error_extractor::take(static_cast<Result>(m_result))
+        );
+      }
+
+      Result m_result;
+    };
+
+    //=========================================================================
+    // sinks
+    //=========================================================================
+
+    // Each stage is evaluated as a sink that receives either the value or the
+    // error of the previous stage, and forwards its own output to the next
+    // sink. Nothing is materialized between stages, so an error is only
+    // passed by reference until it reaches the terminal sink -- or a stage
+    // that transforms it.
+
+    template <typename Fn, typename Next>
+    struct pipeline_map_sink
+    {
+      using result_type = typename Next::result_type;
+
+      Fn& fn;
+      Next& next;
+
+      template <typename...Args>
+      auto on_value(Args&&...args) -> result_type
+      {
+        using value_type = invoke_result_t<Fn&, Args...>;
+
+        return apply(std::is_void<value_type>{}, detail::forward<Args>(args)...);
+      }
+
+      template <typename Error>
+      auto on_error(Error&& error) -> result_type
+      {
+        return next.on_error(detail::forward<Error>(error));
+      }
+
+      template <typename...Args>
+      auto apply(std::true_type, Args&&...args) -> result_type
+      {
+        detail::invoke(fn, detail::forward<Args>(args)...);
+        return next.on_value();
+      }
+
+      template <typename...Args>
+      auto apply(std::false_type, Args&&...args) -> result_type
+      {
+        return next.on_value(detail::invoke(fn, detail::forward<Args>(args)...));
+      }
+    };
+
+    template <typename Fn, typename Next, typename ErrorType>
+    struct pipeline_flat_map_sink
+    {
+      using result_type = typename Next::result_type;
+
+      Fn& fn;
+      Next& next;
+
+      template <typename...Args>
+      auto on_value(Args&&...args) -> result_type
+      {
+        return detail::pipeline_forward_result(
+          next,
+          detail::invoke(fn, detail::forward<Args>(args)...)
+        );
+      }
+
+      template <typename Error>
+      auto on_error(Error&& error) -> result_type
+      {
+        return pass_error(
+          std::is_same<typename std::decay<Error>::type, ErrorType>{},
+          detail::forward<Error>(error)
+        );
+      }
+
+      template <typename Error>
+      auto pass_error(std::true_type, Error&& error) -> result_type
+      {
+        return next.on_error(detail::forward<Error>(error));
+      }
+
+      template <typename Error>
+      auto pass_error(std::false_type, Error&& error) -> result_type
+      {
+        return next.on_error(ErrorType(detail::forward<Error>(error)));
+      }
+    };
+
+    template <typename Fn, typename Next>
+    struct pipeline_map_error_sink
+    {
+      using result_type = typename Next::result_type;
+
+      Fn& fn;
+      Next& next;
+
+      template <typename...Args>
+      auto on_value(Args&&...args) -> result_type
+      {
+        return next.on_value(detail::forward<Args>(args)...);
+      }
+
+      template <typename Error>
+      auto on_error(Error&& error) -> result_type
+      {
+        return next.on_error(detail::invoke(fn, detail::forward<Error>(error)));
+      }
+    };
+
+    template <typename Fn, typename Next, typename ValueType>
+    struct pipeline_flat_map_error_sink
+    {
+      using result_type = typename Next::result_type;
+
+      Fn& fn;
+      Next& next;
+
+      auto on_value() -> result_type
+      {
+        return next.on_value();
+      }
+
+      template <typename Value>
+      auto on_value(Value&& value) -> result_type
+      {
+        return pass_value(
+          std::is_same<
+            typename std::decay<Value>::type,
+            typename std::decay<ValueType>::type
+          >{},
+          detail::forward<Value>(value)
+        );
+      }
+
+      template <typename Error>
+      auto on_error(Error&& error) -> result_type
+      {
+        return detail::pipeline_forward_result(
+          next,
+          detail::invoke(fn, detail::forward<Error>(error))
+        );
+      }
+
+      template <typename Value>
+      auto pass_value(std::true_type, Value&& value) -> result_type
+      {
+        return next.on_value(detail::forward<Value>(value));
+      }
+
+      template <typename Value>
+      auto pass_value(std::false_type, Value&& value) -> result_type
+      {
+        return next.on_value(ValueType(detail::forward<Value>(value)));
+      }
+    };
+
+    /// \brief The terminal sink, which constructs the final result directly
+    ///        from the value or error that reaches it
+    template <typename Result>
+    struct pipeline_collect_sink
+    {
+      using result_type = Result;
+
+      template <typename...Args>
+      auto on_value(Args&&...args) -> result_type
+      {
+        return result_type(in_place, detail::forward<Args>(args)...);
+      }
+
+      template <typename Error>
+      auto on_error(Error&& error) -> result_type
+      {
+        return result_error_extractor::propagate<result_type>(
+          detail::forward<Error>(error)
+        );
+      }
+    };
+
+    //=========================================================================
+    // traits : pipeline_stage_traits<Stage, Upstream>
+    //=========================================================================
+
+    /// \brief The types produced by applying \p Stage to the output of
+    ///        \p Upstream, and the sink that evaluates it
+    template <typename Stage, typename Upstream>
+    struct pipeline_stage_traits;
+
+    template <typename Fn, typename Upstream>
+    struct pipeline_stage_traits<pipeline::map_stage<Fn>, Upstream>
+    {
+      using value_type = pipeline_invoke_result_t<
+        Fn&,
+        typename Upstream::value_reference
+      >;
+      using value_reference = typename std::add_rvalue_reference<value_type>::type;
+      using error_type = typename Upstream::error_type;
+      using error_reference = typename Upstream::error_reference;
+
+      template <typename Next>
+      using sink = pipeline_map_sink<Fn, Next>;
+    };
+
+    template <typename Fn, typename Upstream>
+    struct pipeline_stage_traits<pipeline::flat_map_stage<Fn>, Upstream>
+    {
+      using result_type = typename std::decay<pipeline_invoke_result_t<
+        Fn&,
+        typename Upstream::value_reference
+      >>::type;
+
+      static_assert(
+        is_result<result_type>::value,
+        "flat_map requires a function returning a 'result'"
+      );
+
+      using value_type = typename result_type::value_type;
+      using value_reference = typename std::add_rvalue_reference<value_type>::type;
+      using error_type = typename result_type::error_type;
+      using error_reference = result_error_rvalue_reference<value_type, error_type>;
+
+      static_assert(
+        std::is_constructible<error_type, typename Upstream::error_reference>::value,
+        "flat_map requires the current error to be convertible to the "
+        "error of the returned 'result'"
+      );
+
+      template <typename Next>
+      using sink = pipeline_flat_map_sink<Fn, Next, error_type>;
+    };
+
+    template <typename Fn, typename Upstream>
+    struct pipeline_stage_traits<pipeline::map_error_stage<Fn>, Upstream>
+    {
+      using value_type = typename Upstream::value_type;
+      using value_reference = typename Upstream::value_reference;
+      using error_type = invoke_result_t<Fn&, typename Upstream::error_reference>;
+      using error_reference = typename std::add_rvalue_reference<error_type>::type;
+
+      static_assert(
+        !std::is_void<error_type>::value,
+        "map_error requires a function returning a non-void error"
+      );
+
+      template <typename Next>
+      using sink = pipeline_map_error_sink<Fn, Next>;
+    };
+
+    template <typename Fn, typename Upstream>
+    struct pipeline_stage_traits<pipeline::flat_map_error_stage<Fn>, Upstream>
+    {
+      using result_type = typename std::decay<
+        invoke_result_t<Fn&, typename Upstream::error_reference>
+      >::type;
+
+      static_assert(
+        is_result<result_type>::value,
+        "flat_map_error requires a function returning a 'result'"
+      );
+
+      using value_type = typename result_type::value_type;
+      using value_reference = typename std::add_rvalue_reference<value_type>::type;
+      using error_type = typename result_type::error_type;
+      using error_reference = result_error_rvalue_reference<value_type, error_type>;
+
+      static_assert(
+        std::is_void<value_type>::value ==
+          std::is_void<typename Upstream::value_type>::value,
+        "flat_map_error requires the returned 'result' to have a void value "
+        "only if the current value is void"
+      );
+
+      template <typename Next>
+      using sink = pipeline_flat_map_error_sink<Fn, Next, value_type>;
+    };
+
+  } // namespace detail
+
+namespace pipeline {
+
+  //===========================================================================
+  // class : expression<Source, Stage>
+  //===========================================================================
+
+  /////////////////////////////////////////////////////////////////////////////
+  /// \brief A lazily evaluated pipeline, which applies \p Stage to the output
+  ///        of \p Source
+  ///
+  /// Expressions are created by applying stages to a `result` with
+  /// `operator|`, and are evaluated by terminating them with `collect()`.
+  /// All of the stages are fused into a single evaluation: no intermediate
+  /// `result` objects are created between stages, and an error is passed by
+  /// reference from the stage that produces it directly to the final result,
+  /// skipping any value stages in between.
+  ///
+  /// An expression only refers to its source `result`, which is not moved
+  /// or copied until it reaches the final result. The source must outlive
+  /// the expression; if it is a temporary, the pipeline must be evaluated
+  /// within the same full-expression that created it. The value and error of
+  /// an rvalue source are moved from, so such expressions are move-only and
+  /// may only be evaluated once.
+  ///
+  /// \tparam Source the source of the pipeline, or the preceding expression
+  /// \tparam Stage the stage applied by this expression
+  /////////////////////////////////////////////////////////////////////////////
+  template <typename Source, typename Stage>
+  class expression
+  {
+    using traits = detail::pipeline_stage_traits<Stage, Source>;
+
+    //-------------------------------------------------------------------------
+    // Public Member Types
+    //-------------------------------------------------------------------------
+  public:
+
+    using value_type = typename traits::value_type;
+    using error_type = typename traits::error_type;
+    using value_reference = typename traits::value_reference;
+    using error_reference = typename traits::error_reference;
+
+    /// \brief The type of `result` produced by evaluating this expression
+    using result_type = result<value_type, error_type>;
+
+    //-------------------------------------------------------------------------
+    // Constructors
+    //-------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs an expression that applies \p stage to \p source
+    ///
+    /// \param source the source of the pipeline
+    /// \param stage the stage to apply
+    expression(Source source, Stage stage);
+
+    //-------------------------------------------------------------------------
+    // Evaluation
+    //-------------------------------------------------------------------------
+  public:
+
+    /// \brief Evaluates this pipeline
+    ///
+    /// This is equivalent to `std::move(expr) | pipeline::collect()`
+    ///
+    /// \return the result of the pipeline
+    auto collect() && -> result_type;
+
+    //-------------------------------------------------------------------------
+    // Private Evaluation
+    //-------------------------------------------------------------------------
+  private:
+
+    template <typename, typename>
+    friend class expression;
+
+    template <typename Sink>
+    auto run(Sink& sink) -> typename Sink::result_type;
+
+    //-------------------------------------------------------------------------
+    // Private Members
+    //-------------------------------------------------------------------------
+  private:
+
+    Source m_source;
+    Stage m_stage;
+  };
+
+  //===========================================================================
+  // factories
+  //===========================================================================
+
+  /// \brief Creates a stage that transforms the value with \p fn
+  ///
+  /// This is the pipeline equivalent of `result::map`
+  ///
+  /// \param fn the function to invoke with the value
+  /// \return the stage
+  template <typename Fn>
+  constexpr auto map(Fn&& fn) -> map_stage<typename std::decay<Fn>::type>;
+
+  /// \brief Creates a stage that transforms the value with \p fn, which
+  ///        returns a new `result`
+  ///
+  /// This is the pipeline equivalent of `result::flat_map`
+  ///
+  /// \param fn the function to invoke with the value
+  /// \return the stage
+  template <typename Fn>
+  constexpr auto flat_map(Fn&& fn) -> flat_map_stage<typename std::decay<Fn>::type>;
+
+  /// \brief Creates a stage that transforms the error with \p fn
+  ///
+  /// This is the pipeline equivalent of `result::map_error`
+  ///
+  /// \param fn the function to invoke with the error
+  /// \return the stage
+  template <typename Fn>
+  constexpr auto map_error(Fn&& fn) -> map_error_stage<typename std::decay<Fn>::type>;
+
+  /// \brief Creates a stage that transforms the error with \p fn, which
+  ///        returns a new `result`
+  ///
+  /// This is the pipeline equivalent of `result::flat_map_error`
+  ///
+  /// \param fn the function to invoke with the error
+  /// \return the stage
+  template <typename Fn>
+  constexpr auto flat_map_error(Fn&& fn)
+    -> flat_map_error_stage<typename std::decay<Fn>::type>;
+
+  /// \brief Creates the terminal stage, which evaluates a pipeline
+  ///
+  /// ### Examples
+  ///
+  /// Basic Usage:
+  ///
+  /// ```cpp
+  /// namespace pipe = cpp::pipeline;
+  ///
+  /// auto r = parse(input)
+  ///   | pipe::map(normalize)
+  ///   | pipe::flat_map(validate)
+  ///   | pipe::map_error(to_diagnostic)
+  ///   | pipe::collect();
+  /// ```
+  ///
+  /// \return the stage
+  constexpr auto collect() noexcept -> collect_stage;
+
+  //===========================================================================
+  // operators
+  //===========================================================================
+
+  /// \brief Starts a pipeline that applies \p stage to \p r
+  ///
+  /// \param r the result to refer to
+  /// \param stage the first stage
+  /// \return the pipeline expression
+  template <typename T, typename E, typename Stage,
+            typename = typename std::enable_if<
+              is_stage<typename std::decay<Stage>::type>::value
+            >::type>
+  auto operator|(const result<T,E>& r, Stage&& stage)
+    -> expression<
+      detail::pipeline_source<const result<T,E>&>,
+      typename std::decay<Stage>::type
+    >;
+
+  /// \brief Starts a pipeline that applies \p stage to \p r
+  ///
+  /// \param r the result to consume in the pipeline
+  /// \param stage the first stage
+  /// \return the pipeline expression
+  template <typename T, typename E, typename Stage,
+            typename = typename std::enable_if<
+              is_stage<typename std::decay<Stage>::type>::value
+            >::type>
+  auto operator|(result<T,E>&& r, Stage&& stage)
+    -> expression<
+      detail::pipeline_source<result<T,E>&&>,
+      typename std::decay<Stage>::type
+    >;
+
+  /// \brief Appends \p stage to the pipeline \p expr
+  ///
+  /// \param expr the pipeline
+  /// \param stage the stage to append
+  /// \return the pipeline expression
+  template <typename Source, typename Stage0, typename Stage,
+            typename = typename std::enable_if<
+              is_stage<typename std::decay<Stage>::type>::value
+            >::type>
+  auto operator|(expression<Source,Stage0> expr, Stage&& stage)
+    -> expression<
+      expression<Source,Stage0>,
+      typename std::decay<Stage>::type
+    >;
+
+  /// \brief Evaluates the pipeline \p expr
+  ///
+  /// \param expr the pipeline
+  /// \return the result of the pipeline
+  template <typename Source, typename Stage>
+  auto operator|(expression<Source,Stage> expr, collect_stage)
+    -> typename expression<Source,Stage>::result_type;
+
+} // namespace pipeline
+} // inline namespace bitwizeshift
+} // namespace RESULT_NAMESPACE_INTERNAL
+
+//=============================================================================
+// class : expression<Source, Stage>
+//=============================================================================
+
+template <typename Source, typename Stage>
+inline
+RESULT_NS_IMPL::pipeline::expression<Source,Stage>::expression(Source source,
+                                                               Stage stage)
+  : m_source(std::move(source)),
+    m_stage(std::move(stage))
+{
+}
+
+template <typename Source, typename Stage>
+inline
+auto RESULT_NS_IMPL::pipeline::expression<Source,Stage>::collect()
+  && -> result_type
+{
+  auto sink = detail::pipeline_collect_sink<result_type>{};
+
+  return run(sink);
+}
+
+template <typename Source, typename Stage>
+template <typename Sink>
+inline
+auto RESULT_NS_IMPL::pipeline::expression<Source,Stage>::run(Sink& sink)
+  -> typename Sink::result_type
+{
+  using sink_type = typename traits::template sink<Sink>;
+
+  auto stage_sink = sink_type{m_stage.fn, sink};
+
+  return m_source.run(stage_sink);
+}
+
+//=============================================================================
+// factories
+//=============================================================================
+
+template <typename Fn>
+inline constexpr
+auto RESULT_NS_IMPL::pipeline::map(Fn&& fn)
+  -> map_stage<typename std::decay<Fn>::type>
+{
+  return map_stage<typename std::decay<Fn>::type>{detail::forward<Fn>(fn)};
+}
+
+template <typename Fn>
+inline constexpr
+auto RESULT_NS_IMPL::pipeline::flat_map(Fn&& fn)
+  -> flat_map_stage<typename std::decay<Fn>::type>
+{
+  return flat_map_stage<typename std::decay<Fn>::type>{detail::forward<Fn>(fn)};
+}
+
+template <typename Fn>
+inline constexpr
+auto RESULT_NS_IMPL::pipeline::map_error(Fn&& fn)
+  -> map_error_stage<typename std::decay<Fn>::type>
+{
+  return map_error_stage<typename std::decay<Fn>::type>{detail::forward<Fn>(fn)};
+}
+
+template <typename Fn>
+inline constexpr
+auto RESULT_NS_IMPL::pipeline::flat_map_error(Fn&& fn)
+  -> flat_map_error_stage<typename std::decay<Fn>::type>
+{
+  return flat_map_error_stage<typename std::decay<Fn>::type>{
+    detail::forward<Fn>(fn)
+  };
+}
+
+inline constexpr
+auto RESULT_NS_IMPL::pipeline::collect()
+  noexcept -> collect_stage
+{
+  return collect_stage{};
+}
+
+//=============================================================================
+// operators
+//=============================================================================
+
+template <typename T, typename E, typename Stage, typename>
+inline
+auto RESULT_NS_IMPL::pipeline::operator|(const result<T,E>& r, Stage&& stage)
+  -> expression<
+    detail::pipeline_source<const result<T,E>&>,
+    typename std::decay<Stage>::type
+  >
+{
+  using source_type = detail::pipeline_source<const result<T,E>&>;
+  using expression_type = expression<source_type, typename std::decay<Stage>::type>;
+
+  return expression_type{source_type{r}, detail::forward<Stage>(stage)};
+}
+
+template <typename T, typename E, typename Stage, typename>
+inline
+auto RESULT_NS_IMPL::pipeline::operator|(result<T,E>&& r, Stage&& stage)
+  -> expression<
+    detail::pipeline_source<result<T,E>&&>,
+    typename std::decay<Stage>::type
+  >
+{
+  using source_type = detail::pipeline_source<result<T,E>&&>;
+  using expression_type = expression<source_type, typename std::decay<Stage>::type>;
+
+  return expression_type{source_type{std::move(r)}, detail::forward<Stage>(stage)};
+}
+
+template <typename Source, typename Stage0, typename Stage, typename>
+inline
+auto RESULT_NS_IMPL::pipeline::operator|(expression<Source,Stage0> expr,
+                                         Stage&& stage)
+  -> expression<
+    expression<Source,Stage0>,
+    typename std::decay<Stage>::type
+  >
+{
+  using expression_type = expression<
+    expression<Source,Stage0>,
+    typename std::decay<Stage>::type
+  >;
+
+  return expression_type{std::move(expr), detail::forward<Stage>(stage)};
+}
+
+template <typename Source, typename Stage>
+inline
+auto RESULT_NS_IMPL::pipeline::operator|(expression<Source,Stage> expr,
+                                         collect_stage)
+  -> typename expression<Source,Stage>::result_type
+{
+  return std::move(expr).collect();
+}
+
+#undef RESULT_NAMESPACE_INTERNAL
+#undef RESULT_NS_IMPL
+
+#endif /* RESULT_RESULT_PIPELINE_HPP */
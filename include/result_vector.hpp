@@ -0,0 +1,975 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file result_vector.hpp
+///
+/// \brief This header contains the 'result_vector' container, which stores a
+///        sequence of results in a structure-of-arrays layout
+////////////////////////////////////////////////////////////////////////////////
+
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2017-2021 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef RESULT_RESULT_VECTOR_HPP
+#define RESULT_RESULT_VECTOR_HPP
+
+#include "result.hpp"
+
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint64_t
+#include <iterator>    // std::forward_iterator_tag
+#include <type_traits> // std::is_object
+#include <vector>      // std::vector
+
+#if defined(_MSC_VER) && !defined(__clang__)
+# include <intrin.h> // __popcnt64, _BitScanForward64
+#endif
+
+#if defined(RESULT_NAMESPACE)
+# define RESULT_NAMESPACE_INTERNAL RESULT_NAMESPACE
+#else
+# define RESULT_NAMESPACE_INTERNAL cpp
+#endif
+#define RESULT_NS_IMPL RESULT_NAMESPACE_INTERNAL::bitwizeshift
+
+namespace RESULT_NAMESPACE_INTERNAL {
+inline namespace bitwizeshift {
+
+  namespace detail {
+
+    //=========================================================================
+    // utilities : bit operations
+    //=========================================================================
+
+    /// \brief Counts the number of set bits in \p word
+    auto popcount64(std::uint64_t word) noexcept -> std::size_t;
+
+    /// \brief Counts the number of trailing zero bits in \p word
+    ///
+    /// \pre \p word is not `0`
+    auto countr_zero64(std::uint64_t word) noexcept -> std::size_t;
+
+  } // namespace detail
+
+  //===========================================================================
+  // class : result_vector_span<U>
+  //===========================================================================
+
+  /////////////////////////////////////////////////////////////////////////////
+  /// \brief A contiguous sequence of the values of a `result_vector`, whose
+  ///        elements may be accessed but not added or removed
+  ///
+  /// The values are only ever resized along with the has-value bitmap, so
+  /// that the two never disagree about which elements hold values.
+  ///
+  /// \tparam U the element type, which is `const`-qualified for the values of
+  ///         a `const` container
+  /////////////////////////////////////////////////////////////////////////////
+  template <typename U>
+  class result_vector_span
+  {
+    //-------------------------------------------------------------------------
+    // Public Member Types
+    //-------------------------------------------------------------------------
+  public:
+
+    using element_type = U;
+    using size_type = std::size_t;
+    using iterator = U*;
+
+    //-------------------------------------------------------------------------
+    // Constructors
+    //-------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs a span of the \p size elements starting at \p data
+    ///
+    /// \param data the first element
+    /// \param size the number of elements
+    constexpr result_vector_span(U* data, size_type size) noexcept;
+
+    //-------------------------------------------------------------------------
+    // Observers
+    //-------------------------------------------------------------------------
+  public:
+
+    /// \brief Gets a reference to the element at index \p n
+    ///
+    /// \pre \p n is less than `size()`
+    ///
+    /// \param n the index of the element
+    /// \return the element
+    constexpr auto operator[](size_type n) const noexcept -> U&;
+
+    /// \brief Gets a pointer to the first element
+    constexpr auto data() const noexcept -> U*;
+
+    /// \brief Gets the number of elements
+    constexpr auto size() const noexcept -> size_type;
+
+    /// \brief Queries whether there are no elements
+    constexpr auto empty() const noexcept -> bool;
+
+    //-------------------------------------------------------------------------
+    // Iterators
+    //-------------------------------------------------------------------------
+  public:
+
+    /// \brief Gets an iterator to the first element
+    constexpr auto begin() const noexcept -> iterator;
+
+    /// \brief Gets an iterator past the last element
+    constexpr auto end() const noexcept -> iterator;
+
+    //-------------------------------------------------------------------------
+    // Private Members
+    //-------------------------------------------------------------------------
+  private:
+
+    U* m_data;
+    size_type m_size;
+  };
+
+  //===========================================================================
+  // class : result_vector<T, E>
+  //===========================================================================
+
+  /////////////////////////////////////////////////////////////////////////////
+  /// \brief A sequence container of `result<T,E>` objects that stores its
+  ///        values, errors, and discriminators in separate arrays
+  ///
+  /// A `std::vector<result<T,E>>` interleaves values and errors, and pays for
+  /// the padding of a `bool` discriminator in every element. `result_vector`
+  /// instead stores:
+  ///
+  /// * the values contiguously, in order, as a `std::vector<T>`,
+  /// * the errors contiguously, in order, as a `std::vector<E>`, and
+  /// * one has-value bit per element, packed into 64-bit words.
+  ///
+  /// Elements are accessed by index through `result<T&,E>` views. Locating the
+  /// value or error for an index requires a single population-count on the
+  /// bitmap, using a per-word rank table. Since the values and errors are each
+  /// stored contiguously, bulk operations over one of the two -- such as
+  /// summing all values -- may be performed directly on `values()` or
+  /// `errors()` with the full benefit of the cache.
+  ///
+  /// Elements may only be appended to or removed from the back; the
+  /// active state of an existing element cannot be changed in-place.
+  ///
+  /// ### Examples
+  ///
+  /// Basic Usage:
+  ///
+  /// ```cpp
+  /// auto results = cpp::result_vector<int,std::errc>{};
+  /// results.push_back(42);
+  /// results.push_back(cpp::fail(std::errc::invalid_argument));
+  ///
+  /// assert(results.count_errors() == 1u);
+  /// assert(results.first_error() == 1u);
+  /// assert(*results[0] == 42);
+  /// ```
+  ///
+  /// \tparam T the value type
+  /// \tparam E the error type
+  /////////////////////////////////////////////////////////////////////////////
+  template <typename T, typename E>
+  class result_vector
+  {
+    static_assert(
+      std::is_object<T>::value && !std::is_const<T>::value,
+      "result_vector requires T to be a non-const object type"
+    );
+    static_assert(
+      std::is_object<E>::value && !std::is_const<E>::value,
+      "result_vector requires E to be a non-const object type"
+    );
+
+    template <typename Reference, typename Vector>
+    class basic_iterator;
+
+    //-------------------------------------------------------------------------
+    // Public Member Types
+    //-------------------------------------------------------------------------
+  public:
+
+    using value_type = result<T,E>;
+    using error_type = E;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    using reference = result<T&,E>;
+    using const_reference = result<const T&,E>;
+
+    using iterator = basic_iterator<reference, result_vector>;
+    using const_iterator = basic_iterator<const_reference, const result_vector>;
+
+    //-------------------------------------------------------------------------
+    // Constructors / Assignment
+    //-------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs an empty result_vector
+    result_vector() = default;
+
+    result_vector(const result_vector& other) = default;
+    result_vector(result_vector&& other) = default;
+
+    //-------------------------------------------------------------------------
+
+    auto operator=(const result_vector& other) -> result_vector& = default;
+    auto operator=(result_vector&& other) -> result_vector& = default;
+
+    //-------------------------------------------------------------------------
+    // Element Access
+    //-------------------------------------------------------------------------
+  public:
+
+    /// \{
+    /// \brief Gets a view of the element at index \p n
+    ///
+    /// \pre \p n is less than `size()`
+    ///
+    /// \param n the index of the element
+    /// \return a result referring to the value, or containing a copy of the
+    ///         error
+    auto operator[](size_type n) -> reference;
+    auto operator[](size_type n) const -> const_reference;
+    /// \}
+
+    /// \brief Queries whether the element at index \p n contains a value
+    ///
+    /// \pre \p n is less than `size()`
+    ///
+    /// \param n the index of the element
+    /// \return `true` if the element contains a value
+    auto has_value(size_type n) const noexcept -> bool;
+
+    /// \{
+    /// \brief Gets all the values of this container, in order
+    ///
+    /// The values may be modified in place, but are only ever added or
+    /// removed through this container.
+    ///
+    /// \return the values
+    auto values() noexcept -> result_vector_span<T>;
+    auto values() const noexcept -> result_vector_span<const T>;
+    /// \}
+
+    /// \brief Gets all the errors of this container, in order
+    ///
+    /// \return the errors
+    auto errors() const noexcept -> const std::vector<E>&;
+
+    //-------------------------------------------------------------------------
+    // Iterators
+    //-------------------------------------------------------------------------
+  public:
+
+    /// \{
+    /// \brief Gets an iterator to the beginning of this container
+    auto begin() noexcept -> iterator;
+    auto begin() const noexcept -> const_iterator;
+    auto cbegin() const noexcept -> const_iterator;
+    /// \}
+
+    /// \{
+    /// \brief Gets an iterator to the end of this container
+    auto end() noexcept -> iterator;
+    auto end() const noexcept -> const_iterator;
+    auto cend() const noexcept -> const_iterator;
+    /// \}
+
+    //-------------------------------------------------------------------------
+    // Capacity
+    //-------------------------------------------------------------------------
+  public:
+
+    /// \brief Gets the number of elements in this container
+    auto size() const noexcept -> size_type;
+
+    /// \brief Queries whether this container is empty
+    auto empty() const noexcept -> bool;
+
+    /// \brief Reserves storage for \p values values and \p errors errors
+    ///
+    /// \param values the number of values to reserve
+    /// \param errors the number of errors to reserve
+    auto reserve(size_type values, size_type errors = 0u) -> void;
+
+    //-------------------------------------------------------------------------
+    // Queries
+    //-------------------------------------------------------------------------
+  public:
+
+    /// \brief Counts the number of elements containing a value
+    ///
+    /// \note This is a constant-time operation
+    auto count_values() const noexcept -> size_type;
+
+    /// \brief Counts the number of elements containing an error
+    ///
+    /// \note This is a constant-time operation
+    auto count_errors() const noexcept -> size_type;
+
+    /// \brief Finds the index of the first element containing an error
+    ///
+    /// This scans the has-value bitmap 64 elements at a time
+    ///
+    /// \return the index of the first error, or `size()` if there are none
+    auto first_error() const noexcept -> size_type;
+
+    //-------------------------------------------------------------------------
+    // Modifiers
+    //-------------------------------------------------------------------------
+  public:
+
+    /// \{
+    /// \brief Appends \p r to the end of this container
+    ///
+    /// \param r the result to append
+    auto push_back(const result<T,E>& r) -> void;
+    auto push_back(result<T,E>&& r) -> void;
+    /// \}
+
+    /// \{
+    /// \brief Appends the value \p value to the end of this container
+    ///
+    /// \param value the value to append
+    auto push_back(const T& value) -> void;
+    auto push_back(T&& value) -> void;
+    /// \}
+
+    /// \{
+    /// \brief Appends the error of \p f to the end of this container
+    ///
+    /// \param f the failure to append
+    template <typename E2,
+              typename = typename std::enable_if<std::is_constructible<E,const E2&>::value>::type>
+    auto push_back(const failure<E2>& f) -> void;
+    template <typename E2,
+              typename = typename std::enable_if<std::is_constructible<E,E2&&>::value>::type>
+    auto push_back(failure<E2>&& f) -> void;
+    /// \}
+
+    /// \brief Constructs a value in-place at the end of this container
+    ///
+    /// \param args the arguments to forward to T's constructor
+    template <typename...Args>
+    auto emplace_back(in_place_t, Args&&...args) -> void;
+
+    /// \brief Constructs an error in-place at the end of this container
+    ///
+    /// \param args the arguments to forward to E's constructor
+    template <typename...Args>
+    auto emplace_back(in_place_error_t, Args&&...args) -> void;
+
+    /// \brief Removes the last element of this container
+    ///
+    /// \pre `empty()` is `false`
+    auto pop_back() -> void;
+
+    /// \brief Removes all elements from this container
+    auto clear() noexcept -> void;
+
+    //-------------------------------------------------------------------------
+    // Private Member Functions
+    //-------------------------------------------------------------------------
+  private:
+
+    /// \brief Gets the number of values preceding the element at index \p n
+    auto rank(size_type n) const noexcept -> size_type;
+
+    /// \brief Ensures that the bitmap can grow by one element without
+    ///        allocating
+    auto reserve_bit() -> void;
+
+    /// \brief Appends a has-value bit for an element that has just been added
+    ///        to either the values or the errors
+    ///
+    /// \pre `reserve_bit()` was called prior to adding the element
+    auto push_bit(bool has_value) noexcept -> void;
+
+    //-------------------------------------------------------------------------
+    // Private Member Types
+    //-------------------------------------------------------------------------
+  private:
+
+    using word_type = std::uint64_t;
+
+    static constexpr size_type bits_per_word = 64u;
+
+    //-------------------------------------------------------------------------
+    // Private Members
+    //-------------------------------------------------------------------------
+  private:
+
+    std::vector<T> m_values;
+    std::vector<E> m_errors;
+    std::vector<word_type> m_bits;  ///< has-value bit for each element
+    std::vector<size_type> m_ranks; ///< number of values preceding each word
+  };
+
+  //===========================================================================
+  // class : result_vector<T,E>::basic_iterator
+  //===========================================================================
+
+  template <typename T, typename E>
+  template <typename Reference, typename Vector>
+  class result_vector<T,E>::basic_iterator
+  {
+    //-------------------------------------------------------------------------
+    // Public Member Types
+    //-------------------------------------------------------------------------
+  public:
+
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = result<T,E>;
+    using reference = Reference;
+    using pointer = void;
+    using difference_type = std::ptrdiff_t;
+
+    //-------------------------------------------------------------------------
+    // Constructors
+    //-------------------------------------------------------------------------
+  public:
+
+    basic_iterator() = default;
+    basic_iterator(Vector* vector, std::size_t index) noexcept
+      : m_vector{vector},
+        m_index{index}
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    // Iteration
+    //-------------------------------------------------------------------------
+  public:
+
+    auto operator*() const -> reference { return (*m_vector)[m_index]; }
+
+    auto operator++() noexcept -> basic_iterator&
+    {
+      ++m_index;
+      return (*this);
+    }
+
+    auto operator++(int) noexcept -> basic_iterator
+    {
+      auto copy = (*this);
+      ++m_index;
+      return copy;
+    }
+
+    //-------------------------------------------------------------------------
+    // Comparison
+    //-------------------------------------------------------------------------
+  public:
+
+    friend auto operator==(const basic_iterator& lhs, const basic_iterator& rhs)
+      noexcept -> bool
+    {
+      return lhs.m_index == rhs.m_index;
+    }
+
+    friend auto operator!=(const basic_iterator& lhs, const basic_iterator& rhs)
+      noexcept -> bool
+    {
+      return lhs.m_index != rhs.m_index;
+    }
+
+    //-------------------------------------------------------------------------
+    // Private Members
+    //-------------------------------------------------------------------------
+  private:
+
+    Vector* m_vector = nullptr;
+    std::size_t m_index = 0u;
+  };
+
+} // inline namespace bitwizeshift
+} // namespace RESULT_NAMESPACE_INTERNAL
+
+//=============================================================================
+// utilities : bit operations
+//=============================================================================
+
+inline
+auto RESULT_NS_IMPL::detail::popcount64(std::uint64_t word)
+  noexcept -> std::size_t
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<std::size_t>(__builtin_popcountll(word));
+#elif defined(_MSC_VER) && defined(_M_X64)
+  return static_cast<std::size_t>(__popcnt64(word));
+#else
+  word = word - ((word >> 1u) & 0x5555555555555555ull);
+  word = (word & 0x3333333333333333ull) + ((word >> 2u) & 0x3333333333333333ull);
+  word = (word + (word >> 4u)) & 0x0f0f0f0f0f0f0f0full;
+  return static_cast<std::size_t>((word * 0x0101010101010101ull) >> 56u);
+#endif
+}
+
+inline
+auto RESULT_NS_IMPL::detail::countr_zero64(std::uint64_t word)
+  noexcept -> std::size_t
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<std::size_t>(__builtin_ctzll(word));
+#elif defined(_MSC_VER) && defined(_M_X64)
+  auto index = 0ul;
+  _BitScanForward64(&index, word);
+  return static_cast<std::size_t>(index);
+#else
+  return popcount64((word & (~word + 1u)) - 1u);
+#endif
+}
+
+//=============================================================================
+// class : result_vector_span<U>
+//=============================================================================
+
+template <typename U>
+inline constexpr
+RESULT_NS_IMPL::result_vector_span<U>::result_vector_span(U* data,
+                                                          size_type size)
+  noexcept
+  : m_data{data},
+    m_size{size}
+{
+
+}
+
+template <typename U>
+inline constexpr
+auto RESULT_NS_IMPL::result_vector_span<U>::operator[](size_type n)
+  const noexcept -> U&
+{
+  return m_data[n];
+}
+
+template <typename U>
+inline constexpr
+auto RESULT_NS_IMPL::result_vector_span<U>::data()
+  const noexcept -> U*
+{
+  return m_data;
+}
+
+template <typename U>
+inline constexpr
+auto RESULT_NS_IMPL::result_vector_span<U>::size()
+  const noexcept -> size_type
+{
+  return m_size;
+}
+
+template <typename U>
+inline constexpr
+auto RESULT_NS_IMPL::result_vector_span<U>::empty()
+  const noexcept -> bool
+{
+  return m_size == 0u;
+}
+
+template <typename U>
+inline constexpr
+auto RESULT_NS_IMPL::result_vector_span<U>::begin()
+  const noexcept -> iterator
+{
+  return m_data;
+}
+
+template <typename U>
+inline constexpr
+auto RESULT_NS_IMPL::result_vector_span<U>::end()
+  const noexcept -> iterator
+{
+  return m_data + m_size;
+}
+
+//=============================================================================
+// class : result_vector<T,E>
+//=============================================================================
+
+#if __cplusplus < 201703L
+template <typename T, typename E>
+constexpr typename RESULT_NS_IMPL::result_vector<T,E>::size_type
+  RESULT_NS_IMPL::result_vector<T,E>::bits_per_word;
+#endif
+
+//-----------------------------------------------------------------------------
+// Element Access
+//-----------------------------------------------------------------------------
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::result_vector<T,E>::operator[](size_type n)
+  -> reference
+{
+  const auto r = rank(n);
+
+  if (has_value(n)) {
+    return reference{m_values[r]};
+  }
+  return detail::result_error_extractor::propagate<reference>(m_errors[n - r]);
+}
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::result_vector<T,E>::operator[](size_type n)
+  const -> const_reference
+{
+  const auto r = rank(n);
+
+  if (has_value(n)) {
+    return const_reference{m_values[r]};
+  }
+  return detail::result_error_extractor::propagate<const_reference>(m_errors[n - r]);
+}
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::result_vector<T,E>::has_value(size_type n)
+  const noexcept -> bool
+{
+  return ((m_bits[n / bits_per_word] >> (n % bits_per_word)) & 1u) != 0u;
+}
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::result_vector<T,E>::values()
+  noexcept -> result_vector_span<T>
+{
+  return result_vector_span<T>{m_values.data(), m_values.size()};
+}
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::result_vector<T,E>::values()
+  const noexcept -> result_vector_span<const T>
+{
+  return result_vector_span<const T>{m_values.data(), m_values.size()};
+}
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::result_vector<T,E>::errors()
+  const noexcept -> const std::vector<E>&
+{
+  return m_errors;
+}
+
+//-----------------------------------------------------------------------------
+// Iterators
+//-----------------------------------------------------------------------------
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::result_vector<T,E>::begin()
+  noexcept -> iterator
+{
+  return iterator{this, 0u};
+}
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::result_vector<T,E>::begin()
+  const noexcept -> const_iterator
+{
+  return const_iterator{this, 0u};
+}
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::result_vector<T,E>::cbegin()
+  const noexcept -> const_iterator
+{
+  return const_iterator{this, 0u};
+}
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::result_vector<T,E>::end()
+  noexcept -> iterator
+{
+  return iterator{this, size()};
+}
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::result_vector<T,E>::end()
+  const noexcept -> const_iterator
+{
+  return const_iterator{this, size()};
+}
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::result_vector<T,E>::cend()
+  const noexcept -> const_iterator
+{
+  return const_iterator{this, size()};
+}
+
+//-----------------------------------------------------------------------------
+// Capacity
+//-----------------------------------------------------------------------------
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::result_vector<T,E>::size()
+  const noexcept -> size_type
+{
+  return m_values.size() + m_errors.size();
+}
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::result_vector<T,E>::empty()
+  const noexcept -> bool
+{
+  return m_values.empty() && m_errors.empty();
+}
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::result_vector<T,E>::reserve(size_type values, size_type errors)
+  -> void
+{
+  const auto words = (values + errors + bits_per_word - 1u) / bits_per_word;
+
+  m_values.reserve(values);
+  m_errors.reserve(errors);
+  m_bits.reserve(words);
+  m_ranks.reserve(words);
+}
+
+//-----------------------------------------------------------------------------
+// Queries
+//-----------------------------------------------------------------------------
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::result_vector<T,E>::count_values()
+  const noexcept -> size_type
+{
+  return m_values.size();
+}
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::result_vector<T,E>::count_errors()
+  const noexcept -> size_type
+{
+  return m_errors.size();
+}
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::result_vector<T,E>::first_error()
+  const noexcept -> size_type
+{
+  if (m_errors.empty()) {
+    return size();
+  }
+
+  // Unused bits of the last word are always '0', so they are never mistaken
+  // for errors as long as there is at least one error in the container.
+  const auto words = m_bits.size();
+  for (auto i = std::size_t{0u}; i < words; ++i) {
+    const auto errors = ~m_bits[i];
+    if (errors != 0u) {
+      return i * bits_per_word + detail::countr_zero64(errors);
+    }
+  }
+  return size();
+}
+
+//-----------------------------------------------------------------------------
+// Modifiers
+//-----------------------------------------------------------------------------
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::result_vector<T,E>::push_back(const result<T,E>& r)
+  -> void
+{
+  if (r.has_value()) {
+    push_back(*r);
+  } else {
+    emplace_back(in_place_error, r.error());
+  }
+}
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::result_vector<T,E>::push_back(result<T,E>&& r)
+  -> void
+{
+  if (r.has_value()) {
+    push_back(static_cast<T&&>(*r));
+  } else {
+    emplace_back(in_place_error, static_cast<result<T,E>&&>(r).error());
+  }
+}
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::result_vector<T,E>::push_back(const T& value)
+  -> void
+{
+  emplace_back(in_place, value);
+}
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::result_vector<T,E>::push_back(T&& value)
+  -> void
+{
+  emplace_back(in_place, static_cast<T&&>(value));
+}
+
+template <typename T, typename E>
+template <typename E2, typename>
+inline
+auto RESULT_NS_IMPL::result_vector<T,E>::push_back(const failure<E2>& f)
+  -> void
+{
+  emplace_back(in_place_error, f.error());
+}
+
+template <typename T, typename E>
+template <typename E2, typename>
+inline
+auto RESULT_NS_IMPL::result_vector<T,E>::push_back(failure<E2>&& f)
+  -> void
+{
+  emplace_back(in_place_error, static_cast<failure<E2>&&>(f).error());
+}
+
+template <typename T, typename E>
+template <typename...Args>
+inline
+auto RESULT_NS_IMPL::result_vector<T,E>::emplace_back(in_place_t, Args&&...args)
+  -> void
+{
+  reserve_bit();
+  m_values.emplace_back(detail::forward<Args>(args)...);
+  push_bit(true);
+}
+
+template <typename T, typename E>
+template <typename...Args>
+inline
+auto RESULT_NS_IMPL::result_vector<T,E>::emplace_back(in_place_error_t, Args&&...args)
+  -> void
+{
+  reserve_bit();
+  m_errors.emplace_back(detail::forward<Args>(args)...);
+  push_bit(false);
+}
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::result_vector<T,E>::pop_back()
+  -> void
+{
+  const auto n = size() - 1u;
+
+  if (has_value(n)) {
+    m_values.pop_back();
+  } else {
+    m_errors.pop_back();
+  }
+
+  if (n % bits_per_word == 0u) {
+    m_bits.pop_back();
+    m_ranks.pop_back();
+  } else {
+    m_bits.back() &= ~(word_type{1u} << (n % bits_per_word));
+  }
+}
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::result_vector<T,E>::clear()
+  noexcept -> void
+{
+  m_values.clear();
+  m_errors.clear();
+  m_bits.clear();
+  m_ranks.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::result_vector<T,E>::rank(size_type n)
+  const noexcept -> size_type
+{
+  const auto word = n / bits_per_word;
+  const auto bit = n % bits_per_word;
+  const auto mask = (word_type{1u} << bit) - 1u;
+
+  return m_ranks[word] + detail::popcount64(m_bits[word] & mask);
+}
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::result_vector<T,E>::reserve_bit()
+  -> void
+{
+  // Reserving up-front allows 'push_bit' to be non-throwing, which keeps the
+  // bitmap consistent with the values and errors if an emplacement throws.
+  if (m_bits.size() == m_bits.capacity()) {
+    m_bits.reserve(m_bits.size() * 2u + 1u);
+  }
+  if (m_ranks.size() == m_ranks.capacity()) {
+    m_ranks.reserve(m_ranks.size() * 2u + 1u);
+  }
+}
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::result_vector<T,E>::push_bit(bool has_value)
+  noexcept -> void
+{
+  const auto n = size() - 1u;
+  const auto bit = n % bits_per_word;
+
+  if (bit == 0u) {
+    m_bits.push_back(0u);
+    m_ranks.push_back(m_values.size() - (has_value ? 1u : 0u));
+  }
+  if (has_value) {
+    m_bits.back() |= (word_type{1u} << bit);
+  }
+}
+
+#undef RESULT_NAMESPACE_INTERNAL
+#undef RESULT_NS_IMPL
+
+#endif /* RESULT_RESULT_VECTOR_HPP */
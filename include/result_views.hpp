@@ -0,0 +1,211 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file result_views.hpp
+///
+/// \brief This header provides lazy C++20 range adaptors that view the values
+///        or errors of a range of results
+////////////////////////////////////////////////////////////////////////////////
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020-2021 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef RESULT_RESULT_VIEWS_HPP
+#define RESULT_RESULT_VIEWS_HPP
+
+#include "result.hpp"
+
+#include <type_traits> // std::is_lvalue_reference, std::remove_cvref_t
+#include <utility>     // std::forward
+
+#if __cplusplus >= 202002L && defined(__has_include)
+# if __has_include(<ranges>)
+#   include <ranges> // std::views::filter, std::views::take_while, std::views::transform
+# endif
+#endif
+
+#if defined(__cpp_lib_ranges) && __cpp_lib_ranges >= 201911L
+# define RESULT_HAS_RANGES 1
+#else
+# define RESULT_HAS_RANGES 0
+#endif
+
+#if RESULT_HAS_RANGES
+
+#if defined(RESULT_NAMESPACE)
+# define RESULT_NAMESPACE_INTERNAL RESULT_NAMESPACE
+#else
+# define RESULT_NAMESPACE_INTERNAL cpp
+#endif
+#define RESULT_NS_IMPL RESULT_NAMESPACE_INTERNAL::bitwizeshift
+
+namespace RESULT_NAMESPACE_INTERNAL {
+inline namespace bitwizeshift {
+  namespace detail {
+
+    //=========================================================================
+    // utilities : view projections
+    //=========================================================================
+
+    /// \brief The type that viewing a \p Reference produced by \p Projection
+    ///        yields
+    ///
+    /// Lvalue results are viewed by reference, so that the view refers into
+    /// the original elements, as are lvalue references that rvalue results
+    /// such as `result<T&,E>` refer to. Otherwise, rvalue results may be
+    /// temporaries that do not outlive the dereference, and are moved out of
+    /// by value.
+    template <typename Result, typename Reference>
+    using result_view_reference_t = std::conditional_t<
+      std::is_lvalue_reference_v<Result> || std::is_lvalue_reference_v<Reference>,
+      Reference,
+      std::remove_cvref_t<Reference>
+    >;
+
+    struct result_has_value_fn
+    {
+      template <typename Result>
+      constexpr auto operator()(const Result& r) const noexcept -> bool
+      {
+        return r.has_value();
+      }
+    };
+
+    struct result_has_error_fn
+    {
+      template <typename Result>
+      constexpr auto operator()(const Result& r) const noexcept -> bool
+      {
+        return r.has_error();
+      }
+    };
+
+    struct result_value_fn
+    {
+      template <typename Result>
+      constexpr auto operator()(Result&& r) const
+        -> result_view_reference_t<Result, decltype(*std::forward<Result>(r))>
+      {
+        return *std::forward<Result>(r);
+      }
+    };
+
+    struct result_error_fn
+    {
+      template <typename Result>
+      constexpr auto operator()(Result&& r) const
+        -> result_view_reference_t<Result, decltype(std::forward<Result>(r).error_ref())>
+      {
+        return std::forward<Result>(r).error_ref();
+      }
+    };
+
+  } // namespace detail
+
+  namespace views {
+
+    //=========================================================================
+    // views : values
+    //=========================================================================
+
+    /// \brief A range adaptor that views the values of a range of results,
+    ///        skipping every result that contains an error
+    ///
+    /// Nothing is materialized. Ranges of lvalue results, such as
+    /// containers, yield `T&` (or `const T&`) that refer into the original
+    /// elements.
+    ///
+    /// \note As with `std::views::filter`, each element is dereferenced once
+    ///       to test it and again to view it. Ranges that compute their
+    ///       elements on each dereference, such as a `std::views::transform`,
+    ///       do that work twice for every value.
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// auto results = std::vector<cpp::result<int,std::errc>>{...};
+    ///
+    /// for (int& x : results | cpp::views::values) {
+    ///   ...
+    /// }
+    /// ```
+    inline constexpr auto values = std::views::filter(detail::result_has_value_fn{})
+                                 | std::views::transform(detail::result_value_fn{});
+
+    //=========================================================================
+    // views : errors
+    //=========================================================================
+
+    /// \brief A range adaptor that views the errors of a range of results,
+    ///        skipping every result that contains a value
+    ///
+    /// Ranges of lvalue results yield `E&` (or `const E&`) that refer into
+    /// the original elements, except for results whose error is encoded
+    /// into niche storage, which yield the error by value.
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// for (const auto& e : parse_all(lines) | cpp::views::errors) {
+    ///   log(e);
+    /// }
+    /// ```
+    inline constexpr auto errors = std::views::filter(detail::result_has_error_fn{})
+                                 | std::views::transform(detail::result_error_fn{});
+
+    //=========================================================================
+    // views : take_until_error
+    //=========================================================================
+
+    /// \brief A range adaptor that views the values of a range of results,
+    ///        stopping at the first result that contains an error
+    ///
+    /// The error itself is not part of the view; it may be found afterwards
+    /// with `std::ranges::find_if` if it is needed.
+    ///
+    /// ### Examples
+    ///
+    /// Basic Usage:
+    ///
+    /// ```cpp
+    /// // sums the leading run of successfully parsed numbers
+    /// auto sum = 0;
+    /// for (int x : parse_all(lines) | cpp::views::take_until_error) {
+    ///   sum += x;
+    /// }
+    /// ```
+    inline constexpr auto take_until_error = std::views::take_while(detail::result_has_value_fn{})
+                                           | std::views::transform(detail::result_value_fn{});
+
+  } // namespace views
+} // inline namespace bitwizeshift
+} // namespace RESULT_NAMESPACE_INTERNAL
+
+#undef RESULT_NAMESPACE_INTERNAL
+#undef RESULT_NS_IMPL
+
+#endif // RESULT_HAS_RANGES
+
+#endif /* RESULT_RESULT_VIEWS_HPP */
@@ -0,0 +1,822 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file result_wire.hpp
+///
+/// \brief This header contains a binary wire format for sending 'result'
+///        objects of trivially copyable types between processes
+////////////////////////////////////////////////////////////////////////////////
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2017-2021 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef RESULT_RESULT_WIRE_HPP
+#define RESULT_RESULT_WIRE_HPP
+
+#include "result.hpp"
+
+#include <array>       // std::array
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uintptr_t
+#include <cstring>     // std::memcpy
+#include <memory>      // std::addressof
+#include <string>      // std::string
+#include <system_error> // std::error_category, std::error_code
+#include <type_traits> // std::is_trivially_copyable
+
+#if __cplusplus >= 202002L && defined(__has_include)
+# if __has_include(<span>)
+#   include <span> // std::span
+# endif
+#endif
+
+#if defined(__cpp_lib_span) && __cpp_lib_span >= 202002L
+# define RESULT_HAS_SPAN 1
+#else
+# define RESULT_HAS_SPAN 0
+#endif
+
+#if defined(RESULT_NAMESPACE)
+# define RESULT_NAMESPACE_INTERNAL RESULT_NAMESPACE
+#else
+# define RESULT_NAMESPACE_INTERNAL cpp
+#endif
+#define RESULT_NS_IMPL RESULT_NAMESPACE_INTERNAL::bitwizeshift
+
+namespace RESULT_NAMESPACE_INTERNAL {
+inline namespace bitwizeshift {
+
+  //===========================================================================
+  // enum : wire_errc
+  //===========================================================================
+
+  /// \brief The reasons that a buffer could not be read or written in the
+  ///        wire format
+  enum class wire_errc
+  {
+    truncated = 1,   ///< The buffer is smaller than the encoded result
+    invalid_tag = 2, ///< The buffer does not start with a valid tag
+    misaligned = 3,  ///< The value in the buffer is not suitably aligned to
+                     ///< be viewed in place
+  };
+
+  /// \brief Gets the error category of `wire_errc`
+  ///
+  /// \return the category
+  auto wire_category() noexcept -> const std::error_category&;
+
+  /// \brief Makes an error code from \p error
+  ///
+  /// This allows a `wire_errc` to be converted to a `std::error_code`, so
+  /// that the reason a buffer could not be read may be reported with other
+  /// errors in the process.
+  ///
+  /// \param error the error
+  /// \return the error code
+  auto make_error_code(wire_errc error) noexcept -> std::error_code;
+
+  //===========================================================================
+  // trait : enable_wire_format<T>
+  //===========================================================================
+
+  /////////////////////////////////////////////////////////////////////////////
+  /// \brief A trait that determines whether the object representation of
+  ///        \p T may be sent in the wire format
+  ///
+  /// A pointer is only meaningful within the process that formed it, so types
+  /// that hold one cannot be decoded by another process. This is `false` for
+  /// pointers, and for `std::error_code` and `std::error_condition`, which
+  /// refer to their category by pointer; every other trivially copyable type
+  /// is enabled.
+  ///
+  /// This cannot detect pointers that are members of other types, so a type
+  /// with a pointer member should be disabled by specializing this trait:
+  ///
+  /// ```cpp
+  /// template <>
+  /// struct cpp::enable_wire_format<message> : std::false_type{};
+  /// ```
+  ///
+  /// A pointer that is only sent within a process -- such as through a pipe to
+  /// another thread -- may be enabled in the same way.
+  ///
+  /// \tparam T the type to check
+  /////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  struct enable_wire_format : std::integral_constant<bool,
+    !std::is_pointer<T>::value && !std::is_member_pointer<T>::value
+  >{};
+
+  template <>
+  struct enable_wire_format<std::error_code> : std::false_type{};
+
+  template <>
+  struct enable_wire_format<std::error_condition> : std::false_type{};
+
+  //===========================================================================
+  // struct : wire_layout<R>
+  //===========================================================================
+
+  /////////////////////////////////////////////////////////////////////////////
+  /// \brief The layout of a result of type \p R in the wire format
+  ///
+  /// A result is encoded as a header of `header_size()` bytes followed by the
+  /// object representation of either its value or its error:
+  ///
+  /// | Offset          | Contents                                        |
+  /// |-----------------|-------------------------------------------------|
+  /// | `0`             | The tag: `0x01` for a value, `0x02` for an error |
+  /// | `1`             | Zero padding up to `header_size()`              |
+  /// | `header_size()` | The bytes of the value or the error             |
+  ///
+  /// The header is as large as the strictest alignment of `T` and `E`, so
+  /// that a value in a suitably aligned buffer may be viewed without being
+  /// copied. A `result<void,E>` with a value has no payload.
+  ///
+  /// Since the payload is the object representation, both ends must agree
+  /// on the layout of `T` and `E`, including their endianness, and neither
+  /// may hold a pointer (see `enable_wire_format`).
+  ///
+  /// \tparam R the result type
+  /////////////////////////////////////////////////////////////////////////////
+  template <typename R>
+  struct wire_layout;
+
+  template <typename T, typename E>
+  struct wire_layout<result<T,E>>
+  {
+    static_assert(
+      std::is_void<T>::value || (
+        !std::is_reference<T>::value && std::is_trivially_copyable<T>::value
+      ),
+      "The wire format requires T to be void or a trivially copyable object type"
+    );
+    static_assert(
+      std::is_trivially_copyable<E>::value,
+      "The wire format requires E to be trivially copyable"
+    );
+    static_assert(
+      std::is_void<T>::value ||
+        enable_wire_format<typename std::remove_cv<T>::type>::value,
+      "The wire format requires T to hold no pointers, since they cannot be "
+      "decoded by another process. Specialize 'enable_wire_format' to allow it."
+    );
+    static_assert(
+      enable_wire_format<typename std::remove_cv<E>::type>::value,
+      "The wire format requires E to hold no pointers, since they cannot be "
+      "decoded by another process. Specialize 'enable_wire_format' to allow it. "
+      "'std::error_code' refers to its category by pointer; send its value "
+      "as an enum instead."
+    );
+
+    /// \brief Gets the alignment of the payload
+    static constexpr auto alignment() noexcept -> std::size_t;
+
+    /// \brief Gets the size of the header that precedes the payload
+    static constexpr auto header_size() noexcept -> std::size_t;
+
+    /// \brief Gets the size of the payload of a result with a value
+    static constexpr auto value_size() noexcept -> std::size_t;
+
+    /// \brief Gets the size of the payload of a result with an error
+    static constexpr auto error_size() noexcept -> std::size_t;
+
+    /// \brief Gets the size of the largest encoding of a result
+    static constexpr auto max_size() noexcept -> std::size_t;
+  };
+
+  //===========================================================================
+  // struct : wire_buffer
+  //===========================================================================
+
+  /////////////////////////////////////////////////////////////////////////////
+  /// \brief A contiguous range of bytes to be written, matching the layout
+  ///        of a POSIX `iovec`
+  /////////////////////////////////////////////////////////////////////////////
+  struct wire_buffer
+  {
+    const void* data;
+    std::size_t size;
+  };
+
+  namespace detail {
+
+    /// \brief The object type whose alignment a value of type \p T needs,
+    ///        which is `char` for `void`
+    template <typename T>
+    using wire_object_t = typename std::conditional<
+      std::is_void<T>::value, char, T
+    >::type;
+
+    template <typename R>
+    struct wire_view;
+
+    template <typename T, typename E>
+    struct wire_view<result<T,E>>
+    {
+      using type = result<const T&, E>;
+    };
+
+    template <typename E>
+    struct wire_view<result<void,E>>
+    {
+      using type = result<void, E>;
+    };
+
+    /// \brief The default conversion of a `wire_errc` to the error of \p R,
+    ///        which constructs the error from it
+    template <typename R>
+    struct wire_error_constructor
+    {
+      using error_type = typename R::error_type;
+
+      static_assert(
+        std::is_constructible<error_type, wire_errc>::value,
+        "The error type must be constructible from 'wire_errc', or a "
+        "function converting 'wire_errc' to the error type must be given"
+      );
+
+      auto operator()(wire_errc error) const -> error_type
+      {
+        return error_type(error);
+      }
+    };
+
+  } // namespace detail
+
+  /// \brief The type of a result of type \p R that is viewed in place in a
+  ///        buffer; the value is referenced, and the error is copied
+  template <typename R>
+  using wire_view_t = typename detail::wire_view<R>::type;
+
+  //===========================================================================
+  // functions : wire format
+  //===========================================================================
+
+  /// \brief Gets the number of bytes that \p r is encoded in
+  ///
+  /// \param r the result
+  /// \return the size of the encoding
+  template <typename T, typename E>
+  constexpr auto wire_size(const result<T,E>& r) noexcept -> std::size_t;
+
+  /// \brief Encodes \p r into the buffer \p out of \p size bytes
+  ///
+  /// ### Examples
+  ///
+  /// Basic Usage:
+  ///
+  /// ```cpp
+  /// unsigned char buffer[cpp::wire_layout<cpp::result<order,errc>>::max_size()];
+  ///
+  /// auto written = cpp::wire_write(match_order(o), buffer, sizeof(buffer));
+  /// send(socket, buffer, *written, 0);
+  /// ```
+  ///
+  /// \param r the result
+  /// \param out the buffer to write to
+  /// \param size the size of \p out
+  /// \return the number of bytes written, or `wire_errc::truncated` if \p out
+  ///         is too small
+  template <typename T, typename E>
+  auto wire_write(const result<T,E>& r, void* out, std::size_t size)
+    noexcept -> result<std::size_t, wire_errc>;
+
+  /// \brief Gets the encoding of \p r as a header and a payload, without
+  ///        copying either
+  ///
+  /// The header refers to static storage, and the payload refers to the
+  /// contents of \p r, so the buffers are only valid while \p r is alive and
+  /// unmodified. Results that encode their error in niche storage (see
+  /// `result_niche_traits`) have no error object to refer to, and must be
+  /// encoded with `wire_write` instead. This may be given directly to a
+  /// gathering write:
+  ///
+  /// ```cpp
+  /// const auto buffers = cpp::wire_buffers(r);
+  /// iovec iov[2] = {
+  ///   {const_cast<void*>(buffers[0].data), buffers[0].size},
+  ///   {const_cast<void*>(buffers[1].data), buffers[1].size},
+  /// };
+  /// writev(fd, iov, 2);
+  /// ```
+  ///
+  /// \param r the result
+  /// \return the header and payload buffers
+  template <typename T, typename E>
+  auto wire_buffers(const result<T,E>& r) noexcept -> std::array<wire_buffer,2>;
+
+  /// \brief Decodes a result of type \p R by copying it out of the buffer
+  ///        \p data of \p size bytes
+  ///
+  /// If the buffer does not hold a valid encoding, the result contains the
+  /// error returned by invoking \p on_invalid with the reason. By default,
+  /// the error is constructed from the `wire_errc`, which requires the error
+  /// type to be constructible from it.
+  ///
+  /// \tparam R the result type
+  /// \param data the buffer to read
+  /// \param size the size of \p data
+  /// \param on_invalid the function that converts a `wire_errc` to an error
+  /// \return the result
+  template <typename R, typename Fn = detail::wire_error_constructor<R>>
+  auto wire_read(const void* data, std::size_t size, Fn&& on_invalid = Fn{})
+    -> R;
+
+  /// \brief Decodes a result of type \p R in place in the buffer \p data of
+  ///        \p size bytes
+  ///
+  /// The value is referenced rather than copied, so the buffer -- which may
+  /// be memory-mapped -- must outlive the result, and must be aligned to
+  /// `wire_layout<R>::alignment()`. Invalid encodings are handled as in
+  /// `wire_read`.
+  ///
+  /// ### Examples
+  ///
+  /// Basic Usage:
+  ///
+  /// ```cpp
+  /// auto r = cpp::wire_view<cpp::result<order,errc>>(
+  ///   mapped, mapped_size, [](cpp::wire_errc) { return errc::corrupt; }
+  /// );
+  /// if (r) {
+  ///   const order& o = *r; // refers into 'mapped'
+  /// }
+  /// ```
+  ///
+  /// \tparam R the result type
+  /// \param data the buffer to read
+  /// \param size the size of \p data
+  /// \param on_invalid the function that converts a `wire_errc` to an error
+  /// \return a view of the result
+  template <typename R, typename Fn = detail::wire_error_constructor<R>>
+  auto wire_view(const void* data, std::size_t size, Fn&& on_invalid = Fn{})
+    -> wire_view_t<R>;
+
+#if RESULT_HAS_SPAN
+
+  /// \brief Encodes \p r into the bytes \p out
+  ///
+  /// \param r the result
+  /// \param out the bytes to write to
+  /// \return the number of bytes written, or `wire_errc::truncated`
+  template <typename T, typename E>
+  auto wire_write(const result<T,E>& r, std::span<std::byte> out)
+    noexcept -> result<std::size_t, wire_errc>;
+
+  /// \brief Decodes a result of type \p R by copying it out of \p bytes
+  ///
+  /// \tparam R the result type
+  /// \param bytes the bytes to read
+  /// \param on_invalid the function that converts a `wire_errc` to an error
+  /// \return the result
+  template <typename R, typename Fn = detail::wire_error_constructor<R>>
+  auto wire_read(std::span<const std::byte> bytes, Fn&& on_invalid = Fn{})
+    -> R;
+
+  /// \brief Decodes a result of type \p R in place in \p bytes
+  ///
+  /// \tparam R the result type
+  /// \param bytes the bytes to read
+  /// \param on_invalid the function that converts a `wire_errc` to an error
+  /// \return a view of the result
+  template <typename R, typename Fn = detail::wire_error_constructor<R>>
+  auto wire_view(std::span<const std::byte> bytes, Fn&& on_invalid = Fn{})
+    -> wire_view_t<R>;
+
+#endif // RESULT_HAS_SPAN
+
+  namespace detail {
+
+    //=========================================================================
+    // utilities : wire format
+    //=========================================================================
+
+    enum : unsigned char
+    {
+      wire_value_tag = 0x01,
+      wire_error_tag = 0x02,
+    };
+
+    /// \brief The headers of each tag for a header of \p Size bytes
+    template <std::size_t Size>
+    struct wire_headers
+    {
+      static const unsigned char value[Size];
+      static const unsigned char error[Size];
+    };
+
+    /// \brief Reads and writes the payloads of a result of type \p R
+    template <typename R>
+    struct wire_codec;
+
+    template <typename T, typename E>
+    struct wire_codec<result<T,E>>
+    {
+      static auto value_address(const result<T,E>& r) noexcept -> const void*;
+      static auto read_value(const unsigned char* payload) noexcept -> result<T,E>;
+      static auto view_value(const unsigned char* payload) noexcept -> result<const T&,E>;
+    };
+
+    template <typename E>
+    struct wire_codec<result<void,E>>
+    {
+      static auto value_address(const result<void,E>& r) noexcept -> const void*;
+      static auto read_value(const unsigned char* payload) noexcept -> result<void,E>;
+      static auto view_value(const unsigned char* payload) noexcept -> result<void,E>;
+    };
+
+    /// \brief Copies the error of type \p E out of \p payload
+    template <typename E>
+    auto wire_read_error(const unsigned char* payload) noexcept -> E;
+
+    /// \brief Checks that \p data of \p size bytes holds a valid header and a
+    ///        payload of the size that its tag requires
+    template <typename R>
+    auto wire_check(const unsigned char* data, std::size_t size)
+      noexcept -> result<void, wire_errc>;
+
+  } // namespace detail
+} // inline namespace bitwizeshift
+} // namespace RESULT_NAMESPACE_INTERNAL
+
+namespace std {
+
+  template <>
+  struct is_error_code_enum<::RESULT_NS_IMPL::wire_errc> : true_type{};
+
+} // namespace std
+
+//=============================================================================
+// enum : wire_errc
+//=============================================================================
+
+inline
+auto RESULT_NS_IMPL::wire_category()
+  noexcept -> const std::error_category&
+{
+  class category final : public std::error_category
+  {
+  public:
+    auto name() const noexcept -> const char* override
+    {
+      return "wire";
+    }
+
+    auto message(int condition) const -> std::string override
+    {
+      switch (static_cast<wire_errc>(condition)) {
+        case wire_errc::truncated:
+          return "buffer is smaller than the encoded result";
+        case wire_errc::invalid_tag:
+          return "buffer does not start with a valid tag";
+        case wire_errc::misaligned:
+          return "value is not suitably aligned";
+      }
+      return "unknown wire error";
+    }
+  };
+
+  static const category instance{};
+  return instance;
+}
+
+inline
+auto RESULT_NS_IMPL::make_error_code(wire_errc error)
+  noexcept -> std::error_code
+{
+  return std::error_code{static_cast<int>(error), wire_category()};
+}
+
+//=============================================================================
+// struct : wire_layout<R>
+//=============================================================================
+
+template <typename T, typename E>
+inline constexpr
+auto RESULT_NS_IMPL::wire_layout<RESULT_NS_IMPL::result<T,E>>::alignment()
+  noexcept -> std::size_t
+{
+  return alignof(E) > alignof(detail::wire_object_t<T>)
+    ? alignof(E)
+    : alignof(detail::wire_object_t<T>);
+}
+
+template <typename T, typename E>
+inline constexpr
+auto RESULT_NS_IMPL::wire_layout<RESULT_NS_IMPL::result<T,E>>::header_size()
+  noexcept -> std::size_t
+{
+  return alignment();
+}
+
+template <typename T, typename E>
+inline constexpr
+auto RESULT_NS_IMPL::wire_layout<RESULT_NS_IMPL::result<T,E>>::value_size()
+  noexcept -> std::size_t
+{
+  return std::is_void<T>::value ? 0u : sizeof(detail::wire_object_t<T>);
+}
+
+template <typename T, typename E>
+inline constexpr
+auto RESULT_NS_IMPL::wire_layout<RESULT_NS_IMPL::result<T,E>>::error_size()
+  noexcept -> std::size_t
+{
+  return sizeof(E);
+}
+
+template <typename T, typename E>
+inline constexpr
+auto RESULT_NS_IMPL::wire_layout<RESULT_NS_IMPL::result<T,E>>::max_size()
+  noexcept -> std::size_t
+{
+  return header_size() + (value_size() > error_size() ? value_size() : error_size());
+}
+
+//=============================================================================
+// functions : wire format
+//=============================================================================
+
+template <typename T, typename E>
+inline constexpr
+auto RESULT_NS_IMPL::wire_size(const result<T,E>& r)
+  noexcept -> std::size_t
+{
+  using layout = wire_layout<result<T,E>>;
+
+  return layout::header_size() +
+    (r.has_value() ? layout::value_size() : layout::error_size());
+}
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::wire_write(const result<T,E>& r, void* out, std::size_t size)
+  noexcept -> result<std::size_t, wire_errc>
+{
+  const auto n = wire_size(r);
+  if (size < n) {
+    return fail(wire_errc::truncated);
+  }
+
+  using layout = wire_layout<result<T,E>>;
+  using headers = detail::wire_headers<layout::header_size()>;
+
+  auto* bytes = static_cast<unsigned char*>(out);
+
+  if (r.has_value()) {
+    std::memcpy(bytes, headers::value, layout::header_size());
+    if (layout::value_size() != 0u) {
+      std::memcpy(
+        bytes + layout::header_size(),
+        detail::wire_codec<result<T,E>>::value_address(r),
+        layout::value_size()
+      );
+    }
+    return n;
+  }
+
+  // The error is copied out first, since niche storage has no error object
+  // to copy from
+  const E error = detail::extract_error(r);
+
+  std::memcpy(bytes, headers::error, layout::header_size());
+  std::memcpy(bytes + layout::header_size(), std::addressof(error), layout::error_size());
+  return n;
+}
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::wire_buffers(const result<T,E>& r)
+  noexcept -> std::array<wire_buffer,2>
+{
+  static_assert(
+    std::is_reference<detail::result_const_error_reference<T,E>>::value,
+    "wire_buffers cannot refer to the error of a result that encodes it in "
+    "niche storage, since there is no error object. Use wire_write instead."
+  );
+
+  using layout = wire_layout<result<T,E>>;
+  using headers = detail::wire_headers<layout::header_size()>;
+
+  if (r.has_value()) {
+    return {{
+      wire_buffer{headers::value, layout::header_size()},
+      wire_buffer{detail::wire_codec<result<T,E>>::value_address(r), layout::value_size()},
+    }};
+  }
+  return {{
+    wire_buffer{headers::error, layout::header_size()},
+    wire_buffer{std::addressof(detail::extract_error(r)), layout::error_size()},
+  }};
+}
+
+template <typename R, typename Fn>
+inline
+auto RESULT_NS_IMPL::wire_read(const void* data,
+                               std::size_t size,
+                               Fn&& on_invalid)
+  -> R
+{
+  using layout = wire_layout<R>;
+  using error_type = typename R::error_type;
+
+  const auto* bytes = static_cast<const unsigned char*>(data);
+  const auto check = detail::wire_check<R>(bytes, size);
+  if (!check) {
+    return R{in_place_error, detail::invoke(detail::forward<Fn>(on_invalid), check.error())};
+  }
+
+  const auto* payload = bytes + layout::header_size();
+  if (bytes[0] == detail::wire_value_tag) {
+    return detail::wire_codec<R>::read_value(payload);
+  }
+  return R{in_place_error, detail::wire_read_error<error_type>(payload)};
+}
+
+template <typename R, typename Fn>
+inline
+auto RESULT_NS_IMPL::wire_view(const void* data,
+                               std::size_t size,
+                               Fn&& on_invalid)
+  -> wire_view_t<R>
+{
+  using layout = wire_layout<R>;
+  using error_type = typename R::error_type;
+  using view_type = wire_view_t<R>;
+
+  const auto* bytes = static_cast<const unsigned char*>(data);
+  const auto check = detail::wire_check<R>(bytes, size);
+  if (!check) {
+    return view_type{in_place_error, detail::invoke(detail::forward<Fn>(on_invalid), check.error())};
+  }
+
+  const auto* payload = bytes + layout::header_size();
+  if (bytes[0] == detail::wire_value_tag) {
+    if (reinterpret_cast<std::uintptr_t>(payload) % layout::alignment() != 0u) {
+      return view_type{in_place_error, detail::invoke(detail::forward<Fn>(on_invalid), wire_errc::misaligned)};
+    }
+    return detail::wire_codec<R>::view_value(payload);
+  }
+  return view_type{in_place_error, detail::wire_read_error<error_type>(payload)};
+}
+
+#if RESULT_HAS_SPAN
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::wire_write(const result<T,E>& r, std::span<std::byte> out)
+  noexcept -> result<std::size_t, wire_errc>
+{
+  return wire_write(r, out.data(), out.size());
+}
+
+template <typename R, typename Fn>
+inline
+auto RESULT_NS_IMPL::wire_read(std::span<const std::byte> bytes, Fn&& on_invalid)
+  -> R
+{
+  return wire_read<R>(bytes.data(), bytes.size(), detail::forward<Fn>(on_invalid));
+}
+
+template <typename R, typename Fn>
+inline
+auto RESULT_NS_IMPL::wire_view(std::span<const std::byte> bytes, Fn&& on_invalid)
+  -> wire_view_t<R>
+{
+  return wire_view<R>(bytes.data(), bytes.size(), detail::forward<Fn>(on_invalid));
+}
+
+#endif // RESULT_HAS_SPAN
+
+//=============================================================================
+// utilities : wire format
+//=============================================================================
+
+template <std::size_t Size>
+const unsigned char RESULT_NS_IMPL::detail::wire_headers<Size>::value[Size] = {
+  wire_value_tag
+};
+
+template <std::size_t Size>
+const unsigned char RESULT_NS_IMPL::detail::wire_headers<Size>::error[Size] = {
+  wire_error_tag
+};
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::detail::wire_codec<RESULT_NS_IMPL::result<T,E>>::value_address(
+  const result<T,E>& r
+) noexcept -> const void*
+{
+  return std::addressof(*r);
+}
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::detail::wire_codec<RESULT_NS_IMPL::result<T,E>>::read_value(
+  const unsigned char* payload
+) noexcept -> result<T,E>
+{
+  // 'T' need not be default-constructible, so its bytes are copied into
+  // suitably aligned storage rather than into an object
+  alignas(T) unsigned char storage[sizeof(T)];
+  std::memcpy(storage, payload, sizeof(T));
+
+  return result<T,E>{in_place, *reinterpret_cast<const T*>(storage)};
+}
+
+template <typename T, typename E>
+inline
+auto RESULT_NS_IMPL::detail::wire_codec<RESULT_NS_IMPL::result<T,E>>::view_value(
+  const unsigned char* payload
+) noexcept -> result<const T&,E>
+{
+  return result<const T&,E>{*reinterpret_cast<const T*>(payload)};
+}
+
+template <typename E>
+inline
+auto RESULT_NS_IMPL::detail::wire_codec<RESULT_NS_IMPL::result<void,E>>::value_address(
+  const result<void,E>&
+) noexcept -> const void*
+{
+  return nullptr;
+}
+
+template <typename E>
+inline
+auto RESULT_NS_IMPL::detail::wire_codec<RESULT_NS_IMPL::result<void,E>>::read_value(
+  const unsigned char*
+) noexcept -> result<void,E>
+{
+  return result<void,E>{};
+}
+
+template <typename E>
+inline
+auto RESULT_NS_IMPL::detail::wire_codec<RESULT_NS_IMPL::result<void,E>>::view_value(
+  const unsigned char*
+) noexcept -> result<void,E>
+{
+  return result<void,E>{};
+}
+
+template <typename E>
+inline
+auto RESULT_NS_IMPL::detail::wire_read_error(const unsigned char* payload)
+  noexcept -> E
+{
+  alignas(E) unsigned char storage[sizeof(E)];
+  std::memcpy(storage, payload, sizeof(E));
+
+  return *reinterpret_cast<const E*>(storage);
+}
+
+template <typename R>
+inline
+auto RESULT_NS_IMPL::detail::wire_check(const unsigned char* data,
+                                        std::size_t size)
+  noexcept -> result<void, wire_errc>
+{
+  using layout = wire_layout<R>;
+
+  if (size < layout::header_size()) {
+    return fail(wire_errc::truncated);
+  }
+  if (data[0] != wire_value_tag && data[0] != wire_error_tag) {
+    return fail(wire_errc::invalid_tag);
+  }
+
+  const auto payload_size = (data[0] == wire_value_tag)
+    ? layout::value_size()
+    : layout::error_size();
+  if (size - layout::header_size() < payload_size) {
+    return fail(wire_errc::truncated);
+  }
+  return {};
+}
+
+#undef RESULT_HAS_SPAN
+#undef RESULT_NAMESPACE_INTERNAL
+#undef RESULT_NS_IMPL
+
+#endif /* RESULT_RESULT_WIRE_HPP */
@@ -0,0 +1,110 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file result.cppm
+///
+/// \brief This file contains the 'bitwizeshift.result' module interface
+///
+/// The module exports the same public declarations as `result.hpp`. Macros
+/// cannot be exported from a module, so `RESULT_TRY` and `RESULT_TRY_ASSIGN`
+/// still require including the header.
+////////////////////////////////////////////////////////////////////////////////
+
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2017-2021 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+module;
+
+#include "result.hpp"
+
+export module bitwizeshift.result;
+
+#if defined(RESULT_NAMESPACE)
+# define RESULT_NAMESPACE_INTERNAL RESULT_NAMESPACE
+#else
+# define RESULT_NAMESPACE_INTERNAL cpp
+#endif
+
+export namespace RESULT_NAMESPACE_INTERNAL {
+
+  //---------------------------------------------------------------------------
+  // Types
+  //---------------------------------------------------------------------------
+
+  using RESULT_NAMESPACE_INTERNAL::result;
+  using RESULT_NAMESPACE_INTERNAL::failure;
+#if !defined(RESULT_DISABLE_EXCEPTIONS)
+  using RESULT_NAMESPACE_INTERNAL::bad_result_access;
+#endif
+
+  using RESULT_NAMESPACE_INTERNAL::in_place_t;
+  using RESULT_NAMESPACE_INTERNAL::in_place;
+  using RESULT_NAMESPACE_INTERNAL::in_place_error_t;
+  using RESULT_NAMESPACE_INTERNAL::in_place_error;
+
+  using RESULT_NAMESPACE_INTERNAL::source_location;
+  using RESULT_NAMESPACE_INTERNAL::bad_result_access_info;
+  using RESULT_NAMESPACE_INTERNAL::bad_result_access_handler;
+
+#if defined(RESULT_ENABLE_STATS)
+  using RESULT_NAMESPACE_INTERNAL::failure_stats;
+  using RESULT_NAMESPACE_INTERNAL::failure_count;
+#endif
+#if defined(RESULT_ENABLE_TRACE)
+  using RESULT_NAMESPACE_INTERNAL::failure_trace;
+  using RESULT_NAMESPACE_INTERNAL::failure_trace_entry;
+#endif
+
+  //---------------------------------------------------------------------------
+  // Traits
+  //---------------------------------------------------------------------------
+
+  using RESULT_NAMESPACE_INTERNAL::is_result;
+  using RESULT_NAMESPACE_INTERNAL::is_failure;
+  using RESULT_NAMESPACE_INTERNAL::result_niche_traits;
+  using RESULT_NAMESPACE_INTERNAL::pointer_niche_traits;
+  using RESULT_NAMESPACE_INTERNAL::enum_niche_traits;
+  using RESULT_NAMESPACE_INTERNAL::enable_compact_void_result;
+  using RESULT_NAMESPACE_INTERNAL::enable_throwing_assignment;
+  using RESULT_NAMESPACE_INTERNAL::is_trivially_relocatable;
+
+  //---------------------------------------------------------------------------
+  // Functions
+  //---------------------------------------------------------------------------
+
+  using RESULT_NAMESPACE_INTERNAL::fail;
+  using RESULT_NAMESPACE_INTERNAL::swap;
+  using RESULT_NAMESPACE_INTERNAL::uninitialized_relocate;
+
+  using RESULT_NAMESPACE_INTERNAL::set_bad_result_access_handler;
+  using RESULT_NAMESPACE_INTERNAL::get_bad_result_access_handler;
+
+  using RESULT_NAMESPACE_INTERNAL::operator==;
+  using RESULT_NAMESPACE_INTERNAL::operator!=;
+  using RESULT_NAMESPACE_INTERNAL::operator<;
+  using RESULT_NAMESPACE_INTERNAL::operator>;
+  using RESULT_NAMESPACE_INTERNAL::operator<=;
+  using RESULT_NAMESPACE_INTERNAL::operator>=;
+
+} // namespace RESULT_NAMESPACE_INTERNAL
+
+#undef RESULT_NAMESPACE_INTERNAL
@@ -0,0 +1,293 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020-2021 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include "result.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <memory>
+#include <scoped_allocator>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if __cplusplus >= 201703L && defined(__has_include)
+# if __has_include(<memory_resource>)
+#  include <memory_resource>
+#  define RESULT_TEST_HAS_MEMORY_RESOURCE 1
+# endif
+#endif
+
+namespace cpp {
+namespace test {
+namespace {
+
+// A stateful allocator, where the state identifies which allocator a value
+// was constructed with
+template <typename T>
+struct tagged_allocator
+{
+  using value_type = T;
+
+  tagged_allocator() noexcept = default;
+  explicit tagged_allocator(int tag) noexcept : tag{tag}{}
+  template <typename U>
+  tagged_allocator(const tagged_allocator<U>& other) noexcept : tag{other.tag}{}
+
+  auto allocate(std::size_t n) -> T*
+  {
+    return std::allocator<T>{}.allocate(n);
+  }
+  auto deallocate(T* p, std::size_t n) noexcept -> void
+  {
+    std::allocator<T>{}.deallocate(p, n);
+  }
+
+  int tag = 0;
+};
+
+template <typename T, typename U>
+auto operator==(const tagged_allocator<T>& lhs, const tagged_allocator<U>& rhs)
+  noexcept -> bool
+{
+  return lhs.tag == rhs.tag;
+}
+
+template <typename T, typename U>
+auto operator!=(const tagged_allocator<T>& lhs, const tagged_allocator<U>& rhs)
+  noexcept -> bool
+{
+  return lhs.tag != rhs.tag;
+}
+
+// Uses an allocator with the leading 'std::allocator_arg' convention
+struct leading_payload
+{
+  using allocator_type = tagged_allocator<char>;
+
+  leading_payload() = default;
+  explicit leading_payload(int value) : value{value}{}
+  leading_payload(const leading_payload&) = default;
+
+  leading_payload(std::allocator_arg_t, const allocator_type& alloc)
+    : tag{alloc.tag}{}
+  leading_payload(std::allocator_arg_t, const allocator_type& alloc, int value)
+    : value{value}, tag{alloc.tag}{}
+  leading_payload(std::allocator_arg_t,
+                  const allocator_type& alloc,
+                  const leading_payload& other)
+    : value{other.value}, tag{alloc.tag}{}
+
+  int value = 0;
+  int tag = 0;
+};
+
+// Uses an allocator with the trailing allocator convention
+struct trailing_payload
+{
+  using allocator_type = tagged_allocator<char>;
+
+  trailing_payload() = default;
+  explicit trailing_payload(int value) : value{value}{}
+  trailing_payload(const trailing_payload&) = default;
+
+  explicit trailing_payload(const allocator_type& alloc) : tag{alloc.tag}{}
+  trailing_payload(int value, const allocator_type& alloc)
+    : value{value}, tag{alloc.tag}{}
+  trailing_payload(const trailing_payload& other, const allocator_type& alloc)
+    : value{other.value}, tag{alloc.tag}{}
+
+  int value = 0;
+  int tag = 0;
+};
+
+using tagged = tagged_allocator<char>;
+
+static_assert(std::uses_allocator<result<leading_payload,int>,tagged>::value, "");
+static_assert(std::uses_allocator<result<int,trailing_payload>,tagged>::value, "");
+static_assert(std::uses_allocator<result<void,leading_payload>,tagged>::value, "");
+static_assert(!std::uses_allocator<result<int,int>,tagged>::value, "");
+static_assert(!std::uses_allocator<result<void,int>,tagged>::value, "");
+
+} // namespace <anonymous>
+
+//=============================================================================
+// class : result<T, E> (allocator-extended)
+//=============================================================================
+
+TEST_CASE("result<T,E>::result(std::allocator_arg_t, const Alloc&, ...)", "[ctor][allocator]") {
+  const auto alloc = tagged{42};
+
+  SECTION("Default constructs the value with the allocator") {
+    const result<leading_payload,int> sut{std::allocator_arg, alloc};
+
+    REQUIRE(sut.has_value());
+    REQUIRE(sut->tag == 42);
+  }
+  SECTION("Value uses a leading allocator") {
+    const result<leading_payload,int> sut{std::allocator_arg, alloc, in_place, 5};
+
+    SECTION("Contains value") {
+      REQUIRE(sut.has_value());
+      REQUIRE(sut->value == 5);
+    }
+    SECTION("Value received the allocator") {
+      REQUIRE(sut->tag == 42);
+    }
+  }
+  SECTION("Value uses a trailing allocator") {
+    const result<trailing_payload,int> sut{std::allocator_arg, alloc, in_place, 5};
+
+    REQUIRE(sut->value == 5);
+    REQUIRE(sut->tag == 42);
+  }
+  SECTION("Value is converted with the allocator") {
+    const result<leading_payload,int> sut{std::allocator_arg, alloc, leading_payload{5}};
+
+    REQUIRE(sut->value == 5);
+    REQUIRE(sut->tag == 42);
+  }
+  SECTION("Error uses the allocator") {
+    const result<int,trailing_payload> sut{std::allocator_arg, alloc, in_place_error, 5};
+
+    SECTION("Contains error") {
+      REQUIRE(sut.has_error());
+      REQUIRE(sut.error().value == 5);
+    }
+    SECTION("Error received the allocator") {
+      REQUIRE(sut.error().tag == 42);
+    }
+  }
+  SECTION("Failure is constructed with the allocator") {
+    const result<int,leading_payload> sut{std::allocator_arg, alloc, fail(5)};
+
+    REQUIRE(sut.error().value == 5);
+    REQUIRE(sut.error().tag == 42);
+  }
+  SECTION("Types without allocators ignore it") {
+    const result<int,std::string> sut{std::allocator_arg, alloc, in_place_error, "error"};
+
+    REQUIRE(sut.error() == "error");
+  }
+  SECTION("Copies are rebound to the new allocator") {
+    const result<leading_payload,int> original{std::allocator_arg, tagged{1}, in_place, 5};
+    const result<leading_payload,int> sut{std::allocator_arg, alloc, original};
+
+    REQUIRE(sut->value == 5);
+    REQUIRE(original->tag == 1);
+    REQUIRE(sut->tag == 42);
+  }
+  SECTION("Converted results are rebound to the new allocator") {
+    auto original = result<int,int>{fail(5)};
+    const result<int,trailing_payload> sut{std::allocator_arg, alloc, std::move(original)};
+
+    REQUIRE(sut.error().value == 5);
+    REQUIRE(sut.error().tag == 42);
+  }
+  SECTION("References ignore the allocator") {
+    auto value = leading_payload{5};
+    const result<leading_payload&,int> sut{std::allocator_arg, alloc, value};
+
+    REQUIRE(&*sut == &value);
+  }
+}
+
+TEST_CASE("result<void,E>::result(std::allocator_arg_t, const Alloc&, ...)", "[ctor][allocator]") {
+  const auto alloc = tagged{42};
+
+  SECTION("Default constructs a value") {
+    const result<void,leading_payload> sut{std::allocator_arg, alloc};
+
+    REQUIRE(sut.has_value());
+  }
+  SECTION("Error uses the allocator") {
+    const result<void,leading_payload> sut{std::allocator_arg, alloc, in_place_error, 5};
+
+    REQUIRE(sut.error().value == 5);
+    REQUIRE(sut.error().tag == 42);
+  }
+  SECTION("Copies are rebound to the new allocator") {
+    const result<void,trailing_payload> original{fail(trailing_payload{5})};
+    const result<void,trailing_payload> sut{std::allocator_arg, alloc, original};
+
+    REQUIRE(sut.error().value == 5);
+    REQUIRE(sut.error().tag == 42);
+  }
+}
+
+TEST_CASE("result<T,E> in an allocator-aware container", "[allocator]") {
+  using allocator_type = std::scoped_allocator_adaptor<
+    tagged_allocator<result<leading_payload,trailing_payload>>
+  >;
+  auto sut = std::vector<result<leading_payload,trailing_payload>,allocator_type>{
+    allocator_type{tagged_allocator<char>{42}}
+  };
+
+  sut.emplace_back(in_place, 1);
+  sut.emplace_back(fail(2));
+  sut.push_back(result<leading_payload,trailing_payload>{in_place, 3});
+
+  SECTION("Values are constructed with the container's allocator") {
+    REQUIRE(sut[0]->value == 1);
+    REQUIRE(sut[0]->tag == 42);
+  }
+  SECTION("Errors are constructed with the container's allocator") {
+    REQUIRE(sut[1].error().value == 2);
+    REQUIRE(sut[1].error().tag == 42);
+  }
+  SECTION("Inserted results are rebound to the container's allocator") {
+    REQUIRE(sut[2]->value == 3);
+    REQUIRE(sut[2]->tag == 42);
+  }
+}
+
+#if defined(RESULT_TEST_HAS_MEMORY_RESOURCE)
+
+TEST_CASE("result<T,E> in a std::pmr container", "[allocator]") {
+  auto resource = std::pmr::monotonic_buffer_resource{};
+  auto sut = std::pmr::vector<result<std::pmr::string,std::pmr::string>>{&resource};
+
+  sut.emplace_back("a value that is too long for the small string buffer");
+  sut.emplace_back(fail("an error that is too long for the small string buffer"));
+
+  SECTION("Values use the container's memory resource") {
+    REQUIRE(sut[0]->get_allocator().resource() == &resource);
+  }
+  SECTION("Errors use the container's memory resource") {
+    REQUIRE(sut[1].error_ref().get_allocator().resource() == &resource);
+  }
+  SECTION("Copies into the container use its memory resource") {
+    const auto value = result<std::pmr::string,std::pmr::string>{"value"};
+    sut.push_back(value);
+
+    REQUIRE(value->get_allocator().resource() != &resource);
+    REQUIRE(sut.back()->get_allocator().resource() == &resource);
+  }
+}
+
+#endif // defined(RESULT_TEST_HAS_MEMORY_RESOURCE)
+
+} // namespace test
+} // namespace cpp
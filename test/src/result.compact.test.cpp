@@ -0,0 +1,159 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020-2021 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include "result.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <system_error>
+#include <type_traits>
+
+namespace cpp {
+namespace test {
+namespace {
+
+enum class io_errc {
+  ok,
+  closed,
+  timeout,
+};
+
+} // namespace <anonymous>
+} // namespace test
+
+template <>
+struct enable_compact_void_result<test::io_errc> : std::true_type{};
+template <>
+struct enable_compact_void_result<std::error_code> : std::true_type{};
+
+namespace test {
+namespace {
+
+static_assert(sizeof(result<void,io_errc>) == sizeof(io_errc), "");
+static_assert(sizeof(result<void,std::error_code>) == sizeof(std::error_code), "");
+static_assert(std::is_trivially_copyable<result<void,io_errc>>::value, "");
+
+// Only result<void,E> uses compact storage
+static_assert(sizeof(result<int,io_errc>) > sizeof(io_errc), "");
+
+} // namespace <anonymous>
+
+//=============================================================================
+// class : result<void, E> (compact storage)
+//=============================================================================
+
+TEST_CASE("constexpr result<void,E> with compact storage", "[compact][constexpr]") {
+  SECTION("Default constructed contains value") {
+    constexpr auto sut = result<void,io_errc>{};
+
+    STATIC_REQUIRE(sut.has_value());
+  }
+  SECTION("Error constructed contains error") {
+    constexpr auto sut = result<void,io_errc>{in_place_error, io_errc::timeout};
+
+    STATIC_REQUIRE(sut.error() == io_errc::timeout);
+  }
+}
+
+TEST_CASE("result<void,E> with compact storage", "[compact]") {
+  using sut_type = result<void,std::error_code>;
+
+  SECTION("Value is active") {
+    const auto sut = sut_type{};
+
+    SECTION("Contains value") {
+      REQUIRE(sut.has_value());
+    }
+    SECTION("Error is default-constructed") {
+      REQUIRE(sut.error() == std::error_code{});
+    }
+  }
+  SECTION("Error is active") {
+    const auto error = std::make_error_code(std::errc::io_error);
+    const auto sut = sut_type{fail(error)};
+
+    SECTION("Contains error") {
+      REQUIRE(sut.has_error());
+    }
+    SECTION("Error is the stored error") {
+      REQUIRE(sut.error() == error);
+    }
+  }
+  SECTION("Failure contains the default error state") {
+    const auto sut = sut_type{fail(std::error_code{})};
+
+    SECTION("Contains value") {
+      REQUIRE(sut.has_value());
+    }
+  }
+}
+
+TEST_CASE("result<void,E>::operator= with compact storage", "[compact][assign]") {
+  using sut_type = result<void,io_errc>;
+
+  SECTION("Assigns error to value") {
+    auto sut = sut_type{};
+    sut = fail(io_errc::closed);
+
+    REQUIRE(sut.error() == io_errc::closed);
+  }
+  SECTION("Assigns value to error") {
+    auto sut = sut_type{fail(io_errc::closed)};
+    sut = sut_type{};
+
+    REQUIRE(sut.has_value());
+  }
+}
+
+TEST_CASE("result<void,E>::result(const result<T2,E2>&) with compact storage", "[compact][ctor]") {
+  SECTION("Discards the value") {
+    const auto source = result<int,io_errc>{42};
+    const auto sut = result<void,io_errc>{source};
+
+    REQUIRE(sut.has_value());
+  }
+  SECTION("Copies the error") {
+    const auto source = result<int,io_errc>{fail(io_errc::timeout)};
+    const auto sut = result<void,io_errc>{source};
+
+    REQUIRE(sut.error() == io_errc::timeout);
+  }
+}
+
+TEST_CASE("swap(result<void,E>&, result<void,E>&) with compact storage", "[compact][utility]") {
+  auto lhs = result<void,io_errc>{fail(io_errc::closed)};
+  auto rhs = result<void,io_errc>{fail(io_errc::timeout)};
+
+  swap(lhs, rhs);
+
+  SECTION("Left contains right's error") {
+    REQUIRE(lhs.error() == io_errc::timeout);
+  }
+  SECTION("Right contains left's error") {
+    REQUIRE(rhs.error() == io_errc::closed);
+  }
+}
+
+} // namespace test
+} // namespace cpp
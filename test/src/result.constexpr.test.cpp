@@ -26,6 +26,10 @@
 
 #include <catch2/catch.hpp>
 
+#include <cstdint>
+#include <string>
+#include <vector>
+
 // MSVC 2017 and above compile these tests correctly, but
 // MSVC 2015 struggles with the `constexpr` support.
 #if !defined(_MSC_VER) || _MSC_VER >= 1910
@@ -70,11 +74,22 @@ auto operator==(const constexpr_type& lhs, const constexpr_type& rhs)
 
 using literal_sut = result<constexpr_type, constexpr_type>;
 
+#if __cplusplus < 201703L // deprecated in C++17
 static_assert(std::is_literal_type<literal_sut>::value, "");
+#endif
 static_assert(std::is_trivially_copyable<literal_sut>::value, "");
 static_assert(std::is_trivially_destructible<literal_sut>::value, "");
 
+enum class constexpr_token : std::uint16_t { first, last };
+
 } // namespace <anonymous>
+} // namespace test
+
+template <>
+struct result_niche_traits<test::constexpr_token>
+  : enum_niche_traits<test::constexpr_token, test::constexpr_token::last>{};
+
+namespace test {
 
 //=============================================================================
 // class : result<T,E>
@@ -172,6 +187,35 @@ TEST_CASE("constexpr result<T,E>::error() const &", "[constexpr][observer]") {
   STATIC_REQUIRE(sut.error() == value);
 }
 
+TEST_CASE("constexpr result<T*,E>::has_value()", "[constexpr][observer]") {
+  constexpr result<int*,int> sut{nullptr};
+
+  STATIC_REQUIRE(sut.has_value());
+}
+
+TEST_CASE("constexpr result<T*,E>::error() const &", "[constexpr][observer]") {
+  constexpr auto error = failure<int>{42};
+  constexpr result<int*,int> sut{error};
+
+  STATIC_REQUIRE(sut.has_error());
+  STATIC_REQUIRE(sut.error() == 42);
+}
+
+#if __cplusplus >= 202002L
+
+// Enum niches may be observed in constant expressions, since they do not
+// inspect the bits of an address
+TEST_CASE("constexpr result<T,E>::error() const & (enum niche storage)", "[constexpr][observer]") {
+  using sut_type = result<constexpr_token,std::int8_t>;
+  constexpr auto error = failure<std::int8_t>{-5};
+  constexpr sut_type sut{error};
+
+  STATIC_REQUIRE(sizeof(sut_type) == sizeof(constexpr_token));
+  STATIC_REQUIRE(sut.has_error());
+  STATIC_REQUIRE(sut.error() == -5);
+}
+#endif
+
 //=============================================================================
 // class : result<void,E>
 //=============================================================================
@@ -247,6 +291,158 @@ TEST_CASE("constexpr result<void,E>::error() const &", "[constexpr][observer]")
   STATIC_REQUIRE(sut.error() == value);
 }
 
+//=============================================================================
+// Non-trivial types
+//=============================================================================
+
+// C++20 allows constexpr destructors and 'std::construct_at', which lets
+// results of non-trivial types be used in constant expressions
+#if defined(__cpp_constexpr_dynamic_alloc) && __cpp_constexpr_dynamic_alloc >= 201907L && \
+    defined(__cpp_lib_constexpr_string) && __cpp_lib_constexpr_string >= 201907L && \
+    defined(__cpp_lib_constexpr_vector) && __cpp_lib_constexpr_vector >= 201907L
+
+namespace {
+
+using string_sut = result<std::string, std::string>;
+
+constexpr auto parse_port(const std::string& text) -> result<int, std::string>
+{
+  if (text.empty()) {
+    return fail(std::string{"port is empty"});
+  }
+  auto port = 0;
+  for (auto c : text) {
+    if (c < '0' || c > '9') {
+      return fail("port contains '" + std::string(1u, c) + "'");
+    }
+    port = port * 10 + (c - '0');
+  }
+  return port;
+}
+
+} // namespace <anonymous>
+
+TEST_CASE("constexpr result<T,E> (non-trivial) construction", "[constexpr][ctor]") {
+  SECTION("Constructs and destroys a value") {
+    STATIC_REQUIRE(string_sut{"hello"}.value() == "hello");
+  }
+  SECTION("Constructs and destroys an error") {
+    STATIC_REQUIRE(string_sut{fail(std::string{"bad"})}.error() == "bad");
+  }
+  SECTION("Copies and moves") {
+    constexpr auto test = []{
+      const auto original = string_sut{"hello"};
+      auto copy = original;
+      auto moved = std::move(copy);
+      return moved == original;
+    };
+
+    STATIC_REQUIRE(test());
+  }
+  SECTION("Converts from another result") {
+    constexpr auto test = []{
+      const auto original = result<std::vector<int>, int>{std::vector<int>{1, 2, 3}};
+      const auto sut = result<std::vector<int>, long>{original};
+      return sut->size() == 3u;
+    };
+
+    STATIC_REQUIRE(test());
+  }
+}
+
+TEST_CASE("constexpr result<T,E> (non-trivial) assignment", "[constexpr][assign]") {
+  SECTION("Replaces a value with an error") {
+    constexpr auto test = []{
+      auto sut = string_sut{"hello"};
+      sut = fail(std::string{"bad"});
+      return sut == fail(std::string{"bad"});
+    };
+
+    STATIC_REQUIRE(test());
+  }
+  SECTION("Replaces an error with a value") {
+    constexpr auto test = []{
+      auto sut = string_sut{fail(std::string{"bad"})};
+      sut = string_sut{"hello"};
+      return sut == std::string{"hello"};
+    };
+
+    STATIC_REQUIRE(test());
+  }
+  SECTION("Emplaces a value") {
+    constexpr auto test = []{
+      auto sut = string_sut{fail(std::string{"bad"})};
+      sut.emplace(3u, 'x');
+      return sut == std::string{"xxx"};
+    };
+
+    STATIC_REQUIRE(test());
+  }
+  SECTION("Swaps a value with an error") {
+    constexpr auto test = []{
+      auto lhs = string_sut{"hello"};
+      auto rhs = string_sut{fail(std::string{"bad"})};
+      swap(lhs, rhs);
+      return lhs.error() == "bad" && rhs.value() == "hello";
+    };
+
+    STATIC_REQUIRE(test());
+  }
+}
+
+TEST_CASE("constexpr result<T,E> (non-trivial) monadic functions", "[constexpr][monadic]") {
+  SECTION("value_or and error_or") {
+    STATIC_REQUIRE(string_sut{"a"}.value_or("b") == "a");
+    STATIC_REQUIRE(string_sut{fail(std::string{"e"})}.value_or("b") == "b");
+    STATIC_REQUIRE(string_sut{fail(std::string{"e"})}.error_or("f") == "e");
+  }
+  SECTION("map and map_error") {
+    STATIC_REQUIRE(*string_sut{"abc"}.map(&std::string::size) == 3u);
+    STATIC_REQUIRE(
+      string_sut{fail(std::string{"e"})}.map_error(&std::string::size).error() == 1u
+    );
+  }
+  SECTION("value_or_else, error_or_else and or_else") {
+    STATIC_REQUIRE(string_sut{"a"}.value_or_else([]{ return std::string{"b"}; }) == "a");
+    STATIC_REQUIRE(
+      string_sut{fail(std::string{"e"})}.value_or_else([](const std::string& e){ return e + "b"; }) == "eb"
+    );
+    STATIC_REQUIRE(
+      string_sut{"a"}.error_or_else([](const std::string& v){ return v + "f"; }) == "af"
+    );
+    STATIC_REQUIRE(
+      *parse_port("").or_else([]{ return result<int, std::string>{80}; }) == 80
+    );
+  }
+  SECTION("flat_map chains validation") {
+    constexpr auto validate = [](const std::string& text) {
+      return parse_port(text).flat_map([](int port) -> result<int, std::string> {
+        if (port > 65535) {
+          return fail(std::string{"port is out of range"});
+        }
+        return port;
+      });
+    };
+
+    STATIC_REQUIRE(validate("8080") == 8080);
+    STATIC_REQUIRE(validate("80a0").error() == "port contains 'a'");
+    STATIC_REQUIRE(validate("99999").error() == "port is out of range");
+  }
+}
+
+TEST_CASE("constexpr result<void,E> (non-trivial)", "[constexpr]") {
+  constexpr auto test = []{
+    auto sut = result<void, std::string>{fail(std::string{"bad"})};
+    auto copy = sut;
+    sut.emplace();
+    return sut.has_value() && copy.error() == "bad";
+  };
+
+  STATIC_REQUIRE(test());
+}
+
+#endif
+
 } // namespace test
 } // namespace cpp
 
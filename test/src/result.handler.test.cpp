@@ -0,0 +1,171 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020-2021 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include "result.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <cstring>
+#include <string>
+#include <system_error>
+
+namespace cpp {
+namespace test {
+namespace {
+
+// Captures the handler information, and throws it so that the handler does
+// not return
+struct handler_invoked
+{
+  std::string message;
+  std::error_code error;
+  bool has_error;
+  unsigned line;
+};
+
+auto throwing_handler(const bad_result_access_info& info) -> void
+{
+  const auto* error = info.error_if<std::error_code>();
+
+  throw handler_invoked{
+    info.message(),
+    error != nullptr ? *error : std::error_code{},
+    error != nullptr,
+    info.where().line()
+  };
+}
+
+auto logging_handler(const bad_result_access_info&) -> void
+{
+  // Returns, so that the default behavior follows
+}
+
+template <typename T>
+auto suppress_unused(const T&) -> void{}
+
+// Restores the previous handler when leaving scope
+class scoped_handler
+{
+public:
+  explicit scoped_handler(bad_result_access_handler handler)
+    : m_previous{set_bad_result_access_handler(handler)}
+  {
+  }
+  ~scoped_handler()
+  {
+    set_bad_result_access_handler(m_previous);
+  }
+  scoped_handler(const scoped_handler&) = delete;
+  auto operator=(const scoped_handler&) -> scoped_handler& = delete;
+
+private:
+  bad_result_access_handler m_previous;
+};
+
+} // namespace <anonymous>
+
+//=============================================================================
+// class : source_location
+//=============================================================================
+
+TEST_CASE("source_location::current()", "[source_location]") {
+  const auto line = static_cast<unsigned>(__LINE__ + 1);
+  const auto sut = source_location::current();
+
+  SECTION("Refers to the calling line") {
+    // Compilers without the builtins report an empty location
+    REQUIRE((sut.line() == line || sut.line() == 0u));
+  }
+  SECTION("File name is never null") {
+    REQUIRE(sut.file_name() != nullptr);
+  }
+}
+
+//=============================================================================
+// utilities : bad_result_access_handler
+//=============================================================================
+
+TEST_CASE("set_bad_result_access_handler(bad_result_access_handler)", "[handler]") {
+  SECTION("Returns the previous handler") {
+    const scoped_handler guard{&throwing_handler};
+
+    REQUIRE(set_bad_result_access_handler(&logging_handler) == &throwing_handler);
+    REQUIRE(get_bad_result_access_handler() == &logging_handler);
+  }
+
+  SECTION("Handler is installed") {
+    const scoped_handler guard{&throwing_handler};
+    const auto sut = result<int,std::error_code>{
+      fail(std::make_error_code(std::errc::timed_out))
+    };
+
+    SECTION("value() invokes the handler with the error") {
+      try {
+        suppress_unused(sut.value());
+        FAIL("handler was not invoked");
+      } catch (const handler_invoked& e) {
+        REQUIRE(e.has_error);
+        REQUIRE(e.error == std::errc::timed_out);
+      }
+    }
+    SECTION("value() reports the location of the caller") {
+      const auto line = static_cast<unsigned>(__LINE__ + 2);
+      try {
+        suppress_unused(sut.value());
+        FAIL("handler was not invoked");
+      } catch (const handler_invoked& e) {
+        REQUIRE((e.line == line || e.line == 0u));
+      }
+    }
+    SECTION("expect() invokes the handler with the message") {
+      try {
+        suppress_unused(sut.expect(std::string{"expected a value"}));
+        FAIL("handler was not invoked");
+      } catch (const handler_invoked& e) {
+        REQUIRE(e.message == "expected a value");
+      }
+    }
+    SECTION("error_if does not match other types") {
+      const auto other = result<void,int>{fail(5)};
+      try {
+        other.value();
+        FAIL("handler was not invoked");
+      } catch (const handler_invoked& e) {
+        REQUIRE_FALSE(e.has_error);
+      }
+    }
+  }
+
+  SECTION("Handler returns") {
+    const scoped_handler guard{&logging_handler};
+    const auto sut = result<int,int>{fail(42)};
+
+    SECTION("Throws bad_result_access") {
+      REQUIRE_THROWS_AS(suppress_unused(sut.value()), bad_result_access<int>);
+    }
+  }
+}
+
+} // namespace test
+} // namespace cpp
@@ -0,0 +1,300 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020-2021 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include "result.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+namespace cpp {
+namespace test {
+namespace {
+
+enum class small_errc : std::uint8_t {
+  none,
+  bad = 7,
+  worse = 255,
+};
+
+struct handle
+{
+  int fd;
+};
+
+struct widget
+{
+  int value;
+};
+
+enum class token : std::uint16_t {
+  identifier,
+  number,
+  end,
+};
+
+struct incomplete;
+
+} // namespace <anonymous>
+} // namespace test
+
+// Enums only use niche storage when their last enumerator is given
+template <>
+struct result_niche_traits<test::token>
+  : enum_niche_traits<test::token, test::token::end>{};
+
+// Pointers only use niche storage when opted in
+template <>
+struct result_niche_traits<test::widget*>
+  : pointer_niche_traits<test::widget>{};
+
+// A user-provided niche, where negative file-descriptors are never valid
+template <>
+struct result_niche_traits<test::handle>
+{
+  static constexpr std::size_t payload_bits = 31u;
+
+  static auto make_niche(std::uintmax_t payload) noexcept -> test::handle
+  {
+    return test::handle{-static_cast<int>(payload) - 1};
+  }
+  static auto is_niche(const test::handle& value) noexcept -> bool
+  {
+    return value.fd < 0;
+  }
+  static auto niche_payload(const test::handle& value) noexcept -> std::uintmax_t
+  {
+    return static_cast<std::uintmax_t>(-(value.fd + 1));
+  }
+};
+
+namespace test {
+namespace {
+
+static_assert(sizeof(result<widget*,std::errc>) == sizeof(widget*), "");
+static_assert(sizeof(result<widget*,small_errc>) == sizeof(widget*), "");
+static_assert(sizeof(result<widget*,int>) == sizeof(widget*), "");
+static_assert(sizeof(result<widget&,std::errc>) == sizeof(widget*), "");
+static_assert(sizeof(result<handle,std::uint16_t>) == sizeof(handle), "");
+static_assert(sizeof(result<token,small_errc>) == sizeof(token), "");
+static_assert(result_niche_traits<token>::payload_bits == 15u, "");
+
+// Pointers that have not opted in keep a separate discriminator, so that
+// they may still be used in constant expressions
+static_assert(sizeof(result<int*,std::errc>) > sizeof(int*), "");
+static_assert(sizeof(result<int&,std::errc>) > sizeof(int*), "");
+
+// Niche storage is not possible for types without spare representations, or
+// for errors that do not fit in the niche
+static_assert(sizeof(result<handle,std::uint32_t>) > sizeof(handle), "");
+static_assert(sizeof(result<token,std::uint16_t>) > sizeof(token), "");
+static_assert(sizeof(result<widget*,std::string>) > sizeof(widget*), "");
+static_assert(sizeof(result<widget*,std::uintptr_t>) > sizeof(widget*), "");
+
+// Pointers to incomplete types remain usable with non-encodable errors
+static_assert(sizeof(result<incomplete*,std::error_code>) > sizeof(incomplete*), "");
+
+static_assert(std::is_trivially_copyable<result<widget*,std::errc>>::value, "");
+static_assert(std::is_trivially_copyable<result<widget&,std::errc>>::value, "");
+
+} // namespace <anonymous>
+
+//=============================================================================
+// class : result<T, E> (niche storage)
+//=============================================================================
+
+TEST_CASE("result<T*,E> with niche storage", "[niche]") {
+  using sut_type = result<widget*,std::errc>;
+
+  SECTION("Value is active") {
+    auto value = widget{42};
+    const auto sut = sut_type{&value};
+
+    SECTION("Contains value") {
+      REQUIRE(sut.has_value());
+    }
+    SECTION("Value is the stored pointer") {
+      REQUIRE(*sut == &value);
+    }
+  }
+  SECTION("Value is a null pointer") {
+    const auto sut = sut_type{nullptr};
+
+    SECTION("Contains value") {
+      REQUIRE(sut.has_value());
+    }
+    SECTION("Value is null") {
+      REQUIRE(*sut == nullptr);
+    }
+  }
+  SECTION("Error is active") {
+    const auto sut = sut_type{fail(std::errc::invalid_argument)};
+
+    SECTION("Contains error") {
+      REQUIRE(sut.has_error());
+    }
+    SECTION("Error is the stored error") {
+      REQUIRE(sut.error() == std::errc::invalid_argument);
+    }
+    SECTION("Error reference is returned by value") {
+      STATIC_REQUIRE(std::is_same<decltype(sut.error_ref()),std::errc>::value);
+      REQUIRE(sut.error_ref() == std::errc::invalid_argument);
+    }
+  }
+  SECTION("Negative errors are preserved") {
+    const auto sut = result<widget*,int>{fail(-42)};
+
+    REQUIRE(sut.error() == -42);
+  }
+  SECTION("Largest errors are preserved") {
+    const auto sut = result<widget*,small_errc>{fail(small_errc::worse)};
+
+    REQUIRE(sut.error() == small_errc::worse);
+  }
+}
+
+TEST_CASE("result<T&,E> with niche storage", "[niche]") {
+  using sut_type = result<widget&,std::errc>;
+
+  SECTION("Value is active") {
+    auto value = widget{42};
+    auto sut = sut_type{value};
+
+    SECTION("Refers to value") {
+      REQUIRE(&*sut == &value);
+    }
+    SECTION("Rebinds on assignment") {
+      auto next = widget{0};
+      sut = next;
+
+      REQUIRE(&*sut == &next);
+    }
+    SECTION("Assigns error") {
+      sut = fail(std::errc::io_error);
+
+      REQUIRE(sut.error() == std::errc::io_error);
+    }
+  }
+  SECTION("Error is active") {
+    const auto sut = sut_type{fail(std::errc::io_error)};
+
+    SECTION("Contains error") {
+      REQUIRE(sut.has_error());
+    }
+    SECTION("Error is the stored error") {
+      REQUIRE(sut.error() == std::errc::io_error);
+    }
+  }
+}
+
+TEST_CASE("result<T,E> with user-provided niche storage", "[niche]") {
+  using sut_type = result<handle,std::uint16_t>;
+
+  SECTION("Value is active") {
+    const auto sut = sut_type{handle{3}};
+
+    REQUIRE(sut->fd == 3);
+  }
+  SECTION("Error is active") {
+    const auto sut = sut_type{fail(std::uint16_t{0xffffu})};
+
+    REQUIRE(sut.error() == 0xffffu);
+  }
+}
+
+TEST_CASE("result<T,E> with enum niche storage", "[niche]") {
+  using sut_type = result<token,small_errc>;
+
+  SECTION("Last enumerator is a value") {
+    const auto sut = sut_type{token::end};
+
+    REQUIRE(sut.has_value());
+    REQUIRE(*sut == token::end);
+  }
+  SECTION("Error is active") {
+    const auto sut = sut_type{fail(small_errc::worse)};
+
+    REQUIRE(sut.has_error());
+    REQUIRE(sut.error() == small_errc::worse);
+  }
+  SECTION("Zero error is preserved") {
+    const auto sut = sut_type{fail(small_errc::none)};
+
+    REQUIRE(sut.has_error());
+    REQUIRE(sut.error() == small_errc::none);
+  }
+}
+
+TEST_CASE("result<T,E> with niche storage converts to and from non-niche storage", "[niche]") {
+  SECTION("Converts from non-niche storage") {
+    const auto source = result<widget*,long>{fail(5L)};
+    const auto sut = result<widget*,int>{source};
+
+    REQUIRE(sut.error() == 5);
+  }
+  SECTION("Converts to non-niche storage") {
+    const auto source = result<widget*,int>{fail(5)};
+    const auto sut = result<const widget*,long long>{source};
+
+    REQUIRE(sut.error() == 5);
+  }
+}
+
+TEST_CASE("swap(result<T,E>&, result<T,E>&) with niche storage", "[niche][utility]") {
+  using sut_type = result<widget*,std::errc>;
+
+  SECTION("Both contain errors") {
+    auto lhs = sut_type{fail(std::errc::io_error)};
+    auto rhs = sut_type{fail(std::errc::invalid_argument)};
+
+    swap(lhs, rhs);
+
+    SECTION("Left contains right's error") {
+      REQUIRE(lhs.error() == std::errc::invalid_argument);
+    }
+    SECTION("Right contains left's error") {
+      REQUIRE(rhs.error() == std::errc::io_error);
+    }
+  }
+  SECTION("One contains a value") {
+    auto value = widget{42};
+    auto lhs = sut_type{&value};
+    auto rhs = sut_type{fail(std::errc::io_error)};
+
+    swap(lhs, rhs);
+
+    SECTION("Left contains right's error") {
+      REQUIRE(lhs.error() == std::errc::io_error);
+    }
+    SECTION("Right contains left's value") {
+      REQUIRE(*rhs == &value);
+    }
+  }
+}
+
+} // namespace test
+} // namespace cpp
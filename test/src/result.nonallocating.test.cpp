@@ -0,0 +1,81 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020-2021 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+// This translation unit uses a distinct namespace, so that the alternative
+// definition of 'bad_result_access' does not conflict with the one used by the
+// rest of the tests.
+#define RESULT_NAMESPACE nonallocating
+#define RESULT_NONALLOCATING_BAD_RESULT_ACCESS
+#define RESULT_BAD_RESULT_ACCESS_MESSAGE_SIZE 16
+#include "result.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace nonallocating {
+namespace test {
+namespace {
+
+static_assert(std::is_base_of<std::exception,bad_result_access<int>>::value, "");
+static_assert(!std::is_base_of<std::logic_error,bad_result_access<int>>::value, "");
+
+} // namespace <anonymous>
+
+//=============================================================================
+// class : bad_result_access<E> (non-allocating)
+//=============================================================================
+
+TEST_CASE("bad_result_access<E> with an inline message buffer", "[nonallocating]") {
+  SECTION("Message fits in the buffer") {
+    const auto sut = bad_result_access<int>{"short", 42};
+
+    SECTION("Stores the message") {
+      REQUIRE(std::strcmp(sut.what(), "short") == 0);
+    }
+    SECTION("Stores the error") {
+      REQUIRE(sut.error() == 42);
+    }
+  }
+  SECTION("Message exceeds the buffer") {
+    const auto sut = bad_result_access<int>{std::string{"a very long message"}, 42};
+
+    SECTION("Truncates the message") {
+      REQUIRE(std::string{sut.what()} == "a very long mes");
+    }
+  }
+  SECTION("Thrown from expect") {
+    const auto r = result<int,int>{fail(42)};
+
+    SECTION("Contains the message") {
+      REQUIRE_THROWS_WITH(r.expect("message"), "message");
+    }
+  }
+}
+
+} // namespace test
+} // namespace nonallocating
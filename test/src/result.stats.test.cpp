@@ -0,0 +1,227 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020-2021 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+// This translation unit uses a distinct namespace, so that the recording
+// 'fail' and 'in_place_error' constructors do not conflict with the ones used
+// by the rest of the tests.
+#define RESULT_NAMESPACE stats
+#define RESULT_ENABLE_STATS
+#include "result.hpp"
+#include "result_atomic.hpp"
+#include "result_lazy.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <system_error>
+#include <thread>
+
+namespace stats {
+namespace test {
+namespace {
+
+struct custom_error
+{
+  int code;
+};
+
+auto make_error(int code) -> result<int,custom_error>
+{
+  return fail(custom_error{code});
+}
+
+// Recording must not prevent 'fail' from being used in constant expressions
+constexpr auto constant_failure = fail(42);
+static_assert(constant_failure.error() == 42, "");
+
+} // namespace <anonymous>
+
+//=============================================================================
+// class : failure_stats
+//=============================================================================
+
+TEST_CASE("failure_stats::snapshot()", "[stats]") {
+  failure_stats::reset();
+
+  SECTION("Counts failures from fail(E&&) by type and location") {
+    const auto line = __LINE__ + 2u;
+    for (auto i = 0; i < 3; ++i) {
+      auto r = result<int,std::error_code>{fail(std::make_error_code(std::errc::io_error))};
+      (void) r;
+    }
+
+    const auto sut = failure_stats::snapshot();
+
+    REQUIRE(sut.counts().size() == 1u);
+    const auto& count = sut.counts().front();
+    REQUIRE(count.is<std::error_code>());
+    REQUIRE(count.count() == 3u);
+    REQUIRE(count.where().line() == line);
+    REQUIRE(std::strstr(count.where().file_name(), "result.stats.test.cpp") != nullptr);
+  }
+
+  SECTION("Counts failures from the in_place_error constructor with an empty location") {
+    auto r = result<int,std::string>{in_place_error, "error"};
+    (void) r;
+
+    const auto sut = failure_stats::snapshot();
+
+    REQUIRE(sut.count_of<std::string>() == 1u);
+    REQUIRE(sut.counts().front().where().line() == 0u);
+  }
+
+  SECTION("Counts failures from fail<E>(Args...) with an empty location") {
+    auto f = fail<std::string>(3u, 'x');
+    (void) f;
+
+    const auto sut = failure_stats::snapshot();
+
+    REQUIRE(sut.count_of<std::string>() == 1u);
+    REQUIRE(sut.counts().front().where().line() == 0u);
+  }
+
+  SECTION("Aggregates counts of each type across locations") {
+    auto first = make_error(1);
+    auto second = result<int,custom_error>{fail(custom_error{2})};
+    auto third = fail(std::string{"error"});
+    (void) first;
+    (void) second;
+    (void) third;
+
+    const auto sut = failure_stats::snapshot();
+
+    REQUIRE(sut.counts().size() == 3u);
+    REQUIRE(sut.count_of<custom_error>() == 2u);
+    REQUIRE(sut.count_of<std::string>() == 1u);
+    REQUIRE(sut.count_of<int>() == 0u);
+    REQUIRE(sut.total() == 3u);
+    REQUIRE(sut.dropped() == 0u);
+  }
+
+  SECTION("Does not count errors propagated through monadic functions") {
+    const auto r = make_error(1)
+      .map([](int x) { return x + 1; })
+      .flat_map([](int x) { return result<long,custom_error>{x}; })
+      .and_then(5);
+
+    REQUIRE(r.has_error());
+    REQUIRE(failure_stats::snapshot().total() == 1u);
+  }
+
+  SECTION("Does not count conversions of a failure into a result") {
+    const auto f = fail(custom_error{1});
+    const auto r = result<int,custom_error>{f};
+    const auto r2 = result<long,custom_error>{r};
+    (void) r2;
+
+    REQUIRE(failure_stats::snapshot().total() == 1u);
+  }
+
+  SECTION("Does not count loads of an error stored in an atomic_result") {
+    const atomic_result<std::uint32_t,std::errc> sut{fail(std::errc::timed_out)};
+    for (auto i = 0; i < 5; ++i) {
+      REQUIRE(sut.load().has_error());
+    }
+
+    REQUIRE(failure_stats::snapshot().total() == 1u);
+  }
+
+  SECTION("Does not count reads of an error cached by a lazy_result") {
+    lazy_result<int,custom_error> sut{};
+    for (auto i = 0; i < 5; ++i) {
+      const auto r = sut.get_or_init([]{ return make_error(1); });
+      REQUIRE(r.has_error());
+    }
+
+    REQUIRE(failure_stats::snapshot().total() == 1u);
+  }
+
+  SECTION("Does not count errors returned by a retrying lazy_result") {
+    lazy_result<int,custom_error,lazy_error_policy::retry> sut{};
+    const auto r = sut.get_or_init([]{ return make_error(1); });
+
+    REQUIRE(r.has_error());
+    REQUIRE(failure_stats::snapshot().total() == 1u);
+  }
+
+  SECTION("Includes the failures of other threads") {
+    auto thread = std::thread{[]{
+      for (auto i = 0; i < 10; ++i) {
+        auto r = make_error(i);
+        (void) r;
+      }
+    }};
+    thread.join();
+    auto r = make_error(0);
+    (void) r;
+
+    const auto sut = failure_stats::snapshot();
+
+    REQUIRE(sut.count_of<custom_error>() == 11u);
+    REQUIRE(sut.counts().size() == 1u);
+  }
+}
+
+TEST_CASE("failure_stats::reset()", "[stats]") {
+  auto before = make_error(0);
+  (void) before;
+
+  failure_stats::reset();
+
+  SECTION("Discards earlier failures") {
+    REQUIRE(failure_stats::snapshot().counts().empty());
+  }
+
+  SECTION("Keeps counting newer failures") {
+    auto after = make_error(0);
+    (void) after;
+
+    const auto sut = failure_stats::snapshot();
+
+    REQUIRE(sut.counts().size() == 1u);
+    REQUIRE(sut.counts().front().count() == 1u);
+  }
+}
+
+//=============================================================================
+// class : failure_count
+//=============================================================================
+
+TEST_CASE("failure_count::error_type()", "[stats]") {
+  failure_stats::reset();
+
+  auto r = make_error(0);
+  (void) r;
+
+  const auto sut = failure_stats::snapshot();
+
+  SECTION("Names the error type") {
+    REQUIRE(sut.counts().front().error_type().find("custom_error") != std::string::npos);
+  }
+}
+
+} // namespace test
+} // namespace stats
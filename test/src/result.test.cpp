@@ -28,6 +28,7 @@
 
 #include <string>
 #include <type_traits>
+#include <vector>
 #include <ios> // std::ios_errc
 
 #if defined(_MSC_VER)
@@ -2105,6 +2106,131 @@ TEST_CASE("result<T,E>::operator=(failure<E2>&&)", "[assign]") {
   }
 }
 
+//-----------------------------------------------------------------------------
+// Modifiers
+//-----------------------------------------------------------------------------
+
+TEST_CASE("result<T,E>::emplace(Args&&...)", "[modifiers]") {
+  SECTION("T is not nothrow constructible or nothrow move constructible") {
+    SECTION("result cannot emplace") {
+      STATIC_REQUIRE_FALSE(detail::result_is_emplaceable<throwing<std::string>,const char*>::value);
+    }
+  }
+  SECTION("result contains a value") {
+    using sut_type = result<report_destructor,std::error_code>;
+
+    auto is_invoked = false;
+    auto is_new_invoked = false;
+    sut_type sut{&is_invoked};
+
+    auto& value = sut.emplace(&is_new_invoked);
+
+    SECTION("Calls 'T's destructor first") {
+      REQUIRE(is_invoked);
+    }
+    SECTION("active element is value") {
+      REQUIRE(sut.has_value());
+    }
+    SECTION("returns reference to the new value") {
+      REQUIRE(&value == &*sut);
+      REQUIRE(value.output == &is_new_invoked);
+    }
+  }
+  SECTION("result contains an error") {
+    using sut_type = result<std::string,report_destructor>;
+
+    auto is_invoked = false;
+    sut_type sut{in_place_error, &is_invoked};
+
+    sut.emplace(3u, 'x');
+
+    SECTION("Calls 'E's destructor first") {
+      REQUIRE(is_invoked);
+    }
+    SECTION("active element is value") {
+      REQUIRE(sut.has_value());
+    }
+    SECTION("value is constructed from the arguments") {
+      REQUIRE(sut == "xxx");
+    }
+  }
+  SECTION("T's constructor throws") {
+    struct fails_to_construct
+    {
+      fails_to_construct(int){ throw 42; }
+      fails_to_construct(fails_to_construct&&) noexcept = default;
+    };
+    using sut_type = result<fails_to_construct,int>;
+
+    auto sut = sut_type{fail(7)};
+
+    REQUIRE_THROWS_AS(sut.emplace(1), int);
+
+    SECTION("State is unchanged") {
+      REQUIRE(sut == fail(7));
+    }
+  }
+}
+
+TEST_CASE("result<T,E>::emplace(std::initializer_list<U>, Args&&...)", "[modifiers]") {
+  using sut_type = result<std::vector<int>,std::error_code>;
+
+  auto sut = sut_type{fail(std::make_error_code(std::errc::invalid_argument))};
+
+  auto& value = sut.emplace({1, 2, 3});
+
+  SECTION("active element is value") {
+    REQUIRE(sut.has_value());
+  }
+  SECTION("value is constructed from the list") {
+    REQUIRE(value == std::vector<int>{1, 2, 3});
+  }
+}
+
+TEST_CASE("result<T,E>::assign_or_reuse(U&&)", "[modifiers]") {
+  SECTION("T is not assignable from U") {
+    SECTION("result cannot assign or reuse") {
+      STATIC_REQUIRE_FALSE(detail::result_is_reuse_assignable<std::vector<char>,int>::value);
+    }
+  }
+  SECTION("result contains a value") {
+    using sut_type = result<std::vector<char>,std::error_code>;
+
+    auto sut = sut_type{std::vector<char>(64u, 'x')};
+    const auto* const data = sut->data();
+    const auto source = std::vector<char>(16u, 'y');
+
+    auto& value = sut.assign_or_reuse(source);
+
+    SECTION("value is assigned") {
+      REQUIRE(sut == source);
+    }
+    SECTION("existing storage is reused") {
+      REQUIRE(sut->data() == data);
+      REQUIRE(sut->capacity() >= 64u);
+    }
+    SECTION("returns reference to the value") {
+      REQUIRE(&value == &*sut);
+    }
+  }
+  SECTION("result contains an error") {
+    using sut_type = result<std::vector<char>,report_destructor>;
+
+    auto is_invoked = false;
+    auto sut = sut_type{in_place_error, &is_invoked};
+    const auto source = std::vector<char>(16u, 'y');
+
+    sut.assign_or_reuse(source);
+
+    SECTION("Calls 'E's destructor first") {
+      REQUIRE(is_invoked);
+    }
+    SECTION("value is constructed") {
+      REQUIRE(sut == source);
+    }
+  }
+}
+
 //-----------------------------------------------------------------------------
 // Observers
 //-----------------------------------------------------------------------------
@@ -2374,6 +2500,63 @@ TEST_CASE("result<T,E>::error() &&", "[observers]") {
 
 //-----------------------------------------------------------------------------
 
+TEST_CASE("result<T,E>::error_ref() &", "[observers]") {
+  auto sut = result<int, move_only<std::string>>{fail(std::string{"error"})};
+
+  auto& output = sut.error_ref();
+
+  SECTION("Refers to the contained error") {
+    REQUIRE(&output == sut.error_if());
+  }
+  SECTION("Allows modifying the error") {
+    output += "!";
+
+    REQUIRE(sut.error_ref() == "error!");
+  }
+}
+
+TEST_CASE("result<T,E>::error_ref() const &", "[observers]") {
+  const auto sut = result<int, move_only<std::string>>{fail(std::string{"error"})};
+
+  const auto& output = sut.error_ref();
+
+  SECTION("Refers to the contained error") {
+    REQUIRE(&output == sut.error_if());
+    REQUIRE(output == "error");
+  }
+}
+
+TEST_CASE("result<T,E>::error_ref() &&", "[observers]") {
+  auto sut = result<int, move_only<std::string>>{fail(std::string{"error"})};
+
+  const auto output = std::move(sut).error_ref();
+
+  SECTION("Moves the contained error") {
+    REQUIRE(output == "error");
+  }
+}
+
+TEST_CASE("result<T,E>::error_if()", "[observers]") {
+  SECTION("result contains a value") {
+    auto sut = result<int, std::string>{42};
+
+    SECTION("Returns nullptr") {
+      REQUIRE(sut.error_if() == nullptr);
+      REQUIRE(static_cast<const result<int, std::string>&>(sut).error_if() == nullptr);
+    }
+  }
+  SECTION("result contains an error") {
+    auto sut = result<int, std::string>{fail("error")};
+
+    SECTION("Points to the contained error") {
+      REQUIRE(sut.error_if() != nullptr);
+      REQUIRE(*sut.error_if() == "error");
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
 TEST_CASE("result<T,E>::expect(String&&) &", "[observers]") {
   SECTION("result contains value") {
     auto sut = result<int,int>{42};
@@ -2396,6 +2579,9 @@ TEST_CASE("result<T,E>::expect(String&&) &", "[observers]") {
       REQUIRE_THROWS_AS(sut.expect("test"), bad_result_access<int>);
       REQUIRE_THROWS_WITH(sut.expect("test"), "test");
     }
+    SECTION("throws exception with std::string message") {
+      REQUIRE_THROWS_WITH(sut.expect(std::string{"test"}), "test");
+    }
   }
 }
 
@@ -2581,6 +2767,122 @@ TEST_CASE("result<T,E>::error_or(U&&) &&", "[monadic]") {
   }
 }
 
+TEST_CASE("result<T,E>::value_or_else(Fn&&) const &", "[monadic]") {
+  SECTION("result contains a value") {
+    SECTION("Returns result's value without invoking the function") {
+      auto calls = 0;
+      const auto sut = result<std::string, int>{"hello"};
+
+      const auto output = sut.value_or_else([&]{
+        ++calls;
+        return std::string{"other"};
+      });
+
+      REQUIRE(output == *sut);
+      REQUIRE(calls == 0);
+    }
+  }
+  SECTION("result contains an error") {
+    SECTION("Returns the function's result, given the error") {
+      const auto sut = result<std::string, int>{fail(42)};
+
+      const auto output = sut.value_or_else([](int e){
+        return std::to_string(e);
+      });
+
+      REQUIRE(output == "42");
+    }
+    SECTION("Returns the function's result, without arguments") {
+      const auto sut = result<std::string, int>{fail(42)};
+
+      const auto output = sut.value_or_else([]{
+        return std::string{"other"};
+      });
+
+      REQUIRE(output == "other");
+    }
+  }
+}
+
+TEST_CASE("result<T,E>::value_or_else(Fn&&) &&", "[monadic]") {
+  SECTION("result contains a value") {
+    SECTION("Returns the moved value") {
+      auto input = "Hello world";
+      auto sut = result<move_only<std::string>, int>{input};
+
+      const auto output = std::move(sut).value_or_else([]{
+        return move_only<std::string>{"other"};
+      });
+
+      REQUIRE(output == input);
+    }
+  }
+  SECTION("result contains an error") {
+    SECTION("Returns the function's result, given the moved error") {
+      auto sut = result<int, move_only<std::string>>{fail("Hello world")};
+
+      const auto output = std::move(sut).value_or_else([](move_only<std::string>&& e){
+        return static_cast<int>(std::string{std::move(e)}.size());
+      });
+
+      REQUIRE(output == 11);
+    }
+  }
+}
+
+TEST_CASE("result<T,E>::error_or_else(Fn&&) const &", "[monadic]") {
+  SECTION("result contains a value") {
+    SECTION("Returns the function's result, given the value") {
+      const auto sut = result<int, std::string>{42};
+
+      const auto output = sut.error_or_else([](int v){
+        return std::to_string(v);
+      });
+
+      REQUIRE(output == "42");
+    }
+  }
+  SECTION("result contains an error") {
+    SECTION("Returns the error without invoking the function") {
+      auto calls = 0;
+      const auto sut = result<int, std::string>{fail("error")};
+
+      const auto output = sut.error_or_else([&]{
+        ++calls;
+        return std::string{"other"};
+      });
+
+      REQUIRE(output == "error");
+      REQUIRE(calls == 0);
+    }
+  }
+}
+
+TEST_CASE("result<T,E>::error_or_else(Fn&&) &&", "[monadic]") {
+  SECTION("result contains a value") {
+    SECTION("Returns the function's result, given the moved value") {
+      auto sut = result<move_only<std::string>, std::size_t>{"Hello world"};
+
+      const auto output = std::move(sut).error_or_else([](move_only<std::string>&& v){
+        return std::string{std::move(v)}.size();
+      });
+
+      REQUIRE(output == 11u);
+    }
+  }
+  SECTION("result contains an error") {
+    SECTION("Returns the moved error") {
+      auto sut = result<int, move_only<std::string>>{fail("error")};
+
+      const auto output = std::move(sut).error_or_else([]{
+        return move_only<std::string>{"other"};
+      });
+
+      REQUIRE(output == "error");
+    }
+  }
+}
+
 //-----------------------------------------------------------------------------
 
 TEST_CASE("result<T,E>::and_then(U&&) const", "[monadic]") {
@@ -2897,6 +3199,70 @@ TEST_CASE("result<T,E>::flat_map_error(Fn&&) &&", "[monadic]") {
   }
 }
 
+TEST_CASE("result<T,E>::or_else(Fn&&) const &", "[monadic]") {
+  SECTION("result contains a value") {
+    SECTION("Forwards the value without invoking the function") {
+      auto calls = 0;
+      const auto sut = result<int,int>{42};
+
+      const auto output = sut.or_else([&]{
+        ++calls;
+        return result<int,long>{0};
+      });
+
+      REQUIRE(output == 42);
+      REQUIRE(calls == 0);
+    }
+  }
+  SECTION("result contains an error") {
+    SECTION("Returns the function's result, given the error") {
+      const auto sut = result<int,int>{fail(42)};
+
+      const auto output = sut.or_else([](int e){
+        return result<int,std::string>{fail(std::to_string(e))};
+      });
+
+      REQUIRE(output == fail("42"));
+    }
+    SECTION("Returns the function's result, without arguments") {
+      const auto sut = result<int,int>{fail(42)};
+
+      const auto output = sut.or_else([]{
+        return result<int,int>{7};
+      });
+
+      REQUIRE(output == 7);
+    }
+  }
+}
+
+TEST_CASE("result<T,E>::or_else(Fn&&) &&", "[monadic]") {
+  SECTION("result contains a value") {
+    SECTION("Forwards the moved value") {
+      const auto value = "hello world";
+      auto sut = result<move_only<std::string>,int>{value};
+
+      const auto output = std::move(sut).or_else([]{
+        return result<move_only<std::string>,int>{fail(0)};
+      });
+
+      REQUIRE(output == value);
+    }
+  }
+  SECTION("result contains an error") {
+    SECTION("Returns the function's result, given the moved error") {
+      const auto error = fail("Hello world");
+      auto sut = result<int,move_only<std::string>>{error};
+
+      const auto output = std::move(sut).or_else([](move_only<std::string>&& x){
+        return result<int, std::string>{in_place_error, std::move(x)};
+      });
+
+      REQUIRE(output == error);
+    }
+  }
+}
+
 #endif // !defined(_MSC_VER) || (_MSC_VER >= 1920)
 
 //=============================================================================
@@ -4192,6 +4558,37 @@ TEST_CASE("result<void,E>::operator=(failure<E2>&&)", "[assign]") {
   }
 }
 
+//-----------------------------------------------------------------------------
+// Modifiers
+//-----------------------------------------------------------------------------
+
+TEST_CASE("result<void,E>::emplace()", "[modifiers]") {
+  SECTION("result contains a value") {
+    auto sut = result<void,std::error_code>{};
+
+    sut.emplace();
+
+    SECTION("active element is value") {
+      REQUIRE(sut.has_value());
+    }
+  }
+  SECTION("result contains an error") {
+    using sut_type = result<void,report_destructor>;
+
+    auto is_invoked = false;
+    auto sut = sut_type{in_place_error, &is_invoked};
+
+    sut.emplace();
+
+    SECTION("Calls 'E's destructor first") {
+      REQUIRE(is_invoked);
+    }
+    SECTION("active element is value") {
+      REQUIRE(sut.has_value());
+    }
+  }
+}
+
 //-----------------------------------------------------------------------------
 // Observers
 //-----------------------------------------------------------------------------
@@ -4329,6 +4726,37 @@ TEST_CASE("result<void,E>::error() &&", "[observers]") {
   }
 }
 
+TEST_CASE("result<void,E>::error_ref()", "[observers]") {
+  auto sut = result<void, move_only<std::string>>{fail(std::string{"error"})};
+
+  SECTION("Refers to the contained error") {
+    REQUIRE(&sut.error_ref() == sut.error_if());
+    REQUIRE(static_cast<const result<void, move_only<std::string>>&>(sut).error_ref() == "error");
+  }
+  SECTION("Moves the contained error from an rvalue") {
+    const auto output = std::move(sut).error_ref();
+
+    REQUIRE(output == "error");
+  }
+}
+
+TEST_CASE("result<void,E>::error_if()", "[observers]") {
+  SECTION("result contains a value") {
+    auto sut = result<void, std::string>{};
+
+    SECTION("Returns nullptr") {
+      REQUIRE(sut.error_if() == nullptr);
+    }
+  }
+  SECTION("result contains an error") {
+    auto sut = result<void, std::string>{fail("error")};
+
+    SECTION("Points to the contained error") {
+      REQUIRE(*sut.error_if() == "error");
+    }
+  }
+}
+
 TEST_CASE("result<void,E>::expect(String&&) const &", "[observers]") {
   SECTION("result contains value") {
     const auto sut = result<void,int>{};
@@ -4419,6 +4847,48 @@ TEST_CASE("result<void,E>::error_or(U&&) &&", "[monadic]") {
   }
 }
 
+TEST_CASE("result<void,E>::error_or_else(Fn&&) const &", "[monadic]") {
+  SECTION("result contains a value") {
+    SECTION("Returns the function's result") {
+      const auto sut = result<void, std::string>{};
+
+      const auto output = sut.error_or_else([]{
+        return std::string{"other"};
+      });
+
+      REQUIRE(output == "other");
+    }
+  }
+  SECTION("result contains an error") {
+    SECTION("Returns the error without invoking the function") {
+      auto calls = 0;
+      const auto sut = result<void, std::string>{fail("error")};
+
+      const auto output = sut.error_or_else([&]{
+        ++calls;
+        return std::string{"other"};
+      });
+
+      REQUIRE(output == "error");
+      REQUIRE(calls == 0);
+    }
+  }
+}
+
+TEST_CASE("result<void,E>::error_or_else(Fn&&) &&", "[monadic]") {
+  SECTION("result contains an error") {
+    SECTION("Returns the moved error") {
+      auto sut = result<void, move_only<std::string>>{fail("error")};
+
+      const auto output = std::move(sut).error_or_else([]{
+        return move_only<std::string>{"other"};
+      });
+
+      REQUIRE(output == "error");
+    }
+  }
+}
+
 //-----------------------------------------------------------------------------
 
 TEST_CASE("result<void,E>::and_then(U&&) const", "[monadic]") {
@@ -4733,6 +5203,48 @@ TEST_CASE("result<void,E>::flat_map_error(Fn&&) &&", "[monadic]") {
   }
 }
 
+TEST_CASE("result<void,E>::or_else(Fn&&) const &", "[monadic]") {
+  SECTION("result contains a value") {
+    SECTION("Returns a value without invoking the function") {
+      auto calls = 0;
+      const auto sut = result<void,int>{};
+
+      const auto output = sut.or_else([&](int){
+        ++calls;
+        return result<void,long>{fail(0)};
+      });
+
+      REQUIRE(output.has_value());
+      REQUIRE(calls == 0);
+    }
+  }
+  SECTION("result contains an error") {
+    SECTION("Returns the function's result, given the error") {
+      const auto sut = result<void,int>{fail(42)};
+
+      const auto output = sut.or_else([](int e){
+        return result<void,long>{fail(e * 2L)};
+      });
+
+      REQUIRE(output == fail(84L));
+    }
+  }
+}
+
+TEST_CASE("result<void,E>::or_else(Fn&&) &&", "[monadic]") {
+  SECTION("result contains an error") {
+    SECTION("Returns the function's result, without arguments") {
+      auto sut = result<void,move_only<std::string>>{fail("error")};
+
+      const auto output = std::move(sut).or_else([]{
+        return result<void,std::string>{};
+      });
+
+      REQUIRE(output.has_value());
+    }
+  }
+}
+
 #endif // !defined(_MSC_VER) || (_MSC_VER >= 1920)
 
 //=============================================================================
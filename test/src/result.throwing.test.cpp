@@ -0,0 +1,257 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020-2021 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include "result.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+namespace cpp {
+namespace test {
+namespace {
+
+/// \brief A type with potentially-throwing copies and moves, in the style of
+///        many third-party types
+///
+/// Constructing a widget from a negative value throws.
+struct widget
+{
+  widget() noexcept(false) = default;
+  widget(int v) noexcept(false) : value{v} { if (v < 0) { throw v; } }
+  widget(const widget& other) noexcept(false) : value{other.value}{}
+  widget(widget&& other) noexcept(false) : value{other.value}{}
+
+  auto operator=(const widget&) -> widget& = default;
+  auto operator=(widget&&) -> widget& = default;
+
+  int value = 0;
+};
+
+/// \brief A type whose copies may throw, but whose moves do not
+struct buffer
+{
+  buffer() = default;
+  buffer(bool throws) : throws_on_copy{throws}{}
+  buffer(const buffer& other) noexcept(false)
+    : throws_on_copy{other.throws_on_copy}
+  {
+    if (throws_on_copy) {
+      throw 42;
+    }
+  }
+  buffer(buffer&&) noexcept = default;
+
+  auto operator=(const buffer&) -> buffer& = default;
+  auto operator=(buffer&&) noexcept -> buffer& = default;
+
+  bool throws_on_copy = false;
+};
+
+/// \brief A widget used as an error type
+struct widget_error : widget
+{
+  using widget::widget;
+};
+
+/// \brief A widget that is not opted in to throwing assignment
+struct other_widget : widget
+{
+  using widget::widget;
+};
+
+} // namespace <anonymous>
+} // namespace test
+
+template <>
+struct enable_throwing_assignment<test::widget> : std::true_type{};
+template <>
+struct enable_throwing_assignment<test::buffer> : std::true_type{};
+template <>
+struct enable_throwing_assignment<test::widget_error> : std::true_type{};
+
+namespace test {
+
+//=============================================================================
+// trait : enable_throwing_assignment<T>
+//=============================================================================
+
+TEST_CASE("enable_throwing_assignment<T>", "[assign][throwing]") {
+  SECTION("T is not opted in") {
+    using sut_type = result<other_widget,std::error_code>;
+
+    SECTION("result is not assignable") {
+      STATIC_REQUIRE_FALSE(std::is_copy_assignable<sut_type>::value);
+      STATIC_REQUIRE_FALSE(std::is_move_assignable<sut_type>::value);
+      STATIC_REQUIRE_FALSE(std::is_assignable<sut_type&,int>::value);
+    }
+  }
+  SECTION("T is opted in, and E is nothrow move constructible") {
+    using sut_type = result<widget,std::error_code>;
+
+    SECTION("result is assignable") {
+      STATIC_REQUIRE(std::is_copy_assignable<sut_type>::value);
+      STATIC_REQUIRE(std::is_move_assignable<sut_type>::value);
+      STATIC_REQUIRE(std::is_assignable<sut_type&,int>::value);
+    }
+    SECTION("assignment is not noexcept") {
+      STATIC_REQUIRE_FALSE(std::is_nothrow_copy_assignable<sut_type>::value);
+      STATIC_REQUIRE_FALSE(std::is_nothrow_move_assignable<sut_type>::value);
+    }
+  }
+  SECTION("T and E are opted in, but neither is nothrow move constructible") {
+    using sut_type = result<widget,widget_error>;
+
+    SECTION("result is not assignable") {
+      STATIC_REQUIRE_FALSE(std::is_copy_assignable<sut_type>::value);
+      STATIC_REQUIRE_FALSE(std::is_move_assignable<sut_type>::value);
+    }
+  }
+}
+
+//=============================================================================
+// class : result<T, E>
+//=============================================================================
+
+TEST_CASE("result<T,E>::operator=(U&&) with throwing construction", "[assign][throwing]") {
+  using sut_type = result<widget,std::error_code>;
+
+  SECTION("result contains a value") {
+    auto sut = sut_type{widget{1}};
+
+    sut = 2;
+
+    SECTION("value is assigned") {
+      REQUIRE(sut->value == 2);
+    }
+  }
+  SECTION("result contains an error") {
+    const auto error = std::make_error_code(std::errc::invalid_argument);
+    auto sut = sut_type{fail(error)};
+
+    SECTION("Construction succeeds") {
+      sut = 2;
+
+      SECTION("active element is value") {
+        REQUIRE(sut.has_value());
+        REQUIRE(sut->value == 2);
+      }
+    }
+    SECTION("Construction throws") {
+      REQUIRE_THROWS_AS(sut = -1, int);
+
+      SECTION("error is restored") {
+        REQUIRE(sut == fail(error));
+      }
+    }
+  }
+}
+
+TEST_CASE("result<T,E>::operator=(const result&) with throwing construction", "[assign][throwing]") {
+  using sut_type = result<buffer,std::error_code>;
+
+  const auto error = std::make_error_code(std::errc::invalid_argument);
+
+  SECTION("result contains an error, and other contains a value") {
+    auto sut = sut_type{fail(error)};
+
+    SECTION("Copy succeeds") {
+      const auto other = sut_type{buffer{false}};
+
+      sut = other;
+
+      SECTION("active element is value") {
+        REQUIRE(sut.has_value());
+      }
+    }
+    SECTION("Copy throws") {
+      const auto other = sut_type{buffer{true}};
+
+      REQUIRE_THROWS_AS(sut = other, int);
+
+      SECTION("result is unchanged") {
+        REQUIRE(sut == fail(error));
+      }
+    }
+  }
+  SECTION("result contains a value, and other contains an error") {
+    auto sut = sut_type{buffer{true}};
+    const auto other = sut_type{fail(error)};
+
+    sut = other;
+
+    SECTION("active element is error") {
+      REQUIRE(sut == fail(error));
+    }
+  }
+}
+
+TEST_CASE("result<T,E>::operator=(const failure<E2>&) with throwing construction", "[assign][throwing]") {
+  using sut_type = result<int,widget_error>;
+
+  auto sut = sut_type{42};
+
+  SECTION("Construction succeeds") {
+    sut = fail(1);
+
+    SECTION("active element is error") {
+      REQUIRE(sut.has_error());
+      REQUIRE(sut.error().value == 1);
+    }
+  }
+  SECTION("Construction throws") {
+    REQUIRE_THROWS_AS(sut = fail(-1), int);
+
+    SECTION("value is restored") {
+      REQUIRE(sut == 42);
+    }
+  }
+}
+
+//=============================================================================
+// class : result<void, E>
+//=============================================================================
+
+TEST_CASE("result<void,E>::operator=(const failure<E2>&) with throwing construction", "[assign][throwing]") {
+  using sut_type = result<void,widget_error>;
+
+  auto sut = sut_type{};
+
+  SECTION("result is assignable") {
+    STATIC_REQUIRE(std::is_copy_assignable<sut_type>::value);
+    STATIC_REQUIRE(std::is_move_assignable<sut_type>::value);
+  }
+  SECTION("Construction throws") {
+    REQUIRE_THROWS_AS(sut = fail(-1), int);
+
+    SECTION("value is restored") {
+      REQUIRE(sut.has_value());
+    }
+  }
+}
+
+} // namespace test
+} // namespace cpp
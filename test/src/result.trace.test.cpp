@@ -0,0 +1,185 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020-2021 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+// This translation unit uses a distinct namespace, so that the tracing
+// conversions from 'failure' do not conflict with the ones used by the rest of
+// the tests.
+#define RESULT_NAMESPACE trace
+#define RESULT_ENABLE_TRACE
+#define RESULT_TRACE_BUFFER_SIZE 4
+#include "result.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <cstring>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+namespace trace {
+namespace test {
+namespace {
+
+enum class errc { rejected = 1, timeout = 2 };
+
+struct large_error
+{
+  char data[64];
+};
+
+constexpr auto match_order_line = __LINE__ + 3u;
+auto match_order(int i) -> result<void,errc>
+{
+  return fail(i % 2 == 0 ? errc::rejected : errc::timeout);
+}
+
+static_assert(std::is_trivially_copyable<failure_trace_entry>::value, "");
+static_assert(failure_trace::capacity() == 3u, "");
+
+// Tracing must not prevent conversions from being used in constant
+// expressions
+constexpr auto constant_failure = fail(42);
+constexpr auto constant_result = result<int,int>{constant_failure};
+static_assert(constant_result.has_error(), "");
+
+} // namespace <anonymous>
+
+//=============================================================================
+// class : failure_trace
+//=============================================================================
+
+TEST_CASE("failure_trace::copy(...)", "[trace]") {
+  auto& sut = failure_trace::local();
+  sut.clear();
+
+  failure_trace_entry entries[RESULT_TRACE_BUFFER_SIZE];
+
+  SECTION("Trace is empty") {
+    SECTION("Copies nothing") {
+      REQUIRE(sut.size() == 0u);
+      REQUIRE(sut.copy(entries, RESULT_TRACE_BUFFER_SIZE) == 0u);
+    }
+  }
+
+  SECTION("Failure is converted into a result") {
+    auto r = match_order(0);
+    (void) r;
+
+    const auto n = sut.copy(entries, RESULT_TRACE_BUFFER_SIZE);
+
+    SECTION("Records the conversion") {
+      REQUIRE(n == 1u);
+      REQUIRE(entries[0].is<errc>());
+    }
+    SECTION("Records the location of the conversion") {
+      REQUIRE(entries[0].where().line() == match_order_line);
+      REQUIRE(std::strstr(entries[0].where().file_name(), "result.trace.test.cpp") != nullptr);
+    }
+    SECTION("Keeps trivially copyable errors") {
+      REQUIRE(entries[0].error_if<errc>() != nullptr);
+      REQUIRE(*entries[0].error_if<errc>() == errc::rejected);
+      REQUIRE(entries[0].error_if<int>() == nullptr);
+    }
+    SECTION("Names the error type") {
+      REQUIRE(entries[0].error_type().find("errc") != std::string::npos);
+    }
+  }
+
+  SECTION("Failure is assigned to a result") {
+    auto r = result<int,errc>{42};
+    r = fail(errc::timeout);
+
+    REQUIRE(sut.copy(entries, RESULT_TRACE_BUFFER_SIZE) == 1u);
+    REQUIRE(*entries[0].error_if<errc>() == errc::timeout);
+  }
+
+  SECTION("Error is not kept by value") {
+    auto string_result = result<int,std::string>{fail("error")};
+    auto large_result = result<int,large_error>{fail(large_error{})};
+    (void) string_result;
+    (void) large_result;
+
+    REQUIRE(sut.copy(entries, RESULT_TRACE_BUFFER_SIZE) == 2u);
+
+    SECTION("Records the type") {
+      REQUIRE(entries[0].is<std::string>());
+      REQUIRE(entries[1].is<large_error>());
+    }
+    SECTION("Does not record the error") {
+      REQUIRE(entries[0].error_if<std::string>() == nullptr);
+      REQUIRE(entries[1].error_if<large_error>() == nullptr);
+    }
+  }
+
+  SECTION("More failures than the capacity") {
+    for (auto i = 0; i < 10; ++i) {
+      auto r = result<int,int>{fail(i)};
+      (void) r;
+    }
+
+    SECTION("Keeps the most recent entries, oldest first") {
+      REQUIRE(sut.size() == failure_trace::capacity());
+      REQUIRE(sut.copy(entries, RESULT_TRACE_BUFFER_SIZE) == 3u);
+      REQUIRE(*entries[0].error_if<int>() == 7);
+      REQUIRE(*entries[1].error_if<int>() == 8);
+      REQUIRE(*entries[2].error_if<int>() == 9);
+    }
+    SECTION("Copies only as many entries as requested") {
+      REQUIRE(sut.copy(entries, 1u) == 1u);
+      REQUIRE(*entries[0].error_if<int>() == 9);
+    }
+    SECTION("Timestamps do not decrease") {
+      sut.copy(entries, RESULT_TRACE_BUFFER_SIZE);
+      REQUIRE(entries[0].timestamp() <= entries[1].timestamp());
+      REQUIRE(entries[1].timestamp() <= entries[2].timestamp());
+    }
+  }
+
+  SECTION("Failure is converted on another thread") {
+    auto thread = std::thread{[]{
+      auto r = match_order(0);
+      (void) r;
+    }};
+    thread.join();
+
+    SECTION("Records it in that thread's trace only") {
+      REQUIRE(sut.size() == 0u);
+    }
+  }
+}
+
+TEST_CASE("failure_trace::clear()", "[trace]") {
+  auto& sut = failure_trace::local();
+  auto r = match_order(1);
+  (void) r;
+
+  sut.clear();
+
+  SECTION("Discards all entries") {
+    REQUIRE(sut.size() == 0u);
+  }
+}
+
+} // namespace test
+} // namespace trace
@@ -0,0 +1,185 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020-2021 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include "result.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <memory>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+namespace cpp {
+namespace test {
+namespace {
+
+/// \brief Determines whether \p T is passed and returned in registers by the
+///        platform calling convention
+///
+/// Both the Itanium (SysV) and Win64 ABIs pass a class in registers only if
+/// it is trivial for the purposes of calls -- it has trivial copy and move
+/// constructors and a trivial destructor -- and is small enough: 16 bytes on
+/// SysV, or 8 bytes on Win64.
+template <typename T>
+struct is_register_passable : std::integral_constant<bool,(
+  std::is_trivially_copy_constructible<T>::value &&
+  std::is_trivially_move_constructible<T>::value &&
+  std::is_trivially_destructible<T>::value &&
+#if defined(_WIN64)
+  (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8)
+#else
+  (sizeof(T) <= 2 * sizeof(void*))
+#endif
+)>{};
+
+struct trivial {
+  int x;
+  int y;
+};
+
+//-----------------------------------------------------------------------------
+// Trivially copyable
+//-----------------------------------------------------------------------------
+
+static_assert(std::is_trivially_copyable<result<int,std::errc>>::value, "");
+static_assert(std::is_trivially_copyable<result<int,int>>::value, "");
+static_assert(std::is_trivially_copyable<result<trivial,std::errc>>::value, "");
+static_assert(std::is_trivially_copyable<result<const int,std::errc>>::value, "");
+static_assert(std::is_trivially_copyable<result<int&,std::errc>>::value, "");
+static_assert(std::is_trivially_copyable<result<void,std::errc>>::value, "");
+static_assert(std::is_trivially_copyable<result<void,std::error_code>>::value, "");
+
+static_assert(std::is_trivially_copy_assignable<result<int,std::errc>>::value, "");
+static_assert(std::is_trivially_move_assignable<result<int,std::errc>>::value, "");
+static_assert(std::is_trivially_destructible<result<int,std::errc>>::value, "");
+
+//-----------------------------------------------------------------------------
+// Register-passable
+//-----------------------------------------------------------------------------
+
+static_assert(is_register_passable<result<int,std::errc>>::value, "");
+static_assert(is_register_passable<result<int*,std::errc>>::value, "");
+static_assert(is_register_passable<result<void,std::errc>>::value, "");
+#if !defined(_WIN64)
+static_assert(is_register_passable<result<trivial,std::errc>>::value, "");
+#endif
+
+// Non-trivial types are never passed in registers
+static_assert(!is_register_passable<result<std::string,std::errc>>::value, "");
+
+//-----------------------------------------------------------------------------
+// Trivially relocatable
+//-----------------------------------------------------------------------------
+
+struct relocatable {
+  relocatable(int value) : ptr{new int{value}}{}
+  relocatable(relocatable&& other) noexcept : ptr{other.ptr} { other.ptr = nullptr; }
+  ~relocatable() { delete ptr; }
+
+  int* ptr;
+};
+
+} // namespace <anonymous>
+} // namespace test
+
+template <>
+struct is_trivially_relocatable<test::relocatable> : std::true_type{};
+
+namespace test {
+namespace {
+
+static_assert(is_trivially_relocatable<result<int,std::errc>>::value, "");
+static_assert(is_trivially_relocatable<result<int&,std::errc>>::value, "");
+static_assert(is_trivially_relocatable<result<void,std::errc>>::value, "");
+static_assert(is_trivially_relocatable<result<relocatable,std::errc>>::value, "");
+static_assert(!is_trivially_relocatable<result<std::string,std::errc>>::value, "");
+static_assert(!is_trivially_relocatable<result<int,std::string>>::value, "");
+
+} // namespace <anonymous>
+
+//=============================================================================
+// non-member functions
+//=============================================================================
+
+TEST_CASE("uninitialized_relocate(T*, T*, T*)", "[utility]") {
+  SECTION("T is trivially relocatable") {
+    using sut_type = result<relocatable,std::errc>;
+
+    std::allocator<sut_type> allocator{};
+    auto* source = allocator.allocate(2u);
+    auto* destination = allocator.allocate(2u);
+
+    ::new (static_cast<void*>(source)) sut_type{in_place, 42};
+    ::new (static_cast<void*>(source + 1)) sut_type{fail(std::errc::io_error)};
+
+    auto* end = uninitialized_relocate(source, source + 2, destination);
+
+    SECTION("Returns end of destination range") {
+      REQUIRE(end == destination + 2);
+    }
+    SECTION("Relocates values") {
+      REQUIRE(*destination[0]->ptr == 42);
+    }
+    SECTION("Relocates errors") {
+      REQUIRE(destination[1] == fail(std::errc::io_error));
+    }
+
+    destination[0].~sut_type();
+    destination[1].~sut_type();
+    allocator.deallocate(destination, 2u);
+    allocator.deallocate(source, 2u);
+  }
+
+  SECTION("T is not trivially relocatable") {
+    using sut_type = result<std::string,std::errc>;
+
+    std::allocator<sut_type> allocator{};
+    auto* source = allocator.allocate(2u);
+    auto* destination = allocator.allocate(2u);
+
+    ::new (static_cast<void*>(source)) sut_type{std::string(64u, 'x')};
+    ::new (static_cast<void*>(source + 1)) sut_type{fail(std::errc::io_error)};
+
+    auto* end = uninitialized_relocate(source, source + 2, destination);
+
+    SECTION("Returns end of destination range") {
+      REQUIRE(end == destination + 2);
+    }
+    SECTION("Relocates values") {
+      REQUIRE(*destination[0] == std::string(64u, 'x'));
+    }
+    SECTION("Relocates errors") {
+      REQUIRE(destination[1] == fail(std::errc::io_error));
+    }
+
+    destination[0].~sut_type();
+    destination[1].~sut_type();
+    allocator.deallocate(destination, 2u);
+    allocator.deallocate(source, 2u);
+  }
+}
+
+} // namespace test
+} // namespace cpp
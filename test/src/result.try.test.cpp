@@ -0,0 +1,214 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020-2021 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include "result.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <memory>
+#include <string>
+#include <system_error>
+
+namespace cpp {
+namespace test {
+namespace {
+
+auto make_error(int error) -> std::error_code
+{
+  return std::error_code{error, std::generic_category()};
+}
+
+auto parse(const std::string& s) -> result<int,std::error_code>
+{
+  if (s.empty() || s.find_first_not_of("0123456789") != std::string::npos) {
+    return fail(make_error(static_cast<int>(s.size())));
+  }
+  return std::stoi(s);
+}
+
+auto validate(int x) -> result<void,std::error_code>
+{
+  if (x < 0) {
+    return fail(make_error(x));
+  }
+  return {};
+}
+
+// An error type that can only be moved, to ensure errors are never copied
+using move_only_error = std::unique_ptr<int>;
+
+auto make_move_only(bool ok) -> result<std::unique_ptr<int>,move_only_error>
+{
+  if (!ok) {
+    return fail(std::unique_ptr<int>{new int{-1}});
+  }
+  return std::unique_ptr<int>{new int{42}};
+}
+
+auto assign_pair(const std::string& a, const std::string& b, int& reached)
+  -> result<int,std::error_code>
+{
+  RESULT_TRY_ASSIGN(const auto x, parse(a));
+  ++reached;
+  RESULT_TRY_ASSIGN(const auto y, parse(b));
+  ++reached;
+  return x + y;
+}
+
+auto assign_move_only(bool ok) -> result<int,move_only_error>
+{
+  RESULT_TRY_ASSIGN(auto p, make_move_only(ok));
+  return *p;
+}
+
+auto assign_lvalue(const result<std::string,std::error_code>& r)
+  -> result<std::size_t,std::error_code>
+{
+  RESULT_TRY_ASSIGN(const auto& s, r);
+  return s.size();
+}
+
+auto statement_void(int x, int& reached) -> result<int,std::error_code>
+{
+  RESULT_TRY(validate(x));
+  ++reached;
+  return x;
+}
+
+#if RESULT_HAS_TRY_EXPRESSION
+
+auto expression_sum(const std::string& a, const std::string& b)
+  -> result<int,std::error_code>
+{
+  return RESULT_TRY(parse(a)) + RESULT_TRY(parse(b));
+}
+
+auto expression_move_only(bool ok) -> result<int,move_only_error>
+{
+  const auto p = RESULT_TRY(make_move_only(ok));
+  return *p;
+}
+
+#endif
+
+} // namespace <anonymous>
+
+//=============================================================================
+// macros : RESULT_TRY_ASSIGN
+//=============================================================================
+
+TEST_CASE("RESULT_TRY_ASSIGN(lhs, ...)", "[try]") {
+  auto reached = 0;
+
+  SECTION("Results contain values") {
+    const auto sut = assign_pair("1", "41", reached);
+
+    SECTION("Assigns values and continues") {
+      REQUIRE(sut == 42);
+      REQUIRE(reached == 2);
+    }
+  }
+  SECTION("Result contains error") {
+    const auto sut = assign_pair("1", "abc", reached);
+
+    SECTION("Returns the error") {
+      REQUIRE(sut == fail(make_error(3)));
+    }
+    SECTION("Does not continue after the error") {
+      REQUIRE(reached == 1);
+    }
+  }
+  SECTION("Result contains move-only types") {
+    SECTION("Moves out the value") {
+      REQUIRE(assign_move_only(true) == 42);
+    }
+    SECTION("Moves out the error") {
+      auto sut = assign_move_only(false);
+
+      REQUIRE(*std::move(sut).error() == -1);
+    }
+  }
+  SECTION("Result is an lvalue") {
+    const auto input = result<std::string,std::error_code>{"hello"};
+
+    SECTION("Refers to the value") {
+      REQUIRE(assign_lvalue(input) == 5u);
+    }
+  }
+}
+
+//=============================================================================
+// macros : RESULT_TRY
+//=============================================================================
+
+TEST_CASE("RESULT_TRY(...) as a statement", "[try]") {
+  auto reached = 0;
+
+  SECTION("Result contains value") {
+    const auto sut = statement_void(5, reached);
+
+    SECTION("Continues") {
+      REQUIRE(sut == 5);
+      REQUIRE(reached == 1);
+    }
+  }
+  SECTION("Result contains error") {
+    const auto sut = statement_void(-2, reached);
+
+    SECTION("Returns the error") {
+      REQUIRE(sut == fail(make_error(-2)));
+      REQUIRE(reached == 0);
+    }
+  }
+}
+
+#if RESULT_HAS_TRY_EXPRESSION
+
+TEST_CASE("RESULT_TRY(...) as an expression", "[try]") {
+  SECTION("Results contain values") {
+    SECTION("Produces the values") {
+      REQUIRE(expression_sum("1", "41") == 42);
+    }
+  }
+  SECTION("Result contains error") {
+    SECTION("Returns the error") {
+      REQUIRE(expression_sum("abc", "41") == fail(make_error(3)));
+    }
+  }
+  SECTION("Result contains move-only types") {
+    SECTION("Moves out the value") {
+      REQUIRE(expression_move_only(true) == 42);
+    }
+    SECTION("Moves out the error") {
+      auto sut = expression_move_only(false);
+
+      REQUIRE(*std::move(sut).error() == -1);
+    }
+  }
+}
+
+#endif
+
+} // namespace test
+} // namespace cpp
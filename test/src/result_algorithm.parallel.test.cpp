@@ -0,0 +1,172 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020-2021 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include "result_algorithm.hpp"
+
+#include <catch2/catch.hpp>
+
+#if defined(__cpp_lib_execution) && __cpp_lib_execution >= 201603L
+
+#include <atomic>
+#include <execution>
+#include <memory>
+#include <numeric>
+#include <system_error>
+#include <vector>
+
+namespace cpp {
+namespace test {
+namespace {
+
+using result_type = result<int,std::error_code>;
+
+auto make_error(int error) -> std::error_code
+{
+  return std::error_code{error, std::generic_category()};
+}
+
+// An error whose copy and move may throw, which disables result assignment
+struct throwing_error
+{
+  throwing_error() = default;
+  explicit throwing_error(int c) : code{c}{}
+  throwing_error(const throwing_error& other) noexcept(false) : code{other.code}{}
+
+  int code = 0;
+};
+
+auto make_inputs(std::size_t size) -> std::vector<int>
+{
+  auto inputs = std::vector<int>(size);
+  std::iota(inputs.begin(), inputs.end(), 0);
+  return inputs;
+}
+
+} // namespace <anonymous>
+
+//=============================================================================
+// algorithms : transform_collect (parallel)
+//=============================================================================
+
+TEST_CASE("transform_collect(ExecutionPolicy&&, Range&&, Fn&&)", "[algorithm][transform_collect][parallel]") {
+  const auto input = make_inputs(10000u);
+
+  SECTION("Range contains no failing input") {
+    const auto sut = transform_collect(std::execution::par, input, [](int x) -> result_type {
+      return x * 2;
+    });
+
+    SECTION("Contains transformed values in order") {
+      REQUIRE(sut.has_value());
+      REQUIRE(sut->size() == input.size());
+      for (auto i = 0u; i < input.size(); ++i) {
+        REQUIRE((*sut)[i] == input[i] * 2);
+      }
+    }
+  }
+  SECTION("Range contains failing inputs") {
+    auto calls = std::atomic<std::size_t>{0u};
+    const auto sut = transform_collect(std::execution::par, input, [&](int x) -> result_type {
+      ++calls;
+      if (x >= 100 && x % 100 == 0) {
+        return fail(make_error(x));
+      }
+      return x;
+    });
+
+    SECTION("Contains the first error in the range") {
+      REQUIRE(sut == fail(make_error(100)));
+    }
+    SECTION("Does not transform the whole range") {
+      REQUIRE(calls.load() < input.size());
+    }
+  }
+  SECTION("Sequenced policy") {
+    const auto sut = transform_collect(std::execution::seq, input, [](int x) -> result_type {
+      if (x == 5000) {
+        return fail(make_error(x));
+      }
+      return x;
+    });
+
+    SECTION("Contains the first error") {
+      REQUIRE(sut == fail(make_error(5000)));
+    }
+  }
+  SECTION("Error may throw on copy") {
+    const auto sut = transform_collect(std::execution::par, input, [](int x) -> result<int,throwing_error> {
+      if (x == 5000) {
+        return fail(throwing_error{x});
+      }
+      return x;
+    });
+
+    SECTION("Contains the first error") {
+      REQUIRE(sut.error().code == 5000);
+    }
+  }
+}
+
+//=============================================================================
+// algorithms : collect (parallel)
+//=============================================================================
+
+TEST_CASE("collect(ExecutionPolicy&&, Range&&)", "[algorithm][collect][parallel]") {
+  auto input = std::vector<result_type>{1, 2, 3, fail(make_error(4)), 5};
+
+  SECTION("Range contains errors") {
+    const auto sut = collect(std::execution::par, input);
+
+    SECTION("Contains first error") {
+      REQUIRE(sut == fail(make_error(4)));
+    }
+  }
+  SECTION("Range contains only values") {
+    input.erase(input.begin() + 3);
+
+    const auto sut = collect(std::execution::par_unseq, input);
+
+    SECTION("Contains all values") {
+      REQUIRE(sut == std::vector<int>{1, 2, 3, 5});
+    }
+  }
+  SECTION("Range is an rvalue of move-only results") {
+    auto move_only = std::vector<result<std::unique_ptr<int>,std::error_code>>{};
+    move_only.emplace_back(std::unique_ptr<int>{new int{1}});
+    move_only.emplace_back(std::unique_ptr<int>{new int{2}});
+
+    const auto sut = collect(std::execution::par, std::move(move_only));
+
+    SECTION("Moves the values") {
+      REQUIRE(sut.has_value());
+      REQUIRE(*(*sut)[0] == 1);
+      REQUIRE(*(*sut)[1] == 2);
+    }
+  }
+}
+
+} // namespace test
+} // namespace cpp
+
+#endif
@@ -0,0 +1,366 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020-2021 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include "result_algorithm.hpp"
+#include "result_vector.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <iterator>
+#include <list>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace cpp {
+namespace test {
+namespace {
+
+using result_type = result<int,std::error_code>;
+
+auto make_error(int error) -> std::error_code
+{
+  return std::error_code{error, std::generic_category()};
+}
+
+} // namespace <anonymous>
+
+//=============================================================================
+// algorithms : collect
+//=============================================================================
+
+TEST_CASE("collect(Range&&)", "[algorithm][collect]") {
+  SECTION("Range contains only values") {
+    const auto input = std::list<result_type>{1, 2, 3};
+
+    const auto sut = collect(input);
+
+    SECTION("Contains all values in order") {
+      REQUIRE(sut == std::vector<int>{1, 2, 3});
+    }
+  }
+  SECTION("Range contains errors") {
+    const auto input = std::vector<result_type>{
+      1, fail(make_error(2)), 3, fail(make_error(4))
+    };
+
+    const auto sut = collect(input);
+
+    SECTION("Contains first error") {
+      REQUIRE(sut == fail(make_error(2)));
+    }
+  }
+  SECTION("Range is empty") {
+    const auto input = std::vector<result_type>{};
+
+    const auto sut = collect(input);
+
+    SECTION("Contains empty vector") {
+      REQUIRE(sut == std::vector<int>{});
+    }
+  }
+  SECTION("Range is an rvalue of move-only values") {
+    auto input = std::vector<result<std::unique_ptr<int>,std::error_code>>{};
+    input.emplace_back(std::unique_ptr<int>{new int{42}});
+
+    const auto sut = collect(std::move(input));
+
+    SECTION("Moves values into the output") {
+      REQUIRE(*(*sut)[0] == 42);
+    }
+  }
+}
+
+//=============================================================================
+// algorithms : transform_collect
+//=============================================================================
+
+TEST_CASE("transform_collect(Range&&, Fn&&)", "[algorithm][transform_collect]") {
+  const auto input = std::vector<std::string>{"1", "22", "", "4444"};
+  auto calls = 0;
+  const auto fn = [&](const std::string& s) -> result<std::size_t,std::error_code> {
+    ++calls;
+    if (s.empty()) {
+      return fail(make_error(static_cast<int>(calls)));
+    }
+    return s.size();
+  };
+
+  SECTION("Range contains no failing input") {
+    const auto sut = transform_collect(
+      std::vector<std::string>{"1", "22"}, fn
+    );
+
+    SECTION("Contains transformed values") {
+      REQUIRE(sut == std::vector<std::size_t>{1u, 2u});
+    }
+  }
+  SECTION("Range contains failing input") {
+    const auto sut = transform_collect(input, fn);
+
+    SECTION("Contains error") {
+      REQUIRE(sut == fail(make_error(3)));
+    }
+    SECTION("Stops invoking function after the error") {
+      REQUIRE(calls == 3);
+    }
+  }
+}
+
+//=============================================================================
+// algorithms : partition_results
+//=============================================================================
+
+TEST_CASE("partition_results(InputIt, InputIt, ValueOut, ErrorOut)", "[algorithm][partition_results]") {
+  SECTION("Range contains values and errors") {
+    const auto input = std::vector<result_type>{
+      1, fail(make_error(2)), 3, fail(make_error(4)), 5
+    };
+    auto values = std::vector<int>{};
+    auto errors = std::vector<std::error_code>{};
+
+    const auto sut = partition_results(
+      input.begin(), input.end(),
+      std::back_inserter(values), std::back_inserter(errors)
+    );
+
+    SECTION("Writes the values in order") {
+      REQUIRE(values == std::vector<int>{1, 3, 5});
+    }
+    SECTION("Writes the errors in order") {
+      REQUIRE(errors == std::vector<std::error_code>{make_error(2), make_error(4)});
+    }
+    SECTION("Reports the number of values and errors") {
+      REQUIRE(sut.value_count == 3u);
+      REQUIRE(sut.error_count == 2u);
+    }
+  }
+  SECTION("Outputs are plain iterators") {
+    const auto input = std::vector<result_type>{1, fail(make_error(2)), 3};
+    int values[3] = {};
+    std::error_code errors[3] = {};
+
+    const auto sut = partition_results(input.begin(), input.end(), values, errors);
+
+    SECTION("Returns iterators past the last elements written") {
+      REQUIRE(sut.values_out == values + 2);
+      REQUIRE(sut.errors_out == errors + 1);
+    }
+  }
+  SECTION("Iterators produce rvalues") {
+    using move_only_result = result<std::unique_ptr<int>,std::unique_ptr<int>>;
+    auto input = std::vector<move_only_result>{};
+    input.emplace_back(std::unique_ptr<int>{new int{1}});
+    input.emplace_back(fail(std::unique_ptr<int>{new int{2}}));
+    auto values = std::vector<std::unique_ptr<int>>{};
+    auto errors = std::vector<std::unique_ptr<int>>{};
+
+    partition_results(
+      std::make_move_iterator(input.begin()), std::make_move_iterator(input.end()),
+      std::back_inserter(values), std::back_inserter(errors)
+    );
+
+    SECTION("Moves the values and errors") {
+      REQUIRE(*values[0] == 1);
+      REQUIRE(*errors[0] == 2);
+    }
+  }
+}
+
+TEST_CASE("partition_results(Range&&)", "[algorithm][partition_results]") {
+  SECTION("Range contains values and errors") {
+    const auto input = std::vector<result_type>{
+      1, fail(make_error(2)), 3, fail(make_error(4)), 5
+    };
+
+    const auto sut = partition_results(input);
+
+    SECTION("Contains the values in order") {
+      REQUIRE(sut.values == std::vector<int>{1, 3, 5});
+    }
+    SECTION("Contains the errors in order") {
+      REQUIRE(sut.errors == std::vector<std::error_code>{make_error(2), make_error(4)});
+    }
+    SECTION("Reserves capacity for the values up front") {
+      REQUIRE(sut.values.capacity() >= input.size());
+    }
+  }
+  SECTION("Range contains only values") {
+    const auto input = std::vector<result_type>{1, 2, 3};
+
+    const auto sut = partition_results(input);
+
+    SECTION("Does not allocate storage for errors") {
+      REQUIRE(sut.errors.capacity() == 0u);
+    }
+  }
+  SECTION("Range is not random-access") {
+    const auto input = std::list<result_type>{1, fail(make_error(2)), 3};
+
+    const auto sut = partition_results(input);
+
+    SECTION("Contains the values and errors") {
+      REQUIRE(sut.values == std::vector<int>{1, 3});
+      REQUIRE(sut.errors == std::vector<std::error_code>{make_error(2)});
+    }
+  }
+  SECTION("Range is an rvalue") {
+    using move_only_result = result<std::unique_ptr<int>,std::unique_ptr<int>>;
+    auto input = std::vector<move_only_result>{};
+    input.emplace_back(std::unique_ptr<int>{new int{1}});
+    input.emplace_back(fail(std::unique_ptr<int>{new int{2}}));
+
+    const auto sut = partition_results(std::move(input));
+
+    SECTION("Moves the values and errors") {
+      REQUIRE(*sut.values[0] == 1);
+      REQUIRE(*sut.errors[0] == 2);
+    }
+  }
+  SECTION("Range produces proxy references") {
+    auto input = result_vector<int,std::error_code>{};
+    input.push_back(1);
+    input.push_back(fail(make_error(2)));
+
+    const auto sut = partition_results(input);
+
+    SECTION("Contains the values and errors") {
+      REQUIRE(sut.values == std::vector<int>{1});
+      REQUIRE(sut.errors == std::vector<std::error_code>{make_error(2)});
+    }
+  }
+}
+
+//=============================================================================
+// algorithms : zip
+//=============================================================================
+
+TEST_CASE("zip(R&&, Rs&&...)", "[algorithm][zip]") {
+  using string_result = result<std::string,std::error_code>;
+
+  SECTION("Every result contains a value") {
+    const auto a = result_type{1};
+    const auto b = string_result{"two"};
+
+    const auto sut = zip(a, b, result_type{3});
+
+    SECTION("Result is a tuple of the values") {
+      STATIC_REQUIRE((std::is_same<
+        decltype(sut),
+        const result<std::tuple<int,std::string,int>,std::error_code>
+      >::value));
+    }
+    SECTION("Contains every value in order") {
+      REQUIRE(sut == std::make_tuple(1, std::string{"two"}, 3));
+    }
+  }
+  SECTION("Some results contain errors") {
+    const auto sut = zip(
+      result_type{1},
+      string_result{fail(make_error(2))},
+      result_type{fail(make_error(3))}
+    );
+
+    SECTION("Contains the first error") {
+      REQUIRE(sut == fail(make_error(2)));
+    }
+  }
+  SECTION("Results are rvalues") {
+    using move_only_result = result<std::unique_ptr<int>,std::error_code>;
+
+    auto a = move_only_result{std::unique_ptr<int>{new int{1}}};
+    auto b = move_only_result{std::unique_ptr<int>{new int{2}}};
+
+    const auto sut = zip(std::move(a), std::move(b));
+
+    SECTION("Moves the values into the tuple") {
+      REQUIRE(*std::get<0>(*sut) == 1);
+      REQUIRE(*std::get<1>(*sut) == 2);
+    }
+  }
+  SECTION("Results contain references") {
+    auto value = 42;
+    const auto sut = zip(result<int&,std::error_code>{value}, result_type{1});
+
+    SECTION("Tuple refers to the original value") {
+      REQUIRE(&std::get<0>(*sut) == &value);
+    }
+  }
+}
+
+TEST_CASE("zip_with(Fn&&, R&&, Rs&&...)", "[algorithm][zip]") {
+  SECTION("Every result contains a value") {
+    const auto sut = zip_with([](int a, int b) {
+      return a + b;
+    }, result_type{1}, result_type{2});
+
+    SECTION("Contains the function's result") {
+      REQUIRE(sut == 3);
+    }
+  }
+  SECTION("Some results contain errors") {
+    auto calls = 0;
+    const auto sut = zip_with([&](int, int, int) {
+      ++calls;
+      return 0;
+    }, result_type{1}, result_type{fail(make_error(2))}, result_type{fail(make_error(3))});
+
+    SECTION("Contains the first error") {
+      REQUIRE(sut == fail(make_error(2)));
+    }
+    SECTION("Does not invoke the function") {
+      REQUIRE(calls == 0);
+    }
+  }
+  SECTION("Results are rvalues") {
+    using move_only_result = result<std::unique_ptr<int>,std::error_code>;
+
+    const auto sut = zip_with([](std::unique_ptr<int>&& a, std::unique_ptr<int>&& b) {
+      return *a + *b;
+    }, move_only_result{std::unique_ptr<int>{new int{1}}},
+       move_only_result{std::unique_ptr<int>{new int{2}}});
+
+    SECTION("Passes the values as rvalues") {
+      REQUIRE(sut == 3);
+    }
+  }
+  SECTION("Function returns void") {
+    auto sum = 0;
+    const auto sut = zip_with([&](int a, int b) {
+      sum = a + b;
+    }, result_type{1}, result_type{2});
+
+    SECTION("Returns a result<void,E>") {
+      STATIC_REQUIRE((std::is_same<decltype(sut), const result<void,std::error_code>>::value));
+      REQUIRE(sut.has_value());
+      REQUIRE(sum == 3);
+    }
+  }
+}
+
+} // namespace test
+} // namespace cpp
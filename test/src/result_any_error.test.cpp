@@ -0,0 +1,405 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020-2021 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include "result_any_error.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <cstddef>
+#include <new>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+namespace cpp {
+namespace test {
+namespace {
+
+enum class parse_errc { bad_digit = 1, overflow };
+
+// An error that is too large to be stored inline, which counts the number of
+// of its allocations that are still alive
+struct large_error
+{
+  static int live_allocations;
+
+  static auto operator new(std::size_t size) -> void*
+  {
+    ++live_allocations;
+    return ::operator new(size);
+  }
+  static auto operator delete(void* p) noexcept -> void
+  {
+    --live_allocations;
+    ::operator delete(p);
+  }
+
+  int code;
+  char payload[RESULT_ANY_ERROR_BUFFER_SIZE];
+};
+
+int large_error::live_allocations = 0;
+
+auto operator==(const large_error& lhs, const large_error& rhs) -> bool
+{
+  return lhs.code == rhs.code;
+}
+
+struct not_comparable
+{
+  int code;
+};
+
+struct throws_on_move
+{
+  throws_on_move() = default;
+  throws_on_move(const throws_on_move&) = default;
+  throws_on_move(throws_on_move&&) noexcept(false){}
+};
+
+auto parse_digit(char c) -> result<int,parse_errc>
+{
+  if (c < '0' || c > '9') {
+    return fail(parse_errc::bad_digit);
+  }
+  return c - '0';
+}
+
+auto open(bool ok) -> result<int,std::error_code>
+{
+  if (!ok) {
+    return fail(std::make_error_code(std::errc::no_such_file_or_directory));
+  }
+  return 3;
+}
+
+auto load(bool ok, char c) -> result<int,any_error>
+{
+  auto file = open(ok);
+  if (!file) {
+    return fail(file.error());
+  }
+  auto digit = parse_digit(c);
+  if (!digit) {
+    return fail(digit.error());
+  }
+  return *file + *digit;
+}
+
+} // namespace <anonymous>
+
+//=============================================================================
+// class : any_error
+//=============================================================================
+
+TEST_CASE("any_error", "[any_error]") {
+  SECTION("Stores the inline buffer and a single pointer") {
+    STATIC_REQUIRE(sizeof(any_error) == RESULT_ANY_ERROR_BUFFER_SIZE + sizeof(void*));
+  }
+
+  SECTION("Converts implicitly from error types") {
+    STATIC_REQUIRE(std::is_convertible<std::error_code,any_error>::value);
+    STATIC_REQUIRE(std::is_convertible<parse_errc,any_error>::value);
+  }
+
+  SECTION("Does not convert from failures or results") {
+    STATIC_REQUIRE_FALSE(std::is_convertible<failure<int>,any_error>::value);
+    STATIC_REQUIRE_FALSE(std::is_convertible<result<int,int>,any_error>::value);
+  }
+
+  SECTION("Does not convert from errors without operator==") {
+    STATIC_REQUIRE_FALSE(std::is_convertible<not_comparable,any_error>::value);
+  }
+
+  SECTION("Is nothrow movable") {
+    STATIC_REQUIRE(std::is_nothrow_move_constructible<any_error>::value);
+    STATIC_REQUIRE(std::is_nothrow_move_assignable<any_error>::value);
+  }
+
+  SECTION("Stores small errors inline") {
+    STATIC_REQUIRE(any_error::fits_inline<parse_errc>());
+    STATIC_REQUIRE(any_error::fits_inline<std::error_code>());
+  }
+
+  SECTION("Allocates errors that are too large, or may throw on move") {
+    STATIC_REQUIRE_FALSE(any_error::fits_inline<large_error>());
+    STATIC_REQUIRE_FALSE(any_error::fits_inline<throws_on_move>());
+  }
+}
+
+TEST_CASE("any_error::any_error()", "[any_error]") {
+  const auto sut = any_error{};
+
+  SECTION("Holds no error") {
+    REQUIRE_FALSE(sut.has_error());
+    REQUIRE_FALSE(static_cast<bool>(sut));
+  }
+  SECTION("Is not any type") {
+    REQUIRE_FALSE(sut.is<parse_errc>());
+    REQUIRE(sut.get_if<parse_errc>() == nullptr);
+  }
+}
+
+TEST_CASE("any_error::any_error(E&&)", "[any_error]") {
+  SECTION("Error fits inline") {
+    const auto sut = any_error{parse_errc::overflow};
+
+    SECTION("Holds an error") {
+      REQUIRE(sut.has_error());
+    }
+    SECTION("Is the stored type") {
+      REQUIRE(sut.is<parse_errc>());
+    }
+    SECTION("Is not another type") {
+      REQUIRE_FALSE(sut.is<int>());
+      REQUIRE(sut.get_if<int>() == nullptr);
+    }
+    SECTION("Contains the error") {
+      REQUIRE(sut.get_if<parse_errc>() != nullptr);
+      REQUIRE(*sut.get_if<parse_errc>() == parse_errc::overflow);
+    }
+  }
+  SECTION("Error is too large") {
+    REQUIRE(large_error::live_allocations == 0);
+    {
+      const auto sut = any_error{large_error{42, {}}};
+
+      SECTION("Allocates the error") {
+        REQUIRE(large_error::live_allocations == 1);
+      }
+      SECTION("Contains the error") {
+        REQUIRE(sut.get_if<large_error>() != nullptr);
+        REQUIRE(sut.get_if<large_error>()->code == 42);
+      }
+    }
+    SECTION("Frees the error on destruction") {
+      REQUIRE(large_error::live_allocations == 0);
+    }
+  }
+}
+
+TEST_CASE("any_error::any_error(const any_error&)", "[any_error]") {
+  SECTION("Other holds no error") {
+    const auto other = any_error{};
+    const auto sut = other;
+
+    SECTION("Holds no error") {
+      REQUIRE_FALSE(sut.has_error());
+    }
+  }
+  SECTION("Other holds an inline error") {
+    const auto other = any_error{std::string{"hello"}};
+    const auto sut = other;
+
+    SECTION("Copies the error") {
+      REQUIRE(sut.get_if<std::string>() != nullptr);
+      REQUIRE(*sut.get_if<std::string>() == "hello");
+    }
+    SECTION("Does not share the error") {
+      REQUIRE(sut.get_if<std::string>() != other.get_if<std::string>());
+    }
+  }
+  SECTION("Other holds an allocated error") {
+    const auto other = any_error{large_error{42, {}}};
+    const auto sut = other;
+
+    SECTION("Allocates a copy of the error") {
+      REQUIRE(large_error::live_allocations == 2);
+      REQUIRE(sut.get_if<large_error>() != other.get_if<large_error>());
+      REQUIRE(sut.get_if<large_error>()->code == 42);
+    }
+  }
+}
+
+TEST_CASE("any_error::any_error(any_error&&)", "[any_error]") {
+  SECTION("Other holds an inline error") {
+    auto other = any_error{std::string{"hello"}};
+    const auto sut = std::move(other);
+
+    SECTION("Moves the error") {
+      REQUIRE(sut.get_if<std::string>() != nullptr);
+      REQUIRE(*sut.get_if<std::string>() == "hello");
+    }
+    SECTION("Leaves other without an error") {
+      REQUIRE_FALSE(other.has_error());
+    }
+  }
+  SECTION("Other holds an allocated error") {
+    auto other = any_error{large_error{42, {}}};
+    const auto* error = other.get_if<large_error>();
+    const auto sut = std::move(other);
+
+    SECTION("Transfers ownership of the error") {
+      REQUIRE(large_error::live_allocations == 1);
+      REQUIRE(sut.get_if<large_error>() == error);
+    }
+    SECTION("Leaves other without an error") {
+      REQUIRE_FALSE(other.has_error());
+    }
+  }
+}
+
+TEST_CASE("any_error::operator=(const any_error&)", "[any_error]") {
+  auto sut = any_error{parse_errc::overflow};
+  const auto other = any_error{std::string{"hello"}};
+
+  sut = other;
+
+  SECTION("Replaces the error") {
+    REQUIRE_FALSE(sut.is<parse_errc>());
+    REQUIRE(*sut.get_if<std::string>() == "hello");
+  }
+}
+
+TEST_CASE("any_error::operator=(any_error&&)", "[any_error]") {
+  auto sut = any_error{large_error{1, {}}};
+  auto other = any_error{large_error{2, {}}};
+
+  sut = std::move(other);
+
+  SECTION("Destroys the previous error") {
+    REQUIRE(large_error::live_allocations == 1);
+  }
+  SECTION("Replaces the error") {
+    REQUIRE(sut.get_if<large_error>()->code == 2);
+  }
+  SECTION("Leaves other without an error") {
+    REQUIRE_FALSE(other.has_error());
+  }
+}
+
+TEST_CASE("any_error::operator=(E&&)", "[any_error]") {
+  auto sut = any_error{};
+
+  sut = std::make_error_code(std::errc::invalid_argument);
+
+  SECTION("Stores the error") {
+    REQUIRE(sut.is<std::error_code>());
+    REQUIRE(*sut.get_if<std::error_code>() == std::errc::invalid_argument);
+  }
+}
+
+TEST_CASE("any_error::get_if<E>()", "[any_error]") {
+  auto sut = any_error{std::string{"hello"}};
+
+  SECTION("Returns a mutable pointer to the error") {
+    sut.get_if<std::string>()->append(" world");
+
+    REQUIRE(*sut.get_if<std::string>() == "hello world");
+  }
+}
+
+TEST_CASE("any_error::emplace<E>(Args&&...)", "[any_error]") {
+  auto sut = any_error{parse_errc::overflow};
+
+  auto& error = sut.emplace<std::string>(3u, 'x');
+
+  SECTION("Returns a reference to the stored error") {
+    REQUIRE(&error == sut.get_if<std::string>());
+  }
+  SECTION("Constructs the error from the arguments") {
+    REQUIRE(error == "xxx");
+  }
+}
+
+TEST_CASE("any_error::reset()", "[any_error]") {
+  auto sut = any_error{large_error{42, {}}};
+
+  sut.reset();
+
+  SECTION("Holds no error") {
+    REQUIRE_FALSE(sut.has_error());
+  }
+  SECTION("Destroys the error") {
+    REQUIRE(large_error::live_allocations == 0);
+  }
+}
+
+TEST_CASE("any_error::swap(any_error&)", "[any_error]") {
+  auto lhs = any_error{parse_errc::overflow};
+  auto rhs = any_error{large_error{42, {}}};
+
+  swap(lhs, rhs);
+
+  SECTION("Swaps the errors") {
+    REQUIRE(lhs.get_if<large_error>()->code == 42);
+    REQUIRE(*rhs.get_if<parse_errc>() == parse_errc::overflow);
+  }
+}
+
+//=============================================================================
+// non-member functions : class : any_error
+//=============================================================================
+
+TEST_CASE("operator==(const any_error&, const any_error&)", "[any_error]") {
+  SECTION("Neither holds an error") {
+    REQUIRE(any_error{} == any_error{});
+  }
+  SECTION("Only one holds an error") {
+    REQUIRE(any_error{} != any_error{parse_errc::overflow});
+  }
+  SECTION("Errors of the same type") {
+    REQUIRE(any_error{parse_errc::overflow} == any_error{parse_errc::overflow});
+    REQUIRE(any_error{parse_errc::overflow} != any_error{parse_errc::bad_digit});
+  }
+  SECTION("Errors of different types") {
+    REQUIRE(any_error{1} != any_error{1L});
+  }
+  SECTION("Error is compared with itself") {
+    const auto sut = any_error{large_error{}};
+
+    REQUIRE(sut == sut);
+  }
+}
+
+//=============================================================================
+// result<T, any_error>
+//=============================================================================
+
+TEST_CASE("result<T, any_error>", "[any_error]") {
+  SECTION("Result contains a value") {
+    const auto r = load(true, '4');
+
+    SECTION("Error holds no error") {
+      REQUIRE(r == 7);
+      REQUIRE_FALSE(r.error().has_error());
+    }
+  }
+  SECTION("Errors of different types are propagated") {
+    const auto open_error = load(false, '4');
+    const auto parse_error = load(true, 'x');
+
+    REQUIRE(open_error.error().is<std::error_code>());
+    REQUIRE(parse_error.error().is<parse_errc>());
+  }
+  SECTION("Compares with failures of the stored error type") {
+    const auto r = load(true, 'x');
+
+    REQUIRE(r == fail(parse_errc::bad_digit));
+  }
+}
+
+} // namespace test
+} // namespace cpp
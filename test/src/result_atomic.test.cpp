@@ -0,0 +1,204 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020-2021 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include "result_atomic.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace cpp {
+
+namespace test {
+enum class status_errc : std::uint8_t { stalled = 1, crashed };
+struct node { int value; };
+} // namespace test
+
+template <>
+struct enable_compact_void_result<test::status_errc> : std::true_type{};
+
+template <>
+struct result_niche_traits<test::node*> : pointer_niche_traits<test::node>{};
+
+namespace test {
+namespace {
+
+using status_type = result<std::uint32_t,std::errc>;
+
+struct wide_value
+{
+  std::uint32_t a;
+  std::uint32_t b;
+  std::uint32_t c;
+};
+
+} // namespace <anonymous>
+
+//=============================================================================
+// class : atomic_result<T, E>
+//=============================================================================
+
+TEST_CASE("atomic_result<T, E>", "[atomic]") {
+  SECTION("Packs a tag with the larger of T and E") {
+    STATIC_REQUIRE(sizeof(atomic_result<std::uint32_t,std::errc>) == 8u);
+    STATIC_REQUIRE(sizeof(atomic_result<std::uint16_t,status_errc>) == 4u);
+    STATIC_REQUIRE(sizeof(atomic_result<wide_value,std::errc>) == 16u);
+  }
+  SECTION("Packs niche storage as-is") {
+    STATIC_REQUIRE(sizeof(atomic_result<node*,std::errc>) == sizeof(node*));
+  }
+  SECTION("Packs compact void storage as-is") {
+    STATIC_REQUIRE(sizeof(atomic_result<void,status_errc>) == 4u);
+  }
+  SECTION("Is lock-free for 8-byte words") {
+    const atomic_result<std::uint32_t,std::errc> sut{};
+
+    REQUIRE(sut.is_lock_free());
+  }
+}
+
+TEST_CASE("atomic_result<T, E>::atomic_result()", "[atomic]") {
+  const atomic_result<std::uint32_t,std::errc> sut{};
+
+  SECTION("Contains a value-initialized value") {
+    REQUIRE(sut.load() == 0u);
+  }
+}
+
+TEST_CASE("atomic_result<T, E>::load()", "[atomic]") {
+  SECTION("Stored result contains a value") {
+    const atomic_result<std::uint32_t,std::errc> sut{42u};
+
+    REQUIRE(sut.load() == 42u);
+  }
+  SECTION("Stored result contains an error") {
+    const atomic_result<std::uint32_t,std::errc> sut{fail(std::errc::timed_out)};
+
+    REQUIRE(sut.load() == fail(std::errc::timed_out));
+  }
+  SECTION("Stored result uses niche storage") {
+    auto x = node{5};
+    const atomic_result<node*,std::errc> value{&x};
+    const atomic_result<node*,std::errc> error{fail(std::errc::io_error)};
+
+    REQUIRE(value.load() == &x);
+    REQUIRE(error.load() == fail(std::errc::io_error));
+  }
+  SECTION("Stored result contains void") {
+    const atomic_result<void,status_errc> value{result<void,status_errc>{}};
+    const atomic_result<void,status_errc> error{fail(status_errc::crashed)};
+
+    REQUIRE(value.load().has_value());
+    REQUIRE(error.load() == fail(status_errc::crashed));
+  }
+}
+
+TEST_CASE("atomic_result<T, E>::store(const result<T,E>&)", "[atomic]") {
+  atomic_result<std::uint32_t,std::errc> sut{};
+
+  sut.store(fail(std::errc::timed_out));
+
+  SECTION("Replaces the stored result") {
+    REQUIRE(sut.load() == fail(std::errc::timed_out));
+  }
+}
+
+TEST_CASE("atomic_result<T, E>::exchange(const result<T,E>&)", "[atomic]") {
+  atomic_result<std::uint32_t,std::errc> sut{42u};
+
+  const auto previous = sut.exchange(fail(std::errc::timed_out));
+
+  SECTION("Returns the previous result") {
+    REQUIRE(previous == 42u);
+  }
+  SECTION("Replaces the stored result") {
+    REQUIRE(sut.load() == fail(std::errc::timed_out));
+  }
+}
+
+TEST_CASE("atomic_result<T, E>::compare_exchange_strong(result<T,E>&, const result<T,E>&)", "[atomic]") {
+  atomic_result<std::uint32_t,std::errc> sut{fail(std::errc::timed_out)};
+
+  SECTION("Expected result is stored") {
+    auto expected = status_type{fail(std::errc::timed_out)};
+
+    const auto exchanged = sut.compare_exchange_strong(expected, 1u);
+
+    SECTION("Replaces the stored result") {
+      REQUIRE(exchanged);
+      REQUIRE(sut.load() == 1u);
+    }
+  }
+  SECTION("Expected result is not stored") {
+    auto expected = status_type{fail(std::errc::io_error)};
+
+    const auto exchanged = sut.compare_exchange_strong(expected, 1u);
+
+    SECTION("Does not replace the stored result") {
+      REQUIRE_FALSE(exchanged);
+      REQUIRE(sut.load() == fail(std::errc::timed_out));
+    }
+    SECTION("Loads the stored result into expected") {
+      REQUIRE(expected == fail(std::errc::timed_out));
+    }
+  }
+  SECTION("Expected value has the same bytes as the stored error") {
+    auto expected = status_type{static_cast<std::uint32_t>(std::errc::timed_out)};
+
+    SECTION("Does not compare equal") {
+      REQUIRE_FALSE(sut.compare_exchange_strong(expected, 1u));
+    }
+  }
+}
+
+TEST_CASE("atomic_result<T, E>::compare_exchange_weak(result<T,E>&, const result<T,E>&)", "[atomic]") {
+  static constexpr auto threads = 4u;
+  static constexpr auto increments = 1000u;
+
+  atomic_result<std::uint32_t,std::errc> sut{0u};
+
+  auto workers = std::vector<std::thread>{};
+  for (auto i = 0u; i < threads; ++i) {
+    workers.emplace_back([&]{
+      for (auto j = 0u; j < increments; ++j) {
+        auto expected = sut.load();
+        while (!sut.compare_exchange_weak(expected, *expected + 1u)) {}
+      }
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+
+  SECTION("Publishes every update") {
+    REQUIRE(sut.load() == threads * increments);
+  }
+}
+
+} // namespace test
+} // namespace cpp
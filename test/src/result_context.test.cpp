@@ -0,0 +1,227 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020-2021 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include "result_context.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <string>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace cpp {
+namespace test {
+namespace {
+
+using error_type = contextual_error<std::error_code>;
+
+auto make_error(int error) -> std::error_code
+{
+  return std::error_code{error, std::generic_category()};
+}
+
+auto messages(const error_context& context) -> std::vector<std::string>
+{
+  auto out = std::vector<std::string>{};
+  for (auto message : context) {
+    out.emplace_back(message);
+  }
+  return out;
+}
+
+auto parse(int x) -> result<int,std::error_code>
+{
+  if (x < 0) {
+    return fail(make_error(EINVAL));
+  }
+  return x;
+}
+
+} // namespace <anonymous>
+
+//=============================================================================
+// class : contextual_error<E>
+//=============================================================================
+
+TEST_CASE("contextual_error<E>", "[context]") {
+  SECTION("Only stores a handle to its context") {
+    STATIC_REQUIRE(sizeof(error_type) == sizeof(std::error_code) + sizeof(void*));
+  }
+
+  SECTION("Converts implicitly from E") {
+    STATIC_REQUIRE(std::is_convertible<std::error_code,error_type>::value);
+  }
+
+  SECTION("Is default-constructible only when E is") {
+    struct no_default { explicit no_default(int){} };
+
+    STATIC_REQUIRE(std::is_default_constructible<error_type>::value);
+    STATIC_REQUIRE_FALSE(
+      std::is_default_constructible<contextual_error<no_default>>::value
+    );
+  }
+
+  SECTION("Constructed from E") {
+    const auto sut = error_type{make_error(EIO)};
+
+    SECTION("Contains the error") {
+      REQUIRE(sut.error() == make_error(EIO));
+    }
+    SECTION("Has no context") {
+      REQUIRE(sut.context().empty());
+      REQUIRE(sut.context().to_string() == "");
+    }
+  }
+
+  SECTION("Context is added") {
+    auto sut = error_type{make_error(EIO)};
+    const auto path = std::string{"config.json"};
+
+    sut.add_context("while parsing ", path);
+    sut.add_context("while loading settings");
+
+    SECTION("Messages are ordered from most recent") {
+      const auto expected = std::vector<std::string>{
+        "while loading settings",
+        "while parsing config.json",
+      };
+
+      REQUIRE(messages(sut.context()) == expected);
+    }
+    SECTION("Messages can be joined") {
+      REQUIRE(sut.context().to_string(" <- ") ==
+              "while loading settings <- while parsing config.json");
+    }
+    SECTION("Copies share the context") {
+      const auto copy = sut;
+
+      REQUIRE(copy.context().begin() == sut.context().begin());
+    }
+    SECTION("Copies can add context independently") {
+      auto copy = sut;
+      copy.add_context("while starting");
+
+      REQUIRE(copy.context().to_string() ==
+              "while starting: while loading settings: while parsing config.json");
+      REQUIRE(sut.context().to_string() ==
+              "while loading settings: while parsing config.json");
+    }
+    SECTION("Moves leave the source without context") {
+      const auto moved = std::move(sut);
+
+      REQUIRE(sut.context().empty());
+      REQUIRE(moved.context().to_string() ==
+              "while loading settings: while parsing config.json");
+    }
+    SECTION("Clearing the context removes every message") {
+      sut.clear_context();
+
+      REQUIRE(sut.context().empty());
+    }
+    SECTION("The context is ignored when comparing") {
+      REQUIRE(sut == error_type{make_error(EIO)});
+      REQUIRE(sut == make_error(EIO));
+      REQUIRE(make_error(EINVAL) != sut);
+    }
+  }
+
+  SECTION("Context survives the arena moving to a new block") {
+    auto sut = error_type{make_error(EIO)};
+    sut.add_context("first");
+
+    auto others = std::vector<error_type>{};
+    const auto filler = std::string(RESULT_CONTEXT_ARENA_BLOCK_SIZE / 4, 'x');
+    for (auto i = 0; i < 8; ++i) {
+      others.emplace_back(make_error(EIO));
+      others.back().add_context(filler);
+    }
+    sut.add_context("second");
+    others.clear();
+
+    REQUIRE(sut.context().to_string() == "second: first");
+  }
+
+  SECTION("Messages larger than a block are stored") {
+    auto sut = error_type{make_error(EIO)};
+    const auto message = std::string(RESULT_CONTEXT_ARENA_BLOCK_SIZE * 2, 'x');
+
+    sut.add_context(message);
+
+    REQUIRE(sut.context().to_string() == message);
+  }
+
+  SECTION("Context added on another thread outlives that thread") {
+    auto sut = error_type{make_error(EIO)};
+    sut.add_context("on main thread");
+
+    auto thread = std::thread{[&sut]{
+      sut.add_context("on worker thread");
+    }};
+    thread.join();
+
+    REQUIRE(sut.context().to_string() == "on worker thread: on main thread");
+  }
+}
+
+//=============================================================================
+// utilities : with_context
+//=============================================================================
+
+TEST_CASE("with_context(result<T,E>, ...)", "[context]") {
+  SECTION("Result contains value") {
+    auto sut = with_context(parse(42), "while parsing");
+
+    SECTION("Returns the value") {
+      STATIC_REQUIRE(std::is_same<decltype(sut),result<int,error_type>>::value);
+      REQUIRE(sut == 42);
+    }
+  }
+
+  SECTION("Result contains error") {
+    SECTION("Wraps a plain error with the context") {
+      const auto sut = with_context(parse(-1), "while parsing ", std::string{"-1"});
+
+      REQUIRE(sut.error() == make_error(EINVAL));
+      REQUIRE(sut.error().context().to_string() == "while parsing -1");
+    }
+    SECTION("Appends to an existing context") {
+      const auto inner = with_context(parse(-1), "while parsing");
+      const auto sut = with_context(inner, "while loading");
+
+      REQUIRE(sut.error().context().to_string() == "while loading: while parsing");
+      REQUIRE(inner.error().context().to_string() == "while parsing");
+    }
+    SECTION("Works with void results") {
+      const auto r = result<void,std::error_code>{fail(make_error(EIO))};
+      const auto sut = with_context(r, "while closing");
+
+      REQUIRE(sut.error().context().to_string() == "while closing");
+    }
+  }
+}
+
+} // namespace test
+} // namespace cpp
@@ -0,0 +1,182 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020-2021 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include "result_coroutine.hpp"
+
+#include <catch2/catch.hpp>
+
+#if RESULT_HAS_COROUTINES
+
+#include <memory>
+#include <string>
+#include <system_error>
+
+namespace cpp {
+namespace test {
+namespace {
+
+auto make_error(int error) -> std::error_code
+{
+  return std::error_code{error, std::generic_category()};
+}
+
+auto parse(const std::string& s) -> result<int,std::error_code>
+{
+  if (s.empty() || s.find_first_not_of("0123456789") != std::string::npos) {
+    return fail(make_error(static_cast<int>(s.size())));
+  }
+  return std::stoi(s);
+}
+
+auto sum(const std::string& a, const std::string& b, int& resumed)
+  -> result<int,std::error_code>
+{
+  const auto x = co_await parse(a);
+  ++resumed;
+  const auto y = co_await parse(b);
+  ++resumed;
+  co_return x + y;
+}
+
+auto check(bool ok) -> result<void,std::error_code>
+{
+  if (!ok) {
+    co_await result<void,std::error_code>{fail(make_error(1))};
+  }
+  co_return;
+}
+
+auto nested(int depth) -> result<int,std::error_code>
+{
+  if (depth == 0) {
+    co_return 0;
+  }
+  co_return 1 + co_await nested(depth - 1);
+}
+
+auto move_only(result<std::unique_ptr<int>,std::error_code> r)
+  -> result<std::unique_ptr<int>,std::error_code>
+{
+  co_return co_await std::move(r);
+}
+
+auto by_reference(const result<std::string,std::error_code>& r)
+  -> result<std::size_t,std::error_code>
+{
+  const auto& s = co_await r;
+  co_return s.size();
+}
+
+struct thrown {};
+
+auto throwing() -> result<int,std::error_code>
+{
+  co_await parse("1");
+  throw thrown{};
+}
+
+} // namespace <anonymous>
+
+//=============================================================================
+// coroutines : result<T, E>
+//=============================================================================
+
+TEST_CASE("result<T,E> as a coroutine", "[coroutine]") {
+  auto resumed = 0;
+
+  SECTION("All awaited results contain values") {
+    const auto sut = sum("1", "41", resumed);
+
+    SECTION("Contains the returned value") {
+      REQUIRE(sut == 42);
+    }
+    SECTION("Resumes after each co_await") {
+      REQUIRE(resumed == 2);
+    }
+  }
+  SECTION("An awaited result contains an error") {
+    const auto sut = sum("1", "abc", resumed);
+
+    SECTION("Contains the error") {
+      REQUIRE(sut == fail(make_error(3)));
+    }
+    SECTION("Does not resume after the error") {
+      REQUIRE(resumed == 1);
+    }
+  }
+  SECTION("Coroutines are nested") {
+    const auto sut = nested(100);
+
+    SECTION("Contains the value") {
+      REQUIRE(sut == 100);
+    }
+  }
+  SECTION("Awaited result is an rvalue of a move-only type") {
+    const auto sut = move_only(std::make_unique<int>(42));
+
+    SECTION("Moves the value") {
+      REQUIRE(**sut == 42);
+    }
+  }
+  SECTION("Awaited result is an lvalue") {
+    const auto input = result<std::string,std::error_code>{"hello"};
+
+    const auto sut = by_reference(input);
+
+    SECTION("Contains the value") {
+      REQUIRE(sut == 5u);
+    }
+  }
+  SECTION("Coroutine throws an exception") {
+    SECTION("Propagates the exception") {
+      REQUIRE_THROWS_AS(throwing(), thrown);
+    }
+    SECTION("Can be invoked again afterwards") {
+      REQUIRE_THROWS_AS(throwing(), thrown);
+      REQUIRE(nested(3) == 3);
+    }
+  }
+}
+
+TEST_CASE("result<void,E> as a coroutine", "[coroutine]") {
+  SECTION("Coroutine returns normally") {
+    const auto sut = check(true);
+
+    SECTION("Contains a value") {
+      REQUIRE(sut.has_value());
+    }
+  }
+  SECTION("Awaited result contains an error") {
+    const auto sut = check(false);
+
+    SECTION("Contains the error") {
+      REQUIRE(sut == fail(make_error(1)));
+    }
+  }
+}
+
+} // namespace test
+} // namespace cpp
+
+#endif
@@ -0,0 +1,177 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020-2021 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include "result_lazy.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace cpp {
+namespace test {
+namespace {
+
+using error_type = std::error_code;
+
+auto make_error(int error) -> std::error_code
+{
+  return std::error_code{error, std::generic_category()};
+}
+
+} // namespace <anonymous>
+
+//=============================================================================
+// class : lazy_result<T, E, Policy>
+//=============================================================================
+
+TEST_CASE("lazy_result<T, E, Policy>::lazy_result()", "[lazy]") {
+  const lazy_result<std::string,error_type> sut{};
+
+  SECTION("Has no value") {
+    REQUIRE_FALSE(sut.has_value());
+  }
+}
+
+TEST_CASE("lazy_result<T, E, Policy>::get_or_init(Fn&&)", "[lazy]") {
+  auto calls = 0;
+
+  SECTION("Initializer produces a value") {
+    lazy_result<std::string,error_type> sut{};
+    const auto initializer = [&]() -> result<std::string,error_type> {
+      ++calls;
+      return std::string{"hello"};
+    };
+
+    const auto first = sut.get_or_init(initializer);
+    const auto second = sut.get_or_init(initializer);
+
+    SECTION("Returns the value") {
+      REQUIRE(first == std::string{"hello"});
+    }
+    SECTION("Runs the initializer once") {
+      REQUIRE(calls == 1);
+    }
+    SECTION("Refers to the cached value") {
+      REQUIRE(&*first == &*second);
+    }
+    SECTION("Has a value") {
+      REQUIRE(sut.has_value());
+    }
+  }
+  SECTION("Initializer produces an error") {
+    const auto initializer = [&]() -> result<std::string,error_type> {
+      ++calls;
+      return fail(make_error(calls));
+    };
+
+    SECTION("Errors are cached") {
+      lazy_result<std::string,error_type,lazy_error_policy::cache> sut{};
+
+      const auto first = sut.get_or_init(initializer);
+      const auto second = sut.get_or_init(initializer);
+
+      SECTION("Returns the first error") {
+        REQUIRE(first == fail(make_error(1)));
+        REQUIRE(second == fail(make_error(1)));
+      }
+      SECTION("Runs the initializer once") {
+        REQUIRE(calls == 1);
+      }
+      SECTION("Has no value") {
+        REQUIRE_FALSE(sut.has_value());
+      }
+    }
+    SECTION("Errors are retried") {
+      lazy_result<std::string,error_type,lazy_error_policy::retry> sut{};
+
+      const auto first = sut.get_or_init(initializer);
+      const auto second = sut.get_or_init(initializer);
+
+      SECTION("Returns each error") {
+        REQUIRE(first == fail(make_error(1)));
+        REQUIRE(second == fail(make_error(2)));
+      }
+      SECTION("Caches a later value") {
+        const auto third = sut.get_or_init([] { return result<std::string,error_type>{"ok"}; });
+        const auto fourth = sut.get_or_init(initializer);
+
+        REQUIRE(third == std::string{"ok"});
+        REQUIRE(fourth == std::string{"ok"});
+        REQUIRE(calls == 2);
+      }
+    }
+  }
+  SECTION("Initializer throws") {
+    lazy_result<int,error_type> sut{};
+
+    REQUIRE_THROWS_AS(
+      sut.get_or_init([]() -> result<int,error_type> { throw std::runtime_error{"oops"}; }),
+      std::runtime_error
+    );
+
+    SECTION("Runs the initializer on the next call") {
+      REQUIRE(sut.get_or_init([] { return result<int,error_type>{42}; }) == 42);
+    }
+  }
+  SECTION("Called from many threads") {
+    static constexpr auto threads = 8u;
+
+    lazy_result<std::string,error_type> sut{};
+    std::atomic<int> running{0};
+    auto addresses = std::vector<const std::string*>(threads);
+
+    auto workers = std::vector<std::thread>{};
+    for (auto i = 0u; i < threads; ++i) {
+      workers.emplace_back([&, i]{
+        const auto r = sut.get_or_init([&]() -> result<std::string,error_type> {
+          running.fetch_add(1);
+          std::this_thread::sleep_for(std::chrono::milliseconds{10});
+          return std::string{"shared"};
+        });
+        addresses[i] = &*r;
+      });
+    }
+    for (auto& worker : workers) {
+      worker.join();
+    }
+
+    SECTION("Runs the initializer once") {
+      REQUIRE(running.load() == 1);
+    }
+    SECTION("Every caller sees the same value") {
+      for (auto* address : addresses) {
+        REQUIRE(address == addresses[0]);
+      }
+    }
+  }
+}
+
+} // namespace test
+} // namespace cpp
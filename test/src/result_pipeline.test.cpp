@@ -0,0 +1,342 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020-2021 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include "result_pipeline.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+namespace cpp {
+namespace test {
+namespace {
+
+namespace pipe = ::cpp::pipeline;
+
+/// \brief An error that counts every copy and move made of it
+struct counted_error
+{
+  static int copies;
+  static int moves;
+
+  static auto reset() -> void
+  {
+    copies = 0;
+    moves = 0;
+  }
+
+  counted_error() = default;
+  explicit counted_error(int c) : code{c}{}
+  counted_error(const counted_error& other) : code{other.code} { ++copies; }
+  counted_error(counted_error&& other) noexcept : code{other.code} { ++moves; }
+  auto operator=(const counted_error&) -> counted_error& = default;
+  auto operator=(counted_error&&) -> counted_error& = default;
+
+  int code = 0;
+};
+
+int counted_error::copies = 0;
+int counted_error::moves = 0;
+
+auto add_one(int x) -> int { return x + 1; }
+auto twice(int x) -> int { return x * 2; }
+auto to_string(int x) -> std::string { return std::to_string(x); }
+
+auto make_error(int error) -> std::error_code
+{
+  return std::error_code{error, std::generic_category()};
+}
+
+} // namespace <anonymous>
+
+//=============================================================================
+// operator| : map
+//=============================================================================
+
+TEST_CASE("result | pipeline::map", "[pipeline][map]") {
+  SECTION("Source contains value") {
+    const auto source = result<int,std::error_code>{1};
+
+    const auto sut = source
+      | pipe::map(add_one)
+      | pipe::map(twice)
+      | pipe::map(to_string)
+      | pipe::collect();
+
+    SECTION("Result has every function applied in order") {
+      STATIC_REQUIRE((std::is_same<decltype(sut), const result<std::string,std::error_code>>::value));
+      REQUIRE(sut == "4");
+    }
+  }
+  SECTION("Source contains error") {
+    const auto error = make_error(1);
+    auto invoked = false;
+
+    const auto sut = result<int,std::error_code>{fail(error)}
+      | pipe::map([&](int x) { invoked = true; return x; })
+      | pipe::map(to_string)
+      | pipe::collect();
+
+    SECTION("Result contains the source error") {
+      REQUIRE(sut == fail(error));
+    }
+    SECTION("Functions are not invoked") {
+      REQUIRE_FALSE(invoked);
+    }
+  }
+  SECTION("Function returns void") {
+    auto value = 0;
+
+    const auto sut = result<int,std::error_code>{42}
+      | pipe::map([&](int x) { value = x; })
+      | pipe::collect();
+
+    SECTION("Result is void") {
+      STATIC_REQUIRE((std::is_same<decltype(sut), const result<void,std::error_code>>::value));
+      REQUIRE(sut.has_value());
+    }
+    SECTION("Function is invoked with the value") {
+      REQUIRE(value == 42);
+    }
+  }
+  SECTION("Source is void") {
+    const auto sut = result<void,std::error_code>{}
+      | pipe::map([]() { return 42; })
+      | pipe::collect();
+
+    SECTION("Result contains the function's value") {
+      REQUIRE(sut == 42);
+    }
+  }
+  SECTION("Source contains a reference") {
+    auto value = 1;
+    const auto source = result<int&,std::error_code>{value};
+
+    const auto sut = source
+      | pipe::map([](int& x) -> int& { return ++x; })
+      | pipe::collect();
+
+    SECTION("Result refers to the same object") {
+      REQUIRE(&*sut == &value);
+    }
+    SECTION("Function modified the referenced value") {
+      REQUIRE(value == 2);
+    }
+  }
+}
+
+//=============================================================================
+// operator| : flat_map
+//=============================================================================
+
+TEST_CASE("result | pipeline::flat_map", "[pipeline][flat_map]") {
+  const auto checked_half = [](int x) -> result<int,std::error_code> {
+    if (x % 2 != 0) {
+      return fail(make_error(x));
+    }
+    return x / 2;
+  };
+
+  SECTION("Functions return values") {
+    const auto sut = result<int,std::error_code>{8}
+      | pipe::flat_map(checked_half)
+      | pipe::flat_map(checked_half)
+      | pipe::collect();
+
+    SECTION("Result contains the final value") {
+      REQUIRE(sut == 2);
+    }
+  }
+  SECTION("Function returns error") {
+    auto invoked = false;
+
+    const auto sut = result<int,std::error_code>{6}
+      | pipe::flat_map(checked_half)
+      | pipe::flat_map(checked_half)
+      | pipe::map([&](int x) { invoked = true; return x; })
+      | pipe::collect();
+
+    SECTION("Result contains the returned error") {
+      REQUIRE(sut == fail(make_error(3)));
+    }
+    SECTION("Later stages are not invoked") {
+      REQUIRE_FALSE(invoked);
+    }
+  }
+  SECTION("Function returns a different error type") {
+    const auto sut = result<int,int>{fail(5)}
+      | pipe::flat_map([](int x) -> result<int,long> { return x; })
+      | pipe::collect();
+
+    SECTION("Source error is converted") {
+      STATIC_REQUIRE((std::is_same<decltype(sut), const result<int,long>>::value));
+      REQUIRE(sut == fail(5L));
+    }
+  }
+}
+
+//=============================================================================
+// operator| : map_error
+//=============================================================================
+
+TEST_CASE("result | pipeline::map_error", "[pipeline][map_error]") {
+  SECTION("Source contains value") {
+    auto invoked = false;
+
+    const auto sut = result<int,int>{1}
+      | pipe::map_error([&](int e) { invoked = true; return make_error(e); })
+      | pipe::collect();
+
+    SECTION("Result contains the value") {
+      STATIC_REQUIRE((std::is_same<decltype(sut), const result<int,std::error_code>>::value));
+      REQUIRE(sut == 1);
+    }
+    SECTION("Function is not invoked") {
+      REQUIRE_FALSE(invoked);
+    }
+  }
+  SECTION("Source contains error") {
+    const auto sut = result<int,int>{fail(5)}
+      | pipe::map(add_one)
+      | pipe::map_error(make_error)
+      | pipe::map(twice)
+      | pipe::collect();
+
+    SECTION("Result contains the transformed error") {
+      REQUIRE(sut == fail(make_error(5)));
+    }
+  }
+}
+
+//=============================================================================
+// operator| : flat_map_error
+//=============================================================================
+
+TEST_CASE("result | pipeline::flat_map_error", "[pipeline][flat_map_error]") {
+  SECTION("Function recovers a value") {
+    const auto sut = result<int,int>{fail(5)}
+      | pipe::flat_map_error([](int e) -> result<int,std::error_code> {
+          return e * 10;
+        })
+      | pipe::map(add_one)
+      | pipe::collect();
+
+    SECTION("Later stages are applied to the recovered value") {
+      REQUIRE(sut == 51);
+    }
+  }
+  SECTION("Function returns a new error") {
+    const auto sut = result<int,int>{fail(5)}
+      | pipe::flat_map_error([](int e) -> result<int,std::error_code> {
+          return fail(make_error(e));
+        })
+      | pipe::collect();
+
+    SECTION("Result contains the new error") {
+      REQUIRE(sut == fail(make_error(5)));
+    }
+  }
+  SECTION("Source contains value") {
+    const auto sut = result<int,int>{3}
+      | pipe::flat_map_error([](int) -> result<long,std::error_code> {
+          return 0;
+        })
+      | pipe::collect();
+
+    SECTION("Value is converted to the new value type") {
+      STATIC_REQUIRE((std::is_same<decltype(sut), const result<long,std::error_code>>::value));
+      REQUIRE(sut == 3L);
+    }
+  }
+}
+
+//=============================================================================
+// expression<Source,Stage>::collect
+//=============================================================================
+
+TEST_CASE("pipeline::expression::collect()", "[pipeline][collect]") {
+  auto source = result<int,std::error_code>{1};
+  auto expr = std::move(source) | pipe::map(add_one);
+
+  SECTION("Expression is move-only for rvalue sources") {
+    STATIC_REQUIRE_FALSE(std::is_copy_constructible<decltype(expr)>::value);
+  }
+  SECTION("Evaluates the pipeline") {
+    const auto sut = std::move(expr).collect();
+
+    REQUIRE(sut == 2);
+  }
+}
+
+//=============================================================================
+// error propagation
+//=============================================================================
+
+TEST_CASE("pipeline error propagation", "[pipeline]") {
+  SECTION("Source is an rvalue") {
+    auto source = result<int,counted_error>{fail(counted_error{1})};
+    counted_error::reset();
+
+    const auto sut = std::move(source)
+      | pipe::map(add_one)
+      | pipe::flat_map([](int x) -> result<int,counted_error> { return x; })
+      | pipe::map(twice)
+      | pipe::map(add_one)
+      | pipe::collect();
+
+    SECTION("Error is moved once into the result") {
+      REQUIRE(counted_error::moves == 1);
+    }
+    SECTION("Error is never copied") {
+      REQUIRE(counted_error::copies == 0);
+    }
+    SECTION("Result contains the error") {
+      REQUIRE(sut.error().code == 1);
+    }
+  }
+  SECTION("Source is an lvalue") {
+    const auto source = result<int,counted_error>{fail(counted_error{1})};
+    counted_error::reset();
+
+    const auto sut = source
+      | pipe::map(add_one)
+      | pipe::map(twice)
+      | pipe::collect();
+
+    SECTION("Error is copied once into the result") {
+      REQUIRE(counted_error::copies == 1);
+    }
+    SECTION("Error is never moved") {
+      REQUIRE(counted_error::moves == 0);
+    }
+    SECTION("Result contains the error") {
+      REQUIRE(sut.error().code == 1);
+    }
+  }
+}
+
+} // namespace test
+} // namespace cpp
@@ -0,0 +1,246 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020-2021 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include "result_vector.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+namespace cpp {
+namespace test {
+namespace {
+
+using sut_type = result_vector<std::string,std::error_code>;
+
+auto make_error(int error) -> std::error_code
+{
+  return std::error_code{error, std::generic_category()};
+}
+
+// Fills 'sut' with 'size' elements, where every index divisible by 'stride'
+// is an error, and every other index is its index as a string
+auto fill(sut_type& sut, std::size_t size, std::size_t stride) -> void
+{
+  for (auto i = 0u; i < size; ++i) {
+    if (i % stride == 0u) {
+      sut.push_back(fail(make_error(static_cast<int>(i))));
+    } else {
+      sut.push_back(std::to_string(i));
+    }
+  }
+}
+
+} // namespace <anonymous>
+
+//=============================================================================
+// class : result_vector<T, E>
+//=============================================================================
+
+TEST_CASE("result_vector<T,E>::result_vector()", "[vector][ctor]") {
+  const auto sut = sut_type{};
+
+  SECTION("Is empty") {
+    REQUIRE(sut.empty());
+  }
+  SECTION("Has no errors") {
+    REQUIRE(sut.count_errors() == 0u);
+    REQUIRE(sut.first_error() == sut.size());
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("result_vector<T,E>::push_back", "[vector][modifiers]") {
+  auto sut = sut_type{};
+
+  SECTION("Result with value") {
+    const auto input = result<std::string,std::error_code>{"hello"};
+
+    sut.push_back(input);
+
+    SECTION("Contains value") {
+      REQUIRE(sut.has_value(0u));
+      REQUIRE(*sut[0u] == "hello");
+    }
+    SECTION("Stores value in values()") {
+      REQUIRE(sut.values().size() == 1u);
+    }
+  }
+  SECTION("Result with error") {
+    const auto error = make_error(5);
+    const auto input = result<std::string,std::error_code>{fail(error)};
+
+    sut.push_back(input);
+
+    SECTION("Contains error") {
+      REQUIRE_FALSE(sut.has_value(0u));
+      REQUIRE(sut[0u].error() == error);
+    }
+    SECTION("Stores error in errors()") {
+      REQUIRE(sut.errors().size() == 1u);
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("result_vector<T,E>::values", "[vector][element access]") {
+  auto sut = sut_type{};
+  sut.push_back(result<std::string,std::error_code>{"hello"});
+  sut.push_back(result<std::string,std::error_code>{fail(make_error(5))});
+  sut.push_back(result<std::string,std::error_code>{"world"});
+
+  SECTION("Contains only the values") {
+    REQUIRE(sut.values().size() == 2u);
+  }
+  SECTION("Modifies values in place") {
+    for (auto& value : sut.values()) {
+      value += "!";
+    }
+
+    REQUIRE(*sut[0u] == "hello!");
+    REQUIRE(*sut[2u] == "world!");
+    REQUIRE(sut.first_error() == 1u);
+  }
+  SECTION("Container is const") {
+    const auto& values = static_cast<const sut_type&>(sut).values();
+
+    SECTION("Values are a span of const elements") {
+      STATIC_REQUIRE((std::is_same<
+        decltype(values),
+        const result_vector_span<const std::string>&
+      >::value));
+    }
+    SECTION("Contains only the values") {
+      REQUIRE(values.size() == 2u);
+      REQUIRE(values[0u] == "hello");
+      REQUIRE(values[1u] == "world");
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("result_vector<T,E>::operator[]", "[vector][element access]") {
+  auto sut = sut_type{};
+  fill(sut, 200u, 3u);
+
+  SECTION("Refers to correct element across words") {
+    for (auto i = 0u; i < sut.size(); ++i) {
+      if (i % 3u == 0u) {
+        REQUIRE(sut[i].error() == make_error(static_cast<int>(i)));
+      } else {
+        REQUIRE(*sut[i] == std::to_string(i));
+      }
+    }
+  }
+  SECTION("Value is a reference to the stored value") {
+    *sut[130u] = "modified";
+
+    REQUIRE(*sut[130u] == "modified");
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("result_vector<T,E>::begin", "[vector][iterators]") {
+  auto sut = sut_type{};
+  fill(sut, 100u, 7u);
+
+  SECTION("Iterates all elements in order") {
+    auto i = 0u;
+    for (const auto& r : static_cast<const sut_type&>(sut)) {
+      REQUIRE(r.has_value() == sut.has_value(i));
+      ++i;
+    }
+    REQUIRE(i == sut.size());
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("result_vector<T,E>::count_errors", "[vector][queries]") {
+  auto sut = sut_type{};
+  fill(sut, 150u, 5u);
+
+  SECTION("Counts errors and values") {
+    REQUIRE(sut.count_errors() == 30u);
+    REQUIRE(sut.count_values() == 120u);
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("result_vector<T,E>::first_error", "[vector][queries]") {
+  auto sut = sut_type{};
+
+  SECTION("Only values") {
+    for (auto i = 0u; i < 70u; ++i) {
+      sut.push_back(std::to_string(i));
+    }
+
+    SECTION("Returns size()") {
+      REQUIRE(sut.first_error() == sut.size());
+    }
+  }
+  SECTION("Error after the first word") {
+    for (auto i = 0u; i < 130u; ++i) {
+      sut.push_back(std::to_string(i));
+    }
+    sut.push_back(fail(make_error(1)));
+
+    SECTION("Returns index of the error") {
+      REQUIRE(sut.first_error() == 130u);
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("result_vector<T,E>::pop_back", "[vector][modifiers]") {
+  auto sut = sut_type{};
+  fill(sut, 65u, 64u);
+
+  SECTION("Removes errors across word boundaries") {
+    sut.pop_back();
+
+    REQUIRE(sut.size() == 64u);
+    REQUIRE(sut.count_errors() == 1u);
+  }
+  SECTION("Allows re-appending") {
+    sut.pop_back();
+    sut.pop_back();
+    sut.push_back(std::string{"value"});
+
+    REQUIRE(sut.size() == 64u);
+    REQUIRE(*sut[63u] == "value");
+    REQUIRE(sut.first_error() == 0u);
+  }
+}
+
+} // namespace test
+} // namespace cpp
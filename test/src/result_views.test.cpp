@@ -0,0 +1,198 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020-2021 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include "result_views.hpp"
+#include "result_vector.hpp"
+
+#include <catch2/catch.hpp>
+
+#if RESULT_HAS_RANGES
+
+#include <memory>
+#include <ranges>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+namespace cpp {
+namespace test {
+namespace {
+
+using result_type = result<int,std::error_code>;
+
+auto make_error(int error) -> std::error_code
+{
+  return std::error_code{error, std::generic_category()};
+}
+
+auto parse(int x) -> result_type
+{
+  if (x < 0) {
+    return fail(make_error(-x));
+  }
+  return x;
+}
+
+template <typename View>
+auto to_vector(View&& view)
+{
+  auto out = std::vector<std::remove_cvref_t<std::ranges::range_reference_t<View>>>{};
+  for (auto&& x : view) {
+    out.push_back(x);
+  }
+  return out;
+}
+
+} // namespace <anonymous>
+
+//=============================================================================
+// views : values
+//=============================================================================
+
+TEST_CASE("views::values", "[views]") {
+  auto input = std::vector<result_type>{1, fail(make_error(2)), 3};
+
+  SECTION("Range is a mutable lvalue") {
+    auto sut = input | views::values;
+
+    SECTION("Yields mutable references") {
+      STATIC_REQUIRE(std::is_same_v<std::ranges::range_reference_t<decltype(sut)>,int&>);
+    }
+    SECTION("Refers into the original elements") {
+      REQUIRE(&*sut.begin() == &*input[0]);
+    }
+    SECTION("Skips errors") {
+      REQUIRE(to_vector(sut) == std::vector<int>{1, 3});
+    }
+  }
+  SECTION("Range is a const lvalue") {
+    const auto& view = input;
+    auto sut = view | views::values;
+
+    SECTION("Yields const references") {
+      STATIC_REQUIRE(std::is_same_v<std::ranges::range_reference_t<decltype(sut)>,const int&>);
+    }
+  }
+  SECTION("Range produces temporaries") {
+    const auto numbers = std::vector<int>{1, -2, 3};
+    auto sut = numbers | std::views::transform(parse) | views::values;
+
+    SECTION("Yields values") {
+      STATIC_REQUIRE(std::is_same_v<std::ranges::range_reference_t<decltype(sut)>,int>);
+      REQUIRE(to_vector(sut) == std::vector<int>{1, 3});
+    }
+  }
+  SECTION("Range produces proxy references") {
+    auto results = result_vector<int,std::error_code>{};
+    results.push_back(1);
+    results.push_back(fail(make_error(2)));
+    auto sut = results | views::values;
+
+    SECTION("Refers into the original elements") {
+      REQUIRE(&*sut.begin() == &results.values()[0]);
+    }
+  }
+  SECTION("Is invocable directly") {
+    REQUIRE(to_vector(views::values(input)) == std::vector<int>{1, 3});
+  }
+}
+
+//=============================================================================
+// views : errors
+//=============================================================================
+
+TEST_CASE("views::errors", "[views]") {
+  const auto input = std::vector<result_type>{
+    1, fail(make_error(2)), 3, fail(make_error(4))
+  };
+
+  auto sut = input | views::errors;
+
+  SECTION("Yields const references") {
+    STATIC_REQUIRE(std::is_same_v<
+      std::ranges::range_reference_t<decltype(sut)>,
+      const std::error_code&
+    >);
+  }
+  SECTION("Refers into the original elements") {
+    REQUIRE(&*sut.begin() == &input[1].error_ref());
+  }
+  SECTION("Skips values") {
+    REQUIRE(to_vector(sut) == std::vector<std::error_code>{make_error(2), make_error(4)});
+  }
+  SECTION("Results contain void") {
+    const auto voids = std::vector<result<void,int>>{{}, fail(1), {}, fail(2)};
+
+    REQUIRE(to_vector(voids | views::errors) == std::vector<int>{1, 2});
+  }
+}
+
+//=============================================================================
+// views : take_until_error
+//=============================================================================
+
+TEST_CASE("views::take_until_error", "[views]") {
+  SECTION("Range contains an error") {
+    const auto input = std::vector<result_type>{1, 2, fail(make_error(3)), 4};
+
+    SECTION("Stops at the first error") {
+      REQUIRE(to_vector(input | views::take_until_error) == std::vector<int>{1, 2});
+    }
+  }
+  SECTION("Range contains only values") {
+    const auto input = std::vector<result_type>{1, 2, 3};
+
+    SECTION("Yields every value") {
+      REQUIRE(to_vector(input | views::take_until_error) == std::vector<int>{1, 2, 3});
+    }
+  }
+  SECTION("Range is move-only and infinite") {
+    auto last_input = 0;
+    auto sut = std::views::iota(0)
+             | std::views::transform([&](int x) {
+                 last_input = x;
+                 return x < 3 ? result<std::unique_ptr<int>,int>{std::make_unique<int>(x)}
+                              : result<std::unique_ptr<int>,int>{fail(x)};
+               })
+             | views::take_until_error;
+
+    auto sum = 0;
+    for (auto&& p : sut) {
+      sum += *p;
+    }
+
+    SECTION("Yields the leading values") {
+      REQUIRE(sum == 3);
+    }
+    SECTION("Does not evaluate past the first error") {
+      REQUIRE(last_input == 3);
+    }
+  }
+}
+
+} // namespace test
+} // namespace cpp
+
+#endif // RESULT_HAS_RANGES
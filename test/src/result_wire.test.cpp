@@ -0,0 +1,364 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020-2021 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include "result_wire.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <system_error>
+
+#if __cplusplus >= 202002L && defined(__has_include)
+# if __has_include(<span>)
+#   include <span>
+# endif
+#endif
+
+namespace cpp {
+namespace test {
+namespace {
+
+enum class errc : unsigned char { rejected = 1, timeout = 2, corrupt = 3 };
+
+struct order
+{
+  std::uint64_t id;
+  double price;
+  std::uint32_t quantity;
+};
+
+struct handle
+{
+  std::int32_t fd;
+};
+
+// An error that records why a buffer could not be read
+struct read_error
+{
+  read_error(wire_errc r) : reason{r}{}
+
+  wire_errc reason;
+};
+
+auto operator==(const read_error& lhs, const read_error& rhs) -> bool
+{
+  return lhs.reason == rhs.reason;
+}
+
+// Pointers are only meaningful in one process, unless enabled
+struct message
+{
+  const char* text;
+};
+
+} // namespace <anonymous>
+} // namespace test
+
+template <>
+struct enable_wire_format<test::message> : std::false_type{};
+
+namespace test {
+namespace {
+
+} // namespace <anonymous>
+} // namespace test
+
+// Negative file-descriptors are never valid
+template <>
+struct result_niche_traits<test::handle>
+{
+  static constexpr std::size_t payload_bits = 31u;
+
+  static auto make_niche(std::uintmax_t payload) noexcept -> test::handle
+  {
+    return test::handle{-static_cast<std::int32_t>(payload) - 1};
+  }
+  static auto is_niche(const test::handle& value) noexcept -> bool
+  {
+    return value.fd < 0;
+  }
+  static auto niche_payload(const test::handle& value) noexcept -> std::uintmax_t
+  {
+    return static_cast<std::uintmax_t>(-(value.fd + 1));
+  }
+};
+
+namespace test {
+namespace {
+
+using order_result = result<order,errc>;
+using ack_result = result<void,errc>;
+using checked_result = result<order,read_error>;
+using handle_result = result<handle,std::uint16_t>;
+
+static_assert(sizeof(handle_result) == sizeof(handle), "");
+
+auto to_errc(wire_errc) -> errc
+{
+  return errc::corrupt;
+}
+
+static_assert(wire_layout<order_result>::alignment() == alignof(order), "");
+static_assert(wire_layout<order_result>::header_size() == alignof(order), "");
+static_assert(wire_layout<order_result>::value_size() == sizeof(order), "");
+static_assert(wire_layout<order_result>::error_size() == sizeof(errc), "");
+static_assert(wire_layout<order_result>::max_size() == alignof(order) + sizeof(order), "");
+static_assert(wire_layout<ack_result>::header_size() == 1u, "");
+static_assert(wire_layout<ack_result>::value_size() == 0u, "");
+static_assert(wire_layout<ack_result>::max_size() == 2u, "");
+
+static_assert(enable_wire_format<order>::value, "");
+static_assert(!enable_wire_format<message>::value, "");
+static_assert(!enable_wire_format<const char*>::value, "");
+static_assert(!enable_wire_format<std::error_code>::value, "");
+static_assert(!enable_wire_format<std::error_condition>::value, "");
+
+static_assert(std::is_same<wire_view_t<order_result>, result<const order&,errc>>::value, "");
+static_assert(std::is_same<wire_view_t<ack_result>, ack_result>::value, "");
+
+auto same_order(const order& lhs, const order& rhs) -> bool
+{
+  return lhs.id == rhs.id && lhs.price == rhs.price && lhs.quantity == rhs.quantity;
+}
+
+} // namespace <anonymous>
+
+//=============================================================================
+// functions : wire format
+//=============================================================================
+
+TEST_CASE("wire_write(const result<T,E>&, void*, std::size_t)", "[wire]") {
+  alignas(order) unsigned char buffer[wire_layout<order_result>::max_size()];
+
+  SECTION("Result contains a value") {
+    const auto input = order_result{order{42u, 1.5, 100u}};
+
+    const auto sut = wire_write(input, buffer, sizeof(buffer));
+
+    SECTION("Writes the header and the value") {
+      REQUIRE(sut == wire_size(input));
+      REQUIRE(*sut == alignof(order) + sizeof(order));
+      REQUIRE(buffer[0] == 0x01);
+      REQUIRE(std::memcmp(buffer + alignof(order), &*input, sizeof(order)) == 0);
+    }
+  }
+  SECTION("Result contains an error") {
+    const auto input = order_result{fail(errc::timeout)};
+
+    const auto sut = wire_write(input, buffer, sizeof(buffer));
+
+    SECTION("Writes the header and the error") {
+      REQUIRE(sut == alignof(order) + 1u);
+      REQUIRE(buffer[0] == 0x02);
+      REQUIRE(buffer[alignof(order)] == static_cast<unsigned char>(errc::timeout));
+    }
+  }
+  SECTION("Result stores its error in niche storage") {
+    alignas(handle) unsigned char niche_buffer[wire_layout<handle_result>::max_size()];
+    const auto input = handle_result{fail(std::uint16_t{0x1234u})};
+
+    const auto sut = wire_write(input, niche_buffer, sizeof(niche_buffer));
+
+    SECTION("Writes the header and the decoded error") {
+      const auto expected = std::uint16_t{0x1234u};
+
+      REQUIRE(sut == alignof(handle) + sizeof(std::uint16_t));
+      REQUIRE(niche_buffer[0] == 0x02);
+      REQUIRE(std::memcmp(niche_buffer + alignof(handle), &expected, sizeof(expected)) == 0);
+    }
+    SECTION("Reads back as the same error") {
+      const auto output = wire_read<handle_result>(niche_buffer, *sut, [](wire_errc) {
+        return std::uint16_t{0u};
+      });
+
+      REQUIRE(output == fail(std::uint16_t{0x1234u}));
+    }
+  }
+  SECTION("Buffer is too small") {
+    const auto input = order_result{order{42u, 1.5, 100u}};
+
+    const auto sut = wire_write(input, buffer, sizeof(buffer) - 1u);
+
+    SECTION("Fails as truncated") {
+      REQUIRE(sut == fail(wire_errc::truncated));
+    }
+  }
+}
+
+TEST_CASE("wire_buffers(const result<T,E>&)", "[wire]") {
+  SECTION("Result contains a value") {
+    const auto input = order_result{order{42u, 1.5, 100u}};
+
+    const auto sut = wire_buffers(input);
+
+    SECTION("Payload refers to the value without copying") {
+      REQUIRE(sut[0].size == alignof(order));
+      REQUIRE(static_cast<const unsigned char*>(sut[0].data)[0] == 0x01);
+      REQUIRE(sut[1].data == &*input);
+      REQUIRE(sut[1].size == sizeof(order));
+    }
+  }
+  SECTION("Void result contains a value") {
+    const auto input = ack_result{};
+
+    const auto sut = wire_buffers(input);
+
+    SECTION("Payload is empty") {
+      REQUIRE(sut[0].size == 1u);
+      REQUIRE(sut[1].size == 0u);
+    }
+  }
+}
+
+TEST_CASE("wire_read<R>(const void*, std::size_t)", "[wire]") {
+  alignas(order) unsigned char buffer[wire_layout<order_result>::max_size()];
+
+  SECTION("Buffer contains a value") {
+    const auto input = order_result{order{42u, 1.5, 100u}};
+    const auto n = *wire_write(input, buffer, sizeof(buffer));
+
+    const auto sut = wire_read<order_result>(buffer, n, to_errc);
+
+    SECTION("Copies the value") {
+      REQUIRE(sut.has_value());
+      REQUIRE(same_order(*sut, *input));
+    }
+  }
+  SECTION("Buffer contains an error") {
+    const auto n = *wire_write(order_result{fail(errc::rejected)}, buffer, sizeof(buffer));
+
+    const auto sut = wire_read<order_result>(buffer, n, to_errc);
+
+    SECTION("Copies the error") {
+      REQUIRE(sut == fail(errc::rejected));
+    }
+  }
+  SECTION("Buffer contains a void result") {
+    const auto n = *wire_write(ack_result{}, buffer, sizeof(buffer));
+
+    const auto sut = wire_read<ack_result>(buffer, n, to_errc);
+
+    SECTION("Contains a value") {
+      REQUIRE(n == 1u);
+      REQUIRE(sut.has_value());
+    }
+  }
+  SECTION("Buffer is shorter than the payload") {
+    const auto n = *wire_write(order_result{order{}}, buffer, sizeof(buffer));
+
+    SECTION("Contains the converted error") {
+      const auto sut = wire_read<order_result>(buffer, n - 1u, to_errc);
+
+      REQUIRE(sut == fail(errc::corrupt));
+    }
+    SECTION("Fails as truncated") {
+      const auto sut = wire_read<checked_result>(buffer, n - 1u);
+
+      REQUIRE(sut == fail(read_error{wire_errc::truncated}));
+    }
+  }
+  SECTION("Buffer is empty") {
+    const auto sut = wire_read<checked_result>(buffer, 0u);
+
+    SECTION("Fails as truncated") {
+      REQUIRE(sut == fail(read_error{wire_errc::truncated}));
+    }
+  }
+  SECTION("Buffer has an invalid tag") {
+    buffer[0] = 0x7f;
+
+    const auto sut = wire_read<checked_result>(buffer, sizeof(buffer));
+
+    SECTION("Fails as an invalid tag") {
+      REQUIRE(sut == fail(read_error{wire_errc::invalid_tag}));
+    }
+  }
+  SECTION("Buffer is misaligned") {
+    alignas(order) unsigned char unaligned[wire_layout<order_result>::max_size() + 1u];
+    const auto input = order_result{order{7u, 2.5, 3u}};
+    const auto n = *wire_write(input, unaligned + 1, sizeof(unaligned) - 1u);
+
+    const auto sut = wire_read<order_result>(unaligned + 1, n, to_errc);
+
+    SECTION("Copies the value regardless") {
+      REQUIRE(sut.has_value());
+      REQUIRE(same_order(*sut, *input));
+    }
+  }
+}
+
+TEST_CASE("wire_view<R>(const void*, std::size_t)", "[wire]") {
+  alignas(order) unsigned char buffer[wire_layout<order_result>::max_size() + 1u];
+
+  SECTION("Buffer contains a value") {
+    const auto n = *wire_write(order_result{order{42u, 1.5, 100u}}, buffer, sizeof(buffer));
+
+    const auto sut = wire_view<order_result>(buffer, n, to_errc);
+
+    SECTION("Refers to the value in the buffer") {
+      REQUIRE(sut.has_value());
+      REQUIRE(static_cast<const void*>(&*sut) == buffer + alignof(order));
+      REQUIRE(sut->id == 42u);
+    }
+  }
+  SECTION("Buffer contains an error") {
+    const auto n = *wire_write(order_result{fail(errc::timeout)}, buffer, sizeof(buffer));
+
+    const auto sut = wire_view<order_result>(buffer, n, to_errc);
+
+    SECTION("Copies the error") {
+      REQUIRE(sut == fail(errc::timeout));
+    }
+  }
+  SECTION("Value is misaligned") {
+    const auto n = *wire_write(order_result{order{}}, buffer + 1, sizeof(buffer) - 1u);
+
+    const auto sut = wire_view<checked_result>(buffer + 1, n);
+
+    SECTION("Fails as misaligned") {
+      REQUIRE(sut == fail(read_error{wire_errc::misaligned}));
+    }
+  }
+}
+
+#if defined(__cpp_lib_span) && __cpp_lib_span >= 202002L
+
+TEST_CASE("wire_view<R>(std::span<const std::byte>)", "[wire]") {
+  alignas(order) std::byte buffer[wire_layout<order_result>::max_size()];
+  const auto n = *wire_write(order_result{order{42u, 1.5, 100u}}, std::span<std::byte>{buffer});
+
+  const auto sut = wire_view<order_result>(std::span<const std::byte>{buffer, n}, to_errc);
+
+  SECTION("Refers to the value in the bytes") {
+    REQUIRE(sut.has_value());
+    REQUIRE(static_cast<const void*>(&*sut) == buffer + alignof(order));
+  }
+}
+
+#endif
+
+} // namespace test
+} // namespace cpp